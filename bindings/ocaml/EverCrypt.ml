@@ -25,6 +25,8 @@ module Error = struct
     | AuthenticationFailure
     | InvalidIVLength
     | DecodeError
+    | MaximumLengthExceeded
+    | InvalidState
   type 'a result =
     | Success of 'a
     | Error of error_code
@@ -35,6 +37,8 @@ module Error = struct
       | 3 -> AuthenticationFailure
       | 4 -> InvalidIVLength
       | 5 -> DecodeError
+      | 6 -> MaximumLengthExceeded
+      | 7 -> InvalidState
       | _ -> failwith "Impossible"
     in
     Error err
@@ -24,6 +24,15 @@
 
 #include "EverCrypt_AEAD.h"
 
+#include "Hacl_AES_GCM_CT64.h"
+#include "Hacl_Gf128_NI.h"
+#include "Hacl_Poly1305_32.h"
+#include "Hacl_Poly1305_128.h"
+#include "Hacl_Poly1305_256.h"
+#include "Hacl_Poly1305_512.h"
+#include "EverCrypt_Cipher.h"
+#include "Lib_Memzero0.h"
+
 typedef struct EverCrypt_AEAD_state_s_s
 {
   Spec_Cipher_Expansion_impl impl;
@@ -66,6 +75,14 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
       {
         return Spec_Agile_AEAD_AES256_GCM;
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return Spec_Agile_AEAD_AES128_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return Spec_Agile_AEAD_AES256_GCM;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -109,7 +126,13 @@ create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)92U, sizeof (uint64_t));
+  Hacl_AES_GCM_CT64_aes128_init((uint64_t *)ek, k);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES128, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
 }
 
 static EverCrypt_Error_error_code
@@ -135,7 +158,13 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)124U, sizeof (uint64_t));
+  Hacl_AES_GCM_CT64_aes256_init((uint64_t *)ek, k);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_AES256, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
 }
 
 EverCrypt_Error_error_code
@@ -440,6 +469,40 @@ EverCrypt_AEAD_encrypt(
       {
         return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        Hacl_AES_GCM_CT64_aes128_encrypt((uint64_t *)ek,
+          iv,
+          iv_len,
+          ad,
+          ad_len,
+          plain,
+          plain_len,
+          cipher,
+          tag);
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        if (iv_len == (uint32_t)0U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        Hacl_AES_GCM_CT64_aes256_encrypt((uint64_t *)ek,
+          iv,
+          iv_len,
+          ad,
+          ad_len,
+          plain,
+          plain_len,
+          cipher,
+          tag);
+        return EverCrypt_Error_Success;
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         if (iv_len != (uint32_t)12U)
@@ -593,7 +656,15 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  uint64_t ctx[92U] = { 0U };
+  Hacl_AES_GCM_CT64_aes128_init(ctx, k);
+  Hacl_AES_GCM_CT64_aes128_encrypt(ctx, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  Lib_Memzero0_memzero(ctx, (uint32_t)92U * sizeof (ctx[0U]));
+  return EverCrypt_Error_Success;
 }
 
 EverCrypt_Error_error_code
@@ -732,7 +803,15 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  uint64_t ctx[124U] = { 0U };
+  Hacl_AES_GCM_CT64_aes256_init(ctx, k);
+  Hacl_AES_GCM_CT64_aes256_encrypt(ctx, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  Lib_Memzero0_memzero(ctx, (uint32_t)124U * sizeof (ctx[0U]));
+  return EverCrypt_Error_Success;
 }
 
 EverCrypt_Error_error_code
@@ -1121,6 +1200,88 @@ decrypt_chacha20_poly1305(
   return EverCrypt_Error_AuthenticationFailure;
 }
 
+static EverCrypt_Error_error_code
+decrypt_hacl_aes128_gcm(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint8_t *ek = scrut.ek;
+  uint32_t
+  r =
+    Hacl_AES_GCM_CT64_aes128_decrypt((uint64_t *)ek,
+      iv,
+      iv_len,
+      ad,
+      ad_len,
+      cipher,
+      cipher_len,
+      tag,
+      dst);
+  if (r == (uint32_t)0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+static EverCrypt_Error_error_code
+decrypt_hacl_aes256_gcm(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint8_t *ek = scrut.ek;
+  uint32_t
+  r =
+    Hacl_AES_GCM_CT64_aes256_decrypt((uint64_t *)ek,
+      iv,
+      iv_len,
+      ad,
+      ad_len,
+      cipher,
+      cipher_len,
+      tag,
+      dst);
+  if (r == (uint32_t)0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt(
   EverCrypt_AEAD_state_s *s,
@@ -1150,6 +1311,14 @@ EverCrypt_AEAD_decrypt(
       {
         return decrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return decrypt_hacl_aes128_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return decrypt_hacl_aes256_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         return decrypt_chacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
@@ -1309,7 +1478,20 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  uint64_t ctx[92U] = { 0U };
+  Hacl_AES_GCM_CT64_aes128_init(ctx, k);
+  uint32_t
+  r = Hacl_AES_GCM_CT64_aes128_decrypt(ctx, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  Lib_Memzero0_memzero(ctx, (uint32_t)92U * sizeof (ctx[0U]));
+  if (r == (uint32_t)0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
 }
 
 EverCrypt_Error_error_code
@@ -1459,7 +1641,20 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  uint64_t ctx[124U] = { 0U };
+  Hacl_AES_GCM_CT64_aes256_init(ctx, k);
+  uint32_t
+  r = Hacl_AES_GCM_CT64_aes256_decrypt(ctx, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  Lib_Memzero0_memzero(ctx, (uint32_t)124U * sizeof (ctx[0U]));
+  if (r == (uint32_t)0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
 }
 
 EverCrypt_Error_error_code
@@ -1555,3 +1750,920 @@ void EverCrypt_AEAD_free(EverCrypt_AEAD_state_s *s)
   KRML_HOST_FREE(s);
 }
 
+/* Encrypts n_blocks independent blocks with the key of a CT64 AES-GCM state. */
+static void
+aes_gcm_blocks(EverCrypt_AEAD_state_s *s, uint32_t n_blocks, uint8_t *out, uint8_t *in)
+{
+  EverCrypt_AEAD_state_s scrut = *s;
+  uint64_t *ek = (uint64_t *)scrut.ek;
+  if (scrut.impl == Spec_Cipher_Expansion_Hacl_AES128)
+  {
+    Hacl_AES_GCM_CT64_aes128_encrypt_blocks(ek, n_blocks, out, in);
+  }
+  else
+  {
+    Hacl_AES_GCM_CT64_aes256_encrypt_blocks(ek, n_blocks, out, in);
+  }
+}
+
+/* Moves the cursor (i, j), packet i and payload block j, to the next block to
+   process, skipping packets that are done or that did not authenticate (when
+   results is not NULL); returns false at the end of the batch. */
+static bool
+batch_seek(
+  EverCrypt_AEAD_packet *packets,
+  uint32_t n,
+  EverCrypt_Error_error_code *results,
+  uint32_t *i,
+  uint32_t *j
+)
+{
+  while (i[0U] < n)
+  {
+    bool selected = results == NULL || results[i[0U]] == EverCrypt_Error_Success;
+    if (selected && j[0U] < (packets[i[0U]].len + (uint32_t)15U) / (uint32_t)16U)
+    {
+      return true;
+    }
+    i[0U] = i[0U] + (uint32_t)1U;
+    j[0U] = (uint32_t)0U;
+  }
+  return false;
+}
+
+/* Xors the payload keystream of the packets, counter blocks iv || 2, iv || 3...,
+   from plain into cipher (or back), 64 blocks per block cipher call whatever
+   the packet boundaries. */
+static void
+batch_ctr(
+  EverCrypt_AEAD_state_s *s,
+  EverCrypt_AEAD_packet *packets,
+  uint32_t n,
+  EverCrypt_Error_error_code *results,
+  bool encrypt
+)
+{
+  uint8_t cb[1024U] = { 0U };
+  uint8_t ks[1024U] = { 0U };
+  uint32_t i0 = (uint32_t)0U;
+  uint32_t j0 = (uint32_t)0U;
+  while (batch_seek(packets, n, results, &i0, &j0))
+  {
+    uint32_t i = i0;
+    uint32_t j = j0;
+    uint32_t nb = (uint32_t)0U;
+    while (nb < (uint32_t)64U && batch_seek(packets, n, results, &i, &j))
+    {
+      memcpy(cb + nb * (uint32_t)16U, packets[i].iv, (uint32_t)12U * sizeof (uint8_t));
+      store32_be(cb + nb * (uint32_t)16U + (uint32_t)12U, j + (uint32_t)2U);
+      nb = nb + (uint32_t)1U;
+      j = j + (uint32_t)1U;
+    }
+    aes_gcm_blocks(s, nb, ks, cb);
+    for (uint32_t k = (uint32_t)0U; k < nb; k++)
+    {
+      bool scrut = batch_seek(packets, n, results, &i0, &j0);
+      EverCrypt_AEAD_packet p = packets[i0];
+      uint8_t *src = encrypt ? p.plain : p.cipher;
+      uint8_t *dst = encrypt ? p.cipher : p.plain;
+      uint32_t off = j0 * (uint32_t)16U;
+      uint32_t len = p.len - off < (uint32_t)16U ? p.len - off : (uint32_t)16U;
+      if (len == (uint32_t)16U)
+      {
+        uint64_t x0 = load64_le(src + off) ^ load64_le(ks + k * (uint32_t)16U);
+        uint64_t
+        x1 =
+          load64_le(src + off + (uint32_t)8U)
+          ^ load64_le(ks + k * (uint32_t)16U + (uint32_t)8U);
+        store64_le(dst + off, x0);
+        store64_le(dst + off + (uint32_t)8U, x1);
+      }
+      else
+      {
+        for (uint32_t b = (uint32_t)0U; b < len; b++)
+        {
+          dst[off + b] = src[off + b] ^ ks[k * (uint32_t)16U + b];
+        }
+      }
+      j0 = j0 + (uint32_t)1U;
+    }
+  }
+  Lib_Memzero0_memzero(ks, (uint32_t)1024U * sizeof (ks[0U]));
+}
+
+/* Computes the tag of each packet over its ciphertext. The masks E(K, iv || 1)
+   of 64 packets come from one block cipher call. Without results, the tags are
+   written to the packets; with results, they are compared with the packets'
+   tags and the outcome is written to results. */
+static void
+batch_tags(
+  EverCrypt_AEAD_state_s *s,
+  EverCrypt_AEAD_packet *packets,
+  uint32_t n,
+  EverCrypt_Error_error_code *results
+)
+{
+  EverCrypt_AEAD_state_s scrut = *s;
+  Spec_Cipher_Expansion_impl impl = scrut.impl;
+  uint64_t *ek = (uint64_t *)scrut.ek;
+  uint8_t cb[1024U] = { 0U };
+  uint8_t masks[1024U] = { 0U };
+  uint8_t tag[16U] = { 0U };
+  for (uint32_t i0 = (uint32_t)0U; i0 < n; i0 = i0 + (uint32_t)64U)
+  {
+    uint32_t m = n - i0 < (uint32_t)64U ? n - i0 : (uint32_t)64U;
+    for (uint32_t k = (uint32_t)0U; k < m; k++)
+    {
+      memcpy(cb + k * (uint32_t)16U, packets[i0 + k].iv, (uint32_t)12U * sizeof (uint8_t));
+      store32_be(cb + k * (uint32_t)16U + (uint32_t)12U, (uint32_t)1U);
+    }
+    aes_gcm_blocks(s, m, masks, cb);
+    for (uint32_t k = (uint32_t)0U; k < m; k++)
+    {
+      EverCrypt_AEAD_packet p = packets[i0 + k];
+      uint8_t lb[16U] = { 0U };
+      store64_be(lb, (uint64_t)p.ad_len * (uint64_t)8U);
+      store64_be(lb + (uint32_t)8U, (uint64_t)p.len * (uint64_t)8U);
+      memset(tag, 0U, (uint32_t)16U * sizeof (uint8_t));
+      if (impl == Spec_Cipher_Expansion_Hacl_AES128)
+      {
+        Hacl_AES_GCM_CT64_aes128_ghash(ek, tag, p.ad_len, p.ad);
+        Hacl_AES_GCM_CT64_aes128_ghash(ek, tag, p.len, p.cipher);
+        Hacl_AES_GCM_CT64_aes128_ghash(ek, tag, (uint32_t)16U, lb);
+      }
+      else
+      {
+        Hacl_AES_GCM_CT64_aes256_ghash(ek, tag, p.ad_len, p.ad);
+        Hacl_AES_GCM_CT64_aes256_ghash(ek, tag, p.len, p.cipher);
+        Hacl_AES_GCM_CT64_aes256_ghash(ek, tag, (uint32_t)16U, lb);
+      }
+      for (uint32_t b = (uint32_t)0U; b < (uint32_t)16U; b++)
+      {
+        tag[b] = tag[b] ^ masks[k * (uint32_t)16U + b];
+      }
+      if (results == NULL)
+      {
+        memcpy(p.tag, tag, (uint32_t)16U * sizeof (uint8_t));
+      }
+      else
+      {
+        uint8_t res = (uint8_t)0U;
+        for (uint32_t b = (uint32_t)0U; b < (uint32_t)16U; b++)
+        {
+          res = res | (tag[b] ^ p.tag[b]);
+        }
+        if (res == (uint8_t)0U)
+        {
+          results[i0 + k] = EverCrypt_Error_Success;
+        }
+        else
+        {
+          results[i0 + k] = EverCrypt_Error_AuthenticationFailure;
+        }
+      }
+    }
+  }
+  Lib_Memzero0_memzero(masks, (uint32_t)1024U * sizeof (masks[0U]));
+  Lib_Memzero0_memzero(tag, (uint32_t)16U * sizeof (tag[0U]));
+}
+
+/* The Vale AES-GCM interleaves AES-NI and PCLMULQDQ within each packet, which is
+   faster than any split between a multi-block AES call and GHASH, down to
+   64-byte packets; cross-packet batching pays off for the bitsliced CT64 code,
+   whose four lanes short packets otherwise leave partly empty. */
+static bool batched(EverCrypt_AEAD_state_s *s)
+{
+  Spec_Cipher_Expansion_impl impl = (*s).impl;
+  return impl == Spec_Cipher_Expansion_Hacl_AES128 || impl == Spec_Cipher_Expansion_Hacl_AES256;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  EverCrypt_AEAD_packet *packets,
+  uint32_t n
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (!batched(s))
+  {
+    EverCrypt_Error_error_code r = EverCrypt_Error_Success;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      EverCrypt_AEAD_packet p = packets[i];
+      EverCrypt_Error_error_code
+      r1 =
+        EverCrypt_AEAD_encrypt(s,
+          p.iv,
+          (uint32_t)12U,
+          p.ad,
+          p.ad_len,
+          p.plain,
+          p.len,
+          p.cipher,
+          p.tag);
+      if (r == EverCrypt_Error_Success)
+      {
+        r = r1;
+      }
+    }
+    return r;
+  }
+  batch_ctr(s, packets, n, NULL, true);
+  batch_tags(s, packets, n, NULL);
+  return EverCrypt_Error_Success;
+}
+
+/* The tags of all packets are checked before any plaintext is written. */
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  EverCrypt_AEAD_packet *packets,
+  uint32_t n,
+  EverCrypt_Error_error_code *results
+)
+{
+  if (s == NULL)
+  {
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      results[i] = EverCrypt_Error_InvalidKey;
+    }
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (!batched(s))
+  {
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      EverCrypt_AEAD_packet p = packets[i];
+      results[i] =
+        EverCrypt_AEAD_decrypt(s,
+          p.iv,
+          (uint32_t)12U,
+          p.ad,
+          p.ad_len,
+          p.cipher,
+          p.len,
+          p.tag,
+          p.plain);
+    }
+  }
+  else
+  {
+    batch_tags(s, packets, n, results);
+    batch_ctr(s, packets, n, results, false);
+  }
+  EverCrypt_Error_error_code r = EverCrypt_Error_Success;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    if (results[i] != EverCrypt_Error_Success)
+    {
+      r = EverCrypt_Error_AuthenticationFailure;
+    }
+  }
+  return r;
+}
+
+#define EverCrypt_AEAD_Incremental_Aad 0
+#define EverCrypt_AEAD_Incremental_Encrypt 1
+#define EverCrypt_AEAD_Incremental_Decrypt 2
+#define EverCrypt_AEAD_Incremental_Done 3
+
+typedef uint8_t EverCrypt_AEAD_Incremental_phase;
+
+typedef struct EverCrypt_AEAD_Incremental_state_s_s
+{
+  EverCrypt_AEAD_state_s *k;
+  EverCrypt_AEAD_Incremental_phase phase;
+  uint32_t poly_w;
+  uint8_t *nonce;
+  uint32_t ctr;
+  uint8_t *ks;
+  uint32_t ks_len;
+  uint8_t *buf;
+  uint32_t buf_len;
+  uint8_t *mac_key;
+  uint8_t *mac_b;
+  uint8_t *mac;
+  uint64_t aad_len;
+  uint64_t text_len;
+}
+EverCrypt_AEAD_Incremental_state_s;
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_create_in(
+  EverCrypt_AEAD_state_s *k,
+  EverCrypt_AEAD_Incremental_state_s **dst
+)
+{
+  if (k == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool avx = EverCrypt_AutoConfig2_has_avx();
+  uint32_t poly_w = (uint32_t)32U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx512)
+  {
+    poly_w = (uint32_t)512U;
+  }
+  else if (avx2)
+  {
+    poly_w = (uint32_t)256U;
+  }
+  else if (avx)
+  {
+    poly_w = (uint32_t)128U;
+  }
+  #endif
+  uint8_t *nonce = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
+  uint8_t *ks = KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint8_t));
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
+  uint8_t *mac_key = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  /* The MAC context is the largest Poly1305 context (25 vec512), or the GHASH
+     context, aligned to 64 bytes within mac_b. */
+  uint8_t *mac_b = KRML_HOST_CALLOC((uint32_t)1664U, sizeof (uint8_t));
+  uint32_t mis = (uint32_t)((uintptr_t)mac_b % (uintptr_t)64U);
+  uint8_t *mac = mac_b + ((uint32_t)64U - mis) % (uint32_t)64U;
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_Incremental_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_Incremental_state_s
+  *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_Incremental_state_s));
+  p[0U]
+  =
+    (
+      (EverCrypt_AEAD_Incremental_state_s){
+        .k = k,
+        .phase = EverCrypt_AEAD_Incremental_Done,
+        .poly_w = poly_w,
+        .nonce = nonce,
+        .ctr = (uint32_t)0U,
+        .ks = ks,
+        .ks_len = (uint32_t)0U,
+        .buf = buf,
+        .buf_len = (uint32_t)0U,
+        .mac_key = mac_key,
+        .mac_b = mac_b,
+        .mac = mac,
+        .aad_len = (uint64_t)0U,
+        .text_len = (uint64_t)0U
+      }
+    );
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
+static uint32_t block_len(Spec_Cipher_Expansion_impl impl)
+{
+  if (impl == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    return (uint32_t)64U;
+  }
+  return (uint32_t)16U;
+}
+
+/* Xors n_blocks keystream blocks, starting at p->ctr, into dst and advances
+   the counter. For GCM the counter is the last 32 bits of J0 and wraps. */
+static void
+keystream_blocks(
+  EverCrypt_AEAD_Incremental_state_s *p,
+  uint32_t n_blocks,
+  uint8_t *dst,
+  uint8_t *src
+)
+{
+  EverCrypt_AEAD_state_s scrut = *p->k;
+  Spec_Cipher_Expansion_impl impl = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  uint8_t cb[16U] = { 0U };
+  memcpy(cb, p->nonce, (uint32_t)12U * sizeof (uint8_t));
+  store32_be(cb + (uint32_t)12U, p->ctr);
+  switch (impl)
+  {
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        EverCrypt_Cipher_chacha20(n_blocks * (uint32_t)64U, dst, src, ek, p->nonce, p->ctr);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        uint8_t ctr_block[16U] = { 0U };
+        uint8_t inout_b[16U] = { 0U };
+        store128_le(ctr_block, load128_be(cb));
+        uint64_t
+        scrut0 =
+          gctr128_bytes(src,
+            (uint64_t)n_blocks * (uint64_t)16U,
+            dst,
+            inout_b,
+            ek,
+            ctr_block,
+            (uint64_t)n_blocks);
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        uint8_t ctr_block[16U] = { 0U };
+        uint8_t inout_b[16U] = { 0U };
+        store128_le(ctr_block, load128_be(cb));
+        uint64_t
+        scrut0 =
+          gctr256_bytes(src,
+            (uint64_t)n_blocks * (uint64_t)16U,
+            dst,
+            inout_b,
+            ek,
+            ctr_block,
+            (uint64_t)n_blocks);
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        Hacl_AES_GCM_CT64_aes128_ctr((uint64_t *)ek, cb, n_blocks * (uint32_t)16U, dst, src);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        Hacl_AES_GCM_CT64_aes256_ctr((uint64_t *)ek, cb, n_blocks * (uint32_t)16U, dst, src);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  p->ctr = p->ctr + n_blocks;
+}
+
+/* Whole blocks go through keystream_blocks in a single call; the unused end of
+   the last partial block is kept in ks for the next update. */
+static void
+keystream_xor(EverCrypt_AEAD_Incremental_state_s *p, uint32_t len, uint8_t *dst, uint8_t *src)
+{
+  uint32_t bs = block_len((*p->k).impl);
+  uint8_t *ks = p->ks;
+  uint32_t ks_len = p->ks_len;
+  uint32_t n0 = len < ks_len ? len : ks_len;
+  uint8_t *ks0 = ks + bs - ks_len;
+  for (uint32_t i = (uint32_t)0U; i < n0; i++)
+  {
+    dst[i] = src[i] ^ ks0[i];
+  }
+  p->ks_len = ks_len - n0;
+  uint32_t len1 = len - n0;
+  uint32_t n_blocks = len1 / bs;
+  uint32_t rem = len1 % bs;
+  if (n_blocks > (uint32_t)0U)
+  {
+    keystream_blocks(p, n_blocks, dst + n0, src + n0);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t zeros[64U] = { 0U };
+    uint8_t *src2 = src + n0 + n_blocks * bs;
+    uint8_t *dst2 = dst + n0 + n_blocks * bs;
+    keystream_blocks(p, (uint32_t)1U, ks, zeros);
+    for (uint32_t i = (uint32_t)0U; i < rem; i++)
+    {
+      dst2[i] = src2[i] ^ ks[i];
+    }
+    p->ks_len = bs - rem;
+  }
+}
+
+/* Absorbs len bytes, a multiple of 16, into the MAC. */
+static void mac_blocks(EverCrypt_AEAD_Incremental_state_s *p, uint32_t len, uint8_t *text)
+{
+  EverCrypt_AEAD_state_s scrut = *p->k;
+  Spec_Cipher_Expansion_impl impl = scrut.impl;
+  uint8_t *ek = scrut.ek;
+  switch (impl)
+  {
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        if (p->poly_w == (uint32_t)512U)
+        {
+          Hacl_Poly1305_512_poly1305_update((Lib_IntVector_Intrinsics_vec512 *)p->mac, len, text);
+          break;
+        }
+        if (p->poly_w == (uint32_t)256U)
+        {
+          Hacl_Poly1305_256_poly1305_update((Lib_IntVector_Intrinsics_vec256 *)p->mac, len, text);
+          break;
+        }
+        if (p->poly_w == (uint32_t)128U)
+        {
+          Hacl_Poly1305_128_poly1305_update((Lib_IntVector_Intrinsics_vec128 *)p->mac, len, text);
+          break;
+        }
+        #endif
+        Hacl_Poly1305_32_poly1305_update((uint64_t *)p->mac, len, text);
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        Hacl_Gf128_NI_gcm_update_blocks((Lib_IntVector_Intrinsics_vec128 *)p->mac, len, text);
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        Hacl_Gf128_NI_gcm_update_blocks((Lib_IntVector_Intrinsics_vec128 *)p->mac, len, text);
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        Hacl_AES_GCM_CT64_aes128_ghash((uint64_t *)ek, p->mac, len, text);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        Hacl_AES_GCM_CT64_aes256_ghash((uint64_t *)ek, p->mac, len, text);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/* Buffers MAC input up to a 16-byte boundary. */
+static void mac_update(EverCrypt_AEAD_Incremental_state_s *p, uint32_t len, uint8_t *text)
+{
+  uint8_t *buf = p->buf;
+  uint32_t buf_len = p->buf_len;
+  uint32_t n0 = (uint32_t)0U;
+  if (buf_len > (uint32_t)0U)
+  {
+    n0 = len < (uint32_t)16U - buf_len ? len : (uint32_t)16U - buf_len;
+    memcpy(buf + buf_len, text, n0 * sizeof (uint8_t));
+    buf_len = buf_len + n0;
+    if (buf_len == (uint32_t)16U)
+    {
+      mac_blocks(p, (uint32_t)16U, buf);
+      buf_len = (uint32_t)0U;
+    }
+  }
+  uint32_t len1 = len - n0;
+  uint32_t len16 = len1 / (uint32_t)16U * (uint32_t)16U;
+  if (len16 > (uint32_t)0U)
+  {
+    mac_blocks(p, len16, text + n0);
+  }
+  if (len16 < len1)
+  {
+    memcpy(buf, text + n0 + len16, (len1 - len16) * sizeof (uint8_t));
+    buf_len = len1 - len16;
+  }
+  p->buf_len = buf_len;
+}
+
+/* Zero-pads and absorbs a pending partial block. */
+static void mac_pad(EverCrypt_AEAD_Incremental_state_s *p)
+{
+  uint32_t buf_len = p->buf_len;
+  if (buf_len > (uint32_t)0U)
+  {
+    memset(p->buf + buf_len, 0U, ((uint32_t)16U - buf_len) * sizeof (uint8_t));
+    mac_blocks(p, (uint32_t)16U, p->buf);
+    p->buf_len = (uint32_t)0U;
+  }
+}
+
+static void mac_finish(EverCrypt_AEAD_Incremental_state_s *p, uint8_t *tag)
+{
+  EverCrypt_AEAD_state_s scrut = *p->k;
+  Spec_Cipher_Expansion_impl impl = scrut.impl;
+  uint8_t lb[16U] = { 0U };
+  mac_pad(p);
+  if (impl == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    store64_le(lb, p->aad_len);
+    store64_le(lb + (uint32_t)8U, p->text_len);
+    mac_blocks(p, (uint32_t)16U, lb);
+    #if EVERCRYPT_TARGETCONFIG_X64
+    if (p->poly_w == (uint32_t)512U)
+    {
+      Hacl_Poly1305_512_poly1305_finish(tag, p->mac_key, (Lib_IntVector_Intrinsics_vec512 *)p->mac);
+      return;
+    }
+    if (p->poly_w == (uint32_t)256U)
+    {
+      Hacl_Poly1305_256_poly1305_finish(tag, p->mac_key, (Lib_IntVector_Intrinsics_vec256 *)p->mac);
+      return;
+    }
+    if (p->poly_w == (uint32_t)128U)
+    {
+      Hacl_Poly1305_128_poly1305_finish(tag, p->mac_key, (Lib_IntVector_Intrinsics_vec128 *)p->mac);
+      return;
+    }
+    #endif
+    Hacl_Poly1305_32_poly1305_finish(tag, p->mac_key, (uint64_t *)p->mac);
+    return;
+  }
+  store64_be(lb, p->aad_len * (uint64_t)8U);
+  store64_be(lb + (uint32_t)8U, p->text_len * (uint64_t)8U);
+  mac_blocks(p, (uint32_t)16U, lb);
+  if (impl == Spec_Cipher_Expansion_Vale_AES128 || impl == Spec_Cipher_Expansion_Vale_AES256)
+  {
+    #if EVERCRYPT_TARGETCONFIG_X64
+    Hacl_Gf128_NI_gcm_emit(tag, (Lib_IntVector_Intrinsics_vec128 *)p->mac);
+    #endif
+  }
+  else
+  {
+    memcpy(tag, p->mac, (uint32_t)16U * sizeof (uint8_t));
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    tag[i] = tag[i] ^ p->mac_key[i];
+  }
+}
+
+static void init_chacha20_poly1305(EverCrypt_AEAD_Incremental_state_s *p, uint8_t *iv)
+{
+  uint8_t *ek = (*p->k).ek;
+  uint8_t block[64U] = { 0U };
+  uint8_t zeros[64U] = { 0U };
+  memcpy(p->nonce, iv, (uint32_t)12U * sizeof (uint8_t));
+  EverCrypt_Cipher_chacha20((uint32_t)64U, block, zeros, ek, p->nonce, (uint32_t)0U);
+  memcpy(p->mac_key, block, (uint32_t)32U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(block, (uint32_t)64U * sizeof (block[0U]));
+  p->ctr = (uint32_t)1U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (p->poly_w == (uint32_t)512U)
+  {
+    Hacl_Poly1305_512_poly1305_init((Lib_IntVector_Intrinsics_vec512 *)p->mac, p->mac_key);
+    return;
+  }
+  if (p->poly_w == (uint32_t)256U)
+  {
+    Hacl_Poly1305_256_poly1305_init((Lib_IntVector_Intrinsics_vec256 *)p->mac, p->mac_key);
+    return;
+  }
+  if (p->poly_w == (uint32_t)128U)
+  {
+    Hacl_Poly1305_128_poly1305_init((Lib_IntVector_Intrinsics_vec128 *)p->mac, p->mac_key);
+    return;
+  }
+  #endif
+  Hacl_Poly1305_32_poly1305_init((uint64_t *)p->mac, p->mac_key);
+}
+
+/* H = E(K, 0^128) comes from the keystream at an all-zero counter block; the
+   GHASH context then derives J0 (for IVs other than 96 bits) and the mask
+   E(K, J0), which is the keystream block just before the first payload block. */
+static void init_aes_gcm(EverCrypt_AEAD_Incremental_state_s *p, uint8_t *iv, uint32_t iv_len)
+{
+  Spec_Cipher_Expansion_impl impl = (*p->k).impl;
+  bool
+  vale =
+    impl
+    == Spec_Cipher_Expansion_Vale_AES128
+    || impl == Spec_Cipher_Expansion_Vale_AES256;
+  uint8_t zeros[16U] = { 0U };
+  uint8_t lb[16U] = { 0U };
+  memset(p->nonce, 0U, (uint32_t)16U * sizeof (uint8_t));
+  memset(p->mac, 0U, (uint32_t)16U * sizeof (uint8_t));
+  if (vale)
+  {
+    #if EVERCRYPT_TARGETCONFIG_X64
+    uint8_t h[16U] = { 0U };
+    p->ctr = (uint32_t)0U;
+    keystream_blocks(p, (uint32_t)1U, h, zeros);
+    Hacl_Gf128_NI_gcm_init((Lib_IntVector_Intrinsics_vec128 *)p->mac, h);
+    Lib_Memzero0_memzero(h, (uint32_t)16U * sizeof (h[0U]));
+    #endif
+  }
+  if (iv_len == (uint32_t)12U)
+  {
+    memcpy(p->nonce, iv, (uint32_t)12U * sizeof (uint8_t));
+    store32_be(p->nonce + (uint32_t)12U, (uint32_t)1U);
+  }
+  else
+  {
+    store64_be(lb + (uint32_t)8U, (uint64_t)iv_len * (uint64_t)8U);
+    uint32_t iv_len16 = iv_len / (uint32_t)16U * (uint32_t)16U;
+    mac_blocks(p, iv_len16, iv);
+    if (iv_len16 < iv_len)
+    {
+      uint8_t last[16U] = { 0U };
+      memcpy(last, iv + iv_len16, (iv_len - iv_len16) * sizeof (uint8_t));
+      mac_blocks(p, (uint32_t)16U, last);
+    }
+    mac_blocks(p, (uint32_t)16U, lb);
+    if (vale)
+    {
+      #if EVERCRYPT_TARGETCONFIG_X64
+      Hacl_Gf128_NI_gcm_emit(p->nonce, (Lib_IntVector_Intrinsics_vec128 *)p->mac);
+      #endif
+    }
+    else
+    {
+      memcpy(p->nonce, p->mac, (uint32_t)16U * sizeof (uint8_t));
+    }
+    memset(p->mac, 0U, (uint32_t)16U * sizeof (uint8_t));
+  }
+  p->ctr = load32_be(p->nonce + (uint32_t)12U);
+  keystream_blocks(p, (uint32_t)1U, p->mac_key, zeros);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_init(
+  EverCrypt_AEAD_Incremental_state_s *p,
+  uint8_t *iv,
+  uint32_t iv_len
+)
+{
+  Spec_Cipher_Expansion_impl impl = (*p->k).impl;
+  if (impl == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    if (iv_len != (uint32_t)12U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    init_chacha20_poly1305(p, iv);
+  }
+  else
+  {
+    if (iv_len == (uint32_t)0U)
+    {
+      return EverCrypt_Error_InvalidIVLength;
+    }
+    init_aes_gcm(p, iv, iv_len);
+  }
+  p->phase = EverCrypt_AEAD_Incremental_Aad;
+  p->ks_len = (uint32_t)0U;
+  p->buf_len = (uint32_t)0U;
+  p->aad_len = (uint64_t)0U;
+  p->text_len = (uint64_t)0U;
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_update_aad(
+  EverCrypt_AEAD_Incremental_state_s *p,
+  uint8_t *ad,
+  uint32_t ad_len
+)
+{
+  if (p->phase != EverCrypt_AEAD_Incremental_Aad)
+  {
+    return EverCrypt_Error_InvalidState;
+  }
+  if
+  (
+    (*p->k).impl
+    != Spec_Cipher_Expansion_Hacl_CHACHA20
+    && (uint64_t)ad_len > (uint64_t)0x1fffffffffffffffU - p->aad_len
+  )
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  mac_update(p, ad_len, ad);
+  p->aad_len = p->aad_len + (uint64_t)ad_len;
+  return EverCrypt_Error_Success;
+}
+
+/* Moves from the AAD to the text phase ph, closing the padded AAD, and checks
+   that len more bytes of text fit in the keystream. */
+static EverCrypt_Error_error_code
+start_text(
+  EverCrypt_AEAD_Incremental_state_s *p,
+  EverCrypt_AEAD_Incremental_phase ph,
+  uint32_t len
+)
+{
+  uint64_t max_len;
+  if ((*p->k).impl == Spec_Cipher_Expansion_Hacl_CHACHA20)
+  {
+    max_len = (uint64_t)0x3fffffffc0U;
+  }
+  else
+  {
+    max_len = (uint64_t)0xfffffffe0U;
+  }
+  if (!(p->phase == EverCrypt_AEAD_Incremental_Aad || p->phase == ph))
+  {
+    return EverCrypt_Error_InvalidState;
+  }
+  if ((uint64_t)len > max_len - p->text_len)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  if (p->phase == EverCrypt_AEAD_Incremental_Aad)
+  {
+    mac_pad(p);
+    p->phase = ph;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_encrypt_update(
+  EverCrypt_AEAD_Incremental_state_s *p,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *cipher
+)
+{
+  EverCrypt_Error_error_code r = start_text(p, EverCrypt_AEAD_Incremental_Encrypt, len);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  keystream_xor(p, len, cipher, plain);
+  mac_update(p, len, cipher);
+  p->text_len = p->text_len + (uint64_t)len;
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_decrypt_update(
+  EverCrypt_AEAD_Incremental_state_s *p,
+  uint8_t *cipher,
+  uint32_t len,
+  uint8_t *dst
+)
+{
+  EverCrypt_Error_error_code r = start_text(p, EverCrypt_AEAD_Incremental_Decrypt, len);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  mac_update(p, len, cipher);
+  keystream_xor(p, len, dst, cipher);
+  p->text_len = p->text_len + (uint64_t)len;
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_encrypt_finish(EverCrypt_AEAD_Incremental_state_s *p, uint8_t *tag)
+{
+  EverCrypt_AEAD_Incremental_phase ph = p->phase;
+  if (!(ph == EverCrypt_AEAD_Incremental_Aad || ph == EverCrypt_AEAD_Incremental_Encrypt))
+  {
+    return EverCrypt_Error_InvalidState;
+  }
+  mac_finish(p, tag);
+  p->phase = EverCrypt_AEAD_Incremental_Done;
+  Lib_Memzero0_memzero(p->mac_key, (uint32_t)32U * sizeof (p->mac_key[0U]));
+  Lib_Memzero0_memzero(p->ks, (uint32_t)64U * sizeof (p->ks[0U]));
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_decrypt_finish(EverCrypt_AEAD_Incremental_state_s *p, uint8_t *tag)
+{
+  EverCrypt_AEAD_Incremental_phase ph = p->phase;
+  if (!(ph == EverCrypt_AEAD_Incremental_Aad || ph == EverCrypt_AEAD_Incremental_Decrypt))
+  {
+    return EverCrypt_Error_InvalidState;
+  }
+  uint8_t tag1[16U] = { 0U };
+  mac_finish(p, tag1);
+  p->phase = EverCrypt_AEAD_Incremental_Done;
+  Lib_Memzero0_memzero(p->mac_key, (uint32_t)32U * sizeof (p->mac_key[0U]));
+  Lib_Memzero0_memzero(p->ks, (uint32_t)64U * sizeof (p->ks[0U]));
+  uint8_t res = (uint8_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    res = res | (tag1[i] ^ tag[i]);
+  }
+  if (res == (uint8_t)0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
+void EverCrypt_AEAD_Incremental_free(EverCrypt_AEAD_Incremental_state_s *p)
+{
+  EverCrypt_AEAD_Incremental_state_s scrut = *p;
+  Lib_Memzero0_memzero(scrut.ks, (uint32_t)64U * sizeof (scrut.ks[0U]));
+  Lib_Memzero0_memzero(scrut.buf, (uint32_t)16U * sizeof (scrut.buf[0U]));
+  Lib_Memzero0_memzero(scrut.mac_key, (uint32_t)32U * sizeof (scrut.mac_key[0U]));
+  Lib_Memzero0_memzero(scrut.mac_b, (uint32_t)1664U * sizeof (scrut.mac_b[0U]));
+  KRML_HOST_FREE(scrut.nonce);
+  KRML_HOST_FREE(scrut.ks);
+  KRML_HOST_FREE(scrut.buf);
+  KRML_HOST_FREE(scrut.mac_key);
+  KRML_HOST_FREE(scrut.mac_b);
+  KRML_HOST_FREE(p);
+}
+
@@ -125,6 +125,10 @@ EverCrypt_AEAD_encrypt_expand(
   uint8_t *tag
 );
 
+/* On AuthenticationFailure dst must not be used. The AES-NI AES-GCM writes the
+   plaintext before it checks the tag, so decrypting in place (dst == cipher)
+   loses the ciphertext of a forgery; ChaCha20-Poly1305 in place leaves it
+   intact. */
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt(
   EverCrypt_AEAD_state_s *s,
@@ -193,6 +197,107 @@ EverCrypt_AEAD_decrypt_expand(
 
 void EverCrypt_AEAD_free(EverCrypt_AEAD_state_s *s);
 
+/* Batched AEAD over an expanded key, for the many short packets that a protocol
+   such as QUIC sends or receives under one key. Every packet has a 12-byte IV.
+   encrypt_batch reads plain and writes cipher and tag; decrypt_batch reads
+   cipher and tag and writes plain. In both directions plain and cipher may be
+   the same buffer. The plain of a packet that does not authenticate must not be
+   used: the AES-NI AES-GCM decrypts before it checks the tag, so that in place
+   the ciphertext of such a packet is lost.
+
+   With the portable (CT64) AES-GCM, the counter blocks of consecutive packets,
+   tag masks and then payload keystream, go through the bitsliced AES together,
+   so that short packets still fill its four lanes, and GHASH runs once per
+   packet. The AES-NI AES-GCM, which interleaves AES and GHASH within a packet,
+   and ChaCha20-Poly1305 process the packets one at a time.
+
+   decrypt_batch writes the outcome for each packet to results, and returns
+   AuthenticationFailure if any packet failed. */
+typedef struct EverCrypt_AEAD_packet_s
+{
+  uint8_t *iv;
+  uint8_t *ad;
+  uint32_t ad_len;
+  uint8_t *plain;
+  uint32_t len;
+  uint8_t *cipher;
+  uint8_t *tag;
+}
+EverCrypt_AEAD_packet;
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  EverCrypt_AEAD_packet *packets,
+  uint32_t n
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  EverCrypt_AEAD_packet *packets,
+  uint32_t n,
+  EverCrypt_Error_error_code *results
+);
+
+/* Incremental AEAD over an expanded key: init, any number of update_aad calls,
+   then any number of encrypt_update (or decrypt_update) calls, then
+   encrypt_finish (or decrypt_finish). Chunks can have any length; partial
+   blocks of keystream and of MAC input are carried over between calls. A
+   state can be re-initialized with a fresh IV after finish.
+
+   The state borrows the key state k, which must outlive it. Calls out of
+   order return InvalidState; going over the length limit of the algorithm
+   returns MaximumLengthExceeded and leaves the state unchanged.
+
+   decrypt_update releases plaintext before the tag is checked: it must not be
+   used until decrypt_finish returns Success. Decryption can be in place. */
+typedef struct EverCrypt_AEAD_Incremental_state_s_s EverCrypt_AEAD_Incremental_state_s;
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_create_in(
+  EverCrypt_AEAD_state_s *k,
+  EverCrypt_AEAD_Incremental_state_s **dst
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_init(
+  EverCrypt_AEAD_Incremental_state_s *p,
+  uint8_t *iv,
+  uint32_t iv_len
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_update_aad(
+  EverCrypt_AEAD_Incremental_state_s *p,
+  uint8_t *ad,
+  uint32_t ad_len
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_encrypt_update(
+  EverCrypt_AEAD_Incremental_state_s *p,
+  uint8_t *plain,
+  uint32_t len,
+  uint8_t *cipher
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_decrypt_update(
+  EverCrypt_AEAD_Incremental_state_s *p,
+  uint8_t *cipher,
+  uint32_t len,
+  uint8_t *dst
+);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_encrypt_finish(EverCrypt_AEAD_Incremental_state_s *p, uint8_t *tag);
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_Incremental_decrypt_finish(EverCrypt_AEAD_Incremental_state_s *p, uint8_t *tag);
+
+void EverCrypt_AEAD_Incremental_free(EverCrypt_AEAD_Incremental_state_s *p);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -31,6 +31,8 @@ typedef struct EverCrypt_CTR_state_s_s
   uint32_t iv_len;
   uint8_t *xkey;
   uint32_t ctr;
+  uint8_t *ks;
+  uint32_t ks_len;
 }
 EverCrypt_CTR_state_s;
 
@@ -85,6 +87,24 @@ EverCrypt_CTR___proj__State__item__ctr(
   return projectee.ctr;
 }
 
+uint8_t
+*EverCrypt_CTR___proj__State__item__ks(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_CTR_state_s projectee
+)
+{
+  return projectee.ks;
+}
+
+uint32_t
+EverCrypt_CTR___proj__State__item__ks_len(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_CTR_state_s projectee
+)
+{
+  return projectee.ks_len;
+}
+
 uint8_t EverCrypt_CTR_xor8(uint8_t a, uint8_t b)
 {
   return a ^ b;
@@ -149,6 +169,7 @@ EverCrypt_CTR_create_in(
           uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
           uint8_t *iv_ = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
           memcpy(iv_, iv, iv_len * sizeof (uint8_t));
+          uint8_t *ks = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
           KRML_CHECK_SIZE(sizeof (EverCrypt_CTR_state_s), (uint32_t)1U);
           EverCrypt_CTR_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_state_s));
           p[0U]
@@ -159,7 +180,9 @@ EverCrypt_CTR_create_in(
                 .iv = iv_,
                 .iv_len = iv_len,
                 .xkey = ek,
-                .ctr = c
+                .ctr = c,
+                .ks = ks,
+                .ks_len = (uint32_t)0U
               }
             );
           *dst = p;
@@ -188,6 +211,7 @@ EverCrypt_CTR_create_in(
           uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
           uint8_t *iv_ = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
           memcpy(iv_, iv, iv_len * sizeof (uint8_t));
+          uint8_t *ks = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
           KRML_CHECK_SIZE(sizeof (EverCrypt_CTR_state_s), (uint32_t)1U);
           EverCrypt_CTR_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_state_s));
           p[0U]
@@ -198,7 +222,9 @@ EverCrypt_CTR_create_in(
                 .iv = iv_,
                 .iv_len = iv_len,
                 .xkey = ek,
-                .ctr = c
+                .ctr = c,
+                .ks = ks,
+                .ks_len = (uint32_t)0U
               }
             );
           *dst = p;
@@ -214,6 +240,7 @@ EverCrypt_CTR_create_in(
         KRML_CHECK_SIZE(sizeof (uint8_t), iv_len);
         uint8_t *iv_ = KRML_HOST_CALLOC(iv_len, sizeof (uint8_t));
         memcpy(iv_, iv, iv_len * sizeof (uint8_t));
+        uint8_t *ks = KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint8_t));
         KRML_CHECK_SIZE(sizeof (EverCrypt_CTR_state_s), (uint32_t)1U);
         EverCrypt_CTR_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_state_s));
         p[0U]
@@ -224,7 +251,9 @@ EverCrypt_CTR_create_in(
               .iv = iv_,
               .iv_len = (uint32_t)12U,
               .xkey = ek,
-              .ctr = c
+              .ctr = c,
+              .ks = ks,
+              .ks_len = (uint32_t)0U
             }
           );
         *dst = p;
@@ -250,6 +279,7 @@ EverCrypt_CTR_init(
   EverCrypt_CTR_state_s scrut0 = *p;
   uint8_t *ek = scrut0.xkey;
   uint8_t *iv_ = scrut0.iv;
+  uint8_t *ks = scrut0.ks;
   Spec_Cipher_Expansion_impl i = scrut0.i;
   memcpy(iv_, iv, iv_len * sizeof (uint8_t));
   switch (i)
@@ -285,7 +315,19 @@ EverCrypt_CTR_init(
         KRML_HOST_EXIT(253U);
       }
   }
-  *p = ((EverCrypt_CTR_state_s){ .i = i, .iv = iv_, .iv_len = iv_len, .xkey = ek, .ctr = c });
+  *p
+  =
+    (
+      (EverCrypt_CTR_state_s){
+        .i = i,
+        .iv = iv_,
+        .iv_len = iv_len,
+        .xkey = ek,
+        .ctr = c,
+        .ks = ks,
+        .ks_len = (uint32_t)0U
+      }
+    );
 }
 
 void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src)
@@ -341,7 +383,9 @@ void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t
               .iv = iv1,
               .iv_len = iv_len1,
               .xkey = ek1,
-              .ctr = c1
+              .ctr = c1,
+              .ks = scrut0.ks,
+              .ks_len = (uint32_t)0U
             }
           );
         #endif
@@ -391,7 +435,9 @@ void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t
               .iv = iv1,
               .iv_len = iv_len1,
               .xkey = ek1,
-              .ctr = c1
+              .ctr = c1,
+              .ks = scrut0.ks,
+              .ks_len = (uint32_t)0U
             }
           );
         #endif
@@ -402,6 +448,156 @@ void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t
         uint32_t ctx[16U] = { 0U };
         Hacl_Impl_Chacha20_chacha20_init(ctx, ek, iv, (uint32_t)0U);
         Hacl_Impl_Chacha20_chacha20_encrypt_block(ctx, dst, c0, src);
+        p->ks_len = (uint32_t)0U;
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static uint32_t block_len_of_impl(Spec_Cipher_Expansion_impl i)
+{
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        return (uint32_t)16U;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        return (uint32_t)16U;
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        return (uint32_t)64U;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/* Encrypts n_blocks whole blocks of src into dst with the keystream blocks c,
+   c + 1, ... of the state, in as few calls to the underlying cipher as
+   possible. src and dst may be equal.
+
+   The counter blocks of AES are iv + c as 128-bit big-endian integers, while
+   the Vale CTR loop only increments their low 32 bits: runs are cut where those
+   wrap around, so that the keystream is the one of update_block. */
+static void
+update_blocks(
+  EverCrypt_CTR_state_s *p,
+  uint32_t c,
+  uint32_t n_blocks,
+  uint8_t *dst,
+  uint8_t *src
+)
+{
+  EverCrypt_CTR_state_s scrut = *p;
+  Spec_Cipher_Expansion_impl i = scrut.i;
+  uint8_t *iv = scrut.iv;
+  uint32_t iv_len = scrut.iv_len;
+  uint8_t *ek = scrut.xkey;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        uint8_t ctr_block[16U] = { 0U };
+        memcpy(ctr_block, iv, iv_len * sizeof (uint8_t));
+        FStar_UInt128_uint128 iv0 = load128_be(ctr_block);
+        uint32_t done = (uint32_t)0U;
+        while (done < n_blocks)
+        {
+          FStar_UInt128_uint128
+          c1 =
+            FStar_UInt128_add_mod(iv0,
+              FStar_UInt128_uint64_to_uint128((uint64_t)c + (uint64_t)done));
+          uint64_t lo = FStar_UInt128_uint128_to_uint64(c1) & (uint64_t)0xffffffffU;
+          uint64_t room = (uint64_t)0x100000000U - lo;
+          uint32_t run = n_blocks - done;
+          if ((uint64_t)run > room)
+          {
+            run = (uint32_t)room;
+          }
+          store128_le(ctr_block, c1);
+          uint8_t inout_b[16U] = { 0U };
+          uint64_t
+          scrut0 =
+            gctr128_bytes(src + done * (uint32_t)16U,
+              (uint64_t)run * (uint64_t)16U,
+              dst + done * (uint32_t)16U,
+              inout_b,
+              ek,
+              ctr_block,
+              (uint64_t)run);
+          done = done + run;
+        }
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        uint8_t ctr_block[16U] = { 0U };
+        memcpy(ctr_block, iv, iv_len * sizeof (uint8_t));
+        FStar_UInt128_uint128 iv0 = load128_be(ctr_block);
+        uint32_t done = (uint32_t)0U;
+        while (done < n_blocks)
+        {
+          FStar_UInt128_uint128
+          c1 =
+            FStar_UInt128_add_mod(iv0,
+              FStar_UInt128_uint64_to_uint128((uint64_t)c + (uint64_t)done));
+          uint64_t lo = FStar_UInt128_uint128_to_uint64(c1) & (uint64_t)0xffffffffU;
+          uint64_t room = (uint64_t)0x100000000U - lo;
+          uint32_t run = n_blocks - done;
+          if ((uint64_t)run > room)
+          {
+            run = (uint32_t)room;
+          }
+          store128_le(ctr_block, c1);
+          uint8_t inout_b[16U] = { 0U };
+          uint64_t
+          scrut0 =
+            gctr256_bytes(src + done * (uint32_t)16U,
+              (uint64_t)run * (uint64_t)16U,
+              dst + done * (uint32_t)16U,
+              inout_b,
+              ek,
+              ctr_block,
+              (uint64_t)run);
+          done = done + run;
+        }
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+        bool avx = EverCrypt_AutoConfig2_has_avx();
+        uint32_t len = n_blocks * (uint32_t)64U;
+        #if EVERCRYPT_TARGETCONFIG_X64
+        if (avx2)
+        {
+          Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, dst, src, ek, iv, c);
+          return;
+        }
+        #endif
+        #if EVERCRYPT_TARGETCONFIG_X64
+        if (avx)
+        {
+          Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, dst, src, ek, iv, c);
+          return;
+        }
+        #endif
+        Hacl_Chacha20_chacha20_encrypt(len, dst, src, ek, iv, c);
         break;
       }
     default:
@@ -412,13 +608,75 @@ void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t
   }
 }
 
+EverCrypt_Error_error_code
+EverCrypt_CTR_update(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src, uint32_t len)
+{
+  EverCrypt_CTR_state_s scrut = *p;
+  uint32_t block_len = block_len_of_impl(scrut.i);
+  uint8_t *ks = scrut.ks;
+  uint32_t ks_len = scrut.ks_len;
+  uint32_t c = scrut.ctr;
+  uint32_t n0;
+  if (len < ks_len)
+  {
+    n0 = len;
+  }
+  else
+  {
+    n0 = ks_len;
+  }
+  uint32_t len1 = len - n0;
+  uint32_t n_blocks = len1 / block_len;
+  uint32_t rem = len1 % block_len;
+  uint64_t n_ctr = (uint64_t)n_blocks;
+  if (rem > (uint32_t)0U)
+  {
+    n_ctr = n_ctr + (uint64_t)1U;
+  }
+  if ((uint64_t)c + n_ctr > (uint64_t)0xffffffffU)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint8_t *ks0 = ks + block_len - ks_len;
+  for (uint32_t i = (uint32_t)0U; i < n0; i++)
+  {
+    dst[i] = EverCrypt_CTR_xor8(src[i], ks0[i]);
+  }
+  uint8_t *src1 = src + n0;
+  uint8_t *dst1 = dst + n0;
+  if (n_blocks > (uint32_t)0U)
+  {
+    update_blocks(p, c, n_blocks, dst1, src1);
+  }
+  uint32_t c1 = c + n_blocks;
+  uint32_t ks_len1 = ks_len - n0;
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t *src2 = src1 + n_blocks * block_len;
+    uint8_t *dst2 = dst1 + n_blocks * block_len;
+    memset(ks, 0U, block_len * sizeof (uint8_t));
+    update_blocks(p, c1, (uint32_t)1U, ks, ks);
+    for (uint32_t i = (uint32_t)0U; i < rem; i++)
+    {
+      dst2[i] = EverCrypt_CTR_xor8(src2[i], ks[i]);
+    }
+    c1 = c1 + (uint32_t)1U;
+    ks_len1 = block_len - rem;
+  }
+  p->ctr = c1;
+  p->ks_len = ks_len1;
+  return EverCrypt_Error_Success;
+}
+
 void EverCrypt_CTR_free(EverCrypt_CTR_state_s *p)
 {
   EverCrypt_CTR_state_s scrut = *p;
   uint8_t *iv = scrut.iv;
   uint8_t *ek = scrut.xkey;
+  uint8_t *ks = scrut.ks;
   KRML_HOST_FREE(iv);
   KRML_HOST_FREE(ek);
+  KRML_HOST_FREE(ks);
   KRML_HOST_FREE(p);
 }
 
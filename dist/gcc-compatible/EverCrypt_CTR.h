@@ -38,6 +38,8 @@ extern "C" {
 
 
 #include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
 #include "Hacl_Kremlib.h"
 #include "Vale.h"
 #include "EverCrypt_AutoConfig2.h"
@@ -79,6 +81,18 @@ EverCrypt_CTR___proj__State__item__ctr(
   EverCrypt_CTR_state_s projectee
 );
 
+uint8_t
+*EverCrypt_CTR___proj__State__item__ks(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_CTR_state_s projectee
+);
+
+uint32_t
+EverCrypt_CTR___proj__State__item__ks_len(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_CTR_state_s projectee
+);
+
 typedef uint8_t EverCrypt_CTR_uint8;
 
 uint8_t EverCrypt_CTR_xor8(uint8_t a, uint8_t b);
@@ -108,6 +122,20 @@ EverCrypt_CTR_init(
 
 void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src);
 
+/* Encrypts (or decrypts) len bytes of src into dst, continuing the keystream
+   where the previous call left off: the unused end of a partial keystream block
+   is kept in the state and consumed first, and whole blocks are then handed to
+   the cipher in a single run (the 8-way Vale AES-CTR loop, or the widest
+   ChaCha20 available). len need not be a multiple of the block size. src and dst
+   may be equal. update_block discards any keystream left over by update.
+
+   The counter of the state must never wrap around, since that would reuse
+   keystream, so update uses counters up to 0xfffffffe only: if len needs more,
+   nothing is written, the state is left unchanged and MaximumLengthExceeded is
+   returned. */
+EverCrypt_Error_error_code
+EverCrypt_CTR_update(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src, uint32_t len);
+
 void EverCrypt_CTR_free(EverCrypt_CTR_state_s *p);
 
 #if defined(__cplusplus)
@@ -36,9 +36,17 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   uint8_t *tag
 )
 {
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
   bool avx2 = EverCrypt_AutoConfig2_has_avx2();
   bool avx = EverCrypt_AutoConfig2_has_avx();
   #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx512)
+  {
+    Hacl_Chacha20Poly1305_512_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
   if (avx2)
   {
     Hacl_Chacha20Poly1305_256_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
@@ -67,9 +75,16 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   uint8_t *tag
 )
 {
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
   bool avx2 = EverCrypt_AutoConfig2_has_avx2();
   bool avx = EverCrypt_AutoConfig2_has_avx();
   #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx512)
+  {
+    return Hacl_Chacha20Poly1305_512_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
   if (avx2)
   {
     return Hacl_Chacha20Poly1305_256_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
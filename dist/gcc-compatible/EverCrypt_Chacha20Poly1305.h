@@ -41,6 +41,7 @@ extern "C" {
 #include "Hacl_Chacha20Poly1305_128.h"
 #include "Hacl_Chacha20Poly1305_32.h"
 #include "Hacl_Chacha20Poly1305_256.h"
+#include "Hacl_Chacha20Poly1305_512.h"
 
 void
 EverCrypt_Chacha20Poly1305_aead_encrypt(
@@ -54,6 +55,10 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   uint8_t *tag
 );
 
+/* Returns 0 and writes the plaintext to m if the tag is valid, and 1 otherwise.
+   On failure m must not be used: depending on the implementation picked it is
+   zeroed or left as it was, except in place (m == cipher), where the ciphertext
+   is always left intact. */
 uint32_t
 EverCrypt_Chacha20Poly1305_aead_decrypt(
   uint8_t *k,
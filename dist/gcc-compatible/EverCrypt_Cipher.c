@@ -24,6 +24,11 @@
 
 #include "EverCrypt_Cipher.h"
 
+#include "Hacl_AES_GCM_CT64.h"
+#include "Hacl_AES_NI.h"
+#include "Lib_Memzero0.h"
+#include "Vale.h"
+
 void
 EverCrypt_Cipher_chacha20(
   uint32_t len,
@@ -34,8 +39,300 @@ EverCrypt_Cipher_chacha20(
   uint32_t ctr
 )
 {
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool avx = EverCrypt_AutoConfig2_has_avx();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx512)
+  {
+    Hacl_Chacha20_Vec512_chacha20_encrypt_512(len, dst, src, key, iv, ctr);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, dst, src, key, iv, ctr);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx)
+  {
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, dst, src, key, iv, ctr);
+    return;
+  }
+  #endif
   uint32_t ctx[16U] = { 0U };
   Hacl_Impl_Chacha20_chacha20_init(ctx, key, iv, ctr);
   Hacl_Impl_Chacha20_chacha20_update(ctx, len, dst, src);
 }
 
+typedef struct EverCrypt_Cipher_chacha20_state_s_s
+{
+  uint8_t *key;
+  uint8_t *iv;
+  uint32_t ctr;
+  uint64_t pos;
+  uint8_t *ks;
+}
+EverCrypt_Cipher_chacha20_state_s;
+
+/* Fills ks with the keystream block ctr of the state. */
+static void chacha20_keystream_block(EverCrypt_Cipher_chacha20_state_s *p, uint32_t ctr)
+{
+  EverCrypt_Cipher_chacha20_state_s scrut = *p;
+  uint8_t *ks = scrut.ks;
+  uint32_t ctx[16U] = { 0U };
+  uint8_t zeros[64U] = { 0U };
+  Hacl_Impl_Chacha20_chacha20_init(ctx, scrut.key, scrut.iv, (uint32_t)0U);
+  Hacl_Impl_Chacha20_chacha20_encrypt_block(ctx, ks, ctr, zeros);
+  Lib_Memzero0_memzero(ctx, (uint32_t)16U * sizeof (ctx[0U]));
+}
+
+EverCrypt_Cipher_chacha20_state_s
+*EverCrypt_Cipher_chacha20_create_in(uint8_t *key, uint8_t *iv, uint32_t ctr)
+{
+  uint8_t *key_ = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  memcpy(key_, key, (uint32_t)32U * sizeof (uint8_t));
+  uint8_t *iv_ = KRML_HOST_CALLOC((uint32_t)12U, sizeof (uint8_t));
+  memcpy(iv_, iv, (uint32_t)12U * sizeof (uint8_t));
+  uint8_t *ks = KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (EverCrypt_Cipher_chacha20_state_s), (uint32_t)1U);
+  EverCrypt_Cipher_chacha20_state_s
+  *p = KRML_HOST_MALLOC(sizeof (EverCrypt_Cipher_chacha20_state_s));
+  p[0U]
+  =
+    (
+      (EverCrypt_Cipher_chacha20_state_s){
+        .key = key_,
+        .iv = iv_,
+        .ctr = ctr,
+        .pos = (uint64_t)0U,
+        .ks = ks
+      }
+    );
+  return p;
+}
+
+/* The stream offset just past keystream block 0xffffffff, the last one before
+   the block counter wraps around. */
+static uint64_t chacha20_end(EverCrypt_Cipher_chacha20_state_s *p)
+{
+  return ((uint64_t)0xffffffffU - (uint64_t)p->ctr + (uint64_t)1U) * (uint64_t)64U;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_Cipher_chacha20_seek(EverCrypt_Cipher_chacha20_state_s *p, uint64_t pos)
+{
+  if (pos > chacha20_end(p))
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  p->pos = pos;
+  if (!(pos % (uint64_t)64U == (uint64_t)0U))
+  {
+    uint32_t ctr = p->ctr + (uint32_t)(pos / (uint64_t)64U);
+    chacha20_keystream_block(p, ctr);
+  }
+  return EverCrypt_Error_Success;
+}
+
+uint64_t EverCrypt_Cipher_chacha20_pos(EverCrypt_Cipher_chacha20_state_s *p)
+{
+  return p->pos;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_Cipher_chacha20_update(
+  EverCrypt_Cipher_chacha20_state_s *p,
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src
+)
+{
+  EverCrypt_Cipher_chacha20_state_s scrut = *p;
+  uint8_t *ks = scrut.ks;
+  uint64_t pos = scrut.pos;
+  if (pos + (uint64_t)len > chacha20_end(p))
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint32_t off = (uint32_t)(pos % (uint64_t)64U);
+  uint32_t n0 = (uint32_t)0U;
+  if (!(off == (uint32_t)0U))
+  {
+    if (len < (uint32_t)64U - off)
+    {
+      n0 = len;
+    }
+    else
+    {
+      n0 = (uint32_t)64U - off;
+    }
+    for (uint32_t i = (uint32_t)0U; i < n0; i++)
+    {
+      dst[i] = src[i] ^ ks[off + i];
+    }
+  }
+  uint64_t pos1 = pos + (uint64_t)n0;
+  uint32_t len1 = len - n0;
+  uint32_t n_blocks = len1 / (uint32_t)64U;
+  uint32_t rem = len1 % (uint32_t)64U;
+  uint32_t ctr = scrut.ctr + (uint32_t)(pos1 / (uint64_t)64U);
+  if (n_blocks > (uint32_t)0U)
+  {
+    EverCrypt_Cipher_chacha20(n_blocks * (uint32_t)64U,
+      dst + n0,
+      src + n0,
+      scrut.key,
+      scrut.iv,
+      ctr);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t *src2 = src + n0 + n_blocks * (uint32_t)64U;
+    uint8_t *dst2 = dst + n0 + n_blocks * (uint32_t)64U;
+    chacha20_keystream_block(p, ctr + n_blocks);
+    for (uint32_t i = (uint32_t)0U; i < rem; i++)
+    {
+      dst2[i] = src2[i] ^ ks[i];
+    }
+  }
+  p->pos = pos + (uint64_t)len;
+  return EverCrypt_Error_Success;
+}
+
+void EverCrypt_Cipher_chacha20_free(EverCrypt_Cipher_chacha20_state_s *p)
+{
+  EverCrypt_Cipher_chacha20_state_s scrut = *p;
+  Lib_Memzero0_memzero(scrut.key, (uint32_t)32U * sizeof (scrut.key[0U]));
+  Lib_Memzero0_memzero(scrut.ks, (uint32_t)64U * sizeof (scrut.ks[0U]));
+  KRML_HOST_FREE(scrut.key);
+  KRML_HOST_FREE(scrut.iv);
+  KRML_HOST_FREE(scrut.ks);
+  KRML_HOST_FREE(p);
+}
+
+typedef struct EverCrypt_Cipher_aes_state_s_s
+{
+  Spec_Cipher_Expansion_impl impl;
+  uint8_t *ek;
+  uint32_t ek_len;
+}
+EverCrypt_Cipher_aes_state_s;
+
+EverCrypt_Error_error_code
+EverCrypt_Cipher_aes_create_in(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_Cipher_aes_state_s **dst,
+  uint8_t *key
+)
+{
+  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  Spec_Cipher_Expansion_impl impl;
+  uint8_t *ek;
+  uint32_t ek_len;
+  switch (a)
+  {
+    case Spec_Agile_Cipher_AES128:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        if (has_aesni && has_avx && has_sse)
+        {
+          ek_len = (uint32_t)176U;
+          ek = KRML_HOST_CALLOC(ek_len, sizeof (uint8_t));
+          uint64_t scrut = aes128_key_expansion(key, ek);
+          impl = Spec_Cipher_Expansion_Vale_AES128;
+          break;
+        }
+        #endif
+        ek_len = (uint32_t)92U * (uint32_t)8U;
+        ek = KRML_HOST_CALLOC(ek_len, sizeof (uint8_t));
+        Hacl_AES_GCM_CT64_aes128_init((uint64_t *)ek, key);
+        impl = Spec_Cipher_Expansion_Hacl_AES128;
+        break;
+      }
+    case Spec_Agile_Cipher_AES256:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        if (has_aesni && has_avx && has_sse)
+        {
+          ek_len = (uint32_t)240U;
+          ek = KRML_HOST_CALLOC(ek_len, sizeof (uint8_t));
+          uint64_t scrut = aes256_key_expansion(key, ek);
+          impl = Spec_Cipher_Expansion_Vale_AES256;
+          break;
+        }
+        #endif
+        ek_len = (uint32_t)124U * (uint32_t)8U;
+        ek = KRML_HOST_CALLOC(ek_len, sizeof (uint8_t));
+        Hacl_AES_GCM_CT64_aes256_init((uint64_t *)ek, key);
+        impl = Spec_Cipher_Expansion_Hacl_AES256;
+        break;
+      }
+    default:
+      {
+        return EverCrypt_Error_UnsupportedAlgorithm;
+      }
+  }
+  KRML_CHECK_SIZE(sizeof (EverCrypt_Cipher_aes_state_s), (uint32_t)1U);
+  EverCrypt_Cipher_aes_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_Cipher_aes_state_s));
+  p[0U] = ((EverCrypt_Cipher_aes_state_s){ .impl = impl, .ek = ek, .ek_len = ek_len });
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
+void
+EverCrypt_Cipher_aes_encrypt_blocks(
+  EverCrypt_Cipher_aes_state_s *p,
+  uint32_t n_blocks,
+  uint8_t *dst,
+  uint8_t *src
+)
+{
+  EverCrypt_Cipher_aes_state_s scrut = *p;
+  uint8_t *ek = scrut.ek;
+  switch (scrut.impl)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        Hacl_AES_NI_aes128_encrypt_blocks(ek, n_blocks, dst, src);
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        Hacl_AES_NI_aes256_encrypt_blocks(ek, n_blocks, dst, src);
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        Hacl_AES_GCM_CT64_aes128_encrypt_blocks((uint64_t *)ek, n_blocks, dst, src);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        Hacl_AES_GCM_CT64_aes256_encrypt_blocks((uint64_t *)ek, n_blocks, dst, src);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+void EverCrypt_Cipher_aes_free(EverCrypt_Cipher_aes_state_s *p)
+{
+  EverCrypt_Cipher_aes_state_s scrut = *p;
+  Lib_Memzero0_memzero(scrut.ek, scrut.ek_len * sizeof (scrut.ek[0U]));
+  KRML_HOST_FREE(scrut.ek);
+  KRML_HOST_FREE(p);
+}
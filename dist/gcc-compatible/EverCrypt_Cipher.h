@@ -38,6 +38,12 @@ extern "C" {
 
 
 #include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec512.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Error.h"
+#include "Hacl_Spec.h"
 
 void
 EverCrypt_Cipher_chacha20(
@@ -49,6 +55,64 @@ EverCrypt_Cipher_chacha20(
   uint32_t ctr
 );
 
+/* A ChaCha20 keystream that can be positioned anywhere: the state holds the key,
+   the nonce and the initial block counter, along with the current byte offset
+   into the stream and the keystream block it falls in.
+
+   update encrypts (or decrypts) the next len bytes, so that a large object can
+   be processed in chunks of any size and alignment; whole blocks always go
+   through EverCrypt_Cipher_chacha20 in a single call. seek moves to the byte
+   offset pos of the stream, counted from the initial block counter.
+
+   The 32-bit block counter must never wrap around, since that would reuse
+   keystream: the stream ends after block 0xffffffff. A seek past that end, or
+   an update that would run past it, returns MaximumLengthExceeded without
+   writing anything or changing the state. */
+typedef struct EverCrypt_Cipher_chacha20_state_s_s EverCrypt_Cipher_chacha20_state_s;
+
+EverCrypt_Cipher_chacha20_state_s
+*EverCrypt_Cipher_chacha20_create_in(uint8_t *key, uint8_t *iv, uint32_t ctr);
+
+EverCrypt_Error_error_code
+EverCrypt_Cipher_chacha20_seek(EverCrypt_Cipher_chacha20_state_s *p, uint64_t pos);
+
+uint64_t EverCrypt_Cipher_chacha20_pos(EverCrypt_Cipher_chacha20_state_s *p);
+
+EverCrypt_Error_error_code
+EverCrypt_Cipher_chacha20_update(
+  EverCrypt_Cipher_chacha20_state_s *p,
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src
+);
+
+void EverCrypt_Cipher_chacha20_free(EverCrypt_Cipher_chacha20_state_s *p);
+
+/* An expanded AES-128 or AES-256 key, for encrypting independent 16-byte blocks
+   (ECB). encrypt_blocks takes many blocks at once, so that callers that need one
+   block per item, such as the QUIC header-protection masks of a burst of
+   packets, pay for the dispatch once: the blocks go through AES-NI eight at a
+   time when available, or else four at a time through the bitsliced
+   Hacl_AES_GCM_CT64. create_in returns UnsupportedAlgorithm for CHACHA20. */
+typedef struct EverCrypt_Cipher_aes_state_s_s EverCrypt_Cipher_aes_state_s;
+
+EverCrypt_Error_error_code
+EverCrypt_Cipher_aes_create_in(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_Cipher_aes_state_s **dst,
+  uint8_t *key
+);
+
+void
+EverCrypt_Cipher_aes_encrypt_blocks(
+  EverCrypt_Cipher_aes_state_s *p,
+  uint32_t n_blocks,
+  uint8_t *dst,
+  uint8_t *src
+);
+
+void EverCrypt_Cipher_aes_free(EverCrypt_Cipher_aes_state_s *p);
+
 #if defined(__cplusplus)
 }
 #endif
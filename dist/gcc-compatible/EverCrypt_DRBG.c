@@ -24,6 +24,8 @@
 
 #include "EverCrypt_DRBG.h"
 
+#include "Lib_Memzero0.h"
+
 uint32_t EverCrypt_DRBG_reseed_interval = (uint32_t)1024U;
 
 uint32_t EverCrypt_DRBG_max_output_length = (uint32_t)65536U;
@@ -72,6 +74,9 @@ typedef struct EverCrypt_DRBG_state_s_s
     Hacl_HMAC_DRBG_state case_SHA2_512_s;
   }
   ;
+  EverCrypt_DRBG_reseed_policy policy;
+  uint32_t policy_n;
+  uint64_t bytes_since_reseed;
 }
 EverCrypt_DRBG_state_s;
 
@@ -195,6 +200,77 @@ EverCrypt_DRBG___proj__SHA2_512_s__item___0(
   KRML_HOST_EXIT(255U);
 }
 
+static uint32_t reseed_counter(EverCrypt_DRBG_state_s *st)
+{
+  switch (st->tag)
+  {
+    case EverCrypt_DRBG_SHA1_s:
+      {
+        return st->case_SHA1_s.reseed_counter[0U];
+      }
+    case EverCrypt_DRBG_SHA2_256_s:
+      {
+        return st->case_SHA2_256_s.reseed_counter[0U];
+      }
+    case EverCrypt_DRBG_SHA2_384_s:
+      {
+        return st->case_SHA2_384_s.reseed_counter[0U];
+      }
+    case EverCrypt_DRBG_SHA2_512_s:
+      {
+        return st->case_SHA2_512_s.reseed_counter[0U];
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/* Decides whether a generate request for n bytes first pulls fresh entropy.
+   The reseed counter is 1 right after instantiate or reseed, i.e. when no
+   output has been produced from the current seed. A reseed is always forced
+   before the counter would exceed Hacl_HMAC_DRBG_reseed_interval. */
+static bool must_reseed(EverCrypt_DRBG_state_s *st, uint32_t n)
+{
+  uint32_t ctr = reseed_counter(st);
+  if (ctr >= Hacl_HMAC_DRBG_reseed_interval)
+  {
+    return true;
+  }
+  switch (st->policy)
+  {
+    case EverCrypt_DRBG_Reseed_every_bytes:
+      {
+        uint64_t used = ctr == (uint32_t)1U ? (uint64_t)0U : st->bytes_since_reseed;
+        return used + (uint64_t)n > (uint64_t)st->policy_n;
+      }
+    case EverCrypt_DRBG_Reseed_every_requests:
+      {
+        return ctr > st->policy_n;
+      }
+    default:
+      {
+        return true;
+      }
+  }
+}
+
+/* Called once a request has been served; the counter is 2 for the first
+   request after a (re)seed. */
+static void record_output(EverCrypt_DRBG_state_s *st, uint32_t n)
+{
+  if (reseed_counter(st) == (uint32_t)2U)
+  {
+    st->bytes_since_reseed = (uint64_t)n;
+  }
+  else
+  {
+    st->bytes_since_reseed = st->bytes_since_reseed + (uint64_t)n;
+  }
+}
+
 EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a)
 {
   EverCrypt_DRBG_state_s st;
@@ -980,6 +1056,10 @@ EverCrypt_DRBG_generate_sha1(
   {
     ok0 = false;
   }
+  else if (!must_reseed(st, n))
+  {
+    ok0 = true;
+  }
   else
   {
     uint32_t entropy_input_len1 = Hacl_HMAC_DRBG_min_length(Spec_Hash_Definitions_SHA1);
@@ -1172,6 +1252,7 @@ EverCrypt_DRBG_generate_sha1(
     }
     uint32_t old_ctr = ctr[0U];
     ctr[0U] = old_ctr + (uint32_t)1U;
+    record_output(st, n);
     b = true;
   }
   return true;
@@ -1201,6 +1282,10 @@ EverCrypt_DRBG_generate_sha2_256(
   {
     ok0 = false;
   }
+  else if (!must_reseed(st, n))
+  {
+    ok0 = true;
+  }
   else
   {
     uint32_t entropy_input_len1 = Hacl_HMAC_DRBG_min_length(Spec_Hash_Definitions_SHA2_256);
@@ -1393,6 +1478,7 @@ EverCrypt_DRBG_generate_sha2_256(
     }
     uint32_t old_ctr = ctr[0U];
     ctr[0U] = old_ctr + (uint32_t)1U;
+    record_output(st, n);
     b = true;
   }
   return true;
@@ -1422,6 +1508,10 @@ EverCrypt_DRBG_generate_sha2_384(
   {
     ok0 = false;
   }
+  else if (!must_reseed(st, n))
+  {
+    ok0 = true;
+  }
   else
   {
     uint32_t entropy_input_len1 = Hacl_HMAC_DRBG_min_length(Spec_Hash_Definitions_SHA2_384);
@@ -1614,6 +1704,7 @@ EverCrypt_DRBG_generate_sha2_384(
     }
     uint32_t old_ctr = ctr[0U];
     ctr[0U] = old_ctr + (uint32_t)1U;
+    record_output(st, n);
     b = true;
   }
   return true;
@@ -1643,6 +1734,10 @@ EverCrypt_DRBG_generate_sha2_512(
   {
     ok0 = false;
   }
+  else if (!must_reseed(st, n))
+  {
+    ok0 = true;
+  }
   else
   {
     uint32_t entropy_input_len1 = Hacl_HMAC_DRBG_min_length(Spec_Hash_Definitions_SHA2_512);
@@ -1835,6 +1930,7 @@ EverCrypt_DRBG_generate_sha2_512(
     }
     uint32_t old_ctr = ctr[0U];
     ctr[0U] = old_ctr + (uint32_t)1U;
+    record_output(st, n);
     b = true;
   }
   return true;
@@ -2070,3 +2166,87 @@ void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st)
   KRML_HOST_EXIT(255U);
 }
 
+void
+EverCrypt_DRBG_set_reseed_policy(
+  EverCrypt_DRBG_state_s *st,
+  EverCrypt_DRBG_reseed_policy policy,
+  uint32_t n
+)
+{
+  st->policy = policy;
+  st->policy_n = n;
+}
+
+typedef struct EverCrypt_DRBG_buffered_s_s
+{
+  EverCrypt_DRBG_state_s *st;
+  uint8_t *buf;
+  uint32_t len;
+  uint32_t pos;
+}
+EverCrypt_DRBG_buffered_s;
+
+EverCrypt_DRBG_buffered_s
+*EverCrypt_DRBG_buffered_create(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t buf_len,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  if (buf_len == (uint32_t)0U || buf_len > Hacl_HMAC_DRBG_max_output_length)
+  {
+    return NULL;
+  }
+  EverCrypt_DRBG_state_s *st = EverCrypt_DRBG_create(a);
+  if (!EverCrypt_DRBG_instantiate(st, personalization_string, personalization_string_len))
+  {
+    EverCrypt_DRBG_uninstantiate(st);
+    return NULL;
+  }
+  uint8_t *buf = KRML_HOST_CALLOC(buf_len, sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (EverCrypt_DRBG_buffered_s), (uint32_t)1U);
+  EverCrypt_DRBG_buffered_s *b = KRML_HOST_MALLOC(sizeof (EverCrypt_DRBG_buffered_s));
+  b[0U] = ((EverCrypt_DRBG_buffered_s){ .st = st, .buf = buf, .len = buf_len, .pos = buf_len });
+  return b;
+}
+
+void
+EverCrypt_DRBG_buffered_set_reseed_policy(
+  EverCrypt_DRBG_buffered_s *b,
+  EverCrypt_DRBG_reseed_policy policy,
+  uint32_t n
+)
+{
+  EverCrypt_DRBG_set_reseed_policy(b->st, policy, n);
+}
+
+bool EverCrypt_DRBG_buffered_generate(uint8_t *output, EverCrypt_DRBG_buffered_s *b, uint32_t n)
+{
+  if (n > b->len - b->pos)
+  {
+    if (n >= b->len)
+    {
+      return EverCrypt_DRBG_generate(output, b->st, n, NULL, (uint32_t)0U);
+    }
+    if (!EverCrypt_DRBG_generate(b->buf, b->st, b->len, NULL, (uint32_t)0U))
+    {
+      return false;
+    }
+    b->pos = (uint32_t)0U;
+  }
+  uint8_t *src = b->buf + b->pos;
+  memcpy(output, src, n * sizeof (uint8_t));
+  Lib_Memzero0_memzero(src, n * sizeof (src[0U]));
+  b->pos = b->pos + n;
+  return true;
+}
+
+void EverCrypt_DRBG_buffered_free(EverCrypt_DRBG_buffered_s *b)
+{
+  Lib_Memzero0_memzero(b->buf, b->len * sizeof (b->buf[0U]));
+  KRML_HOST_FREE(b->buf);
+  EverCrypt_DRBG_uninstantiate(b->st);
+  KRML_HOST_FREE(b);
+}
+
@@ -66,6 +66,18 @@ typedef uint8_t EverCrypt_DRBG_state_s_tags;
 
 typedef struct EverCrypt_DRBG_state_s_s EverCrypt_DRBG_state_s;
 
+/* When generate pulls fresh system entropy before producing output:
+   - every_call (the default): on every request, for prediction resistance;
+   - every_bytes: once more than n bytes were produced from the current seed;
+   - every_requests: once n requests were served from the current seed.
+   Independently of the policy, a reseed happens before
+   Hacl_HMAC_DRBG_reseed_interval requests are served from one seed. */
+#define EverCrypt_DRBG_Reseed_every_call 0
+#define EverCrypt_DRBG_Reseed_every_bytes 1
+#define EverCrypt_DRBG_Reseed_every_requests 2
+
+typedef uint8_t EverCrypt_DRBG_reseed_policy;
+
 bool
 EverCrypt_DRBG_uu___is_SHA1_s(
   Spec_Hash_Definitions_hash_alg uu___,
@@ -241,6 +253,40 @@ EverCrypt_DRBG_generate(
 
 void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st);
 
+void
+EverCrypt_DRBG_set_reseed_policy(
+  EverCrypt_DRBG_state_s *st,
+  EverCrypt_DRBG_reseed_policy policy,
+  uint32_t n
+);
+
+/* A generator that draws buf_len bytes at a time and serves small requests
+   from that buffer; bytes are wiped from the buffer as they are handed out.
+   Requests of at least buf_len bytes bypass the buffer. The reseed policy
+   applies to the underlying DRBG, i.e. per refill. There is no locking: use
+   one generator per thread. create returns NULL if buf_len is 0 or larger
+   than Hacl_HMAC_DRBG_max_output_length, or if instantiation fails. */
+typedef struct EverCrypt_DRBG_buffered_s_s EverCrypt_DRBG_buffered_s;
+
+EverCrypt_DRBG_buffered_s
+*EverCrypt_DRBG_buffered_create(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t buf_len,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+);
+
+void
+EverCrypt_DRBG_buffered_set_reseed_policy(
+  EverCrypt_DRBG_buffered_s *b,
+  EverCrypt_DRBG_reseed_policy policy,
+  uint32_t n
+);
+
+bool EverCrypt_DRBG_buffered_generate(uint8_t *output, EverCrypt_DRBG_buffered_s *b, uint32_t n);
+
+void EverCrypt_DRBG_buffered_free(EverCrypt_DRBG_buffered_s *b);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -34,6 +34,19 @@ bool EverCrypt_Ed25519_verify(uint8_t *output, uint32_t len, uint8_t *msg, uint8
   return Hacl_Ed25519_verify(output, len, msg, signature);
 }
 
+bool
+EverCrypt_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t **pks,
+  uint32_t *lens,
+  uint8_t **msgs,
+  uint8_t **sigs,
+  bool *results
+)
+{
+  return Hacl_Ed25519_verify_batch(n, pks, lens, msgs, sigs, results);
+}
+
 void EverCrypt_Ed25519_secret_to_public(uint8_t *output, uint8_t *secret)
 {
   Hacl_Ed25519_secret_to_public(output, secret);
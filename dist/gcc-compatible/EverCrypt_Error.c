@@ -114,3 +114,33 @@ bool EverCrypt_Error_uu___is_DecodeError(EverCrypt_Error_error_code projectee)
   }
 }
 
+bool EverCrypt_Error_uu___is_MaximumLengthExceeded(EverCrypt_Error_error_code projectee)
+{
+  switch (projectee)
+  {
+    case EverCrypt_Error_MaximumLengthExceeded:
+      {
+        return true;
+      }
+    default:
+      {
+        return false;
+      }
+  }
+}
+
+bool EverCrypt_Error_uu___is_InvalidState(EverCrypt_Error_error_code projectee)
+{
+  switch (projectee)
+  {
+    case EverCrypt_Error_InvalidState:
+      {
+        return true;
+      }
+    default:
+      {
+        return false;
+      }
+  }
+}
+
@@ -24,17 +24,18 @@
 
 #include "EverCrypt_HKDF.h"
 
+#include "Lib_Memzero0.h"
+
 void
-EverCrypt_HKDF_expand_sha1(
+EverCrypt_HKDF_expand_keyed(
+  EverCrypt_HMAC_state_s *prk,
   uint8_t *okm,
-  uint8_t *prk,
-  uint32_t prklen,
   uint8_t *info,
   uint32_t infolen,
   uint32_t len
 )
 {
-  uint32_t tlen = (uint32_t)20U;
+  uint32_t tlen = Hacl_Hash_Definitions_hash_len(prk->alg);
   uint32_t n = len / tlen;
   uint8_t *output = okm;
   KRML_CHECK_SIZE(sizeof (uint8_t), tlen + infolen + (uint32_t)1U);
@@ -49,11 +50,11 @@ EverCrypt_HKDF_expand_sha1(
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_keyed(prk, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_keyed(prk, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -62,15 +63,32 @@ EverCrypt_HKDF_expand_sha1(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_keyed(prk, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_compute_keyed(prk, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(text, (tlen + infolen + (uint32_t)1U) * sizeof (text[0U]));
+}
+
+void
+EverCrypt_HKDF_expand_sha1(
+  uint8_t *okm,
+  uint8_t *prk,
+  uint32_t prklen,
+  uint8_t *info,
+  uint32_t infolen,
+  uint32_t len
+)
+{
+  EverCrypt_HMAC_state_s st;
+  EverCrypt_HMAC_init(&st, Spec_Hash_Definitions_SHA1, prk, prklen);
+  EverCrypt_HKDF_expand_keyed(&st, okm, info, infolen, len);
+  Lib_Memzero0_memzero(&st, sizeof (EverCrypt_HMAC_state_s));
 }
 
 void
@@ -95,43 +113,10 @@ EverCrypt_HKDF_expand_sha2_256(
   uint32_t len
 )
 {
-  uint32_t tlen = (uint32_t)32U;
-  uint32_t n = len / tlen;
-  uint8_t *output = okm;
-  KRML_CHECK_SIZE(sizeof (uint8_t), tlen + infolen + (uint32_t)1U);
-  uint8_t text[tlen + infolen + (uint32_t)1U];
-  memset(text, 0U, (tlen + infolen + (uint32_t)1U) * sizeof (uint8_t));
-  uint8_t *text0 = text + tlen;
-  uint8_t *tag = text;
-  uint8_t *ctr = text + tlen + infolen;
-  memcpy(text + tlen, info, infolen * sizeof (uint8_t));
-  for (uint32_t i = (uint32_t)0U; i < n; i++)
-  {
-    ctr[0U] = (uint8_t)(i + (uint32_t)1U);
-    if (i == (uint32_t)0U)
-    {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text0, infolen + (uint32_t)1U);
-    }
-    else
-    {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
-    }
-    memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
-  }
-  if (n * tlen < len)
-  {
-    ctr[0U] = (uint8_t)(n + (uint32_t)1U);
-    if (n == (uint32_t)0U)
-    {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text0, infolen + (uint32_t)1U);
-    }
-    else
-    {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
-    }
-    uint8_t *block = okm + n * tlen;
-    memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
-  }
+  EverCrypt_HMAC_state_s st;
+  EverCrypt_HMAC_init(&st, Spec_Hash_Definitions_SHA2_256, prk, prklen);
+  EverCrypt_HKDF_expand_keyed(&st, okm, info, infolen, len);
+  Lib_Memzero0_memzero(&st, sizeof (EverCrypt_HMAC_state_s));
 }
 
 void
@@ -156,43 +141,10 @@ EverCrypt_HKDF_expand_sha2_384(
   uint32_t len
 )
 {
-  uint32_t tlen = (uint32_t)48U;
-  uint32_t n = len / tlen;
-  uint8_t *output = okm;
-  KRML_CHECK_SIZE(sizeof (uint8_t), tlen + infolen + (uint32_t)1U);
-  uint8_t text[tlen + infolen + (uint32_t)1U];
-  memset(text, 0U, (tlen + infolen + (uint32_t)1U) * sizeof (uint8_t));
-  uint8_t *text0 = text + tlen;
-  uint8_t *tag = text;
-  uint8_t *ctr = text + tlen + infolen;
-  memcpy(text + tlen, info, infolen * sizeof (uint8_t));
-  for (uint32_t i = (uint32_t)0U; i < n; i++)
-  {
-    ctr[0U] = (uint8_t)(i + (uint32_t)1U);
-    if (i == (uint32_t)0U)
-    {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text0, infolen + (uint32_t)1U);
-    }
-    else
-    {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
-    }
-    memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
-  }
-  if (n * tlen < len)
-  {
-    ctr[0U] = (uint8_t)(n + (uint32_t)1U);
-    if (n == (uint32_t)0U)
-    {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text0, infolen + (uint32_t)1U);
-    }
-    else
-    {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
-    }
-    uint8_t *block = okm + n * tlen;
-    memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
-  }
+  EverCrypt_HMAC_state_s st;
+  EverCrypt_HMAC_init(&st, Spec_Hash_Definitions_SHA2_384, prk, prklen);
+  EverCrypt_HKDF_expand_keyed(&st, okm, info, infolen, len);
+  Lib_Memzero0_memzero(&st, sizeof (EverCrypt_HMAC_state_s));
 }
 
 void
@@ -217,43 +169,10 @@ EverCrypt_HKDF_expand_sha2_512(
   uint32_t len
 )
 {
-  uint32_t tlen = (uint32_t)64U;
-  uint32_t n = len / tlen;
-  uint8_t *output = okm;
-  KRML_CHECK_SIZE(sizeof (uint8_t), tlen + infolen + (uint32_t)1U);
-  uint8_t text[tlen + infolen + (uint32_t)1U];
-  memset(text, 0U, (tlen + infolen + (uint32_t)1U) * sizeof (uint8_t));
-  uint8_t *text0 = text + tlen;
-  uint8_t *tag = text;
-  uint8_t *ctr = text + tlen + infolen;
-  memcpy(text + tlen, info, infolen * sizeof (uint8_t));
-  for (uint32_t i = (uint32_t)0U; i < n; i++)
-  {
-    ctr[0U] = (uint8_t)(i + (uint32_t)1U);
-    if (i == (uint32_t)0U)
-    {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text0, infolen + (uint32_t)1U);
-    }
-    else
-    {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
-    }
-    memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
-  }
-  if (n * tlen < len)
-  {
-    ctr[0U] = (uint8_t)(n + (uint32_t)1U);
-    if (n == (uint32_t)0U)
-    {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text0, infolen + (uint32_t)1U);
-    }
-    else
-    {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
-    }
-    uint8_t *block = okm + n * tlen;
-    memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
-  }
+  EverCrypt_HMAC_state_s st;
+  EverCrypt_HMAC_init(&st, Spec_Hash_Definitions_SHA2_512, prk, prklen);
+  EverCrypt_HKDF_expand_keyed(&st, okm, info, infolen, len);
+  Lib_Memzero0_memzero(&st, sizeof (EverCrypt_HMAC_state_s));
 }
 
 void
@@ -278,43 +197,10 @@ EverCrypt_HKDF_expand_blake2s(
   uint32_t len
 )
 {
-  uint32_t tlen = (uint32_t)32U;
-  uint32_t n = len / tlen;
-  uint8_t *output = okm;
-  KRML_CHECK_SIZE(sizeof (uint8_t), tlen + infolen + (uint32_t)1U);
-  uint8_t text[tlen + infolen + (uint32_t)1U];
-  memset(text, 0U, (tlen + infolen + (uint32_t)1U) * sizeof (uint8_t));
-  uint8_t *text0 = text + tlen;
-  uint8_t *tag = text;
-  uint8_t *ctr = text + tlen + infolen;
-  memcpy(text + tlen, info, infolen * sizeof (uint8_t));
-  for (uint32_t i = (uint32_t)0U; i < n; i++)
-  {
-    ctr[0U] = (uint8_t)(i + (uint32_t)1U);
-    if (i == (uint32_t)0U)
-    {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text0, infolen + (uint32_t)1U);
-    }
-    else
-    {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
-    }
-    memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
-  }
-  if (n * tlen < len)
-  {
-    ctr[0U] = (uint8_t)(n + (uint32_t)1U);
-    if (n == (uint32_t)0U)
-    {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text0, infolen + (uint32_t)1U);
-    }
-    else
-    {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
-    }
-    uint8_t *block = okm + n * tlen;
-    memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
-  }
+  EverCrypt_HMAC_state_s st;
+  EverCrypt_HMAC_init(&st, Spec_Hash_Definitions_Blake2S, prk, prklen);
+  EverCrypt_HKDF_expand_keyed(&st, okm, info, infolen, len);
+  Lib_Memzero0_memzero(&st, sizeof (EverCrypt_HMAC_state_s));
 }
 
 void
@@ -339,43 +225,10 @@ EverCrypt_HKDF_expand_blake2b(
   uint32_t len
 )
 {
-  uint32_t tlen = (uint32_t)64U;
-  uint32_t n = len / tlen;
-  uint8_t *output = okm;
-  KRML_CHECK_SIZE(sizeof (uint8_t), tlen + infolen + (uint32_t)1U);
-  uint8_t text[tlen + infolen + (uint32_t)1U];
-  memset(text, 0U, (tlen + infolen + (uint32_t)1U) * sizeof (uint8_t));
-  uint8_t *text0 = text + tlen;
-  uint8_t *tag = text;
-  uint8_t *ctr = text + tlen + infolen;
-  memcpy(text + tlen, info, infolen * sizeof (uint8_t));
-  for (uint32_t i = (uint32_t)0U; i < n; i++)
-  {
-    ctr[0U] = (uint8_t)(i + (uint32_t)1U);
-    if (i == (uint32_t)0U)
-    {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text0, infolen + (uint32_t)1U);
-    }
-    else
-    {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
-    }
-    memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
-  }
-  if (n * tlen < len)
-  {
-    ctr[0U] = (uint8_t)(n + (uint32_t)1U);
-    if (n == (uint32_t)0U)
-    {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text0, infolen + (uint32_t)1U);
-    }
-    else
-    {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
-    }
-    uint8_t *block = okm + n * tlen;
-    memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
-  }
+  EverCrypt_HMAC_state_s st;
+  EverCrypt_HMAC_init(&st, Spec_Hash_Definitions_Blake2B, prk, prklen);
+  EverCrypt_HKDF_expand_keyed(&st, okm, info, infolen, len);
+  Lib_Memzero0_memzero(&st, sizeof (EverCrypt_HMAC_state_s));
 }
 
 void
@@ -40,6 +40,17 @@ extern "C" {
 #include "EverCrypt_HMAC.h"
 #include "Hacl_Spec.h"
 
+/* HKDF-Expand from a PRK whose HMAC key schedule has already been computed,
+   e.g. to derive several labels from one secret. */
+void
+EverCrypt_HKDF_expand_keyed(
+  EverCrypt_HMAC_state_s *prk,
+  uint8_t *okm,
+  uint8_t *info,
+  uint32_t infolen,
+  uint32_t len
+);
+
 void
 EverCrypt_HKDF_expand_sha1(
   uint8_t *okm,
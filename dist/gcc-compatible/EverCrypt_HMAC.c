@@ -24,6 +24,8 @@
 
 #include "EverCrypt_HMAC.h"
 
+#include "Lib_Memzero0.h"
+
 void
 EverCrypt_HMAC_compute_sha1(
   uint8_t *dst,
@@ -848,3 +850,152 @@ EverCrypt_HMAC_compute(
   }
 }
 
+static EverCrypt_Hash_state_s
+hash_state_of(Spec_Hash_Definitions_hash_alg a, EverCrypt_HMAC_hash_words *w)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA1_s, { .case_SHA1_s = w->case_32 } });
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_SHA2_256_s,
+              { .case_SHA2_256_s = w->case_32 }
+            }
+          );
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        return
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_SHA2_384_s,
+              { .case_SHA2_384_s = w->case_64 }
+            }
+          );
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_SHA2_512_s,
+              { .case_SHA2_512_s = w->case_64 }
+            }
+          );
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Blake2S_s, { .case_Blake2S_s = w->case_32 } });
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        return
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Blake2B_s, { .case_Blake2B_s = w->case_64 } });
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+void
+EverCrypt_HMAC_init(
+  EverCrypt_HMAC_state_s *st,
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key,
+  uint32_t key_len
+)
+{
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  st->alg = a;
+  memset(st->key_block, 0U, (uint32_t)128U * sizeof (uint8_t));
+  if (key_len <= l)
+  {
+    memcpy(st->key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_hash(a, st->key_block, key, key_len);
+  }
+  uint8_t pad[128U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    pad[i] = (uint8_t)0x36U ^ st->key_block[i];
+  }
+  EverCrypt_Hash_state_s s_in = hash_state_of(a, &st->inner);
+  EverCrypt_Hash_init(&s_in);
+  EverCrypt_Hash_update_multi2(&s_in, (uint64_t)0U, pad, l);
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    pad[i] = (uint8_t)0x5cU ^ st->key_block[i];
+  }
+  EverCrypt_Hash_state_s s_out = hash_state_of(a, &st->outer);
+  EverCrypt_Hash_init(&s_out);
+  EverCrypt_Hash_update_multi2(&s_out, (uint64_t)0U, pad, l);
+  Lib_Memzero0_memzero(pad, (uint32_t)128U * sizeof (pad[0U]));
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HMAC_create_in(
+  Spec_Hash_Definitions_hash_alg a,
+  EverCrypt_HMAC_state_s **dst,
+  uint8_t *key,
+  uint32_t key_len
+)
+{
+  if (!EverCrypt_HMAC_is_supported_alg(a))
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  KRML_CHECK_SIZE(sizeof (EverCrypt_HMAC_state_s), (uint32_t)1U);
+  EverCrypt_HMAC_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_state_s));
+  EverCrypt_HMAC_init(p, a, key, key_len);
+  dst[0U] = p;
+  return EverCrypt_Error_Success;
+}
+
+void
+EverCrypt_HMAC_compute_keyed(
+  EverCrypt_HMAC_state_s *st,
+  uint8_t *mac,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  Spec_Hash_Definitions_hash_alg a = st->alg;
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  if
+  (
+    data_len
+    == (uint32_t)0U
+    && (a == Spec_Hash_Definitions_Blake2S || a == Spec_Hash_Definitions_Blake2B)
+  )
+  {
+    EverCrypt_HMAC_compute(a, mac, st->key_block, l, data, data_len);
+    return;
+  }
+  uint8_t hash1[64U] = { 0U };
+  EverCrypt_HMAC_hash_words w = st->inner;
+  EverCrypt_Hash_state_s s = hash_state_of(a, &w);
+  EverCrypt_Hash_update_last2(&s, (uint64_t)l, data, data_len);
+  EverCrypt_Hash_finish(&s, hash1);
+  w = st->outer;
+  EverCrypt_Hash_update_last2(&s, (uint64_t)l, hash1, Hacl_Hash_Definitions_hash_len(a));
+  EverCrypt_Hash_finish(&s, mac);
+}
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state_s *st)
+{
+  Lib_Memzero0_memzero(st, sizeof (EverCrypt_HMAC_state_s));
+  KRML_HOST_FREE(st);
+}
+
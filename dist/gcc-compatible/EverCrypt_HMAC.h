@@ -43,6 +43,7 @@ extern "C" {
 #include "Hacl_Hash.h"
 #include "Hacl_Spec.h"
 #include "EverCrypt_Hash.h"
+#include "EverCrypt_Error.h"
 
 void
 EverCrypt_HMAC_compute_sha1(
@@ -112,6 +113,53 @@ EverCrypt_HMAC_compute(
   uint32_t datalen
 );
 
+typedef union {
+  uint32_t case_32[16U];
+  uint64_t case_64[16U];
+}
+EverCrypt_HMAC_hash_words;
+
+/* An HMAC key schedule: the hash states after absorbing the ipad and opad
+   blocks. Each MAC clones them, which saves two compression-function calls
+   per message over EverCrypt_HMAC_compute. The key block is kept for BLAKE2
+   with empty data, where the ipad block is itself the final block. */
+typedef struct EverCrypt_HMAC_state_s_s
+{
+  Spec_Hash_Definitions_hash_alg alg;
+  uint8_t key_block[128U];
+  EverCrypt_HMAC_hash_words inner;
+  EverCrypt_HMAC_hash_words outer;
+}
+EverCrypt_HMAC_state_s;
+
+/* In-place variant of create_in, for caller-allocated states; a must satisfy
+   EverCrypt_HMAC_is_supported_alg. */
+void
+EverCrypt_HMAC_init(
+  EverCrypt_HMAC_state_s *st,
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key,
+  uint32_t key_len
+);
+
+EverCrypt_Error_error_code
+EverCrypt_HMAC_create_in(
+  Spec_Hash_Definitions_hash_alg a,
+  EverCrypt_HMAC_state_s **dst,
+  uint8_t *key,
+  uint32_t key_len
+);
+
+void
+EverCrypt_HMAC_compute_keyed(
+  EverCrypt_HMAC_state_s *st,
+  uint8_t *mac,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state_s *st);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -24,6 +24,9 @@
 
 #include "EverCrypt_Hash.h"
 
+#include "Hacl_SHA2_Vec256.h"
+#include "Hacl_SHA3_Vec256.h"
+
 C_String_t EverCrypt_Hash_string_of_alg(Spec_Hash_Definitions_hash_alg uu___)
 {
   switch (uu___)
@@ -60,6 +63,30 @@ C_String_t EverCrypt_Hash_string_of_alg(Spec_Hash_Definitions_hash_alg uu___)
       {
         return "Blake2B";
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return "SHA3_256";
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return "SHA3_224";
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return "SHA3_384";
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return "SHA3_512";
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        return "Shake128";
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        return "Shake256";
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -308,6 +335,186 @@ uint64_t
   KRML_HOST_EXIT(255U);
 }
 
+bool
+EverCrypt_Hash_uu___is_SHA3_256_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_256_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    return projectee.case_SHA3_256_s;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
+bool
+EverCrypt_Hash_uu___is_SHA3_224_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_224_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    return projectee.case_SHA3_224_s;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
+bool
+EverCrypt_Hash_uu___is_SHA3_384_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_384_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    return projectee.case_SHA3_384_s;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
+bool
+EverCrypt_Hash_uu___is_SHA3_512_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_512_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    return projectee.case_SHA3_512_s;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
+bool
+EverCrypt_Hash_uu___is_Shake128_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_Shake128_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+uint64_t
+*EverCrypt_Hash___proj__Shake128_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_Shake128_s)
+  {
+    return projectee.case_Shake128_s;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
+bool
+EverCrypt_Hash_uu___is_Shake256_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_Shake256_s)
+  {
+    return true;
+  }
+  return false;
+}
+
+uint64_t
+*EverCrypt_Hash___proj__Shake256_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+)
+{
+  if (projectee.tag == EverCrypt_Hash_Shake256_s)
+  {
+    return projectee.case_Shake256_s;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
 Spec_Hash_Definitions_hash_alg EverCrypt_Hash_alg_of_state(EverCrypt_Hash_state_s *s)
 {
   EverCrypt_Hash_state_s scrut = *s;
@@ -343,6 +550,30 @@ Spec_Hash_Definitions_hash_alg EverCrypt_Hash_alg_of_state(EverCrypt_Hash_state_
   {
     return Spec_Hash_Definitions_Blake2B;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    return Spec_Hash_Definitions_SHA3_256;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    return Spec_Hash_Definitions_SHA3_224;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    return Spec_Hash_Definitions_SHA3_384;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    return Spec_Hash_Definitions_SHA3_512;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake128_s)
+  {
+    return Spec_Hash_Definitions_Shake128;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake256_s)
+  {
+    return Spec_Hash_Definitions_Shake256;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -407,6 +638,48 @@ EverCrypt_Hash_state_s *EverCrypt_Hash_create_in(Spec_Hash_Definitions_hash_alg
         s = ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Blake2B_s, { .case_Blake2B_s = buf } });
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_256_s, { .case_SHA3_256_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_224_s, { .case_SHA3_224_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_384_s, { .case_SHA3_384_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_SHA3_512_s, { .case_SHA3_512_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Shake128_s, { .case_Shake128_s = buf } });
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        uint64_t *buf = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+        s =
+          ((EverCrypt_Hash_state_s){ .tag = EverCrypt_Hash_Shake256_s, { .case_Shake256_s = buf } });
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -535,6 +808,42 @@ void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s)
     FStar_UInt128_uint128 uu____1 = FStar_UInt128_uint64_to_uint128((uint64_t)0U);
     return;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake128_s)
+  {
+    uint64_t *p1 = scrut.case_Shake128_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake256_s)
+  {
+    uint64_t *p1 = scrut.case_Shake256_s;
+    memset(p1, 0U, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -633,6 +942,42 @@ void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t
         block);
     return;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    Hacl_Impl_SHA3_absorb_inner((uint32_t)136U, block, p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    Hacl_Impl_SHA3_absorb_inner((uint32_t)144U, block, p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    Hacl_Impl_SHA3_absorb_inner((uint32_t)104U, block, p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    Hacl_Impl_SHA3_absorb_inner((uint32_t)72U, block, p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake128_s)
+  {
+    uint64_t *p1 = scrut.case_Shake128_s;
+    Hacl_Impl_SHA3_absorb_inner((uint32_t)168U, block, p1);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake256_s)
+  {
+    uint64_t *p1 = scrut.case_Shake256_s;
+    Hacl_Impl_SHA3_absorb_inner((uint32_t)136U, block, p1);
+    return;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -717,27 +1062,87 @@ EverCrypt_Hash_update_multi2(
         n);
     return;
   }
-  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
-    __FILE__,
-    __LINE__,
-    "unreachable (pattern matches are exhaustive in F*)");
-  KRML_HOST_EXIT(255U);
-}
-
-KRML_DEPRECATED("Use update_multi2 instead")
-
-void EverCrypt_Hash_update_multi(EverCrypt_Hash_state_s *s, uint8_t *blocks, uint32_t len)
-{
-  EverCrypt_Hash_update_multi2(s, (uint64_t)0U, blocks, len);
-}
-
-void
-EverCrypt_Hash_update_last_256(
-  uint32_t *s,
-  uint64_t input,
-  uint8_t *input_len,
-  uint32_t input_len1
-)
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    uint32_t n = len / (uint32_t)136U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner((uint32_t)136U, blocks + i * (uint32_t)136U, p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    uint32_t n = len / (uint32_t)144U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner((uint32_t)144U, blocks + i * (uint32_t)144U, p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    uint32_t n = len / (uint32_t)104U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner((uint32_t)104U, blocks + i * (uint32_t)104U, p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    uint32_t n = len / (uint32_t)72U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner((uint32_t)72U, blocks + i * (uint32_t)72U, p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake128_s)
+  {
+    uint64_t *p1 = scrut.case_Shake128_s;
+    uint32_t n = len / (uint32_t)168U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner((uint32_t)168U, blocks + i * (uint32_t)168U, p1);
+    }
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake256_s)
+  {
+    uint64_t *p1 = scrut.case_Shake256_s;
+    uint32_t n = len / (uint32_t)136U;
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      Hacl_Impl_SHA3_absorb_inner((uint32_t)136U, blocks + i * (uint32_t)136U, p1);
+    }
+    return;
+  }
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "unreachable (pattern matches are exhaustive in F*)");
+  KRML_HOST_EXIT(255U);
+}
+
+KRML_DEPRECATED("Use update_multi2 instead")
+
+void EverCrypt_Hash_update_multi(EverCrypt_Hash_state_s *s, uint8_t *blocks, uint32_t len)
+{
+  EverCrypt_Hash_update_multi2(s, (uint64_t)0U, blocks, len);
+}
+
+void
+EverCrypt_Hash_update_last_256(
+  uint32_t *s,
+  uint64_t input,
+  uint8_t *input_len,
+  uint32_t input_len1
+)
 {
   uint32_t blocks_n = input_len1 / (uint32_t)64U;
   uint32_t blocks_len = blocks_n * (uint32_t)64U;
@@ -826,6 +1231,42 @@ EverCrypt_Hash_update_last2(
         last_len);
     return;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)136U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)144U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)104U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)72U, last_len, last, (uint8_t)0x06U);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake128_s)
+  {
+    uint64_t *p1 = scrut.case_Shake128_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)168U, last_len, last, (uint8_t)0x1FU);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake256_s)
+  {
+    uint64_t *p1 = scrut.case_Shake256_s;
+    Hacl_Impl_SHA3_absorb(p1, (uint32_t)136U, last_len, last, (uint8_t)0x1FU);
+    return;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -881,6 +1322,36 @@ void EverCrypt_Hash_update_last(EverCrypt_Hash_state_s *s, uint8_t *last, uint64
         sw = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw = (uint32_t)72U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        sw = (uint32_t)168U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        sw = (uint32_t)136U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -945,6 +1416,42 @@ void EverCrypt_Hash_finish(EverCrypt_Hash_state_s *s, uint8_t *dst)
       dst);
     return;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)136U, (uint32_t)32U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)144U, (uint32_t)28U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)104U, (uint32_t)48U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)72U, (uint32_t)64U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake128_s)
+  {
+    uint64_t *p1 = scrut.case_Shake128_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)168U, (uint32_t)32U, dst);
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake256_s)
+  {
+    uint64_t *p1 = scrut.case_Shake256_s;
+    Hacl_Impl_SHA3_squeeze(p1, (uint32_t)136U, (uint32_t)64U, dst);
+    return;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -995,6 +1502,36 @@ void EverCrypt_Hash_free(EverCrypt_Hash_state_s *s)
     uint64_t *p1 = scrut.case_Blake2B_s;
     KRML_HOST_FREE(p1);
   }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_256_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_224_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_384_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p1 = scrut.case_SHA3_512_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_Shake128_s)
+  {
+    uint64_t *p1 = scrut.case_Shake128_s;
+    KRML_HOST_FREE(p1);
+  }
+  else if (scrut.tag == EverCrypt_Hash_Shake256_s)
+  {
+    uint64_t *p1 = scrut.case_Shake256_s;
+    KRML_HOST_FREE(p1);
+  }
   else
   {
     KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
@@ -1137,6 +1674,102 @@ void EverCrypt_Hash_copy(EverCrypt_Hash_state_s *s_src, EverCrypt_Hash_state_s *
     memcpy(p_dst, p_src, (uint32_t)16U * sizeof (uint64_t));
     return;
   }
+  if (scrut.tag == EverCrypt_Hash_SHA3_256_s)
+  {
+    uint64_t *p_src = scrut.case_SHA3_256_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA3_256_s)
+    {
+      p_dst = x1.case_SHA3_256_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_224_s)
+  {
+    uint64_t *p_src = scrut.case_SHA3_224_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA3_224_s)
+    {
+      p_dst = x1.case_SHA3_224_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_384_s)
+  {
+    uint64_t *p_src = scrut.case_SHA3_384_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA3_384_s)
+    {
+      p_dst = x1.case_SHA3_384_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_SHA3_512_s)
+  {
+    uint64_t *p_src = scrut.case_SHA3_512_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_SHA3_512_s)
+    {
+      p_dst = x1.case_SHA3_512_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake128_s)
+  {
+    uint64_t *p_src = scrut.case_Shake128_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_Shake128_s)
+    {
+      p_dst = x1.case_Shake128_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
+  if (scrut.tag == EverCrypt_Hash_Shake256_s)
+  {
+    uint64_t *p_src = scrut.case_Shake256_s;
+    EverCrypt_Hash_state_s x1 = *s_dst;
+    uint64_t *p_dst;
+    if (x1.tag == EverCrypt_Hash_Shake256_s)
+    {
+      p_dst = x1.case_Shake256_s;
+    }
+    else
+    {
+      p_dst = KRML_EABORT(uint64_t *, "unreachable (pattern matches are exhaustive in F*)");
+    }
+    memcpy(p_dst, p_src, (uint32_t)25U * sizeof (uint64_t));
+    return;
+  }
   KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -1260,6 +1893,36 @@ EverCrypt_Hash_hash(
         Hacl_Hash_Blake2_hash_blake2b_32(input, len, dst);
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        Hacl_SHA3_sha3_256(len, input, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        Hacl_SHA3_sha3_224(len, input, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        Hacl_SHA3_sha3_384(len, input, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        Hacl_SHA3_sha3_512(len, input, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        Hacl_SHA3_shake128_hacl(len, input, (uint32_t)32U, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        Hacl_SHA3_shake256_hacl(len, input, (uint32_t)64U, dst);
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1268,6 +1931,81 @@ EverCrypt_Hash_hash(
   }
 }
 
+void
+EverCrypt_Hash_hash_256_multi(uint32_t n, uint8_t **inputs, uint32_t *lens, uint8_t **dst)
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  uint32_t n_vec = (uint32_t)0U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2 && !(has_shaext && has_sse))
+  {
+    n_vec = n / (uint32_t)8U * (uint32_t)8U;
+    Hacl_SHA2_Vec256_sha256_multi(n_vec, inputs, lens, dst);
+  }
+  #endif
+  for (uint32_t i = n_vec; i < n; i++)
+  {
+    EverCrypt_Hash_hash_256(inputs[i], lens[i], dst[i]);
+  }
+}
+
+void
+EverCrypt_Hash_hash_512_multi(uint32_t n, uint8_t **inputs, uint32_t *lens, uint8_t **dst)
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  uint32_t n_vec = (uint32_t)0U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    n_vec = n / (uint32_t)4U * (uint32_t)4U;
+    Hacl_SHA2_Vec256_sha512_multi(n_vec, inputs, lens, dst);
+  }
+  #endif
+  for (uint32_t i = n_vec; i < n; i++)
+  {
+    Hacl_Hash_SHA2_hash_512(inputs[i], lens[i], dst[i]);
+  }
+}
+
+void
+EverCrypt_Hash_shake128_x4(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    Hacl_SHA3_Vec256_shake128_4(inputByteLen,
+      input0,
+      input1,
+      input2,
+      input3,
+      outputByteLen,
+      output0,
+      output1,
+      output2,
+      output3);
+    return;
+  }
+  #endif
+  Hacl_SHA3_shake128_hacl(inputByteLen, input0, outputByteLen, output0);
+  Hacl_SHA3_shake128_hacl(inputByteLen, input1, outputByteLen, output1);
+  Hacl_SHA3_shake128_hacl(inputByteLen, input2, outputByteLen, output2);
+  Hacl_SHA3_shake128_hacl(inputByteLen, input3, outputByteLen, output3);
+}
+
 typedef struct Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s_____s
 {
   EverCrypt_Hash_state_s *block_state;
@@ -1322,6 +2060,36 @@ Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
         sw = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw = (uint32_t)72U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        sw = (uint32_t)168U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        sw = (uint32_t)136U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1414,6 +2182,36 @@ EverCrypt_Hash_Incremental_update(
         sw0 = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw0 = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw0 = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw0 = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw0 = (uint32_t)72U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        sw0 = (uint32_t)168U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        sw0 = (uint32_t)136U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1465,6 +2263,36 @@ EverCrypt_Hash_Incremental_update(
           sz = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sz = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sz = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sz = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sz = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sz = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sz = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1517,6 +2345,36 @@ EverCrypt_Hash_Incremental_update(
           sw = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sw = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sw = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sw = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sw = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1568,6 +2426,36 @@ EverCrypt_Hash_Incremental_update(
         sw1 = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw1 = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw1 = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw1 = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw1 = (uint32_t)72U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        sw1 = (uint32_t)168U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        sw1 = (uint32_t)136U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1624,6 +2512,36 @@ EverCrypt_Hash_Incremental_update(
           sw2 = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sw2 = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sw2 = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sw2 = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sw2 = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sw2 = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sw2 = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1675,6 +2593,36 @@ EverCrypt_Hash_Incremental_update(
             sz1 = (uint32_t)128U;
             break;
           }
+        case Spec_Hash_Definitions_SHA3_256:
+          {
+            sz1 = (uint32_t)136U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_224:
+          {
+            sz1 = (uint32_t)144U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_384:
+          {
+            sz1 = (uint32_t)104U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_512:
+          {
+            sz1 = (uint32_t)72U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake128:
+          {
+            sz1 = (uint32_t)168U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake256:
+          {
+            sz1 = (uint32_t)136U;
+            break;
+          }
         default:
           {
             KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1727,6 +2675,36 @@ EverCrypt_Hash_Incremental_update(
             sw = (uint32_t)128U;
             break;
           }
+        case Spec_Hash_Definitions_SHA3_256:
+          {
+            sw = (uint32_t)136U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_224:
+          {
+            sw = (uint32_t)144U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_384:
+          {
+            sw = (uint32_t)104U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_512:
+          {
+            sw = (uint32_t)72U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake128:
+          {
+            sw = (uint32_t)168U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake256:
+          {
+            sw = (uint32_t)136U;
+            break;
+          }
         default:
           {
             KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1799,6 +2777,36 @@ EverCrypt_Hash_Incremental_update(
           sw2 = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sw2 = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sw2 = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sw2 = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sw2 = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sw2 = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sw2 = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1850,6 +2858,36 @@ EverCrypt_Hash_Incremental_update(
             sz1 = (uint32_t)128U;
             break;
           }
+        case Spec_Hash_Definitions_SHA3_256:
+          {
+            sz1 = (uint32_t)136U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_224:
+          {
+            sz1 = (uint32_t)144U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_384:
+          {
+            sz1 = (uint32_t)104U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_512:
+          {
+            sz1 = (uint32_t)72U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake128:
+          {
+            sz1 = (uint32_t)168U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake256:
+          {
+            sz1 = (uint32_t)136U;
+            break;
+          }
         default:
           {
             KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1902,6 +2940,36 @@ EverCrypt_Hash_Incremental_update(
             sw = (uint32_t)128U;
             break;
           }
+        case Spec_Hash_Definitions_SHA3_256:
+          {
+            sw = (uint32_t)136U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_224:
+          {
+            sw = (uint32_t)144U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_384:
+          {
+            sw = (uint32_t)104U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_512:
+          {
+            sw = (uint32_t)72U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake128:
+          {
+            sw = (uint32_t)168U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake256:
+          {
+            sw = (uint32_t)136U;
+            break;
+          }
         default:
           {
             KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1956,6 +3024,36 @@ EverCrypt_Hash_Incremental_update(
             sw = (uint32_t)128U;
             break;
           }
+        case Spec_Hash_Definitions_SHA3_256:
+          {
+            sw = (uint32_t)136U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_224:
+          {
+            sw = (uint32_t)144U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_384:
+          {
+            sw = (uint32_t)104U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_512:
+          {
+            sw = (uint32_t)72U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake128:
+          {
+            sw = (uint32_t)168U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake256:
+          {
+            sw = (uint32_t)136U;
+            break;
+          }
         default:
           {
             KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2007,6 +3105,36 @@ EverCrypt_Hash_Incremental_update(
           sw3 = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sw3 = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sw3 = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sw3 = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sw3 = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sw3 = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sw3 = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2058,6 +3186,36 @@ EverCrypt_Hash_Incremental_update(
             ite = (uint32_t)128U;
             break;
           }
+        case Spec_Hash_Definitions_SHA3_256:
+          {
+            ite = (uint32_t)136U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_224:
+          {
+            ite = (uint32_t)144U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_384:
+          {
+            ite = (uint32_t)104U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_512:
+          {
+            ite = (uint32_t)72U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake128:
+          {
+            ite = (uint32_t)168U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake256:
+          {
+            ite = (uint32_t)136U;
+            break;
+          }
         default:
           {
             KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2110,6 +3268,36 @@ EverCrypt_Hash_Incremental_update(
             sw = (uint32_t)128U;
             break;
           }
+        case Spec_Hash_Definitions_SHA3_256:
+          {
+            sw = (uint32_t)136U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_224:
+          {
+            sw = (uint32_t)144U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_384:
+          {
+            sw = (uint32_t)104U;
+            break;
+          }
+        case Spec_Hash_Definitions_SHA3_512:
+          {
+            sw = (uint32_t)72U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake128:
+          {
+            sw = (uint32_t)168U;
+            break;
+          }
+        case Spec_Hash_Definitions_Shake256:
+          {
+            sw = (uint32_t)136U;
+            break;
+          }
         default:
           {
             KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2161,10 +3349,40 @@ EverCrypt_Hash_Incremental_update(
           sw4 = (uint32_t)128U;
           break;
         }
-      default:
+      case Spec_Hash_Definitions_SHA3_256:
         {
-          KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
-          KRML_HOST_EXIT(253U);
+          sw4 = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sw4 = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sw4 = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sw4 = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sw4 = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sw4 = (uint32_t)136U;
+          break;
+        }
+      default:
+        {
+          KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+          KRML_HOST_EXIT(253U);
         }
     }
     uint32_t n_blocks = (len - ite) / sw4;
@@ -2211,6 +3429,36 @@ EverCrypt_Hash_Incremental_update(
           sw = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sw = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sw = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sw = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sw = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2278,6 +3526,36 @@ EverCrypt_Hash_Incremental_update(
         sw2 = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw2 = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw2 = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw2 = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw2 = (uint32_t)72U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        sw2 = (uint32_t)168U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        sw2 = (uint32_t)136U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2335,6 +3613,36 @@ EverCrypt_Hash_Incremental_update(
         sw3 = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw3 = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw3 = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw3 = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw3 = (uint32_t)72U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        sw3 = (uint32_t)168U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        sw3 = (uint32_t)136U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2386,6 +3694,36 @@ EverCrypt_Hash_Incremental_update(
           sz10 = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sz10 = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sz10 = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sz10 = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sz10 = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sz10 = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sz10 = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2438,6 +3776,36 @@ EverCrypt_Hash_Incremental_update(
           sw = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sw = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sw = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sw = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sw = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2506,6 +3874,36 @@ EverCrypt_Hash_Incremental_update(
         sw4 = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw4 = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw4 = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw4 = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw4 = (uint32_t)72U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        sw4 = (uint32_t)168U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        sw4 = (uint32_t)136U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2557,6 +3955,36 @@ EverCrypt_Hash_Incremental_update(
           sz1 = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sz1 = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sz1 = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sz1 = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sz1 = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sz1 = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sz1 = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2609,6 +4037,36 @@ EverCrypt_Hash_Incremental_update(
           sw = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sw = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sw = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sw = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sw = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2663,6 +4121,36 @@ EverCrypt_Hash_Incremental_update(
           sw = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sw = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sw = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sw = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sw = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2714,6 +4202,36 @@ EverCrypt_Hash_Incremental_update(
         sw5 = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw5 = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw5 = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw5 = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw5 = (uint32_t)72U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        sw5 = (uint32_t)168U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        sw5 = (uint32_t)136U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2771,6 +4289,36 @@ EverCrypt_Hash_Incremental_update(
           ite = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          ite = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          ite = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          ite = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          ite = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          ite = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          ite = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2823,6 +4371,36 @@ EverCrypt_Hash_Incremental_update(
           sw = (uint32_t)128U;
           break;
         }
+      case Spec_Hash_Definitions_SHA3_256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_224:
+        {
+          sw = (uint32_t)144U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_384:
+        {
+          sw = (uint32_t)104U;
+          break;
+        }
+      case Spec_Hash_Definitions_SHA3_512:
+        {
+          sw = (uint32_t)72U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake128:
+        {
+          sw = (uint32_t)168U;
+          break;
+        }
+      case Spec_Hash_Definitions_Shake256:
+        {
+          sw = (uint32_t)136U;
+          break;
+        }
       default:
         {
           KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2874,6 +4452,36 @@ EverCrypt_Hash_Incremental_update(
         sw6 = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw6 = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw6 = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw6 = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw6 = (uint32_t)72U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        sw6 = (uint32_t)168U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        sw6 = (uint32_t)136U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -2924,6 +4532,36 @@ EverCrypt_Hash_Incremental_update(
         sw = (uint32_t)128U;
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        sw = (uint32_t)136U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        sw = (uint32_t)144U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        sw = (uint32_t)104U;
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        sw = (uint32_t)72U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        sw = (uint32_t)168U;
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        sw = (uint32_t)136U;
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -3180,6 +4818,180 @@ EverCrypt_Hash_Incremental_finish_blake2b(
   EverCrypt_Hash_finish(&tmp_block_state, dst);
 }
 
+void
+EverCrypt_Hash_Incremental_finish_sha3_256(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)136U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)136U);
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_256_s, { .case_SHA3_256_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len, buf_1, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_224(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)144U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)144U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)144U);
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_224_s, { .case_SHA3_224_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len, buf_1, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_384(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)104U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)104U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)104U);
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_384_s, { .case_SHA3_384_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len, buf_1, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_512(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)72U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)72U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)72U);
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_SHA3_512_s, { .case_SHA3_512_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len, buf_1, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+void
+EverCrypt_Hash_Incremental_finish_shake128(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)168U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)168U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)168U);
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_Shake128_s, { .case_Shake128_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len, buf_1, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
+void
+EverCrypt_Hash_Incremental_finish_shake256(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+)
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ scrut = *p;
+  EverCrypt_Hash_state_s *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)136U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)136U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)136U);
+  }
+  uint8_t *buf_1 = buf_;
+  uint64_t buf[25U] = { 0U };
+  EverCrypt_Hash_state_s s = { .tag = EverCrypt_Hash_Shake256_s, { .case_Shake256_s = buf } };
+  EverCrypt_Hash_state_s tmp_block_state = s;
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
+  uint64_t prev_len = total_len - (uint64_t)r;
+  EverCrypt_Hash_update_last2(&tmp_block_state, prev_len, buf_1, r);
+  EverCrypt_Hash_finish(&tmp_block_state, dst);
+}
+
 Spec_Hash_Definitions_hash_alg
 EverCrypt_Hash_Incremental_alg_of_state(
   Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s
@@ -3239,6 +5051,36 @@ EverCrypt_Hash_Incremental_finish(
         EverCrypt_Hash_Incremental_finish_blake2b(s, dst);
         break;
       }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        EverCrypt_Hash_Incremental_finish_sha3_256(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        EverCrypt_Hash_Incremental_finish_sha3_224(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        EverCrypt_Hash_Incremental_finish_sha3_384(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        EverCrypt_Hash_Incremental_finish_sha3_512(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_Shake128:
+      {
+        EverCrypt_Hash_Incremental_finish_shake128(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_Shake256:
+      {
+        EverCrypt_Hash_Incremental_finish_shake256(s, dst);
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -41,6 +41,7 @@ extern "C" {
 #include "Hacl_Impl_Blake2_Constants.h"
 #include "Vale.h"
 #include "Hacl_Hash.h"
+#include "Hacl_SHA3.h"
 #include "EverCrypt_AutoConfig2.h"
 #include "Hacl_Spec.h"
 
@@ -62,6 +63,12 @@ typedef void *EverCrypt_Hash_e_alg;
 #define EverCrypt_Hash_SHA2_512_s 5
 #define EverCrypt_Hash_Blake2S_s 6
 #define EverCrypt_Hash_Blake2B_s 7
+#define EverCrypt_Hash_SHA3_256_s 8
+#define EverCrypt_Hash_SHA3_224_s 9
+#define EverCrypt_Hash_SHA3_384_s 10
+#define EverCrypt_Hash_SHA3_512_s 11
+#define EverCrypt_Hash_Shake128_s 12
+#define EverCrypt_Hash_Shake256_s 13
 
 typedef uint8_t EverCrypt_Hash_state_s_tags;
 
@@ -77,6 +84,12 @@ typedef struct EverCrypt_Hash_state_s_s
     uint64_t *case_SHA2_512_s;
     uint32_t *case_Blake2S_s;
     uint64_t *case_Blake2B_s;
+    uint64_t *case_SHA3_256_s;
+    uint64_t *case_SHA3_224_s;
+    uint64_t *case_SHA3_384_s;
+    uint64_t *case_SHA3_512_s;
+    uint64_t *case_Shake128_s;
+    uint64_t *case_Shake256_s;
   }
   ;
 }
@@ -178,6 +191,78 @@ uint64_t
   EverCrypt_Hash_state_s projectee
 );
 
+bool
+EverCrypt_Hash_uu___is_SHA3_256_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_256_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+bool
+EverCrypt_Hash_uu___is_SHA3_224_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_224_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+bool
+EverCrypt_Hash_uu___is_SHA3_384_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_384_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+bool
+EverCrypt_Hash_uu___is_SHA3_512_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+uint64_t
+*EverCrypt_Hash___proj__SHA3_512_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+bool
+EverCrypt_Hash_uu___is_Shake128_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+uint64_t
+*EverCrypt_Hash___proj__Shake128_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+bool
+EverCrypt_Hash_uu___is_Shake256_s(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
+uint64_t
+*EverCrypt_Hash___proj__Shake256_s__item__p(
+  Spec_Hash_Definitions_hash_alg uu___,
+  EverCrypt_Hash_state_s projectee
+);
+
 Spec_Hash_Definitions_hash_alg EverCrypt_Hash_alg_of_state(EverCrypt_Hash_state_s *s);
 
 EverCrypt_Hash_state_s *EverCrypt_Hash_create_in(Spec_Hash_Definitions_hash_alg a);
@@ -244,6 +329,35 @@ EverCrypt_Hash_hash(
   uint32_t len
 );
 
+/* Hashes n independent messages; inputs[i] (lens[i] bytes) is hashed into
+   dst[i]. On AVX2 machines the messages are processed 8 (SHA-256) or 4
+   (SHA-512) at a time with the multi-buffer kernels of Hacl_SHA2_Vec256;
+   SHA-256 keeps hashing one message at a time when the SHA extensions are
+   available, since they outrun the 8-way kernel. */
+void
+EverCrypt_Hash_hash_256_multi(uint32_t n, uint8_t **inputs, uint32_t *lens, uint8_t **dst);
+
+void
+EverCrypt_Hash_hash_512_multi(uint32_t n, uint8_t **inputs, uint32_t *lens, uint8_t **dst);
+
+/* SHAKE128 of four inputs of the same length, each squeezed to outputByteLen
+   bytes. Runs the four Keccak states in parallel (Hacl_SHA3_Vec256) when
+   AVX2 is available, and falls back to four calls to Hacl_SHA3_shake128_hacl
+   otherwise. */
+void
+EverCrypt_Hash_shake128_x4(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
 typedef struct Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s_____s
 Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____;
 
@@ -308,6 +422,42 @@ EverCrypt_Hash_Incremental_finish_blake2b(
   uint8_t *dst
 );
 
+void
+EverCrypt_Hash_Incremental_finish_sha3_256(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+);
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_224(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+);
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_384(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+);
+
+void
+EverCrypt_Hash_Incremental_finish_sha3_512(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+);
+
+void
+EverCrypt_Hash_Incremental_finish_shake128(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+);
+
+void
+EverCrypt_Hash_Incremental_finish_shake256(
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *p,
+  uint8_t *dst
+);
+
 Spec_Hash_Definitions_hash_alg
 EverCrypt_Hash_Incremental_alg_of_state(
   Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s
@@ -0,0 +1,778 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_AES_GCM_CT64.h"
+
+static void sub_bytes(uint64_t *q)
+{
+  uint64_t x0 = q[7U];
+  uint64_t x1 = q[6U];
+  uint64_t x2 = q[5U];
+  uint64_t x3 = q[4U];
+  uint64_t x4 = q[3U];
+  uint64_t x5 = q[2U];
+  uint64_t x6 = q[1U];
+  uint64_t x7 = q[0U];
+  uint64_t y14 = x3 ^ x5;
+  uint64_t y13 = x0 ^ x6;
+  uint64_t y9 = x0 ^ x3;
+  uint64_t y8 = x0 ^ x5;
+  uint64_t t0 = x1 ^ x2;
+  uint64_t y1 = t0 ^ x7;
+  uint64_t y4 = y1 ^ x3;
+  uint64_t y12 = y13 ^ y14;
+  uint64_t y2 = y1 ^ x0;
+  uint64_t y5 = y1 ^ x6;
+  uint64_t y3 = y5 ^ y8;
+  uint64_t t1 = x4 ^ y12;
+  uint64_t y15 = t1 ^ x5;
+  uint64_t y20 = t1 ^ x1;
+  uint64_t y6 = y15 ^ x7;
+  uint64_t y10 = y15 ^ t0;
+  uint64_t y11 = y20 ^ y9;
+  uint64_t y7 = x7 ^ y11;
+  uint64_t y17 = y10 ^ y11;
+  uint64_t y19 = y10 ^ y8;
+  uint64_t y16 = t0 ^ y11;
+  uint64_t y21 = y13 ^ y16;
+  uint64_t y18 = x0 ^ y16;
+  uint64_t t2 = y12 & y15;
+  uint64_t t3 = y3 & y6;
+  uint64_t t4 = t3 ^ t2;
+  uint64_t t5 = y4 & x7;
+  uint64_t t6 = t5 ^ t2;
+  uint64_t t7 = y13 & y16;
+  uint64_t t8 = y5 & y1;
+  uint64_t t9 = t8 ^ t7;
+  uint64_t t10 = y2 & y7;
+  uint64_t t11 = t10 ^ t7;
+  uint64_t t12 = y9 & y11;
+  uint64_t t13 = y14 & y17;
+  uint64_t t14 = t13 ^ t12;
+  uint64_t t15 = y8 & y10;
+  uint64_t t16 = t15 ^ t12;
+  uint64_t t17 = t4 ^ t14;
+  uint64_t t18 = t6 ^ t16;
+  uint64_t t19 = t9 ^ t14;
+  uint64_t t20 = t11 ^ t16;
+  uint64_t t21 = t17 ^ y20;
+  uint64_t t22 = t18 ^ y19;
+  uint64_t t23 = t19 ^ y21;
+  uint64_t t24 = t20 ^ y18;
+  uint64_t t25 = t21 ^ t22;
+  uint64_t t26 = t21 & t23;
+  uint64_t t27 = t24 ^ t26;
+  uint64_t t28 = t25 & t27;
+  uint64_t t29 = t28 ^ t22;
+  uint64_t t30 = t23 ^ t24;
+  uint64_t t31 = t22 ^ t26;
+  uint64_t t32 = t31 & t30;
+  uint64_t t33 = t32 ^ t24;
+  uint64_t t34 = t23 ^ t33;
+  uint64_t t35 = t27 ^ t33;
+  uint64_t t36 = t24 & t35;
+  uint64_t t37 = t36 ^ t34;
+  uint64_t t38 = t27 ^ t36;
+  uint64_t t39 = t29 & t38;
+  uint64_t t40 = t25 ^ t39;
+  uint64_t t41 = t40 ^ t37;
+  uint64_t t42 = t29 ^ t33;
+  uint64_t t43 = t29 ^ t40;
+  uint64_t t44 = t33 ^ t37;
+  uint64_t t45 = t42 ^ t41;
+  uint64_t z0 = t44 & y15;
+  uint64_t z1 = t37 & y6;
+  uint64_t z2 = t33 & x7;
+  uint64_t z3 = t43 & y16;
+  uint64_t z4 = t40 & y1;
+  uint64_t z5 = t29 & y7;
+  uint64_t z6 = t42 & y11;
+  uint64_t z7 = t45 & y17;
+  uint64_t z8 = t41 & y10;
+  uint64_t z9 = t44 & y12;
+  uint64_t z10 = t37 & y3;
+  uint64_t z11 = t33 & y4;
+  uint64_t z12 = t43 & y13;
+  uint64_t z13 = t40 & y5;
+  uint64_t z14 = t29 & y2;
+  uint64_t z15 = t42 & y9;
+  uint64_t z16 = t45 & y14;
+  uint64_t z17 = t41 & y8;
+  uint64_t t46 = z15 ^ z16;
+  uint64_t t47 = z10 ^ z11;
+  uint64_t t48 = z5 ^ z13;
+  uint64_t t49 = z9 ^ z10;
+  uint64_t t50 = z2 ^ z12;
+  uint64_t t51 = z2 ^ z5;
+  uint64_t t52 = z7 ^ z8;
+  uint64_t t53 = z0 ^ z3;
+  uint64_t t54 = z6 ^ z7;
+  uint64_t t55 = z16 ^ z17;
+  uint64_t t56 = z12 ^ t48;
+  uint64_t t57 = t50 ^ t53;
+  uint64_t t58 = z4 ^ t46;
+  uint64_t t59 = z3 ^ t54;
+  uint64_t t60 = t46 ^ t57;
+  uint64_t t61 = z14 ^ t57;
+  uint64_t t62 = t52 ^ t58;
+  uint64_t t63 = t49 ^ t58;
+  uint64_t t64 = z4 ^ t59;
+  uint64_t t65 = t61 ^ t62;
+  uint64_t t66 = z1 ^ t63;
+  uint64_t s0 = t59 ^ t63;
+  uint64_t s6 = t56 ^ ~t62;
+  uint64_t s7 = t48 ^ ~t60;
+  uint64_t t67 = t64 ^ t65;
+  uint64_t s3 = t53 ^ t66;
+  uint64_t s4 = t51 ^ t66;
+  uint64_t s5 = t47 ^ t65;
+  uint64_t s1 = t64 ^ ~s3;
+  uint64_t s2 = t55 ^ ~t67;
+  q[7U] = s0;
+  q[6U] = s1;
+  q[5U] = s2;
+  q[4U] = s3;
+  q[3U] = s4;
+  q[2U] = s5;
+  q[1U] = s6;
+  q[0U] = s7;
+}
+
+static inline uint64_t rotr64(uint64_t x, uint32_t n)
+{
+  return x >> n | x << ((uint32_t)64U - n);
+}
+
+/* Bit 16 * col + 4 * row + blk of plane j holds bit j of byte (row, col) of block blk. */
+
+static void shift_rows(uint64_t *q)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint64_t x = q[i];
+    q[i] =
+      (x & (uint64_t)0x000F000F000F000FU)
+      | rotr64(x & (uint64_t)0x00F000F000F000F0U, (uint32_t)16U)
+      | rotr64(x & (uint64_t)0x0F000F000F000F00U, (uint32_t)32U)
+      | rotr64(x & (uint64_t)0xF000F000F000F000U, (uint32_t)48U);
+  }
+}
+
+static inline uint64_t rot_rows1(uint64_t x)
+{
+  return (x >> (uint32_t)4U & (uint64_t)0x0FFF0FFF0FFF0FFFU) | (x << (uint32_t)12U & (uint64_t)0xF000F000F000F000U);
+}
+
+static inline uint64_t rot_rows2(uint64_t x)
+{
+  return (x >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU) | (x << (uint32_t)8U & (uint64_t)0xFF00FF00FF00FF00U);
+}
+
+static void mix_columns(uint64_t *q)
+{
+  uint64_t a1[8U] = { 0U };
+  uint64_t t[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    a1[i] = rot_rows1(q[i]);
+    t[i] = q[i] ^ a1[i];
+  }
+  uint64_t t7 = t[7U];
+  q[0U] = t7 ^ a1[0U] ^ rot_rows2(t[0U]);
+  q[1U] = t[0U] ^ t7 ^ a1[1U] ^ rot_rows2(t[1U]);
+  q[2U] = t[1U] ^ a1[2U] ^ rot_rows2(t[2U]);
+  q[3U] = t[2U] ^ t7 ^ a1[3U] ^ rot_rows2(t[3U]);
+  q[4U] = t[3U] ^ t7 ^ a1[4U] ^ rot_rows2(t[4U]);
+  q[5U] = t[4U] ^ a1[5U] ^ rot_rows2(t[5U]);
+  q[6U] = t[5U] ^ a1[6U] ^ rot_rows2(t[6U]);
+  q[7U] = t[6U] ^ a1[7U] ^ rot_rows2(t[7U]);
+}
+
+static inline void add_round_key(uint64_t *q, uint64_t *rk)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    q[i] = q[i] ^ rk[i];
+  }
+}
+
+static inline uint64_t transpose8x8(uint64_t x)
+{
+  uint64_t t0 = (x ^ x >> (uint32_t)7U) & (uint64_t)0x00AA00AA00AA00AAU;
+  uint64_t x1 = x ^ t0 ^ t0 << (uint32_t)7U;
+  uint64_t t1 = (x1 ^ x1 >> (uint32_t)14U) & (uint64_t)0x0000CCCC0000CCCCU;
+  uint64_t x2 = x1 ^ t1 ^ t1 << (uint32_t)14U;
+  uint64_t t2 = (x2 ^ x2 >> (uint32_t)28U) & (uint64_t)0x00000000F0F0F0F0U;
+  return x2 ^ t2 ^ t2 << (uint32_t)28U;
+}
+
+static inline uint64_t spread8(uint64_t b)
+{
+  uint64_t x0 = (b | b << (uint32_t)12U) & (uint64_t)0x000F000FU;
+  uint64_t x1 = (x0 | x0 << (uint32_t)6U) & (uint64_t)0x03030303U;
+  return (x1 | x1 << (uint32_t)3U) & (uint64_t)0x11111111U;
+}
+
+static inline uint64_t compress8(uint64_t x)
+{
+  uint64_t x0 = x & (uint64_t)0x11111111U;
+  uint64_t x1 = (x0 | x0 >> (uint32_t)3U) & (uint64_t)0x03030303U;
+  uint64_t x2 = (x1 | x1 >> (uint32_t)6U) & (uint64_t)0x000F000FU;
+  return (x2 | x2 >> (uint32_t)12U) & (uint64_t)0xFFU;
+}
+
+/* Bitslices four consecutive 16-byte blocks into eight planes. */
+static void load_blocks(uint64_t *q, uint8_t *b)
+{
+  memset(q, 0U, (uint32_t)8U * sizeof (uint64_t));
+  for (uint32_t blk = (uint32_t)0U; blk < (uint32_t)4U; blk++)
+  {
+    for (uint32_t h = (uint32_t)0U; h < (uint32_t)2U; h++)
+    {
+      uint64_t w = transpose8x8(load64_le(b + blk * (uint32_t)16U + h * (uint32_t)8U));
+      uint32_t sh = h * (uint32_t)32U + blk;
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+      {
+        q[j] = q[j] | spread8(w >> j * (uint32_t)8U & (uint64_t)0xFFU) << sh;
+      }
+    }
+  }
+}
+
+static void store_blocks(uint8_t *b, uint64_t *q)
+{
+  for (uint32_t blk = (uint32_t)0U; blk < (uint32_t)4U; blk++)
+  {
+    for (uint32_t h = (uint32_t)0U; h < (uint32_t)2U; h++)
+    {
+      uint32_t sh = h * (uint32_t)32U + blk;
+      uint64_t w = (uint64_t)0U;
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+      {
+        w = w | compress8(q[j] >> sh) << j * (uint32_t)8U;
+      }
+      store64_le(b + blk * (uint32_t)16U + h * (uint32_t)8U, transpose8x8(w));
+    }
+  }
+}
+
+static void aes_encrypt4(uint64_t *rk, uint32_t nr, uint64_t *q)
+{
+  add_round_key(q, rk);
+  for (uint32_t i = (uint32_t)1U; i < nr; i++)
+  {
+    sub_bytes(q);
+    shift_rows(q);
+    mix_columns(q);
+    add_round_key(q, rk + i * (uint32_t)8U);
+  }
+  sub_bytes(q);
+  shift_rows(q);
+  add_round_key(q, rk + nr * (uint32_t)8U);
+}
+
+/* Carry-less 64x64 multiplication (low half) with integer multiplies: the
+   operands are split into four interleaved bit masks so that carries never
+   reach a bit that is kept. */
+static inline uint64_t bmul64(uint64_t x, uint64_t y)
+{
+  uint64_t x0 = x & (uint64_t)0x1111111111111111U;
+  uint64_t x1 = x & (uint64_t)0x2222222222222222U;
+  uint64_t x2 = x & (uint64_t)0x4444444444444444U;
+  uint64_t x3 = x & (uint64_t)0x8888888888888888U;
+  uint64_t y0 = y & (uint64_t)0x1111111111111111U;
+  uint64_t y1 = y & (uint64_t)0x2222222222222222U;
+  uint64_t y2 = y & (uint64_t)0x4444444444444444U;
+  uint64_t y3 = y & (uint64_t)0x8888888888888888U;
+  uint64_t z0 = x0 * y0 ^ x1 * y3 ^ x2 * y2 ^ x3 * y1;
+  uint64_t z1 = x0 * y1 ^ x1 * y0 ^ x2 * y3 ^ x3 * y2;
+  uint64_t z2 = x0 * y2 ^ x1 * y1 ^ x2 * y0 ^ x3 * y3;
+  uint64_t z3 = x0 * y3 ^ x1 * y2 ^ x2 * y1 ^ x3 * y0;
+  return
+    (z0 & (uint64_t)0x1111111111111111U)
+    | (z1 & (uint64_t)0x2222222222222222U)
+    | (z2 & (uint64_t)0x4444444444444444U)
+    | (z3 & (uint64_t)0x8888888888888888U);
+}
+
+static inline uint64_t rev64(uint64_t x)
+{
+  uint64_t
+  x0 = (x & (uint64_t)0x5555555555555555U) << (uint32_t)1U | (x >> (uint32_t)1U & (uint64_t)0x5555555555555555U);
+  uint64_t
+  x1 =
+    (x0 & (uint64_t)0x3333333333333333U)
+    << (uint32_t)2U
+    | (x0 >> (uint32_t)2U & (uint64_t)0x3333333333333333U);
+  uint64_t
+  x2 =
+    (x1 & (uint64_t)0x0F0F0F0F0F0F0F0FU)
+    << (uint32_t)4U
+    | (x1 >> (uint32_t)4U & (uint64_t)0x0F0F0F0F0F0F0F0FU);
+  uint64_t
+  x3 =
+    (x2 & (uint64_t)0x00FF00FF00FF00FFU)
+    << (uint32_t)8U
+    | (x2 >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU);
+  uint64_t
+  x4 =
+    (x3 & (uint64_t)0x0000FFFF0000FFFFU)
+    << (uint32_t)16U
+    | (x3 >> (uint32_t)16U & (uint64_t)0x0000FFFF0000FFFFU);
+  return x4 << (uint32_t)32U | x4 >> (uint32_t)32U;
+}
+
+/* y = (y ^ block) * H in GF(2^128) for each 16-byte block of data; a final
+   partial block is zero-padded. hk = [h1; h0; rev64 h1; rev64 h0], y = [y1; y0]. */
+static void ghash(uint64_t *hk, uint64_t *y, uint8_t *data, uint32_t len)
+{
+  uint64_t h1 = hk[0U];
+  uint64_t h0 = hk[1U];
+  uint64_t h1r = hk[2U];
+  uint64_t h0r = hk[3U];
+  uint64_t h2 = h0 ^ h1;
+  uint64_t h2r = h0r ^ h1r;
+  uint64_t y1 = y[0U];
+  uint64_t y0 = y[1U];
+  uint32_t nb = (len + (uint32_t)15U) / (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *src = data + i * (uint32_t)16U;
+    uint8_t last[16U] = { 0U };
+    uint32_t rem = len - i * (uint32_t)16U;
+    if (rem < (uint32_t)16U)
+    {
+      memcpy(last, src, rem * sizeof (uint8_t));
+      src = last;
+    }
+    y1 = y1 ^ load64_be(src);
+    y0 = y0 ^ load64_be(src + (uint32_t)8U);
+    uint64_t y0r = rev64(y0);
+    uint64_t y1r = rev64(y1);
+    uint64_t y2 = y0 ^ y1;
+    uint64_t y2r = y0r ^ y1r;
+    uint64_t z0 = bmul64(y0, h0);
+    uint64_t z1 = bmul64(y1, h1);
+    uint64_t z2 = bmul64(y2, h2) ^ z0 ^ z1;
+    uint64_t z0h = bmul64(y0r, h0r);
+    uint64_t z1h = bmul64(y1r, h1r);
+    uint64_t z2h = bmul64(y2r, h2r) ^ z0h ^ z1h;
+    uint64_t z0h1 = rev64(z0h) >> (uint32_t)1U;
+    uint64_t z1h1 = rev64(z1h) >> (uint32_t)1U;
+    uint64_t z2h1 = rev64(z2h) >> (uint32_t)1U;
+    uint64_t v0 = z0;
+    uint64_t v1 = z0h1 ^ z2;
+    uint64_t v2 = z1 ^ z2h1;
+    uint64_t v3 = z1h1;
+    uint64_t w3 = v3 << (uint32_t)1U | v2 >> (uint32_t)63U;
+    uint64_t w2 = v2 << (uint32_t)1U | v1 >> (uint32_t)63U;
+    uint64_t w1 = v1 << (uint32_t)1U | v0 >> (uint32_t)63U;
+    uint64_t w0 = v0 << (uint32_t)1U;
+    uint64_t w21 = w2 ^ w0 ^ w0 >> (uint32_t)1U ^ w0 >> (uint32_t)2U ^ w0 >> (uint32_t)7U;
+    uint64_t w11 = w1 ^ w0 << (uint32_t)63U ^ w0 << (uint32_t)62U ^ w0 << (uint32_t)57U;
+    y1 = w3 ^ w11 ^ w11 >> (uint32_t)1U ^ w11 >> (uint32_t)2U ^ w11 >> (uint32_t)7U;
+    y0 = w21 ^ w11 << (uint32_t)63U ^ w11 << (uint32_t)62U ^ w11 << (uint32_t)57U;
+  }
+  y[0U] = y1;
+  y[1U] = y0;
+}
+
+static const
+uint8_t
+rcon[10U] =
+  {
+    (uint8_t)0x01U, (uint8_t)0x02U, (uint8_t)0x04U, (uint8_t)0x08U, (uint8_t)0x10U, (uint8_t)0x20U,
+    (uint8_t)0x40U, (uint8_t)0x80U, (uint8_t)0x1bU, (uint8_t)0x36U
+  };
+
+static void sub_word(uint8_t *w)
+{
+  uint64_t q[8U] = { 0U };
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k++)
+    {
+      q[j] = q[j] | (uint64_t)(w[k] >> j & (uint8_t)1U) << k;
+    }
+  }
+  sub_bytes(q);
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k++)
+  {
+    uint8_t b = (uint8_t)0U;
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      b = b | (uint8_t)(q[j] >> k & (uint64_t)1U) << j;
+    }
+    w[k] = b;
+  }
+}
+
+/* Expands an nk-word key into nr + 1 bitsliced round keys, each replicated
+   across the four block lanes, then derives the GHASH key H = E(0^128). */
+static void init(uint64_t *ctx, uint32_t nk, uint32_t nr, uint8_t *key)
+{
+  uint8_t w[240U] = { 0U };
+  uint32_t nw = (nr + (uint32_t)1U) * (uint32_t)4U;
+  memcpy(w, key, nk * (uint32_t)4U * sizeof (uint8_t));
+  for (uint32_t i = nk; i < nw; i++)
+  {
+    uint8_t tmp[4U] = { 0U };
+    memcpy(tmp, w + (i - (uint32_t)1U) * (uint32_t)4U, (uint32_t)4U * sizeof (uint8_t));
+    if (i % nk == (uint32_t)0U)
+    {
+      uint8_t t0 = tmp[0U];
+      tmp[0U] = tmp[1U];
+      tmp[1U] = tmp[2U];
+      tmp[2U] = tmp[3U];
+      tmp[3U] = t0;
+      sub_word(tmp);
+      tmp[0U] = tmp[0U] ^ rcon[i / nk - (uint32_t)1U];
+    }
+    else if (nk > (uint32_t)6U && i % nk == (uint32_t)4U)
+    {
+      sub_word(tmp);
+    }
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k++)
+    {
+      w[i * (uint32_t)4U + k] = w[(i - nk) * (uint32_t)4U + k] ^ tmp[k];
+    }
+  }
+  for (uint32_t r = (uint32_t)0U; r <= nr; r++)
+  {
+    uint8_t b[64U] = { 0U };
+    for (uint32_t blk = (uint32_t)0U; blk < (uint32_t)4U; blk++)
+    {
+      memcpy(b + blk * (uint32_t)16U, w + r * (uint32_t)16U, (uint32_t)16U * sizeof (uint8_t));
+    }
+    load_blocks(ctx + r * (uint32_t)8U, b);
+  }
+  Lib_Memzero0_memzero(w, (uint32_t)240U * sizeof (w[0U]));
+  uint64_t q[8U] = { 0U };
+  uint8_t h[64U] = { 0U };
+  aes_encrypt4(ctx, nr, q);
+  store_blocks(h, q);
+  uint64_t *hk = ctx + (nr + (uint32_t)1U) * (uint32_t)8U;
+  hk[0U] = load64_be(h);
+  hk[1U] = load64_be(h + (uint32_t)8U);
+  hk[2U] = rev64(hk[0U]);
+  hk[3U] = rev64(hk[1U]);
+}
+
+/* Keystream for the four counter blocks j0[0..12] || ctr + i, i = 0..3. */
+static void ctr_blocks(uint64_t *rk, uint32_t nr, uint8_t *j0, uint32_t ctr, uint8_t *ks)
+{
+  uint64_t q[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    memcpy(ks + i * (uint32_t)16U, j0, (uint32_t)12U * sizeof (uint8_t));
+    store32_be(ks + i * (uint32_t)16U + (uint32_t)12U, ctr + i);
+  }
+  load_blocks(q, ks);
+  aes_encrypt4(rk, nr, q);
+  store_blocks(ks, q);
+}
+
+/* Encrypts n_blocks independent blocks, four per bitsliced call. */
+static void ecb(uint64_t *rk, uint32_t nr, uint32_t n_blocks, uint8_t *out, uint8_t *in)
+{
+  uint64_t q[8U] = { 0U };
+  uint8_t b[64U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < n_blocks; i = i + (uint32_t)4U)
+  {
+    uint32_t n = n_blocks - i < (uint32_t)4U ? n_blocks - i : (uint32_t)4U;
+    memcpy(b, in + i * (uint32_t)16U, n * (uint32_t)16U * sizeof (uint8_t));
+    load_blocks(q, b);
+    aes_encrypt4(rk, nr, q);
+    store_blocks(b, q);
+    memcpy(out + i * (uint32_t)16U, b, n * (uint32_t)16U * sizeof (uint8_t));
+  }
+  Lib_Memzero0_memzero(q, (uint32_t)8U * sizeof (q[0U]));
+  Lib_Memzero0_memzero(b, (uint32_t)64U * sizeof (b[0U]));
+}
+
+static void
+ctr_xor(uint64_t *rk, uint32_t nr, uint8_t *j0, uint32_t ctr, uint8_t *out, uint8_t *in, uint32_t len)
+{
+  uint8_t ks[64U] = { 0U };
+  uint32_t c = ctr;
+  for (uint32_t off = (uint32_t)0U; off < len; off = off + (uint32_t)64U)
+  {
+    uint32_t n = len - off < (uint32_t)64U ? len - off : (uint32_t)64U;
+    ctr_blocks(rk, nr, j0, c, ks);
+    for (uint32_t i = (uint32_t)0U; i < n; i++)
+    {
+      out[off + i] = in[off + i] ^ ks[i];
+    }
+    c = c + (uint32_t)4U;
+  }
+}
+
+static void compute_j0(uint64_t *hk, uint8_t *iv, uint32_t iv_len, uint8_t *j0)
+{
+  if (iv_len == (uint32_t)12U)
+  {
+    memcpy(j0, iv, (uint32_t)12U * sizeof (uint8_t));
+    store32_be(j0 + (uint32_t)12U, (uint32_t)1U);
+    return;
+  }
+  uint64_t y[2U] = { 0U };
+  uint8_t lb[16U] = { 0U };
+  store64_be(lb + (uint32_t)8U, (uint64_t)iv_len * (uint64_t)8U);
+  ghash(hk, y, iv, iv_len);
+  ghash(hk, y, lb, (uint32_t)16U);
+  store64_be(j0, y[0U]);
+  store64_be(j0 + (uint32_t)8U, y[1U]);
+}
+
+static void
+compute_tag(
+  uint64_t *hk,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t len,
+  uint8_t *ekj0,
+  uint8_t *tag
+)
+{
+  uint64_t y[2U] = { 0U };
+  uint8_t lb[16U] = { 0U };
+  store64_be(lb, (uint64_t)ad_len * (uint64_t)8U);
+  store64_be(lb + (uint32_t)8U, (uint64_t)len * (uint64_t)8U);
+  ghash(hk, y, ad, ad_len);
+  ghash(hk, y, cipher, len);
+  ghash(hk, y, lb, (uint32_t)16U);
+  store64_be(tag, y[0U]);
+  store64_be(tag + (uint32_t)8U, y[1U]);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    tag[i] = tag[i] ^ ekj0[i];
+  }
+}
+
+/* The first keystream batch covers E(J0) (for the tag) and the first three
+   payload blocks, so short messages cost a single four-block AES call. */
+static void
+encrypt(
+  uint64_t *ctx,
+  uint32_t nr,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint64_t *hk = ctx + (nr + (uint32_t)1U) * (uint32_t)8U;
+  uint8_t j0[16U] = { 0U };
+  uint8_t ks[64U] = { 0U };
+  compute_j0(hk, iv, iv_len, j0);
+  uint32_t c0 = load32_be(j0 + (uint32_t)12U);
+  ctr_blocks(ctx, nr, j0, c0, ks);
+  uint32_t n0 = plain_len < (uint32_t)48U ? plain_len : (uint32_t)48U;
+  for (uint32_t i = (uint32_t)0U; i < n0; i++)
+  {
+    cipher[i] = plain[i] ^ ks[(uint32_t)16U + i];
+  }
+  ctr_xor(ctx, nr, j0, c0 + (uint32_t)4U, cipher + n0, plain + n0, plain_len - n0);
+  compute_tag(hk, ad, ad_len, cipher, plain_len, ks, tag);
+}
+
+static uint32_t
+decrypt(
+  uint64_t *ctx,
+  uint32_t nr,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  uint64_t *hk = ctx + (nr + (uint32_t)1U) * (uint32_t)8U;
+  uint8_t j0[16U] = { 0U };
+  uint8_t ks[64U] = { 0U };
+  uint8_t tag1[16U] = { 0U };
+  compute_j0(hk, iv, iv_len, j0);
+  uint32_t c0 = load32_be(j0 + (uint32_t)12U);
+  ctr_blocks(ctx, nr, j0, c0, ks);
+  compute_tag(hk, ad, ad_len, cipher, cipher_len, ks, tag1);
+  uint8_t res = (uint8_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    res = res | (tag1[i] ^ tag[i]);
+  }
+  if (res != (uint8_t)0U)
+  {
+    return (uint32_t)1U;
+  }
+  uint32_t n0 = cipher_len < (uint32_t)48U ? cipher_len : (uint32_t)48U;
+  for (uint32_t i = (uint32_t)0U; i < n0; i++)
+  {
+    dst[i] = cipher[i] ^ ks[(uint32_t)16U + i];
+  }
+  ctr_xor(ctx, nr, j0, c0 + (uint32_t)4U, dst + n0, cipher + n0, cipher_len - n0);
+  return (uint32_t)0U;
+}
+
+static void ctr_cb(uint64_t *ctx, uint32_t nr, uint8_t *cb, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  ctr_xor(ctx, nr, cb, load32_be(cb + (uint32_t)12U), out, in, len);
+}
+
+static void ghash_bytes(uint64_t *ctx, uint32_t nr, uint8_t *y, uint32_t len, uint8_t *text)
+{
+  uint64_t *hk = ctx + (nr + (uint32_t)1U) * (uint32_t)8U;
+  uint64_t y1[2U] = { 0U };
+  y1[0U] = load64_be(y);
+  y1[1U] = load64_be(y + (uint32_t)8U);
+  ghash(hk, y1, text, len);
+  store64_be(y, y1[0U]);
+  store64_be(y + (uint32_t)8U, y1[1U]);
+}
+
+void Hacl_AES_GCM_CT64_aes128_init(uint64_t *ctx, uint8_t *key)
+{
+  init(ctx, (uint32_t)4U, (uint32_t)10U, key);
+}
+
+void Hacl_AES_GCM_CT64_aes256_init(uint64_t *ctx, uint8_t *key)
+{
+  init(ctx, (uint32_t)8U, (uint32_t)14U, key);
+}
+
+void
+Hacl_AES_GCM_CT64_aes128_encrypt(
+  uint64_t *ctx,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  encrypt(ctx, (uint32_t)10U, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+}
+
+uint32_t
+Hacl_AES_GCM_CT64_aes128_decrypt(
+  uint64_t *ctx,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  return decrypt(ctx, (uint32_t)10U, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+}
+
+void
+Hacl_AES_GCM_CT64_aes256_encrypt(
+  uint64_t *ctx,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  encrypt(ctx, (uint32_t)14U, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+}
+
+uint32_t
+Hacl_AES_GCM_CT64_aes256_decrypt(
+  uint64_t *ctx,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  return decrypt(ctx, (uint32_t)14U, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+}
+
+void
+Hacl_AES_GCM_CT64_aes128_ctr(uint64_t *ctx, uint8_t *cb, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  ctr_cb(ctx, (uint32_t)10U, cb, len, out, in);
+}
+
+void
+Hacl_AES_GCM_CT64_aes256_ctr(uint64_t *ctx, uint8_t *cb, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  ctr_cb(ctx, (uint32_t)14U, cb, len, out, in);
+}
+
+void Hacl_AES_GCM_CT64_aes128_ghash(uint64_t *ctx, uint8_t *y, uint32_t len, uint8_t *text)
+{
+  ghash_bytes(ctx, (uint32_t)10U, y, len, text);
+}
+
+void Hacl_AES_GCM_CT64_aes256_ghash(uint64_t *ctx, uint8_t *y, uint32_t len, uint8_t *text)
+{
+  ghash_bytes(ctx, (uint32_t)14U, y, len, text);
+}
+
+void
+Hacl_AES_GCM_CT64_aes128_encrypt_blocks(
+  uint64_t *ctx,
+  uint32_t n_blocks,
+  uint8_t *out,
+  uint8_t *in
+)
+{
+  ecb(ctx, (uint32_t)10U, n_blocks, out, in);
+}
+
+void
+Hacl_AES_GCM_CT64_aes256_encrypt_blocks(
+  uint64_t *ctx,
+  uint32_t n_blocks,
+  uint8_t *out,
+  uint8_t *in
+)
+{
+  ecb(ctx, (uint32_t)14U, n_blocks, out, in);
+}
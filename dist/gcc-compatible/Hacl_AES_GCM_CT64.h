@@ -0,0 +1,148 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_AES_GCM_CT64_H
+#define __Hacl_AES_GCM_CT64_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Lib_Memzero0.h"
+
+/* Portable, constant-time AES-GCM: bitsliced AES (four blocks per call, eight
+   64-bit planes) and a carry-less GHASH built from integer multiplications.
+   No table lookups depend on secret data. Used by EverCrypt_AEAD when the
+   Vale AES-NI/PCLMULQDQ implementation is not available.
+
+   The context holds the bitsliced round keys followed by the hash key; it is
+   92 uint64_t for AES-128 and 124 uint64_t for AES-256. The decrypt functions
+   return 0 on success and 1 if the tag does not verify, in which case nothing
+   is written to dst. */
+
+void Hacl_AES_GCM_CT64_aes128_init(uint64_t *ctx, uint8_t *key);
+
+void Hacl_AES_GCM_CT64_aes256_init(uint64_t *ctx, uint8_t *key);
+
+void
+Hacl_AES_GCM_CT64_aes128_encrypt(
+  uint64_t *ctx,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+uint32_t
+Hacl_AES_GCM_CT64_aes128_decrypt(
+  uint64_t *ctx,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+);
+
+void
+Hacl_AES_GCM_CT64_aes256_encrypt(
+  uint64_t *ctx,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+uint32_t
+Hacl_AES_GCM_CT64_aes256_decrypt(
+  uint64_t *ctx,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+);
+
+/* Building blocks for the incremental AEAD in EverCrypt_AEAD. ctr xors len bytes
+   of in with the keystream starting at the 16-byte counter block cb; only the
+   last 32 bits of cb are incremented. ghash absorbs text into the 16-byte
+   big-endian accumulator y, zero-padding a final partial block. */
+
+void
+Hacl_AES_GCM_CT64_aes128_ctr(uint64_t *ctx, uint8_t *cb, uint32_t len, uint8_t *out, uint8_t *in);
+
+void
+Hacl_AES_GCM_CT64_aes256_ctr(uint64_t *ctx, uint8_t *cb, uint32_t len, uint8_t *out, uint8_t *in);
+
+void Hacl_AES_GCM_CT64_aes128_ghash(uint64_t *ctx, uint8_t *y, uint32_t len, uint8_t *text);
+
+void Hacl_AES_GCM_CT64_aes256_ghash(uint64_t *ctx, uint8_t *y, uint32_t len, uint8_t *text);
+
+/* Encrypts n_blocks independent 16-byte blocks (ECB), four per bitsliced call;
+   in and out may be the same buffer. */
+
+void
+Hacl_AES_GCM_CT64_aes128_encrypt_blocks(
+  uint64_t *ctx,
+  uint32_t n_blocks,
+  uint8_t *out,
+  uint8_t *in
+);
+
+void
+Hacl_AES_GCM_CT64_aes256_encrypt_blocks(
+  uint64_t *ctx,
+  uint32_t n_blocks,
+  uint8_t *out,
+  uint8_t *in
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AES_GCM_CT64_H_DEFINED
+#endif
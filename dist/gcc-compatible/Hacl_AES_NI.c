@@ -0,0 +1,97 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AES_NI.h"
+
+static inline void
+encrypt8(Lib_IntVector_Intrinsics_vec128 *rk, uint32_t nr, uint8_t *out, uint8_t *in)
+{
+  Lib_IntVector_Intrinsics_vec128 st[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    st[i] =
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_load_le(in
+          + i * (uint32_t)16U),
+        rk[0U]);
+  }
+  for (uint32_t r = (uint32_t)1U; r < nr; r++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      st[i] = Lib_IntVector_Intrinsics_ni_aes_enc(st[i], rk[r]);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128_store_le(out + i * (uint32_t)16U,
+      Lib_IntVector_Intrinsics_ni_aes_enc_last(st[i], rk[nr]));
+  }
+}
+
+static inline void
+encrypt1(Lib_IntVector_Intrinsics_vec128 *rk, uint32_t nr, uint8_t *out, uint8_t *in)
+{
+  Lib_IntVector_Intrinsics_vec128
+  st = Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_load_le(in), rk[0U]);
+  for (uint32_t r = (uint32_t)1U; r < nr; r++)
+  {
+    st = Lib_IntVector_Intrinsics_ni_aes_enc(st, rk[r]);
+  }
+  Lib_IntVector_Intrinsics_vec128_store_le(out,
+    Lib_IntVector_Intrinsics_ni_aes_enc_last(st, rk[nr]));
+}
+
+static void
+encrypt_blocks(uint8_t *key, uint32_t nr, uint32_t n_blocks, uint8_t *out, uint8_t *in)
+{
+  Lib_IntVector_Intrinsics_vec128 rk[15U];
+  for (uint32_t _i = 0U; _i < (uint32_t)15U; ++_i)
+    rk[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  for (uint32_t i = (uint32_t)0U; i <= nr; i++)
+  {
+    rk[i] = Lib_IntVector_Intrinsics_vec128_load_le(key + i * (uint32_t)16U);
+  }
+  uint32_t n8 = n_blocks / (uint32_t)8U;
+  for (uint32_t i = (uint32_t)0U; i < n8; i++)
+  {
+    encrypt8(rk, nr, out + i * (uint32_t)128U, in + i * (uint32_t)128U);
+  }
+  for (uint32_t i = n8 * (uint32_t)8U; i < n_blocks; i++)
+  {
+    encrypt1(rk, nr, out + i * (uint32_t)16U, in + i * (uint32_t)16U);
+  }
+  Lib_Memzero0_memzero(rk, (uint32_t)15U * sizeof (rk[0U]));
+}
+
+void
+Hacl_AES_NI_aes128_encrypt_blocks(uint8_t *key, uint32_t n_blocks, uint8_t *out, uint8_t *in)
+{
+  encrypt_blocks(key, (uint32_t)10U, n_blocks, out, in);
+}
+
+void
+Hacl_AES_NI_aes256_encrypt_blocks(uint8_t *key, uint32_t n_blocks, uint8_t *out, uint8_t *in)
+{
+  encrypt_blocks(key, (uint32_t)14U, n_blocks, out, in);
+}
@@ -0,0 +1,59 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_AES_NI_H
+#define __Hacl_AES_NI_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Lib_Memzero0.h"
+
+/* Multi-block AES encryption (ECB) with AES-NI. The key is the expanded key in
+   the layout of the Vale key expansion: 11 round keys (176 bytes) for AES-128,
+   15 round keys (240 bytes) for AES-256. The n_blocks blocks of in are
+   independent; they go through the rounds eight at a time, so that the latency
+   of aesenc is hidden. in and out may be the same buffer. */
+
+void
+Hacl_AES_NI_aes128_encrypt_blocks(uint8_t *key, uint32_t n_blocks, uint8_t *out, uint8_t *in);
+
+void
+Hacl_AES_NI_aes256_encrypt_blocks(uint8_t *key, uint32_t n_blocks, uint8_t *out, uint8_t *in);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AES_NI_H_DEFINED
+#endif
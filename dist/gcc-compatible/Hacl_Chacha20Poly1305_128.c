@@ -24,6 +24,235 @@
 
 #include "Hacl_Chacha20Poly1305_128.h"
 
+static inline void
+poly1305_blocks_128(Lib_IntVector_Intrinsics_vec128 *ctx, uint32_t len, uint8_t *text)
+{
+  Lib_IntVector_Intrinsics_vec128 *pre0 = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec128 *acc0 = ctx;
+  uint32_t bs = (uint32_t)32U;
+  uint8_t *text1 = text;
+  uint32_t nb = len / bs;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *block = text1 + i * bs;
+    Lib_IntVector_Intrinsics_vec128 e[5U];
+    for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+      e[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+    Lib_IntVector_Intrinsics_vec128 b1 = Lib_IntVector_Intrinsics_vec128_load_le(block);
+    Lib_IntVector_Intrinsics_vec128
+    b2 = Lib_IntVector_Intrinsics_vec128_load_le(block + (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_interleave_low64(b1, b2);
+    Lib_IntVector_Intrinsics_vec128
+    hi = Lib_IntVector_Intrinsics_vec128_interleave_high64(b1, b2);
+    Lib_IntVector_Intrinsics_vec128
+    f00 =
+      Lib_IntVector_Intrinsics_vec128_and(lo,
+        Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
+    Lib_IntVector_Intrinsics_vec128
+    f15 =
+      Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_shift_right64(lo,
+          (uint32_t)26U),
+        Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
+    Lib_IntVector_Intrinsics_vec128
+    f25 =
+      Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_shift_right64(lo,
+          (uint32_t)52U),
+        Lib_IntVector_Intrinsics_vec128_shift_left64(Lib_IntVector_Intrinsics_vec128_and(hi,
+            Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3fffU)),
+          (uint32_t)12U));
+    Lib_IntVector_Intrinsics_vec128
+    f30 =
+      Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_shift_right64(hi,
+          (uint32_t)14U),
+        Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
+    Lib_IntVector_Intrinsics_vec128
+    f40 = Lib_IntVector_Intrinsics_vec128_shift_right64(hi, (uint32_t)40U);
+    Lib_IntVector_Intrinsics_vec128 f0 = f00;
+    Lib_IntVector_Intrinsics_vec128 f1 = f15;
+    Lib_IntVector_Intrinsics_vec128 f2 = f25;
+    Lib_IntVector_Intrinsics_vec128 f3 = f30;
+    Lib_IntVector_Intrinsics_vec128 f41 = f40;
+    e[0U] = f0;
+    e[1U] = f1;
+    e[2U] = f2;
+    e[3U] = f3;
+    e[4U] = f41;
+    uint64_t b = (uint64_t)0x1000000U;
+    Lib_IntVector_Intrinsics_vec128 mask = Lib_IntVector_Intrinsics_vec128_load64(b);
+    Lib_IntVector_Intrinsics_vec128 f4 = e[4U];
+    e[4U] = Lib_IntVector_Intrinsics_vec128_or(f4, mask);
+    Lib_IntVector_Intrinsics_vec128 *rn = pre0 + (uint32_t)10U;
+    Lib_IntVector_Intrinsics_vec128 *rn5 = pre0 + (uint32_t)15U;
+    Lib_IntVector_Intrinsics_vec128 r0 = rn[0U];
+    Lib_IntVector_Intrinsics_vec128 r1 = rn[1U];
+    Lib_IntVector_Intrinsics_vec128 r2 = rn[2U];
+    Lib_IntVector_Intrinsics_vec128 r3 = rn[3U];
+    Lib_IntVector_Intrinsics_vec128 r4 = rn[4U];
+    Lib_IntVector_Intrinsics_vec128 r51 = rn5[1U];
+    Lib_IntVector_Intrinsics_vec128 r52 = rn5[2U];
+    Lib_IntVector_Intrinsics_vec128 r53 = rn5[3U];
+    Lib_IntVector_Intrinsics_vec128 r54 = rn5[4U];
+    Lib_IntVector_Intrinsics_vec128 f10 = acc0[0U];
+    Lib_IntVector_Intrinsics_vec128 f110 = acc0[1U];
+    Lib_IntVector_Intrinsics_vec128 f120 = acc0[2U];
+    Lib_IntVector_Intrinsics_vec128 f130 = acc0[3U];
+    Lib_IntVector_Intrinsics_vec128 f140 = acc0[4U];
+    Lib_IntVector_Intrinsics_vec128 a0 = Lib_IntVector_Intrinsics_vec128_mul64(r0, f10);
+    Lib_IntVector_Intrinsics_vec128 a1 = Lib_IntVector_Intrinsics_vec128_mul64(r1, f10);
+    Lib_IntVector_Intrinsics_vec128 a2 = Lib_IntVector_Intrinsics_vec128_mul64(r2, f10);
+    Lib_IntVector_Intrinsics_vec128 a3 = Lib_IntVector_Intrinsics_vec128_mul64(r3, f10);
+    Lib_IntVector_Intrinsics_vec128 a4 = Lib_IntVector_Intrinsics_vec128_mul64(r4, f10);
+    Lib_IntVector_Intrinsics_vec128
+    a01 =
+      Lib_IntVector_Intrinsics_vec128_add64(a0,
+        Lib_IntVector_Intrinsics_vec128_mul64(r54, f110));
+    Lib_IntVector_Intrinsics_vec128
+    a11 =
+      Lib_IntVector_Intrinsics_vec128_add64(a1,
+        Lib_IntVector_Intrinsics_vec128_mul64(r0, f110));
+    Lib_IntVector_Intrinsics_vec128
+    a21 =
+      Lib_IntVector_Intrinsics_vec128_add64(a2,
+        Lib_IntVector_Intrinsics_vec128_mul64(r1, f110));
+    Lib_IntVector_Intrinsics_vec128
+    a31 =
+      Lib_IntVector_Intrinsics_vec128_add64(a3,
+        Lib_IntVector_Intrinsics_vec128_mul64(r2, f110));
+    Lib_IntVector_Intrinsics_vec128
+    a41 =
+      Lib_IntVector_Intrinsics_vec128_add64(a4,
+        Lib_IntVector_Intrinsics_vec128_mul64(r3, f110));
+    Lib_IntVector_Intrinsics_vec128
+    a02 =
+      Lib_IntVector_Intrinsics_vec128_add64(a01,
+        Lib_IntVector_Intrinsics_vec128_mul64(r53, f120));
+    Lib_IntVector_Intrinsics_vec128
+    a12 =
+      Lib_IntVector_Intrinsics_vec128_add64(a11,
+        Lib_IntVector_Intrinsics_vec128_mul64(r54, f120));
+    Lib_IntVector_Intrinsics_vec128
+    a22 =
+      Lib_IntVector_Intrinsics_vec128_add64(a21,
+        Lib_IntVector_Intrinsics_vec128_mul64(r0, f120));
+    Lib_IntVector_Intrinsics_vec128
+    a32 =
+      Lib_IntVector_Intrinsics_vec128_add64(a31,
+        Lib_IntVector_Intrinsics_vec128_mul64(r1, f120));
+    Lib_IntVector_Intrinsics_vec128
+    a42 =
+      Lib_IntVector_Intrinsics_vec128_add64(a41,
+        Lib_IntVector_Intrinsics_vec128_mul64(r2, f120));
+    Lib_IntVector_Intrinsics_vec128
+    a03 =
+      Lib_IntVector_Intrinsics_vec128_add64(a02,
+        Lib_IntVector_Intrinsics_vec128_mul64(r52, f130));
+    Lib_IntVector_Intrinsics_vec128
+    a13 =
+      Lib_IntVector_Intrinsics_vec128_add64(a12,
+        Lib_IntVector_Intrinsics_vec128_mul64(r53, f130));
+    Lib_IntVector_Intrinsics_vec128
+    a23 =
+      Lib_IntVector_Intrinsics_vec128_add64(a22,
+        Lib_IntVector_Intrinsics_vec128_mul64(r54, f130));
+    Lib_IntVector_Intrinsics_vec128
+    a33 =
+      Lib_IntVector_Intrinsics_vec128_add64(a32,
+        Lib_IntVector_Intrinsics_vec128_mul64(r0, f130));
+    Lib_IntVector_Intrinsics_vec128
+    a43 =
+      Lib_IntVector_Intrinsics_vec128_add64(a42,
+        Lib_IntVector_Intrinsics_vec128_mul64(r1, f130));
+    Lib_IntVector_Intrinsics_vec128
+    a04 =
+      Lib_IntVector_Intrinsics_vec128_add64(a03,
+        Lib_IntVector_Intrinsics_vec128_mul64(r51, f140));
+    Lib_IntVector_Intrinsics_vec128
+    a14 =
+      Lib_IntVector_Intrinsics_vec128_add64(a13,
+        Lib_IntVector_Intrinsics_vec128_mul64(r52, f140));
+    Lib_IntVector_Intrinsics_vec128
+    a24 =
+      Lib_IntVector_Intrinsics_vec128_add64(a23,
+        Lib_IntVector_Intrinsics_vec128_mul64(r53, f140));
+    Lib_IntVector_Intrinsics_vec128
+    a34 =
+      Lib_IntVector_Intrinsics_vec128_add64(a33,
+        Lib_IntVector_Intrinsics_vec128_mul64(r54, f140));
+    Lib_IntVector_Intrinsics_vec128
+    a44 =
+      Lib_IntVector_Intrinsics_vec128_add64(a43,
+        Lib_IntVector_Intrinsics_vec128_mul64(r0, f140));
+    Lib_IntVector_Intrinsics_vec128 t01 = a04;
+    Lib_IntVector_Intrinsics_vec128 t1 = a14;
+    Lib_IntVector_Intrinsics_vec128 t2 = a24;
+    Lib_IntVector_Intrinsics_vec128 t3 = a34;
+    Lib_IntVector_Intrinsics_vec128 t4 = a44;
+    Lib_IntVector_Intrinsics_vec128
+    mask26 = Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU);
+    Lib_IntVector_Intrinsics_vec128
+    z0 = Lib_IntVector_Intrinsics_vec128_shift_right64(t01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec128
+    z1 = Lib_IntVector_Intrinsics_vec128_shift_right64(t3, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec128 x0 = Lib_IntVector_Intrinsics_vec128_and(t01, mask26);
+    Lib_IntVector_Intrinsics_vec128 x3 = Lib_IntVector_Intrinsics_vec128_and(t3, mask26);
+    Lib_IntVector_Intrinsics_vec128 x1 = Lib_IntVector_Intrinsics_vec128_add64(t1, z0);
+    Lib_IntVector_Intrinsics_vec128 x4 = Lib_IntVector_Intrinsics_vec128_add64(t4, z1);
+    Lib_IntVector_Intrinsics_vec128
+    z01 = Lib_IntVector_Intrinsics_vec128_shift_right64(x1, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec128
+    z11 = Lib_IntVector_Intrinsics_vec128_shift_right64(x4, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec128
+    t = Lib_IntVector_Intrinsics_vec128_shift_left64(z11, (uint32_t)2U);
+    Lib_IntVector_Intrinsics_vec128 z12 = Lib_IntVector_Intrinsics_vec128_add64(z11, t);
+    Lib_IntVector_Intrinsics_vec128 x11 = Lib_IntVector_Intrinsics_vec128_and(x1, mask26);
+    Lib_IntVector_Intrinsics_vec128 x41 = Lib_IntVector_Intrinsics_vec128_and(x4, mask26);
+    Lib_IntVector_Intrinsics_vec128 x2 = Lib_IntVector_Intrinsics_vec128_add64(t2, z01);
+    Lib_IntVector_Intrinsics_vec128 x01 = Lib_IntVector_Intrinsics_vec128_add64(x0, z12);
+    Lib_IntVector_Intrinsics_vec128
+    z02 = Lib_IntVector_Intrinsics_vec128_shift_right64(x2, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec128
+    z13 = Lib_IntVector_Intrinsics_vec128_shift_right64(x01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec128 x21 = Lib_IntVector_Intrinsics_vec128_and(x2, mask26);
+    Lib_IntVector_Intrinsics_vec128 x02 = Lib_IntVector_Intrinsics_vec128_and(x01, mask26);
+    Lib_IntVector_Intrinsics_vec128 x31 = Lib_IntVector_Intrinsics_vec128_add64(x3, z02);
+    Lib_IntVector_Intrinsics_vec128 x12 = Lib_IntVector_Intrinsics_vec128_add64(x11, z13);
+    Lib_IntVector_Intrinsics_vec128
+    z03 = Lib_IntVector_Intrinsics_vec128_shift_right64(x31, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec128 x32 = Lib_IntVector_Intrinsics_vec128_and(x31, mask26);
+    Lib_IntVector_Intrinsics_vec128 x42 = Lib_IntVector_Intrinsics_vec128_add64(x41, z03);
+    Lib_IntVector_Intrinsics_vec128 o00 = x02;
+    Lib_IntVector_Intrinsics_vec128 o10 = x12;
+    Lib_IntVector_Intrinsics_vec128 o20 = x21;
+    Lib_IntVector_Intrinsics_vec128 o30 = x32;
+    Lib_IntVector_Intrinsics_vec128 o40 = x42;
+    acc0[0U] = o00;
+    acc0[1U] = o10;
+    acc0[2U] = o20;
+    acc0[3U] = o30;
+    acc0[4U] = o40;
+    Lib_IntVector_Intrinsics_vec128 f100 = acc0[0U];
+    Lib_IntVector_Intrinsics_vec128 f11 = acc0[1U];
+    Lib_IntVector_Intrinsics_vec128 f12 = acc0[2U];
+    Lib_IntVector_Intrinsics_vec128 f13 = acc0[3U];
+    Lib_IntVector_Intrinsics_vec128 f14 = acc0[4U];
+    Lib_IntVector_Intrinsics_vec128 f20 = e[0U];
+    Lib_IntVector_Intrinsics_vec128 f21 = e[1U];
+    Lib_IntVector_Intrinsics_vec128 f22 = e[2U];
+    Lib_IntVector_Intrinsics_vec128 f23 = e[3U];
+    Lib_IntVector_Intrinsics_vec128 f24 = e[4U];
+    Lib_IntVector_Intrinsics_vec128 o0 = Lib_IntVector_Intrinsics_vec128_add64(f100, f20);
+    Lib_IntVector_Intrinsics_vec128 o1 = Lib_IntVector_Intrinsics_vec128_add64(f11, f21);
+    Lib_IntVector_Intrinsics_vec128 o2 = Lib_IntVector_Intrinsics_vec128_add64(f12, f22);
+    Lib_IntVector_Intrinsics_vec128 o3 = Lib_IntVector_Intrinsics_vec128_add64(f13, f23);
+    Lib_IntVector_Intrinsics_vec128 o4 = Lib_IntVector_Intrinsics_vec128_add64(f14, f24);
+    acc0[0U] = o0;
+    acc0[1U] = o1;
+    acc0[2U] = o2;
+    acc0[3U] = o3;
+    acc0[4U] = o4;
+}
+}
+
 static inline void
 poly1305_padded_128(Lib_IntVector_Intrinsics_vec128 *ctx, uint32_t len, uint8_t *text)
 {
@@ -43,226 +272,7 @@ poly1305_padded_128(Lib_IntVector_Intrinsics_vec128 *ctx, uint32_t len, uint8_t
     Hacl_Impl_Poly1305_Field32xN_128_load_acc2(acc0, text0);
     uint32_t len1 = len0 - bs;
     uint8_t *text1 = t00 + bs;
-    uint32_t nb = len1 / bs;
-    for (uint32_t i = (uint32_t)0U; i < nb; i++)
-    {
-      uint8_t *block = text1 + i * bs;
-      Lib_IntVector_Intrinsics_vec128 e[5U];
-      for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
-        e[_i] = Lib_IntVector_Intrinsics_vec128_zero;
-      Lib_IntVector_Intrinsics_vec128 b1 = Lib_IntVector_Intrinsics_vec128_load_le(block);
-      Lib_IntVector_Intrinsics_vec128
-      b2 = Lib_IntVector_Intrinsics_vec128_load_le(block + (uint32_t)16U);
-      Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_vec128_interleave_low64(b1, b2);
-      Lib_IntVector_Intrinsics_vec128
-      hi = Lib_IntVector_Intrinsics_vec128_interleave_high64(b1, b2);
-      Lib_IntVector_Intrinsics_vec128
-      f00 =
-        Lib_IntVector_Intrinsics_vec128_and(lo,
-          Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
-      Lib_IntVector_Intrinsics_vec128
-      f15 =
-        Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_shift_right64(lo,
-            (uint32_t)26U),
-          Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
-      Lib_IntVector_Intrinsics_vec128
-      f25 =
-        Lib_IntVector_Intrinsics_vec128_or(Lib_IntVector_Intrinsics_vec128_shift_right64(lo,
-            (uint32_t)52U),
-          Lib_IntVector_Intrinsics_vec128_shift_left64(Lib_IntVector_Intrinsics_vec128_and(hi,
-              Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3fffU)),
-            (uint32_t)12U));
-      Lib_IntVector_Intrinsics_vec128
-      f30 =
-        Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_shift_right64(hi,
-            (uint32_t)14U),
-          Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU));
-      Lib_IntVector_Intrinsics_vec128
-      f40 = Lib_IntVector_Intrinsics_vec128_shift_right64(hi, (uint32_t)40U);
-      Lib_IntVector_Intrinsics_vec128 f0 = f00;
-      Lib_IntVector_Intrinsics_vec128 f1 = f15;
-      Lib_IntVector_Intrinsics_vec128 f2 = f25;
-      Lib_IntVector_Intrinsics_vec128 f3 = f30;
-      Lib_IntVector_Intrinsics_vec128 f41 = f40;
-      e[0U] = f0;
-      e[1U] = f1;
-      e[2U] = f2;
-      e[3U] = f3;
-      e[4U] = f41;
-      uint64_t b = (uint64_t)0x1000000U;
-      Lib_IntVector_Intrinsics_vec128 mask = Lib_IntVector_Intrinsics_vec128_load64(b);
-      Lib_IntVector_Intrinsics_vec128 f4 = e[4U];
-      e[4U] = Lib_IntVector_Intrinsics_vec128_or(f4, mask);
-      Lib_IntVector_Intrinsics_vec128 *rn = pre0 + (uint32_t)10U;
-      Lib_IntVector_Intrinsics_vec128 *rn5 = pre0 + (uint32_t)15U;
-      Lib_IntVector_Intrinsics_vec128 r0 = rn[0U];
-      Lib_IntVector_Intrinsics_vec128 r1 = rn[1U];
-      Lib_IntVector_Intrinsics_vec128 r2 = rn[2U];
-      Lib_IntVector_Intrinsics_vec128 r3 = rn[3U];
-      Lib_IntVector_Intrinsics_vec128 r4 = rn[4U];
-      Lib_IntVector_Intrinsics_vec128 r51 = rn5[1U];
-      Lib_IntVector_Intrinsics_vec128 r52 = rn5[2U];
-      Lib_IntVector_Intrinsics_vec128 r53 = rn5[3U];
-      Lib_IntVector_Intrinsics_vec128 r54 = rn5[4U];
-      Lib_IntVector_Intrinsics_vec128 f10 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec128 f110 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec128 f120 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec128 f130 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec128 f140 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec128 a0 = Lib_IntVector_Intrinsics_vec128_mul64(r0, f10);
-      Lib_IntVector_Intrinsics_vec128 a1 = Lib_IntVector_Intrinsics_vec128_mul64(r1, f10);
-      Lib_IntVector_Intrinsics_vec128 a2 = Lib_IntVector_Intrinsics_vec128_mul64(r2, f10);
-      Lib_IntVector_Intrinsics_vec128 a3 = Lib_IntVector_Intrinsics_vec128_mul64(r3, f10);
-      Lib_IntVector_Intrinsics_vec128 a4 = Lib_IntVector_Intrinsics_vec128_mul64(r4, f10);
-      Lib_IntVector_Intrinsics_vec128
-      a01 =
-        Lib_IntVector_Intrinsics_vec128_add64(a0,
-          Lib_IntVector_Intrinsics_vec128_mul64(r54, f110));
-      Lib_IntVector_Intrinsics_vec128
-      a11 =
-        Lib_IntVector_Intrinsics_vec128_add64(a1,
-          Lib_IntVector_Intrinsics_vec128_mul64(r0, f110));
-      Lib_IntVector_Intrinsics_vec128
-      a21 =
-        Lib_IntVector_Intrinsics_vec128_add64(a2,
-          Lib_IntVector_Intrinsics_vec128_mul64(r1, f110));
-      Lib_IntVector_Intrinsics_vec128
-      a31 =
-        Lib_IntVector_Intrinsics_vec128_add64(a3,
-          Lib_IntVector_Intrinsics_vec128_mul64(r2, f110));
-      Lib_IntVector_Intrinsics_vec128
-      a41 =
-        Lib_IntVector_Intrinsics_vec128_add64(a4,
-          Lib_IntVector_Intrinsics_vec128_mul64(r3, f110));
-      Lib_IntVector_Intrinsics_vec128
-      a02 =
-        Lib_IntVector_Intrinsics_vec128_add64(a01,
-          Lib_IntVector_Intrinsics_vec128_mul64(r53, f120));
-      Lib_IntVector_Intrinsics_vec128
-      a12 =
-        Lib_IntVector_Intrinsics_vec128_add64(a11,
-          Lib_IntVector_Intrinsics_vec128_mul64(r54, f120));
-      Lib_IntVector_Intrinsics_vec128
-      a22 =
-        Lib_IntVector_Intrinsics_vec128_add64(a21,
-          Lib_IntVector_Intrinsics_vec128_mul64(r0, f120));
-      Lib_IntVector_Intrinsics_vec128
-      a32 =
-        Lib_IntVector_Intrinsics_vec128_add64(a31,
-          Lib_IntVector_Intrinsics_vec128_mul64(r1, f120));
-      Lib_IntVector_Intrinsics_vec128
-      a42 =
-        Lib_IntVector_Intrinsics_vec128_add64(a41,
-          Lib_IntVector_Intrinsics_vec128_mul64(r2, f120));
-      Lib_IntVector_Intrinsics_vec128
-      a03 =
-        Lib_IntVector_Intrinsics_vec128_add64(a02,
-          Lib_IntVector_Intrinsics_vec128_mul64(r52, f130));
-      Lib_IntVector_Intrinsics_vec128
-      a13 =
-        Lib_IntVector_Intrinsics_vec128_add64(a12,
-          Lib_IntVector_Intrinsics_vec128_mul64(r53, f130));
-      Lib_IntVector_Intrinsics_vec128
-      a23 =
-        Lib_IntVector_Intrinsics_vec128_add64(a22,
-          Lib_IntVector_Intrinsics_vec128_mul64(r54, f130));
-      Lib_IntVector_Intrinsics_vec128
-      a33 =
-        Lib_IntVector_Intrinsics_vec128_add64(a32,
-          Lib_IntVector_Intrinsics_vec128_mul64(r0, f130));
-      Lib_IntVector_Intrinsics_vec128
-      a43 =
-        Lib_IntVector_Intrinsics_vec128_add64(a42,
-          Lib_IntVector_Intrinsics_vec128_mul64(r1, f130));
-      Lib_IntVector_Intrinsics_vec128
-      a04 =
-        Lib_IntVector_Intrinsics_vec128_add64(a03,
-          Lib_IntVector_Intrinsics_vec128_mul64(r51, f140));
-      Lib_IntVector_Intrinsics_vec128
-      a14 =
-        Lib_IntVector_Intrinsics_vec128_add64(a13,
-          Lib_IntVector_Intrinsics_vec128_mul64(r52, f140));
-      Lib_IntVector_Intrinsics_vec128
-      a24 =
-        Lib_IntVector_Intrinsics_vec128_add64(a23,
-          Lib_IntVector_Intrinsics_vec128_mul64(r53, f140));
-      Lib_IntVector_Intrinsics_vec128
-      a34 =
-        Lib_IntVector_Intrinsics_vec128_add64(a33,
-          Lib_IntVector_Intrinsics_vec128_mul64(r54, f140));
-      Lib_IntVector_Intrinsics_vec128
-      a44 =
-        Lib_IntVector_Intrinsics_vec128_add64(a43,
-          Lib_IntVector_Intrinsics_vec128_mul64(r0, f140));
-      Lib_IntVector_Intrinsics_vec128 t01 = a04;
-      Lib_IntVector_Intrinsics_vec128 t1 = a14;
-      Lib_IntVector_Intrinsics_vec128 t2 = a24;
-      Lib_IntVector_Intrinsics_vec128 t3 = a34;
-      Lib_IntVector_Intrinsics_vec128 t4 = a44;
-      Lib_IntVector_Intrinsics_vec128
-      mask26 = Lib_IntVector_Intrinsics_vec128_load64((uint64_t)0x3ffffffU);
-      Lib_IntVector_Intrinsics_vec128
-      z0 = Lib_IntVector_Intrinsics_vec128_shift_right64(t01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128
-      z1 = Lib_IntVector_Intrinsics_vec128_shift_right64(t3, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128 x0 = Lib_IntVector_Intrinsics_vec128_and(t01, mask26);
-      Lib_IntVector_Intrinsics_vec128 x3 = Lib_IntVector_Intrinsics_vec128_and(t3, mask26);
-      Lib_IntVector_Intrinsics_vec128 x1 = Lib_IntVector_Intrinsics_vec128_add64(t1, z0);
-      Lib_IntVector_Intrinsics_vec128 x4 = Lib_IntVector_Intrinsics_vec128_add64(t4, z1);
-      Lib_IntVector_Intrinsics_vec128
-      z01 = Lib_IntVector_Intrinsics_vec128_shift_right64(x1, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128
-      z11 = Lib_IntVector_Intrinsics_vec128_shift_right64(x4, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128
-      t = Lib_IntVector_Intrinsics_vec128_shift_left64(z11, (uint32_t)2U);
-      Lib_IntVector_Intrinsics_vec128 z12 = Lib_IntVector_Intrinsics_vec128_add64(z11, t);
-      Lib_IntVector_Intrinsics_vec128 x11 = Lib_IntVector_Intrinsics_vec128_and(x1, mask26);
-      Lib_IntVector_Intrinsics_vec128 x41 = Lib_IntVector_Intrinsics_vec128_and(x4, mask26);
-      Lib_IntVector_Intrinsics_vec128 x2 = Lib_IntVector_Intrinsics_vec128_add64(t2, z01);
-      Lib_IntVector_Intrinsics_vec128 x01 = Lib_IntVector_Intrinsics_vec128_add64(x0, z12);
-      Lib_IntVector_Intrinsics_vec128
-      z02 = Lib_IntVector_Intrinsics_vec128_shift_right64(x2, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128
-      z13 = Lib_IntVector_Intrinsics_vec128_shift_right64(x01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128 x21 = Lib_IntVector_Intrinsics_vec128_and(x2, mask26);
-      Lib_IntVector_Intrinsics_vec128 x02 = Lib_IntVector_Intrinsics_vec128_and(x01, mask26);
-      Lib_IntVector_Intrinsics_vec128 x31 = Lib_IntVector_Intrinsics_vec128_add64(x3, z02);
-      Lib_IntVector_Intrinsics_vec128 x12 = Lib_IntVector_Intrinsics_vec128_add64(x11, z13);
-      Lib_IntVector_Intrinsics_vec128
-      z03 = Lib_IntVector_Intrinsics_vec128_shift_right64(x31, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec128 x32 = Lib_IntVector_Intrinsics_vec128_and(x31, mask26);
-      Lib_IntVector_Intrinsics_vec128 x42 = Lib_IntVector_Intrinsics_vec128_add64(x41, z03);
-      Lib_IntVector_Intrinsics_vec128 o00 = x02;
-      Lib_IntVector_Intrinsics_vec128 o10 = x12;
-      Lib_IntVector_Intrinsics_vec128 o20 = x21;
-      Lib_IntVector_Intrinsics_vec128 o30 = x32;
-      Lib_IntVector_Intrinsics_vec128 o40 = x42;
-      acc0[0U] = o00;
-      acc0[1U] = o10;
-      acc0[2U] = o20;
-      acc0[3U] = o30;
-      acc0[4U] = o40;
-      Lib_IntVector_Intrinsics_vec128 f100 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec128 f11 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec128 f12 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec128 f13 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec128 f14 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec128 f20 = e[0U];
-      Lib_IntVector_Intrinsics_vec128 f21 = e[1U];
-      Lib_IntVector_Intrinsics_vec128 f22 = e[2U];
-      Lib_IntVector_Intrinsics_vec128 f23 = e[3U];
-      Lib_IntVector_Intrinsics_vec128 f24 = e[4U];
-      Lib_IntVector_Intrinsics_vec128 o0 = Lib_IntVector_Intrinsics_vec128_add64(f100, f20);
-      Lib_IntVector_Intrinsics_vec128 o1 = Lib_IntVector_Intrinsics_vec128_add64(f11, f21);
-      Lib_IntVector_Intrinsics_vec128 o2 = Lib_IntVector_Intrinsics_vec128_add64(f12, f22);
-      Lib_IntVector_Intrinsics_vec128 o3 = Lib_IntVector_Intrinsics_vec128_add64(f13, f23);
-      Lib_IntVector_Intrinsics_vec128 o4 = Lib_IntVector_Intrinsics_vec128_add64(f14, f24);
-      acc0[0U] = o0;
-      acc0[1U] = o1;
-      acc0[2U] = o2;
-      acc0[3U] = o3;
-      acc0[4U] = o4;
-    }
+    poly1305_blocks_128(ctx, len1, text1);
     Hacl_Impl_Poly1305_Field32xN_128_fmul_r2_normalize(acc0, pre0);
   }
   uint32_t len1 = n * (uint32_t)16U - len0;
@@ -905,22 +915,30 @@ poly1305_padded_128(Lib_IntVector_Intrinsics_vec128 *ctx, uint32_t len, uint8_t
 }
 
 static inline void
-poly1305_do_128(
+poly1305_chunk_128(Lib_IntVector_Intrinsics_vec128 *ctx, bool first, uint8_t *text)
+{
+  Lib_IntVector_Intrinsics_vec128 *acc0 = ctx;
+  if (first)
+  {
+    Hacl_Impl_Poly1305_Field32xN_128_load_acc2(acc0, text);
+    poly1305_blocks_128(ctx, (uint32_t)4064U, text + (uint32_t)32U);
+  }
+  else
+  {
+    poly1305_blocks_128(ctx, (uint32_t)4096U, text);
+  }
+}
+
+static inline void
+poly1305_finish_128(
+  Lib_IntVector_Intrinsics_vec128 *ctx,
   uint8_t *k,
   uint32_t aadlen,
-  uint8_t *aad,
   uint32_t mlen,
-  uint8_t *m,
   uint8_t *out
 )
 {
-  Lib_IntVector_Intrinsics_vec128 ctx[25U];
-  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
-    ctx[_i] = Lib_IntVector_Intrinsics_vec128_zero;
   uint8_t block[16U] = { 0U };
-  Hacl_Poly1305_128_poly1305_init(ctx, k);
-  poly1305_padded_128(ctx, aadlen, aad);
-  poly1305_padded_128(ctx, mlen, m);
   store64_le(block, (uint64_t)aadlen);
   store64_le(block + (uint32_t)8U, (uint64_t)mlen);
   Lib_IntVector_Intrinsics_vec128 *pre = ctx + (uint32_t)5U;
@@ -1145,11 +1163,41 @@ Hacl_Chacha20Poly1305_128_aead_encrypt(
   uint8_t *mac
 )
 {
-  Hacl_Chacha20_Vec128_chacha20_encrypt_128(mlen, cipher, m, k, n, (uint32_t)1U);
   uint8_t tmp[64U] = { 0U };
   Hacl_Chacha20_Vec128_chacha20_encrypt_128((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
   uint8_t *key = tmp;
-  poly1305_do_128(key, aadlen, aad, mlen, cipher, mac);
+  Lib_IntVector_Intrinsics_vec128 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Hacl_Poly1305_128_poly1305_init(ctx, key);
+  poly1305_padded_128(ctx, aadlen, aad);
+  /* Encrypt and authenticate one 4096-byte chunk at a time, so that the
+     ciphertext is still in L1 when Poly1305 reads it back. */
+  uint32_t nc = mlen / (uint32_t)4096U;
+  uint32_t len0 = nc * (uint32_t)4096U;
+  for (uint32_t i = (uint32_t)0U; i < nc; i++)
+  {
+    uint8_t *c = cipher + i * (uint32_t)4096U;
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128((uint32_t)4096U,
+      c,
+      m + i * (uint32_t)4096U,
+      k,
+      n,
+      (uint32_t)1U + i * (uint32_t)64U);
+    poly1305_chunk_128(ctx, i == (uint32_t)0U, c);
+  }
+  if (nc > (uint32_t)0U)
+  {
+    Hacl_Impl_Poly1305_Field32xN_128_fmul_r2_normalize(ctx, ctx + (uint32_t)5U);
+  }
+  Hacl_Chacha20_Vec128_chacha20_encrypt_128(mlen - len0,
+    cipher + len0,
+    m + len0,
+    k,
+    n,
+    (uint32_t)1U + nc * (uint32_t)64U);
+  poly1305_padded_128(ctx, mlen - len0, cipher + len0);
+  poly1305_finish_128(ctx, key, aadlen, mlen, mac);
 }
 
 uint32_t
@@ -1168,7 +1216,47 @@ Hacl_Chacha20Poly1305_128_aead_decrypt(
   uint8_t tmp[64U] = { 0U };
   Hacl_Chacha20_Vec128_chacha20_encrypt_128((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
   uint8_t *key = tmp;
-  poly1305_do_128(key, aadlen, aad, mlen, cipher, computed_mac);
+  Lib_IntVector_Intrinsics_vec128 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Hacl_Poly1305_128_poly1305_init(ctx, key);
+  poly1305_padded_128(ctx, aadlen, aad);
+  if (m == cipher)
+  {
+    /* In place, decrypting before the tag check would destroy the ciphertext
+       of a forgery: authenticate all of it first, then decrypt. */
+    poly1305_padded_128(ctx, mlen, cipher);
+  }
+  else
+  {
+    /* Authenticate each chunk of ciphertext before decrypting it into the
+       separate plaintext buffer; on a tag mismatch the plaintext is wiped. */
+    uint32_t nc = mlen / (uint32_t)4096U;
+    uint32_t len0 = nc * (uint32_t)4096U;
+    for (uint32_t i = (uint32_t)0U; i < nc; i++)
+    {
+      uint8_t *c = cipher + i * (uint32_t)4096U;
+      poly1305_chunk_128(ctx, i == (uint32_t)0U, c);
+      Hacl_Chacha20_Vec128_chacha20_encrypt_128((uint32_t)4096U,
+        m + i * (uint32_t)4096U,
+        c,
+        k,
+        n,
+        (uint32_t)1U + i * (uint32_t)64U);
+    }
+    if (nc > (uint32_t)0U)
+    {
+      Hacl_Impl_Poly1305_Field32xN_128_fmul_r2_normalize(ctx, ctx + (uint32_t)5U);
+    }
+    poly1305_padded_128(ctx, mlen - len0, cipher + len0);
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128(mlen - len0,
+      m + len0,
+      cipher + len0,
+      k,
+      n,
+      (uint32_t)1U + nc * (uint32_t)64U);
+  }
+  poly1305_finish_128(ctx, key, aadlen, mlen, computed_mac);
   uint8_t res = (uint8_t)255U;
   for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
   {
@@ -1178,9 +1266,16 @@ Hacl_Chacha20Poly1305_128_aead_decrypt(
   uint8_t z = res;
   if (z == (uint8_t)255U)
   {
-    Hacl_Chacha20_Vec128_chacha20_encrypt_128(mlen, m, cipher, k, n, (uint32_t)1U);
+    if (m == cipher)
+    {
+      Hacl_Chacha20_Vec128_chacha20_encrypt_128(mlen, m, cipher, k, n, (uint32_t)1U);
+    }
     return (uint32_t)0U;
   }
+  if (!(m == cipher))
+  {
+    memset(m, 0U, mlen * sizeof (uint8_t));
+  }
   return (uint32_t)1U;
 }
 
@@ -53,6 +53,11 @@ Hacl_Chacha20Poly1305_128_aead_encrypt(
   uint8_t *mac
 );
 
+/* Returns 0 and writes the plaintext to m if the tag is valid, and 1 otherwise.
+   m and cipher are either disjoint or the same buffer. When disjoint, the
+   plaintext is written while the ciphertext is authenticated, and m is zeroed
+   on failure. In place, the whole ciphertext is authenticated before it is
+   decrypted, so a failure leaves it intact. */
 uint32_t
 Hacl_Chacha20Poly1305_128_aead_decrypt(
   uint8_t *k,
@@ -24,6 +24,237 @@
 
 #include "Hacl_Chacha20Poly1305_256.h"
 
+static inline void
+poly1305_blocks_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t *text)
+{
+  Lib_IntVector_Intrinsics_vec256 *pre0 = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec256 *acc0 = ctx;
+  uint32_t bs = (uint32_t)64U;
+  uint8_t *text1 = text;
+  uint32_t nb = len / bs;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *block = text1 + i * bs;
+    Lib_IntVector_Intrinsics_vec256 e[5U];
+    for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+      e[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+    Lib_IntVector_Intrinsics_vec256 lo = Lib_IntVector_Intrinsics_vec256_load_le(block);
+    Lib_IntVector_Intrinsics_vec256
+    hi = Lib_IntVector_Intrinsics_vec256_load_le(block + (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256
+    mask260 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+    Lib_IntVector_Intrinsics_vec256
+    m0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(lo, hi);
+    Lib_IntVector_Intrinsics_vec256
+    m1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(lo, hi);
+    Lib_IntVector_Intrinsics_vec256
+    m2 = Lib_IntVector_Intrinsics_vec256_shift_right(m0, (uint32_t)48U);
+    Lib_IntVector_Intrinsics_vec256
+    m3 = Lib_IntVector_Intrinsics_vec256_shift_right(m1, (uint32_t)48U);
+    Lib_IntVector_Intrinsics_vec256
+    m4 = Lib_IntVector_Intrinsics_vec256_interleave_high64(m0, m1);
+    Lib_IntVector_Intrinsics_vec256
+    t010 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m0, m1);
+    Lib_IntVector_Intrinsics_vec256
+    t30 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m2, m3);
+    Lib_IntVector_Intrinsics_vec256
+    t20 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)4U);
+    Lib_IntVector_Intrinsics_vec256 o20 = Lib_IntVector_Intrinsics_vec256_and(t20, mask260);
+    Lib_IntVector_Intrinsics_vec256
+    t10 = Lib_IntVector_Intrinsics_vec256_shift_right64(t010, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 o10 = Lib_IntVector_Intrinsics_vec256_and(t10, mask260);
+    Lib_IntVector_Intrinsics_vec256 o5 = Lib_IntVector_Intrinsics_vec256_and(t010, mask260);
+    Lib_IntVector_Intrinsics_vec256
+    t31 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)30U);
+    Lib_IntVector_Intrinsics_vec256 o30 = Lib_IntVector_Intrinsics_vec256_and(t31, mask260);
+    Lib_IntVector_Intrinsics_vec256
+    o40 = Lib_IntVector_Intrinsics_vec256_shift_right64(m4, (uint32_t)40U);
+    Lib_IntVector_Intrinsics_vec256 o00 = o5;
+    Lib_IntVector_Intrinsics_vec256 o11 = o10;
+    Lib_IntVector_Intrinsics_vec256 o21 = o20;
+    Lib_IntVector_Intrinsics_vec256 o31 = o30;
+    Lib_IntVector_Intrinsics_vec256 o41 = o40;
+    e[0U] = o00;
+    e[1U] = o11;
+    e[2U] = o21;
+    e[3U] = o31;
+    e[4U] = o41;
+    uint64_t b = (uint64_t)0x1000000U;
+    Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64(b);
+    Lib_IntVector_Intrinsics_vec256 f4 = e[4U];
+    e[4U] = Lib_IntVector_Intrinsics_vec256_or(f4, mask);
+    Lib_IntVector_Intrinsics_vec256 *rn = pre0 + (uint32_t)10U;
+    Lib_IntVector_Intrinsics_vec256 *rn5 = pre0 + (uint32_t)15U;
+    Lib_IntVector_Intrinsics_vec256 r0 = rn[0U];
+    Lib_IntVector_Intrinsics_vec256 r1 = rn[1U];
+    Lib_IntVector_Intrinsics_vec256 r2 = rn[2U];
+    Lib_IntVector_Intrinsics_vec256 r3 = rn[3U];
+    Lib_IntVector_Intrinsics_vec256 r4 = rn[4U];
+    Lib_IntVector_Intrinsics_vec256 r51 = rn5[1U];
+    Lib_IntVector_Intrinsics_vec256 r52 = rn5[2U];
+    Lib_IntVector_Intrinsics_vec256 r53 = rn5[3U];
+    Lib_IntVector_Intrinsics_vec256 r54 = rn5[4U];
+    Lib_IntVector_Intrinsics_vec256 f10 = acc0[0U];
+    Lib_IntVector_Intrinsics_vec256 f110 = acc0[1U];
+    Lib_IntVector_Intrinsics_vec256 f120 = acc0[2U];
+    Lib_IntVector_Intrinsics_vec256 f130 = acc0[3U];
+    Lib_IntVector_Intrinsics_vec256 f140 = acc0[4U];
+    Lib_IntVector_Intrinsics_vec256 a0 = Lib_IntVector_Intrinsics_vec256_mul64(r0, f10);
+    Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_mul64(r1, f10);
+    Lib_IntVector_Intrinsics_vec256 a2 = Lib_IntVector_Intrinsics_vec256_mul64(r2, f10);
+    Lib_IntVector_Intrinsics_vec256 a3 = Lib_IntVector_Intrinsics_vec256_mul64(r3, f10);
+    Lib_IntVector_Intrinsics_vec256 a4 = Lib_IntVector_Intrinsics_vec256_mul64(r4, f10);
+    Lib_IntVector_Intrinsics_vec256
+    a01 =
+      Lib_IntVector_Intrinsics_vec256_add64(a0,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a11 =
+      Lib_IntVector_Intrinsics_vec256_add64(a1,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a21 =
+      Lib_IntVector_Intrinsics_vec256_add64(a2,
+        Lib_IntVector_Intrinsics_vec256_mul64(r1, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a31 =
+      Lib_IntVector_Intrinsics_vec256_add64(a3,
+        Lib_IntVector_Intrinsics_vec256_mul64(r2, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a41 =
+      Lib_IntVector_Intrinsics_vec256_add64(a4,
+        Lib_IntVector_Intrinsics_vec256_mul64(r3, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a02 =
+      Lib_IntVector_Intrinsics_vec256_add64(a01,
+        Lib_IntVector_Intrinsics_vec256_mul64(r53, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a12 =
+      Lib_IntVector_Intrinsics_vec256_add64(a11,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a22 =
+      Lib_IntVector_Intrinsics_vec256_add64(a21,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a32 =
+      Lib_IntVector_Intrinsics_vec256_add64(a31,
+        Lib_IntVector_Intrinsics_vec256_mul64(r1, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a42 =
+      Lib_IntVector_Intrinsics_vec256_add64(a41,
+        Lib_IntVector_Intrinsics_vec256_mul64(r2, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a03 =
+      Lib_IntVector_Intrinsics_vec256_add64(a02,
+        Lib_IntVector_Intrinsics_vec256_mul64(r52, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a13 =
+      Lib_IntVector_Intrinsics_vec256_add64(a12,
+        Lib_IntVector_Intrinsics_vec256_mul64(r53, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a23 =
+      Lib_IntVector_Intrinsics_vec256_add64(a22,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a33 =
+      Lib_IntVector_Intrinsics_vec256_add64(a32,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a43 =
+      Lib_IntVector_Intrinsics_vec256_add64(a42,
+        Lib_IntVector_Intrinsics_vec256_mul64(r1, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a04 =
+      Lib_IntVector_Intrinsics_vec256_add64(a03,
+        Lib_IntVector_Intrinsics_vec256_mul64(r51, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a14 =
+      Lib_IntVector_Intrinsics_vec256_add64(a13,
+        Lib_IntVector_Intrinsics_vec256_mul64(r52, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a24 =
+      Lib_IntVector_Intrinsics_vec256_add64(a23,
+        Lib_IntVector_Intrinsics_vec256_mul64(r53, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a34 =
+      Lib_IntVector_Intrinsics_vec256_add64(a33,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a44 =
+      Lib_IntVector_Intrinsics_vec256_add64(a43,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f140));
+    Lib_IntVector_Intrinsics_vec256 t01 = a04;
+    Lib_IntVector_Intrinsics_vec256 t1 = a14;
+    Lib_IntVector_Intrinsics_vec256 t2 = a24;
+    Lib_IntVector_Intrinsics_vec256 t3 = a34;
+    Lib_IntVector_Intrinsics_vec256 t4 = a44;
+    Lib_IntVector_Intrinsics_vec256
+    mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+    Lib_IntVector_Intrinsics_vec256
+    z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t01, mask26);
+    Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
+    Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t1, z0);
+    Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
+    Lib_IntVector_Intrinsics_vec256
+    z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    t = Lib_IntVector_Intrinsics_vec256_shift_left64(z11, (uint32_t)2U);
+    Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_add64(z11, t);
+    Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
+    Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
+    Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
+    Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
+    Lib_IntVector_Intrinsics_vec256
+    z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
+    Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
+    Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
+    Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
+    Lib_IntVector_Intrinsics_vec256
+    z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
+    Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
+    Lib_IntVector_Intrinsics_vec256 o01 = x02;
+    Lib_IntVector_Intrinsics_vec256 o12 = x12;
+    Lib_IntVector_Intrinsics_vec256 o22 = x21;
+    Lib_IntVector_Intrinsics_vec256 o32 = x32;
+    Lib_IntVector_Intrinsics_vec256 o42 = x42;
+    acc0[0U] = o01;
+    acc0[1U] = o12;
+    acc0[2U] = o22;
+    acc0[3U] = o32;
+    acc0[4U] = o42;
+    Lib_IntVector_Intrinsics_vec256 f100 = acc0[0U];
+    Lib_IntVector_Intrinsics_vec256 f11 = acc0[1U];
+    Lib_IntVector_Intrinsics_vec256 f12 = acc0[2U];
+    Lib_IntVector_Intrinsics_vec256 f13 = acc0[3U];
+    Lib_IntVector_Intrinsics_vec256 f14 = acc0[4U];
+    Lib_IntVector_Intrinsics_vec256 f20 = e[0U];
+    Lib_IntVector_Intrinsics_vec256 f21 = e[1U];
+    Lib_IntVector_Intrinsics_vec256 f22 = e[2U];
+    Lib_IntVector_Intrinsics_vec256 f23 = e[3U];
+    Lib_IntVector_Intrinsics_vec256 f24 = e[4U];
+    Lib_IntVector_Intrinsics_vec256 o0 = Lib_IntVector_Intrinsics_vec256_add64(f100, f20);
+    Lib_IntVector_Intrinsics_vec256 o1 = Lib_IntVector_Intrinsics_vec256_add64(f11, f21);
+    Lib_IntVector_Intrinsics_vec256 o2 = Lib_IntVector_Intrinsics_vec256_add64(f12, f22);
+    Lib_IntVector_Intrinsics_vec256 o3 = Lib_IntVector_Intrinsics_vec256_add64(f13, f23);
+    Lib_IntVector_Intrinsics_vec256 o4 = Lib_IntVector_Intrinsics_vec256_add64(f14, f24);
+    acc0[0U] = o0;
+    acc0[1U] = o1;
+    acc0[2U] = o2;
+    acc0[3U] = o3;
+    acc0[4U] = o4;
+}
+}
+
 static inline void
 poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t *text)
 {
@@ -43,228 +274,7 @@ poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t
     Hacl_Impl_Poly1305_Field32xN_256_load_acc4(acc0, text0);
     uint32_t len1 = len0 - bs;
     uint8_t *text1 = t00 + bs;
-    uint32_t nb = len1 / bs;
-    for (uint32_t i = (uint32_t)0U; i < nb; i++)
-    {
-      uint8_t *block = text1 + i * bs;
-      Lib_IntVector_Intrinsics_vec256 e[5U];
-      for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
-        e[_i] = Lib_IntVector_Intrinsics_vec256_zero;
-      Lib_IntVector_Intrinsics_vec256 lo = Lib_IntVector_Intrinsics_vec256_load_le(block);
-      Lib_IntVector_Intrinsics_vec256
-      hi = Lib_IntVector_Intrinsics_vec256_load_le(block + (uint32_t)32U);
-      Lib_IntVector_Intrinsics_vec256
-      mask260 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
-      Lib_IntVector_Intrinsics_vec256
-      m0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(lo, hi);
-      Lib_IntVector_Intrinsics_vec256
-      m1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(lo, hi);
-      Lib_IntVector_Intrinsics_vec256
-      m2 = Lib_IntVector_Intrinsics_vec256_shift_right(m0, (uint32_t)48U);
-      Lib_IntVector_Intrinsics_vec256
-      m3 = Lib_IntVector_Intrinsics_vec256_shift_right(m1, (uint32_t)48U);
-      Lib_IntVector_Intrinsics_vec256
-      m4 = Lib_IntVector_Intrinsics_vec256_interleave_high64(m0, m1);
-      Lib_IntVector_Intrinsics_vec256
-      t010 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m0, m1);
-      Lib_IntVector_Intrinsics_vec256
-      t30 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m2, m3);
-      Lib_IntVector_Intrinsics_vec256
-      t20 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)4U);
-      Lib_IntVector_Intrinsics_vec256 o20 = Lib_IntVector_Intrinsics_vec256_and(t20, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      t10 = Lib_IntVector_Intrinsics_vec256_shift_right64(t010, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 o10 = Lib_IntVector_Intrinsics_vec256_and(t10, mask260);
-      Lib_IntVector_Intrinsics_vec256 o5 = Lib_IntVector_Intrinsics_vec256_and(t010, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      t31 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)30U);
-      Lib_IntVector_Intrinsics_vec256 o30 = Lib_IntVector_Intrinsics_vec256_and(t31, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      o40 = Lib_IntVector_Intrinsics_vec256_shift_right64(m4, (uint32_t)40U);
-      Lib_IntVector_Intrinsics_vec256 o00 = o5;
-      Lib_IntVector_Intrinsics_vec256 o11 = o10;
-      Lib_IntVector_Intrinsics_vec256 o21 = o20;
-      Lib_IntVector_Intrinsics_vec256 o31 = o30;
-      Lib_IntVector_Intrinsics_vec256 o41 = o40;
-      e[0U] = o00;
-      e[1U] = o11;
-      e[2U] = o21;
-      e[3U] = o31;
-      e[4U] = o41;
-      uint64_t b = (uint64_t)0x1000000U;
-      Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64(b);
-      Lib_IntVector_Intrinsics_vec256 f4 = e[4U];
-      e[4U] = Lib_IntVector_Intrinsics_vec256_or(f4, mask);
-      Lib_IntVector_Intrinsics_vec256 *rn = pre0 + (uint32_t)10U;
-      Lib_IntVector_Intrinsics_vec256 *rn5 = pre0 + (uint32_t)15U;
-      Lib_IntVector_Intrinsics_vec256 r0 = rn[0U];
-      Lib_IntVector_Intrinsics_vec256 r1 = rn[1U];
-      Lib_IntVector_Intrinsics_vec256 r2 = rn[2U];
-      Lib_IntVector_Intrinsics_vec256 r3 = rn[3U];
-      Lib_IntVector_Intrinsics_vec256 r4 = rn[4U];
-      Lib_IntVector_Intrinsics_vec256 r51 = rn5[1U];
-      Lib_IntVector_Intrinsics_vec256 r52 = rn5[2U];
-      Lib_IntVector_Intrinsics_vec256 r53 = rn5[3U];
-      Lib_IntVector_Intrinsics_vec256 r54 = rn5[4U];
-      Lib_IntVector_Intrinsics_vec256 f10 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec256 f110 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec256 f120 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec256 f130 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec256 f140 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec256 a0 = Lib_IntVector_Intrinsics_vec256_mul64(r0, f10);
-      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_mul64(r1, f10);
-      Lib_IntVector_Intrinsics_vec256 a2 = Lib_IntVector_Intrinsics_vec256_mul64(r2, f10);
-      Lib_IntVector_Intrinsics_vec256 a3 = Lib_IntVector_Intrinsics_vec256_mul64(r3, f10);
-      Lib_IntVector_Intrinsics_vec256 a4 = Lib_IntVector_Intrinsics_vec256_mul64(r4, f10);
-      Lib_IntVector_Intrinsics_vec256
-      a01 =
-        Lib_IntVector_Intrinsics_vec256_add64(a0,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a11 =
-        Lib_IntVector_Intrinsics_vec256_add64(a1,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a21 =
-        Lib_IntVector_Intrinsics_vec256_add64(a2,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a31 =
-        Lib_IntVector_Intrinsics_vec256_add64(a3,
-          Lib_IntVector_Intrinsics_vec256_mul64(r2, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a41 =
-        Lib_IntVector_Intrinsics_vec256_add64(a4,
-          Lib_IntVector_Intrinsics_vec256_mul64(r3, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a02 =
-        Lib_IntVector_Intrinsics_vec256_add64(a01,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a12 =
-        Lib_IntVector_Intrinsics_vec256_add64(a11,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a22 =
-        Lib_IntVector_Intrinsics_vec256_add64(a21,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a32 =
-        Lib_IntVector_Intrinsics_vec256_add64(a31,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a42 =
-        Lib_IntVector_Intrinsics_vec256_add64(a41,
-          Lib_IntVector_Intrinsics_vec256_mul64(r2, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a03 =
-        Lib_IntVector_Intrinsics_vec256_add64(a02,
-          Lib_IntVector_Intrinsics_vec256_mul64(r52, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a13 =
-        Lib_IntVector_Intrinsics_vec256_add64(a12,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a23 =
-        Lib_IntVector_Intrinsics_vec256_add64(a22,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a33 =
-        Lib_IntVector_Intrinsics_vec256_add64(a32,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a43 =
-        Lib_IntVector_Intrinsics_vec256_add64(a42,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a04 =
-        Lib_IntVector_Intrinsics_vec256_add64(a03,
-          Lib_IntVector_Intrinsics_vec256_mul64(r51, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a14 =
-        Lib_IntVector_Intrinsics_vec256_add64(a13,
-          Lib_IntVector_Intrinsics_vec256_mul64(r52, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a24 =
-        Lib_IntVector_Intrinsics_vec256_add64(a23,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a34 =
-        Lib_IntVector_Intrinsics_vec256_add64(a33,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a44 =
-        Lib_IntVector_Intrinsics_vec256_add64(a43,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f140));
-      Lib_IntVector_Intrinsics_vec256 t01 = a04;
-      Lib_IntVector_Intrinsics_vec256 t1 = a14;
-      Lib_IntVector_Intrinsics_vec256 t2 = a24;
-      Lib_IntVector_Intrinsics_vec256 t3 = a34;
-      Lib_IntVector_Intrinsics_vec256 t4 = a44;
-      Lib_IntVector_Intrinsics_vec256
-      mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
-      Lib_IntVector_Intrinsics_vec256
-      z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t01, mask26);
-      Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
-      Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t1, z0);
-      Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
-      Lib_IntVector_Intrinsics_vec256
-      z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      t = Lib_IntVector_Intrinsics_vec256_shift_left64(z11, (uint32_t)2U);
-      Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_add64(z11, t);
-      Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
-      Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
-      Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
-      Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
-      Lib_IntVector_Intrinsics_vec256
-      z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
-      Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
-      Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
-      Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
-      Lib_IntVector_Intrinsics_vec256
-      z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
-      Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
-      Lib_IntVector_Intrinsics_vec256 o01 = x02;
-      Lib_IntVector_Intrinsics_vec256 o12 = x12;
-      Lib_IntVector_Intrinsics_vec256 o22 = x21;
-      Lib_IntVector_Intrinsics_vec256 o32 = x32;
-      Lib_IntVector_Intrinsics_vec256 o42 = x42;
-      acc0[0U] = o01;
-      acc0[1U] = o12;
-      acc0[2U] = o22;
-      acc0[3U] = o32;
-      acc0[4U] = o42;
-      Lib_IntVector_Intrinsics_vec256 f100 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec256 f11 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec256 f12 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec256 f13 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec256 f14 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec256 f20 = e[0U];
-      Lib_IntVector_Intrinsics_vec256 f21 = e[1U];
-      Lib_IntVector_Intrinsics_vec256 f22 = e[2U];
-      Lib_IntVector_Intrinsics_vec256 f23 = e[3U];
-      Lib_IntVector_Intrinsics_vec256 f24 = e[4U];
-      Lib_IntVector_Intrinsics_vec256 o0 = Lib_IntVector_Intrinsics_vec256_add64(f100, f20);
-      Lib_IntVector_Intrinsics_vec256 o1 = Lib_IntVector_Intrinsics_vec256_add64(f11, f21);
-      Lib_IntVector_Intrinsics_vec256 o2 = Lib_IntVector_Intrinsics_vec256_add64(f12, f22);
-      Lib_IntVector_Intrinsics_vec256 o3 = Lib_IntVector_Intrinsics_vec256_add64(f13, f23);
-      Lib_IntVector_Intrinsics_vec256 o4 = Lib_IntVector_Intrinsics_vec256_add64(f14, f24);
-      acc0[0U] = o0;
-      acc0[1U] = o1;
-      acc0[2U] = o2;
-      acc0[3U] = o3;
-      acc0[4U] = o4;
-    }
+    poly1305_blocks_256(ctx, len1, text1);
     Hacl_Impl_Poly1305_Field32xN_256_fmul_r4_normalize(acc0, pre0);
   }
   uint32_t len1 = n * (uint32_t)16U - len0;
@@ -907,22 +917,30 @@ poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t
 }
 
 static inline void
-poly1305_do_256(
+poly1305_chunk_256(Lib_IntVector_Intrinsics_vec256 *ctx, bool first, uint8_t *text)
+{
+  Lib_IntVector_Intrinsics_vec256 *acc0 = ctx;
+  if (first)
+  {
+    Hacl_Impl_Poly1305_Field32xN_256_load_acc4(acc0, text);
+    poly1305_blocks_256(ctx, (uint32_t)4032U, text + (uint32_t)64U);
+  }
+  else
+  {
+    poly1305_blocks_256(ctx, (uint32_t)4096U, text);
+  }
+}
+
+static inline void
+poly1305_finish_256(
+  Lib_IntVector_Intrinsics_vec256 *ctx,
   uint8_t *k,
   uint32_t aadlen,
-  uint8_t *aad,
   uint32_t mlen,
-  uint8_t *m,
   uint8_t *out
 )
 {
-  Lib_IntVector_Intrinsics_vec256 ctx[25U];
-  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
-    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
   uint8_t block[16U] = { 0U };
-  Hacl_Poly1305_256_poly1305_init(ctx, k);
-  poly1305_padded_256(ctx, aadlen, aad);
-  poly1305_padded_256(ctx, mlen, m);
   store64_le(block, (uint64_t)aadlen);
   store64_le(block + (uint32_t)8U, (uint64_t)mlen);
   Lib_IntVector_Intrinsics_vec256 *pre = ctx + (uint32_t)5U;
@@ -1147,11 +1165,41 @@ Hacl_Chacha20Poly1305_256_aead_encrypt(
   uint8_t *mac
 )
 {
-  Hacl_Chacha20_Vec256_chacha20_encrypt_256(mlen, cipher, m, k, n, (uint32_t)1U);
   uint8_t tmp[64U] = { 0U };
   Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
   uint8_t *key = tmp;
-  poly1305_do_256(key, aadlen, aad, mlen, cipher, mac);
+  Lib_IntVector_Intrinsics_vec256 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_Poly1305_256_poly1305_init(ctx, key);
+  poly1305_padded_256(ctx, aadlen, aad);
+  /* Encrypt and authenticate one 4096-byte chunk at a time, so that the
+     ciphertext is still in L1 when Poly1305 reads it back. */
+  uint32_t nc = mlen / (uint32_t)4096U;
+  uint32_t len0 = nc * (uint32_t)4096U;
+  for (uint32_t i = (uint32_t)0U; i < nc; i++)
+  {
+    uint8_t *c = cipher + i * (uint32_t)4096U;
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)4096U,
+      c,
+      m + i * (uint32_t)4096U,
+      k,
+      n,
+      (uint32_t)1U + i * (uint32_t)64U);
+    poly1305_chunk_256(ctx, i == (uint32_t)0U, c);
+  }
+  if (nc > (uint32_t)0U)
+  {
+    Hacl_Impl_Poly1305_Field32xN_256_fmul_r4_normalize(ctx, ctx + (uint32_t)5U);
+  }
+  Hacl_Chacha20_Vec256_chacha20_encrypt_256(mlen - len0,
+    cipher + len0,
+    m + len0,
+    k,
+    n,
+    (uint32_t)1U + nc * (uint32_t)64U);
+  poly1305_padded_256(ctx, mlen - len0, cipher + len0);
+  poly1305_finish_256(ctx, key, aadlen, mlen, mac);
 }
 
 uint32_t
@@ -1170,7 +1218,47 @@ Hacl_Chacha20Poly1305_256_aead_decrypt(
   uint8_t tmp[64U] = { 0U };
   Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
   uint8_t *key = tmp;
-  poly1305_do_256(key, aadlen, aad, mlen, cipher, computed_mac);
+  Lib_IntVector_Intrinsics_vec256 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_Poly1305_256_poly1305_init(ctx, key);
+  poly1305_padded_256(ctx, aadlen, aad);
+  if (m == cipher)
+  {
+    /* In place, decrypting before the tag check would destroy the ciphertext
+       of a forgery: authenticate all of it first, then decrypt. */
+    poly1305_padded_256(ctx, mlen, cipher);
+  }
+  else
+  {
+    /* Authenticate each chunk of ciphertext before decrypting it into the
+       separate plaintext buffer; on a tag mismatch the plaintext is wiped. */
+    uint32_t nc = mlen / (uint32_t)4096U;
+    uint32_t len0 = nc * (uint32_t)4096U;
+    for (uint32_t i = (uint32_t)0U; i < nc; i++)
+    {
+      uint8_t *c = cipher + i * (uint32_t)4096U;
+      poly1305_chunk_256(ctx, i == (uint32_t)0U, c);
+      Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)4096U,
+        m + i * (uint32_t)4096U,
+        c,
+        k,
+        n,
+        (uint32_t)1U + i * (uint32_t)64U);
+    }
+    if (nc > (uint32_t)0U)
+    {
+      Hacl_Impl_Poly1305_Field32xN_256_fmul_r4_normalize(ctx, ctx + (uint32_t)5U);
+    }
+    poly1305_padded_256(ctx, mlen - len0, cipher + len0);
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(mlen - len0,
+      m + len0,
+      cipher + len0,
+      k,
+      n,
+      (uint32_t)1U + nc * (uint32_t)64U);
+  }
+  poly1305_finish_256(ctx, key, aadlen, mlen, computed_mac);
   uint8_t res = (uint8_t)255U;
   for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
   {
@@ -1180,9 +1268,16 @@ Hacl_Chacha20Poly1305_256_aead_decrypt(
   uint8_t z = res;
   if (z == (uint8_t)255U)
   {
-    Hacl_Chacha20_Vec256_chacha20_encrypt_256(mlen, m, cipher, k, n, (uint32_t)1U);
+    if (m == cipher)
+    {
+      Hacl_Chacha20_Vec256_chacha20_encrypt_256(mlen, m, cipher, k, n, (uint32_t)1U);
+    }
     return (uint32_t)0U;
   }
+  if (!(m == cipher))
+  {
+    memset(m, 0U, mlen * sizeof (uint8_t));
+  }
   return (uint32_t)1U;
 }
 
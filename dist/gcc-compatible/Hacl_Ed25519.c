@@ -24,6 +24,9 @@
 
 #include "Hacl_Ed25519.h"
 
+#include "Hacl_Ed25519_PrecompTable.h"
+#include "Lib_RandomBuffer_System.h"
+
 static void fsum(uint64_t *a, uint64_t *b)
 {
   Hacl_Impl_Curve25519_Field51_fadd(a, a, b);
@@ -393,155 +396,181 @@ static void point_double(uint64_t *out, uint64_t *p)
   fmul0(z3, tmp4, tmp2);
 }
 
-static void
-swap_conditional_step(uint64_t *a_, uint64_t *b_, uint64_t *a, uint64_t *b, uint64_t swap)
+static void precomp_get_consttime(const uint64_t *table, uint64_t bits_l, uint64_t *tmp)
 {
-  uint64_t a0 = a[0U];
-  uint64_t a1 = a[1U];
-  uint64_t a2 = a[2U];
-  uint64_t a3 = a[3U];
-  uint64_t a4 = a[4U];
-  uint64_t b0 = b[0U];
-  uint64_t b1 = b[1U];
-  uint64_t b2 = b[2U];
-  uint64_t b3 = b[3U];
-  uint64_t b4 = b[4U];
-  uint64_t x0 = (a0 ^ b0) & swap;
-  uint64_t x1 = (a1 ^ b1) & swap;
-  uint64_t x2 = (a2 ^ b2) & swap;
-  uint64_t x3 = (a3 ^ b3) & swap;
-  uint64_t x4 = (a4 ^ b4) & swap;
-  a_[0U] = a0 ^ x0;
-  b_[0U] = b0 ^ x0;
-  a_[1U] = a1 ^ x1;
-  b_[1U] = b1 ^ x1;
-  a_[2U] = a2 ^ x2;
-  b_[2U] = b2 ^ x2;
-  a_[3U] = a3 ^ x3;
-  b_[3U] = b3 ^ x3;
-  a_[4U] = a4 ^ x4;
-  b_[4U] = b4 ^ x4;
+  memcpy(tmp, (uint64_t *)table, (uint32_t)20U * sizeof (uint64_t));
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)15U; i0++)
+  {
+    uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i0 + (uint32_t)1U));
+    const uint64_t *res_j = table + (i0 + (uint32_t)1U) * (uint32_t)20U;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)20U; i++)
+    {
+      uint64_t *os = tmp;
+      uint64_t x = (c & res_j[i]) | (~c & tmp[i]);
+      os[i] = x;
+    }
+  }
 }
 
-static void
-swap_conditional(uint64_t *a_, uint64_t *b_, uint64_t *a, uint64_t *b, uint64_t iswap)
-{
-  uint64_t swap = (uint64_t)0U - iswap;
-  swap_conditional_step(a_, b_, a, b, swap);
-  swap_conditional_step(a_ + (uint32_t)5U,
-    b_ + (uint32_t)5U,
-    a + (uint32_t)5U,
-    b + (uint32_t)5U,
-    swap);
-  swap_conditional_step(a_ + (uint32_t)10U,
-    b_ + (uint32_t)10U,
-    a + (uint32_t)10U,
-    b + (uint32_t)10U,
-    swap);
-  swap_conditional_step(a_ + (uint32_t)15U,
-    b_ + (uint32_t)15U,
-    a + (uint32_t)15U,
-    b + (uint32_t)15U,
-    swap);
-}
-
-static void swap_conditional_inplace(uint64_t *a, uint64_t *b, uint64_t iswap)
-{
-  uint64_t swap = (uint64_t)0U - iswap;
-  swap_conditional_step(a, b, a, b, swap);
-  swap_conditional_step(a + (uint32_t)5U,
-    b + (uint32_t)5U,
-    a + (uint32_t)5U,
-    b + (uint32_t)5U,
-    swap);
-  swap_conditional_step(a + (uint32_t)10U,
-    b + (uint32_t)10U,
-    a + (uint32_t)10U,
-    b + (uint32_t)10U,
-    swap);
-  swap_conditional_step(a + (uint32_t)15U,
-    b + (uint32_t)15U,
-    a + (uint32_t)15U,
-    b + (uint32_t)15U,
-    swap);
-}
-
-static void point_mul(uint64_t *result, uint8_t *scalar, uint64_t *q)
-{
-  uint64_t b[80U] = { 0U };
-  uint64_t *nq = b;
-  uint64_t *nqpq = b + (uint32_t)20U;
-  uint64_t *x = nq;
-  uint64_t *y = nq + (uint32_t)5U;
-  uint64_t *z = nq + (uint32_t)10U;
-  uint64_t *t = nq + (uint32_t)15U;
-  x[0U] = (uint64_t)0U;
-  x[1U] = (uint64_t)0U;
-  x[2U] = (uint64_t)0U;
-  x[3U] = (uint64_t)0U;
-  x[4U] = (uint64_t)0U;
+static void point_mul_g(uint64_t *result, uint8_t *scalar)
+{
+  uint64_t bscalar[4U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint64_t *os = bscalar;
+    uint8_t *bj = scalar + i * (uint32_t)8U;
+    uint64_t u = load64_le(bj);
+    uint64_t x = u;
+    os[i] = x;
+  }
+  uint64_t r1 = bscalar[0U];
+  uint64_t r2 = bscalar[1U];
+  uint64_t r3 = bscalar[2U];
+  uint64_t r4 = bscalar[3U];
+  uint64_t *x = result;
+  uint64_t *y = result + (uint32_t)5U;
+  uint64_t *z = result + (uint32_t)10U;
+  uint64_t *t = result + (uint32_t)15U;
+  memset(x, 0U, (uint32_t)5U * sizeof (uint64_t));
+  memset(y, 0U, (uint32_t)5U * sizeof (uint64_t));
   y[0U] = (uint64_t)1U;
-  y[1U] = (uint64_t)0U;
-  y[2U] = (uint64_t)0U;
-  y[3U] = (uint64_t)0U;
-  y[4U] = (uint64_t)0U;
+  memset(z, 0U, (uint32_t)5U * sizeof (uint64_t));
   z[0U] = (uint64_t)1U;
-  z[1U] = (uint64_t)0U;
-  z[2U] = (uint64_t)0U;
-  z[3U] = (uint64_t)0U;
-  z[4U] = (uint64_t)0U;
-  t[0U] = (uint64_t)0U;
-  t[1U] = (uint64_t)0U;
-  t[2U] = (uint64_t)0U;
-  t[3U] = (uint64_t)0U;
-  t[4U] = (uint64_t)0U;
-  memcpy(nqpq, q, (uint32_t)20U * sizeof (uint64_t));
+  memset(t, 0U, (uint32_t)5U * sizeof (uint64_t));
+  uint64_t tmp[20U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+    {
+      point_double(result, result);
+    }
+    uint32_t k = (uint32_t)64U - (uint32_t)4U * i - (uint32_t)4U;
+    uint64_t bits_l = r4 >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_Ed25519_PrecompTable_precomp_g_pow2_192_table_w4, bits_l, tmp);
+    point_add(result, result, tmp);
+    uint64_t bits_l0 = r3 >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_Ed25519_PrecompTable_precomp_g_pow2_128_table_w4, bits_l0, tmp);
+    point_add(result, result, tmp);
+    uint64_t bits_l1 = r2 >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_Ed25519_PrecompTable_precomp_g_pow2_64_table_w4, bits_l1, tmp);
+    point_add(result, result, tmp);
+    uint64_t bits_l2 = r1 >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w4, bits_l2, tmp);
+    point_add(result, result, tmp);
+  }
+}
+
+static void point_negate(uint64_t *out, uint64_t *p)
+{
+  uint64_t zero[5U] = { 0U };
+  uint64_t *x = out;
+  uint64_t *t = out + (uint32_t)15U;
+  memcpy(out, p, (uint32_t)20U * sizeof (uint64_t));
+  fdifference(x, zero);
+  fdifference(t, zero);
+}
+
+/* Signed sliding-window recoding of a 256-bit little-endian scalar: every
+   non-zero digit is odd and lies in [-15, 15], and any two non-zero digits
+   are separated by at least four zeros. Variable-time; public scalars only. */
+static void recode_slide_vartime(int8_t *r, uint8_t *a)
+{
   for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
   {
-    uint64_t *nq1 = b;
-    uint64_t *nqpq1 = b + (uint32_t)20U;
-    uint64_t *nq2 = b + (uint32_t)40U;
-    uint64_t *nqpq2 = b + (uint32_t)60U;
-    uint32_t q1 = ((uint32_t)255U - i) >> (uint32_t)3U;
-    uint32_t r = ((uint32_t)255U - i) & (uint32_t)7U;
-    uint8_t kq = scalar[q1];
-    uint8_t i1 = kq >> r & (uint8_t)1U;
-    swap_conditional_inplace(nq1, nqpq1, (uint64_t)i1);
-    point_double(nq2, nq1);
-    point_add(nqpq2, nq1, nqpq1);
-    swap_conditional(nq1, nqpq1, nq2, nqpq2, (uint64_t)i1);
+    r[i] = (int8_t)(a[i >> (uint32_t)3U] >> (i & (uint32_t)7U) & (uint8_t)1U);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+  {
+    if (r[i] != (int8_t)0)
+    {
+      for (uint32_t b = (uint32_t)1U; b <= (uint32_t)6U && i + b < (uint32_t)256U; b++)
+      {
+        if (r[i + b] != (int8_t)0)
+        {
+          int32_t rb = (int32_t)r[i + b] << b;
+          if ((int32_t)r[i] + rb <= (int32_t)15)
+          {
+            r[i] = (int8_t)((int32_t)r[i] + rb);
+            r[i + b] = (int8_t)0;
+          }
+          else if ((int32_t)r[i] - rb >= (int32_t)-15)
+          {
+            r[i] = (int8_t)((int32_t)r[i] - rb);
+            for (uint32_t k = i + b; k < (uint32_t)256U; k++)
+            {
+              if (r[k] == (int8_t)0)
+              {
+                r[k] = (int8_t)1;
+                break;
+              }
+              r[k] = (int8_t)0;
+            }
+          }
+          else
+          {
+            break;
+          }
+        }
+      }
+    }
   }
-  memcpy(result, nq, (uint32_t)20U * sizeof (uint64_t));
 }
 
-static void point_mul_g(uint64_t *result, uint8_t *scalar)
+static void point_add_digit_vartime(uint64_t *out, const uint64_t *table, int8_t d)
 {
-  uint64_t g[20U] = { 0U };
-  uint64_t *gx = g;
-  uint64_t *gy = g + (uint32_t)5U;
-  uint64_t *gz = g + (uint32_t)10U;
-  uint64_t *gt = g + (uint32_t)15U;
-  gx[0U] = (uint64_t)0x00062d608f25d51aU;
-  gx[1U] = (uint64_t)0x000412a4b4f6592aU;
-  gx[2U] = (uint64_t)0x00075b7171a4b31dU;
-  gx[3U] = (uint64_t)0x0001ff60527118feU;
-  gx[4U] = (uint64_t)0x000216936d3cd6e5U;
-  gy[0U] = (uint64_t)0x0006666666666658U;
-  gy[1U] = (uint64_t)0x0004ccccccccccccU;
-  gy[2U] = (uint64_t)0x0001999999999999U;
-  gy[3U] = (uint64_t)0x0003333333333333U;
-  gy[4U] = (uint64_t)0x0006666666666666U;
-  gz[0U] = (uint64_t)1U;
-  gz[1U] = (uint64_t)0U;
-  gz[2U] = (uint64_t)0U;
-  gz[3U] = (uint64_t)0U;
-  gz[4U] = (uint64_t)0U;
-  gt[0U] = (uint64_t)0x00068ab3a5b7dda3U;
-  gt[1U] = (uint64_t)0x00000eea2a5eadbbU;
-  gt[2U] = (uint64_t)0x0002af8df483c27eU;
-  gt[3U] = (uint64_t)0x000332b375274732U;
-  gt[4U] = (uint64_t)0x00067875f0fd78b7U;
-  point_mul(result, scalar, g);
+  uint64_t tmp[20U] = { 0U };
+  if (d > (int8_t)0)
+  {
+    memcpy(tmp, (uint64_t *)table + (uint32_t)d * (uint32_t)20U, (uint32_t)20U * sizeof (uint64_t));
+    point_add(out, out, tmp);
+  }
+  else if (d < (int8_t)0)
+  {
+    point_negate(tmp, (uint64_t *)table + (uint32_t)-d * (uint32_t)20U);
+    point_add(out, out, tmp);
+  }
+}
+
+/* out = [s]G + [h]q, computed with a joint sliding window over both scalars
+   so that the 253 doublings are shared. The G half reads the odd entries of
+   the fixed-base table; the q half uses a table built on the fly. This is
+   variable-time and only meant for verification, where s, h and q are
+   public. */
+static void point_mul_g_double_vartime(uint64_t *out, uint8_t *s, uint8_t *h, uint64_t *q)
+{
+  int8_t sslide[256U] = { 0 };
+  int8_t hslide[256U] = { 0 };
+  recode_slide_vartime(sslide, s);
+  recode_slide_vartime(hslide, h);
+  /* table_q[i] = [i]q for odd i in [1, 15]; even entries are unused */
+  uint64_t table_q[320U] = { 0U };
+  uint64_t q2[20U] = { 0U };
+  memcpy(table_q + (uint32_t)20U, q, (uint32_t)20U * sizeof (uint64_t));
+  point_double(q2, q);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    point_add(table_q + ((uint32_t)2U * i + (uint32_t)1U) * (uint32_t)20U,
+      table_q + ((uint32_t)2U * i - (uint32_t)1U) * (uint32_t)20U,
+      q2);
+  }
+  uint64_t *y = out + (uint32_t)5U;
+  uint64_t *z = out + (uint32_t)10U;
+  memset(out, 0U, (uint32_t)20U * sizeof (uint64_t));
+  y[0U] = (uint64_t)1U;
+  z[0U] = (uint64_t)1U;
+  uint32_t top = (uint32_t)256U;
+  while (top > (uint32_t)0U && sslide[top - (uint32_t)1U] == (int8_t)0
+    && hslide[top - (uint32_t)1U] == (int8_t)0)
+  {
+    top--;
+  }
+  for (uint32_t i = top; i > (uint32_t)0U; i--)
+  {
+    uint32_t j = i - (uint32_t)1U;
+    point_double(out, out);
+    point_add_digit_vartime(out, Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w4, sslide[j]);
+    point_add_digit_vartime(out, table_q, hslide[j]);
+  }
 }
 
 static void point_compress(uint8_t *z, uint64_t *p)
@@ -2059,14 +2088,12 @@ bool Hacl_Ed25519_verify(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *sign
         sha512_modq_pre_pre2(r_2, rs1, pub, len, msg);
         store_56(tmp_, r_2);
         uint8_t *uu____0 = signature + (uint32_t)32U;
-        uint64_t tmp1[60U] = { 0U };
-        uint64_t *hA = tmp1;
-        uint64_t *rhA = tmp1 + (uint32_t)20U;
-        uint64_t *sB = tmp1 + (uint32_t)40U;
-        point_mul_g(sB, uu____0);
-        point_mul(hA, tmp_, a_1);
-        point_add(rhA, r_1, hA);
-        bool b1 = point_equal(sB, rhA);
+        uint64_t tmp1[40U] = { 0U };
+        uint64_t *negA = tmp1;
+        uint64_t *sBmhA = tmp1 + (uint32_t)20U;
+        point_negate(negA, a_1);
+        point_mul_g_double_vartime(sBmhA, uu____0, tmp_, negA);
+        bool b1 = point_equal(r_1, sBmhA);
         bool b10 = b1;
         res = b10;
       }
@@ -2084,6 +2111,319 @@ bool Hacl_Ed25519_verify(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *sign
   return res0;
 }
 
+static uint32_t multi_mul_window_bits(uint32_t m)
+{
+  if (m < (uint32_t)32U)
+  {
+    return (uint32_t)4U;
+  }
+  if (m < (uint32_t)128U)
+  {
+    return (uint32_t)5U;
+  }
+  if (m < (uint32_t)512U)
+  {
+    return (uint32_t)6U;
+  }
+  if (m < (uint32_t)2048U)
+  {
+    return (uint32_t)7U;
+  }
+  return (uint32_t)8U;
+}
+
+/* out = sum of [scalars_j]points_j for j < m (Pippenger's bucket method with
+   signed digits). Scalars are 32-byte little-endian values below 2^253.
+   Variable-time; public inputs only. */
+static void
+point_multi_mul_vartime(uint64_t *out, uint32_t m, uint64_t *points, uint8_t *scalars)
+{
+  uint32_t c = multi_mul_window_bits(m);
+  uint32_t nwin = ((uint32_t)253U + c - (uint32_t)1U) / c + (uint32_t)1U;
+  uint32_t nbuckets = (uint32_t)1U << (c - (uint32_t)1U);
+  KRML_CHECK_SIZE(sizeof (int16_t), (uint64_t)m * (uint64_t)nwin);
+  int16_t *digits = KRML_HOST_CALLOC(m * nwin, sizeof (int16_t));
+  uint64_t *buckets = KRML_HOST_CALLOC(nbuckets * (uint32_t)20U, sizeof (uint64_t));
+  bool *used = KRML_HOST_CALLOC(nbuckets, sizeof (bool));
+  for (uint32_t j = (uint32_t)0U; j < m; j++)
+  {
+    uint64_t l[5U] = { 0U };
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      l[i] = load64_le(scalars + j * (uint32_t)32U + i * (uint32_t)8U);
+    }
+    int32_t carry = (int32_t)0;
+    for (uint32_t w = (uint32_t)0U; w < nwin; w++)
+    {
+      uint32_t pos = w * c;
+      uint32_t q = pos >> (uint32_t)6U;
+      uint32_t r = pos & (uint32_t)63U;
+      uint64_t bits = l[q] >> r;
+      if (r + c > (uint32_t)64U)
+      {
+        bits = bits | l[q + (uint32_t)1U] << ((uint32_t)64U - r);
+      }
+      bits = bits & (((uint64_t)1U << c) - (uint64_t)1U);
+      int32_t d = (int32_t)bits + carry;
+      if (d > (int32_t)nbuckets)
+      {
+        d = d - ((int32_t)1 << c);
+        carry = (int32_t)1;
+      }
+      else
+      {
+        carry = (int32_t)0;
+      }
+      digits[j * nwin + w] = (int16_t)d;
+    }
+  }
+  uint64_t *y = out + (uint32_t)5U;
+  uint64_t *z = out + (uint32_t)10U;
+  memset(out, 0U, (uint32_t)20U * sizeof (uint64_t));
+  y[0U] = (uint64_t)1U;
+  z[0U] = (uint64_t)1U;
+  uint64_t tmp[20U] = { 0U };
+  uint64_t running[20U] = { 0U };
+  uint64_t sum[20U] = { 0U };
+  for (uint32_t w = nwin; w > (uint32_t)0U; w--)
+  {
+    uint32_t wi = w - (uint32_t)1U;
+    if (w != nwin)
+    {
+      for (uint32_t i = (uint32_t)0U; i < c; i++)
+      {
+        point_double(out, out);
+      }
+    }
+    memset(used, 0U, nbuckets * sizeof (bool));
+    for (uint32_t j = (uint32_t)0U; j < m; j++)
+    {
+      int32_t d = (int32_t)digits[j * nwin + wi];
+      if (d != (int32_t)0)
+      {
+        uint64_t *p = points + j * (uint32_t)20U;
+        uint32_t b;
+        if (d > (int32_t)0)
+        {
+          b = (uint32_t)d - (uint32_t)1U;
+          memcpy(tmp, p, (uint32_t)20U * sizeof (uint64_t));
+        }
+        else
+        {
+          b = (uint32_t)-d - (uint32_t)1U;
+          point_negate(tmp, p);
+        }
+        uint64_t *bucket = buckets + b * (uint32_t)20U;
+        if (used[b])
+        {
+          point_add(bucket, bucket, tmp);
+        }
+        else
+        {
+          memcpy(bucket, tmp, (uint32_t)20U * sizeof (uint64_t));
+          used[b] = true;
+        }
+      }
+    }
+    bool running_used = false;
+    bool sum_used = false;
+    for (uint32_t b = nbuckets; b > (uint32_t)0U; b--)
+    {
+      uint64_t *bucket = buckets + (b - (uint32_t)1U) * (uint32_t)20U;
+      if (used[b - (uint32_t)1U])
+      {
+        if (running_used)
+        {
+          point_add(running, running, bucket);
+        }
+        else
+        {
+          memcpy(running, bucket, (uint32_t)20U * sizeof (uint64_t));
+          running_used = true;
+        }
+      }
+      if (running_used)
+      {
+        if (sum_used)
+        {
+          point_add(sum, sum, running);
+        }
+        else
+        {
+          memcpy(sum, running, (uint32_t)20U * sizeof (uint64_t));
+          sum_used = true;
+        }
+      }
+    }
+    if (sum_used)
+    {
+      point_add(out, out, sum);
+    }
+  }
+  KRML_HOST_FREE(used);
+  KRML_HOST_FREE(buckets);
+  KRML_HOST_FREE(digits);
+}
+
+/* The cofactored counterpart of Hacl_Ed25519_verify, used by verify_batch for
+   the signatures it checks one at a time: [8]([s]B - [h]A - R) is the
+   identity. The caller has checked that A and R decompress and that s < q. */
+static bool
+verify_cofactored(
+  uint64_t *a_,
+  uint64_t *r_,
+  uint8_t *pub,
+  uint32_t len,
+  uint8_t *msg,
+  uint8_t *signature
+)
+{
+  uint64_t hq[5U] = { 0U };
+  uint8_t h[32U] = { 0U };
+  uint64_t tmp[60U] = { 0U };
+  uint64_t *negA = tmp;
+  uint64_t *sBmhA = tmp + (uint32_t)20U;
+  uint64_t *id = tmp + (uint32_t)40U;
+  sha512_modq_pre_pre2(hq, signature, pub, len, msg);
+  store_56(h, hq);
+  point_negate(negA, a_);
+  point_mul_g_double_vartime(sBmhA, signature + (uint32_t)32U, h, negA);
+  point_negate(negA, r_);
+  point_add(sBmhA, sBmhA, negA);
+  point_double(sBmhA, sBmhA);
+  point_double(sBmhA, sBmhA);
+  point_double(sBmhA, sBmhA);
+  id[5U] = (uint64_t)1U;
+  id[10U] = (uint64_t)1U;
+  return point_equal(sBmhA, id);
+}
+
+/* Checks that [8]([sum z_i s_i]B - sum [z_i]R_i - sum [z_i h_i]A_i) is the
+   identity for fresh random 128-bit z_i, with a single multi-scalar
+   multiplication. Signatures whose A or R fails to decompress, or whose s is
+   not below q, are rejected upfront. If the combined check fails, or the
+   system RNG is unavailable, the remaining signatures are checked one by one
+   with the same cofactored equation, so that the outcome for a signature does
+   not depend on the rest of the batch. */
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t **pub,
+  uint32_t *len,
+  uint8_t **msg,
+  uint8_t **signature,
+  bool *res
+)
+{
+  if (n == (uint32_t)0U)
+  {
+    return true;
+  }
+  /* Larger batches are split, which keeps every size below 2^32. */
+  if (n > (uint32_t)0x100000U)
+  {
+    uint32_t n0 = (uint32_t)0x100000U;
+    bool r0 = Hacl_Ed25519_verify_batch(n0, pub, len, msg, signature, res);
+    bool
+    r1 =
+      Hacl_Ed25519_verify_batch(n - n0,
+        pub + n0,
+        len + n0,
+        msg + n0,
+        signature + n0,
+        res + n0);
+    return r0 && r1;
+  }
+  uint32_t m = (uint32_t)2U * n + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), (uint64_t)m * (uint64_t)20U);
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint64_t)m * (uint64_t)32U);
+  uint64_t *points = KRML_HOST_CALLOC(m * (uint32_t)20U, sizeof (uint64_t));
+  uint8_t *scalars = KRML_HOST_CALLOC(m * (uint32_t)32U, sizeof (uint8_t));
+  uint8_t *zs = KRML_HOST_CALLOC(n * (uint32_t)16U, sizeof (uint8_t));
+  uint32_t *idx = KRML_HOST_CALLOC(n, sizeof (uint32_t));
+  bool rnd_ok = Lib_RandomBuffer_System_randombytes(zs, n * (uint32_t)16U);
+  uint64_t sacc[5U] = { 0U };
+  uint32_t k = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint64_t tmp[40U] = { 0U };
+    uint64_t *a_ = tmp;
+    uint64_t *r_ = tmp + (uint32_t)20U;
+    uint64_t sq[5U] = { 0U };
+    res[i] = false;
+    if (!point_decompress(a_, pub[i]) || !point_decompress(r_, signature[i]))
+    {
+      continue;
+    }
+    load_32_bytes(sq, signature[i] + (uint32_t)32U);
+    if (gte_q(sq))
+    {
+      continue;
+    }
+    uint64_t hq[5U] = { 0U };
+    uint64_t zq[5U] = { 0U };
+    uint64_t zh[5U] = { 0U };
+    uint64_t zsq[5U] = { 0U };
+    uint8_t *zb = scalars + ((uint32_t)2U * k + (uint32_t)1U) * (uint32_t)32U;
+    memcpy(zb, zs + i * (uint32_t)16U, (uint32_t)16U * sizeof (uint8_t));
+    zb[0U] = zb[0U] | (uint8_t)1U;
+    load_32_bytes(zq, zb);
+    sha512_modq_pre_pre2(hq, signature[i], pub[i], len[i], msg[i]);
+    mul_modq(zh, zq, hq);
+    mul_modq(zsq, zq, sq);
+    add_modq(sacc, sacc, zsq);
+    store_56(scalars + ((uint32_t)2U * k + (uint32_t)2U) * (uint32_t)32U, zh);
+    point_negate(points + ((uint32_t)2U * k + (uint32_t)1U) * (uint32_t)20U, r_);
+    point_negate(points + ((uint32_t)2U * k + (uint32_t)2U) * (uint32_t)20U, a_);
+    idx[k] = i;
+    k++;
+  }
+  bool batch_ok = false;
+  if (rnd_ok && k > (uint32_t)0U)
+  {
+    uint64_t sum[20U] = { 0U };
+    uint64_t id[20U] = { 0U };
+    memcpy(points,
+      (uint64_t *)Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w4 + (uint32_t)20U,
+      (uint32_t)20U * sizeof (uint64_t));
+    store_56(scalars, sacc);
+    point_multi_mul_vartime(sum, (uint32_t)2U * k + (uint32_t)1U, points, scalars);
+    point_double(sum, sum);
+    point_double(sum, sum);
+    point_double(sum, sum);
+    id[5U] = (uint64_t)1U;
+    id[10U] = (uint64_t)1U;
+    batch_ok = point_equal(sum, id);
+  }
+  for (uint32_t j = (uint32_t)0U; j < k; j++)
+  {
+    uint32_t i = idx[j];
+    if (batch_ok)
+    {
+      res[i] = true;
+    }
+    else
+    {
+      uint64_t tmp[40U] = { 0U };
+      uint64_t *a_ = tmp;
+      uint64_t *r_ = tmp + (uint32_t)20U;
+      bool b = point_decompress(a_, pub[i]);
+      bool b_ = point_decompress(r_, signature[i]);
+      res[i] = b && b_ && verify_cofactored(a_, r_, pub[i], len[i], msg[i], signature[i]);
+    }
+  }
+  KRML_HOST_FREE(idx);
+  KRML_HOST_FREE(zs);
+  KRML_HOST_FREE(scalars);
+  KRML_HOST_FREE(points);
+  bool all = true;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    all = all && res[i];
+  }
+  return all;
+}
+
 void Hacl_Ed25519_secret_to_public(uint8_t *pub, uint8_t *priv)
 {
   secret_to_public(pub, priv);
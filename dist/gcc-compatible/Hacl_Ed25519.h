@@ -45,6 +45,24 @@ void Hacl_Ed25519_sign(uint8_t *signature, uint8_t *priv, uint32_t len, uint8_t
 
 bool Hacl_Ed25519_verify(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *signature);
 
+/* Verifies n independent signatures; res[i] receives the outcome for
+   (pub[i], len[i], msg[i], signature[i]) and the return value is true iff all
+   of them are valid. Every signature is judged by the cofactored verification
+   equation [8][s]B = [8]R + [8][h]A, which RFC 8032 also allows, whether it
+   is checked as part of the batch or on its own; res[i] therefore depends only
+   on the i-th signature. For honestly generated keys and signatures this
+   agrees with Hacl_Ed25519_verify; signatures with a small-order component
+   may be accepted here and rejected there. */
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t **pub,
+  uint32_t *len,
+  uint8_t **msg,
+  uint8_t **signature,
+  bool *res
+);
+
 void Hacl_Ed25519_secret_to_public(uint8_t *pub, uint8_t *priv);
 
 void Hacl_Ed25519_expand_keys(uint8_t *ks, uint8_t *priv);
@@ -0,0 +1,447 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Ed25519_PrecompTable_H
+#define __Hacl_Ed25519_PrecompTable_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+
+
+/* [i]P for i = 0..15, P = G, in extended coordinates (X, Y, Z = 1, T = XY) */
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_basepoint_table_w4[320U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0x62d608f25d51aU, (uint64_t)0x412a4b4f6592aU,
+    (uint64_t)0x75b7171a4b31dU, (uint64_t)0x1ff60527118feU, (uint64_t)0x216936d3cd6e5U,
+    (uint64_t)0x6666666666658U, (uint64_t)0x4ccccccccccccU, (uint64_t)0x1999999999999U,
+    (uint64_t)0x3333333333333U, (uint64_t)0x6666666666666U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0x68ab3a5b7dda3U, (uint64_t)0xeea2a5eadbbU,
+    (uint64_t)0x2af8df483c27eU, (uint64_t)0x332b375274732U, (uint64_t)0x67875f0fd78b7U,
+    (uint64_t)0x5a14e2843ce0eU, (uint64_t)0xa2baf48bf078U, (uint64_t)0xcf9eb0203639U,
+    (uint64_t)0x2361e821dbe8cU, (uint64_t)0x36ab384c9f5a0U, (uint64_t)0x746ae6af8a3c9U,
+    (uint64_t)0x22c870a2ac1cbU, (uint64_t)0x6887d5a5ce43dU, (uint64_t)0x4e10ed12f7464U,
+    (uint64_t)0x2260cdf309232U, (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0x23f556d69b401U, (uint64_t)0x1383ee48056e3U,
+    (uint64_t)0x40ed04d75e6b3U, (uint64_t)0x46e0ef2af8439U, (uint64_t)0x2498a7850b2f6U,
+    (uint64_t)0x2485fd3f8e25cU, (uint64_t)0x3302c4910d58cU, (uint64_t)0x36b20e98d0e60U,
+    (uint64_t)0x7a48ffa573a1fU, (uint64_t)0x67ae9c4a22928U, (uint64_t)0x3684878f5b4d4U,
+    (uint64_t)0x2ece480608058U, (uint64_t)0x9a7bde7c5bb0U, (uint64_t)0x4d5d09350c730U,
+    (uint64_t)0x1267b1d177ee6U, (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0x108fa78b3a41aU, (uint64_t)0x17f62df8959bfU,
+    (uint64_t)0x6e4549d709cd6U, (uint64_t)0x28875f79bc1d6U, (uint64_t)0x2a4d025cb1dd9U,
+    (uint64_t)0x2a657c4c9f870U, (uint64_t)0x3279c2a8e927U, (uint64_t)0xd483e469ce7bU,
+    (uint64_t)0xa34192ea5c3dU, (uint64_t)0x203da8db56cffU, (uint64_t)0xab61ca32112fU,
+    (uint64_t)0x65d45e1fe1be7U, (uint64_t)0x355c5b133c8a0U, (uint64_t)0x2f0a3875c42c0U,
+    (uint64_t)0x47d0e827cb159U, (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0x722f6728a1358U, (uint64_t)0x3d6dba0f94bf1U,
+    (uint64_t)0x1f0a581c6578cU, (uint64_t)0x306390a5d3563U, (uint64_t)0x22783cd8d8732U,
+    (uint64_t)0x9cc0322ef233U, (uint64_t)0x727c37c34b228U, (uint64_t)0x4b6977970a067U,
+    (uint64_t)0x43dfe77be7be8U, (uint64_t)0x49fda73eade35U, (uint64_t)0x21f83d676c8edU,
+    (uint64_t)0x15128616ba21aU, (uint64_t)0x6491998c4a0bbU, (uint64_t)0x737f016370a44U,
+    (uint64_t)0x5f4825b298feaU, (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0x150bcf3e801d0U, (uint64_t)0xa00124d7ec83U, (uint64_t)0x4db1fe6bee53aU,
+    (uint64_t)0x6a618b0752843U, (uint64_t)0x745c562c9c593U, (uint64_t)0x2741a7dcbf23dU,
+    (uint64_t)0x4d8f6884ef07U, (uint64_t)0x428a6fa879666U, (uint64_t)0xe315756606eU,
+    (uint64_t)0x4c9797ba7a456U, (uint64_t)0x27ad0f9497ef4U, (uint64_t)0xd289ad6c183aU,
+    (uint64_t)0x53df5dfe505f0U, (uint64_t)0x4508edb84d3feU, (uint64_t)0x54de3fc2886dU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x6d6c8b44ef1d2U, (uint64_t)0x28f8fb91378f9U, (uint64_t)0x79f73102ebe48U,
+    (uint64_t)0x27c142ad4ca7U, (uint64_t)0x3c32efd109aa6U, (uint64_t)0x5981af50e4107U,
+    (uint64_t)0x6777e39d2ab0aU, (uint64_t)0x476041e0fa027U, (uint64_t)0x6a774f1f70ca5U,
+    (uint64_t)0x14568685fcf4bU, (uint64_t)0x4c4b59f4062b8U, (uint64_t)0xdef57e47a258U,
+    (uint64_t)0x4dab507c220adU, (uint64_t)0x297c3e732346eU, (uint64_t)0x31c563e32b47dU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x545565587ed1bU, (uint64_t)0x543d3549c8217U, (uint64_t)0x756ead14a518cU,
+    (uint64_t)0x70dcdf416e2c4U, (uint64_t)0x119e77b11d165U, (uint64_t)0x7fdbc08a584c8U,
+    (uint64_t)0x7700d31732770U, (uint64_t)0x13b3e4faceb19U, (uint64_t)0xdb214316ae7cU,
+    (uint64_t)0x6742e15f97d77U, (uint64_t)0x75ba9fc37b9b4U, (uint64_t)0x78c43dc9263c5U,
+    (uint64_t)0x22bce3e05e0f3U, (uint64_t)0x1bcb756b784b3U, (uint64_t)0x21d30600c9e57U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x6f41ad41a51bfU, (uint64_t)0x5a689857eadf7U, (uint64_t)0x2cf664d17c339U,
+    (uint64_t)0x5708b04614d9cU, (uint64_t)0x2c4f59ecedf7eU, (uint64_t)0x23065185715cU,
+    (uint64_t)0x385c9c0529a7cU, (uint64_t)0x6508ae21b6039U, (uint64_t)0xb28df99b7037U,
+    (uint64_t)0x357cc970c8007U, (uint64_t)0x644845522f1c0U, (uint64_t)0x2646dc88618e9U,
+    (uint64_t)0x3cb4bf47de240U, (uint64_t)0x6fa595f7e74abU, (uint64_t)0x7f3d23c2c2dd0U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x3386f88b2f465U, (uint64_t)0x41eee064fcb87U, (uint64_t)0x51f35d05ecf52U,
+    (uint64_t)0x5fcedb33b56fbU, (uint64_t)0x5c70fc48ea87cU, (uint64_t)0x51f224877f94fU,
+    (uint64_t)0x1db06df028892U, (uint64_t)0x2f219dc81fa39U, (uint64_t)0x6baa2385b0769U,
+    (uint64_t)0x602c797e30ca6U, (uint64_t)0x74b06ae87b2cU, (uint64_t)0xa7bc1d087751U,
+    (uint64_t)0x262ff3c95da9aU, (uint64_t)0x23be47226aa64U, (uint64_t)0x637ffcaa7a1b2U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x74c95035bc63eU, (uint64_t)0x6967724a4a87cU, (uint64_t)0x6d15dfdd3d6a7U,
+    (uint64_t)0x149445fe88184U, (uint64_t)0x36e05f3266735U, (uint64_t)0x7d2c1207cf3cbU,
+    (uint64_t)0x658b27aaa5fe5U, (uint64_t)0x1c490e34e0696U, (uint64_t)0x20bdb6783c6ebU,
+    (uint64_t)0x14e528b1154beU, (uint64_t)0x72dc36a033713U, (uint64_t)0x387938b1a8611U,
+    (uint64_t)0x3fc3f38496164U, (uint64_t)0x5cbad37be71a0U, (uint64_t)0x2d9082313f21aU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x5cf2edb5beed4U, (uint64_t)0x3bc31f906fd70U, (uint64_t)0x5ab6fd640007U,
+    (uint64_t)0x4511ce5535f79U, (uint64_t)0x5ae6a565800f2U, (uint64_t)0x2fe6678f0902dU,
+    (uint64_t)0x470b8276855ccU, (uint64_t)0x289276cca56fcU, (uint64_t)0x69aaf67b87006U,
+    (uint64_t)0x4719e17e016e5U, (uint64_t)0x281dc2e2de4f9U, (uint64_t)0x68a4e72cce67aU,
+    (uint64_t)0x5e096e15921faU, (uint64_t)0x11738eb62731U, (uint64_t)0x4070ce608bce8U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x4c3128e4b1ccbU, (uint64_t)0x918b62757abdU, (uint64_t)0x73401bc3c7bc3U,
+    (uint64_t)0x4509033e9d418U, (uint64_t)0x2b344e203a485U, (uint64_t)0xe073b7c05fedU,
+    (uint64_t)0x511a456f706f0U, (uint64_t)0xb4c13e210f8fU, (uint64_t)0x3666d99d6f814U,
+    (uint64_t)0x107427e0d5f36U, (uint64_t)0x7e1aeea401f80U, (uint64_t)0x6451344e470fdU,
+    (uint64_t)0x36a26e0dd033eU, (uint64_t)0x5ba3c23301169U, (uint64_t)0x12dbb00ded538U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x4dccde8de2f53U, (uint64_t)0x23d65d1df8a45U, (uint64_t)0x5588ce16c52a9U,
+    (uint64_t)0x23062e06eb0e6U, (uint64_t)0x412806b917be6U, (uint64_t)0x67353b58515b9U,
+    (uint64_t)0x307c730655471U, (uint64_t)0x32aec57637b9bU, (uint64_t)0x55782463d44aeU,
+    (uint64_t)0x205f3b42f5884U, (uint64_t)0x1fd98899c2839U, (uint64_t)0x50336c4cb906dU,
+    (uint64_t)0x6dc0afe9d2263U, (uint64_t)0x5c08add68bd65U, (uint64_t)0x4e50256f50c4cU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x33d2ca271c2e0U, (uint64_t)0x7fccc88bc1122U, (uint64_t)0x2ff91e5c79d0dU,
+    (uint64_t)0x707c753055f9eU, (uint64_t)0x66432d1463a87U, (uint64_t)0x17f3e66a18dc1U,
+    (uint64_t)0x68ee03139720cU, (uint64_t)0x481067b658c4dU, (uint64_t)0x21aee2d637caeU,
+    (uint64_t)0x4f162deaec2ecU, (uint64_t)0x54cc4ad2e5cdfU, (uint64_t)0x314335354328dU,
+    (uint64_t)0x34a4cc6b396bcU, (uint64_t)0x17aa8b17b80b2U, (uint64_t)0x12cbfb2d04ff2U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x57f335c92bf29U, (uint64_t)0x1fc815cbea281U, (uint64_t)0x5d8378be98edaU,
+    (uint64_t)0x248d5927e9120U, (uint64_t)0x5e33f00e36b77U
+  };
+
+/* [i]P for i = 0..15, P = [2^64]G, in extended coordinates (X, Y, Z = 1, T = XY) */
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_g_pow2_64_table_w4[320U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0x36b8ff4eda202U, (uint64_t)0x7daa346bd67c1U,
+    (uint64_t)0x2822a5801e36dU, (uint64_t)0x4eaea25b067daU, (uint64_t)0x6222bd88bf2dfU,
+    (uint64_t)0x6fa5782e45313U, (uint64_t)0x117520560d1e3U, (uint64_t)0x6df13d5042d8U,
+    (uint64_t)0x12eeb5ed7693U, (uint64_t)0x325bb42ea4edU, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0x592e9b6740859U,
+    (uint64_t)0x1d39897f0c5bfU, (uint64_t)0x251580ec2af8U, (uint64_t)0x70563ccc07320U,
+    (uint64_t)0x628b09e2c7d3aU, (uint64_t)0x2aa2d8bdba597U, (uint64_t)0x337727e412228U,
+    (uint64_t)0x682a0453a101bU, (uint64_t)0x262572fd31592U, (uint64_t)0x23bc7abc84cbU,
+    (uint64_t)0x511df0f29c9eeU, (uint64_t)0x1e58c41b9ddb0U, (uint64_t)0x5c81ba413e52eU,
+    (uint64_t)0x58a64a8101b8eU, (uint64_t)0x4d2b97a739eceU, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0x320ab2c14539aU,
+    (uint64_t)0x137b00f01661fU, (uint64_t)0x5b6edcf358ad2U, (uint64_t)0x4243cb28d0446U,
+    (uint64_t)0x2be24dbdd7a46U, (uint64_t)0x7640e33263467U, (uint64_t)0x4d99d421b1000U,
+    (uint64_t)0x229877cb2a32aU, (uint64_t)0x20e2cd45a4e5U, (uint64_t)0x132a065edb5c4U,
+    (uint64_t)0x5fa3e1dd7de2fU, (uint64_t)0x3863fd1d4b30cU, (uint64_t)0x7973f46ce42c3U,
+    (uint64_t)0x3c03b16b5bdc2U, (uint64_t)0x534ef70a3532fU, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0x25b0e72ecf407U,
+    (uint64_t)0x5e9b86d31f29eU, (uint64_t)0x717e3d7ee0972U, (uint64_t)0x2d2ea94ab733aU,
+    (uint64_t)0x13de9f98824e0U, (uint64_t)0x633fbbd39d169U, (uint64_t)0x2de1deb9e1897U,
+    (uint64_t)0x1cb211e5ff1a1U, (uint64_t)0x252cc055229dbU, (uint64_t)0x6d5066cf7137bU,
+    (uint64_t)0x347115219a417U, (uint64_t)0x68445d52b6b96U, (uint64_t)0x2e0615fe54802U,
+    (uint64_t)0x3e441d5f1ad5fU, (uint64_t)0x54bb8cd82a0a8U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0xead868ab7c70U, (uint64_t)0x37519f2944719U,
+    (uint64_t)0x239bc7c2a540bU, (uint64_t)0x7330e4f203f15U, (uint64_t)0x609142e130e7fU,
+    (uint64_t)0x2429c7b04c2cdU, (uint64_t)0x1f7334164ea0eU, (uint64_t)0x2e82a3d8f00c4U,
+    (uint64_t)0x49a3fac10ad3aU, (uint64_t)0x35ff8f7cdb086U, (uint64_t)0x49cbaa6ce8b8aU,
+    (uint64_t)0x2fbfc351521f8U, (uint64_t)0x6ed81ad386d5cU, (uint64_t)0x782aa34f434a9U,
+    (uint64_t)0x50e1cc6871155U, (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0x289b38c30e3d7U, (uint64_t)0xa98bfd31710bU, (uint64_t)0x6dec6dcfff0edU,
+    (uint64_t)0x4a8cc50bd6ec3U, (uint64_t)0x330c0a7ed1b12U, (uint64_t)0x2120a622e0213U,
+    (uint64_t)0x4928e70b4255eU, (uint64_t)0x20ca395004af1U, (uint64_t)0x137b5a74383cdU,
+    (uint64_t)0x6c6365c17f4bbU, (uint64_t)0x1499e5494c782U, (uint64_t)0x54c171a7d6061U,
+    (uint64_t)0x2a7b2382370ccU, (uint64_t)0x4b4641905002bU, (uint64_t)0x1c5703a9d3d1aU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x2125c8b8f0450U, (uint64_t)0x68a693333f97eU, (uint64_t)0x4db1dc8b06120U,
+    (uint64_t)0x1547ff45b5efeU, (uint64_t)0x397f5db80e233U, (uint64_t)0x44c675bd887d1U,
+    (uint64_t)0x309183c31e772U, (uint64_t)0x1f3aa0d1e7794U, (uint64_t)0x2965c1800a0dfU,
+    (uint64_t)0x68b818a50b31dU, (uint64_t)0xe4dfed398826U, (uint64_t)0x2a6b5bb8ee8e5U,
+    (uint64_t)0x5b63d0e5a1659U, (uint64_t)0x35914773a6ba9U, (uint64_t)0x1e8b233ec0076U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x795099c995b42U, (uint64_t)0x350ab19851e94U, (uint64_t)0x4657c36d323bfU,
+    (uint64_t)0x14e89c4af4304U, (uint64_t)0x76724d74dba8eU, (uint64_t)0x3e8be859362a9U,
+    (uint64_t)0x285b6b601c94eU, (uint64_t)0x277aacb4ea942U, (uint64_t)0x6a71a039dbb31U,
+    (uint64_t)0x6b66159ac8702U, (uint64_t)0x61a22c8ca96c5U, (uint64_t)0x644c063cebfdU,
+    (uint64_t)0x110cae7398c22U, (uint64_t)0x282724d9d2eacU, (uint64_t)0x19dd4bef38efdU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x356e7c4fdc3U, (uint64_t)0x6cce9df96746aU, (uint64_t)0x231226afcf26fU,
+    (uint64_t)0xe6a709a55008U, (uint64_t)0x667fbacce0dc3U, (uint64_t)0x50334a9d159aU,
+    (uint64_t)0x5ce33ce0e9334U, (uint64_t)0x334c4d2f28074U, (uint64_t)0x352820028e76fU,
+    (uint64_t)0x1d3b69c19baa7U, (uint64_t)0x7fbf1373fd0b9U, (uint64_t)0x7c4663d51a8e7U,
+    (uint64_t)0x3b378c1ccc439U, (uint64_t)0x281e507cf1be7U, (uint64_t)0x68d73077fa5e3U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x375c055e14773U, (uint64_t)0x5bff2ad6e8f26U, (uint64_t)0x1d069a22c054fU,
+    (uint64_t)0x7b510676d36c9U, (uint64_t)0x492034611c74U, (uint64_t)0x2e27609a42401U,
+    (uint64_t)0x2309b257e2d42U, (uint64_t)0x3da7c8d0cb2c7U, (uint64_t)0x67eb1a5a486fbU,
+    (uint64_t)0x1a12237794fd0U, (uint64_t)0x684b7d2ba4f29U, (uint64_t)0x23e115d6e7ea6U,
+    (uint64_t)0x55638174762b3U, (uint64_t)0x7797572f6eab2U, (uint64_t)0x1d079c642f577U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x536d1e398a5ddU, (uint64_t)0x4b74cc9f3766aU, (uint64_t)0x578e721630175U,
+    (uint64_t)0x18a9e40238fadU, (uint64_t)0x533594b8b7e22U, (uint64_t)0x673b0f96c0677U,
+    (uint64_t)0x2b01cac525d87U, (uint64_t)0xb716b8b91d3aU, (uint64_t)0xe236c66fa7c8U,
+    (uint64_t)0x17ffc4a242bfcU, (uint64_t)0x555f000269875U, (uint64_t)0x33d877c0c651dU,
+    (uint64_t)0x608cf36b7dccbU, (uint64_t)0x5244ca9423174U, (uint64_t)0x69b87fc7d5aefU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x4c59dd4aa431bU, (uint64_t)0x7464e76380fc5U, (uint64_t)0x714b55fc458fdU,
+    (uint64_t)0xb6246313a047U, (uint64_t)0x573e2870fd086U, (uint64_t)0x568a17517c24dU,
+    (uint64_t)0x71c688078d879U, (uint64_t)0x3903cfd1e4425U, (uint64_t)0x2100fbefd2c49U,
+    (uint64_t)0x6f0219bc5e589U, (uint64_t)0x3a75491d8d620U, (uint64_t)0x61f40c689641eU,
+    (uint64_t)0x5d1944051bf20U, (uint64_t)0x7e71334f82709U, (uint64_t)0x64c8c5d0f490cU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x42f04bce66fc8U, (uint64_t)0x5dec0dc5fbd5fU, (uint64_t)0x1226e1387aaa0U,
+    (uint64_t)0x5e9ec008c01beU, (uint64_t)0xc8e43546e18cU, (uint64_t)0x4b72109a85cc5U,
+    (uint64_t)0x761ee0187ec1cU, (uint64_t)0x1c9a0cbd9bb4aU, (uint64_t)0x116b7bdb3030bU,
+    (uint64_t)0x4a52307dc395eU, (uint64_t)0x3da3eb734947dU, (uint64_t)0x12913b4a5f390U,
+    (uint64_t)0x18967261e0095U, (uint64_t)0x6aaa501f214deU, (uint64_t)0x6a83e11cb340fU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x256370cb5a454U, (uint64_t)0x3a5a52e73f7abU, (uint64_t)0x60902a84204b9U,
+    (uint64_t)0x349e23f6ad1e9U, (uint64_t)0x38ca9f6f16e0cU, (uint64_t)0x8dc7b4d7e206U,
+    (uint64_t)0x422442e9ca98dU, (uint64_t)0x681e8c56e3a74U, (uint64_t)0x4c8fb148d15eU,
+    (uint64_t)0x7d664177da027U, (uint64_t)0x35d0e82761ae9U, (uint64_t)0x3b0bd222bd613U,
+    (uint64_t)0xb8cac3dfeabU, (uint64_t)0x5cf0f8a5d92b9U, (uint64_t)0x2e680498e9582U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0xbd35dde74c3dU, (uint64_t)0x314202fcaf86eU, (uint64_t)0x1f392acaa2ee8U,
+    (uint64_t)0x257d726bfdd59U, (uint64_t)0x419480e62aa87U, (uint64_t)0x61c7c797779d5U,
+    (uint64_t)0x4bfbfd0827c0bU, (uint64_t)0x1ba5951da73d0U, (uint64_t)0x6b19d7cc847c7U,
+    (uint64_t)0x2ae19cea663d4U, (uint64_t)0x377e5bfcf9334U, (uint64_t)0x5a6a3140242baU,
+    (uint64_t)0x77e504b59af89U, (uint64_t)0x763f53b5953d0U, (uint64_t)0x6fc4bdd1912e5U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x4d5bc000fc6b3U, (uint64_t)0x2cce6c31c323bU, (uint64_t)0x17384421af80cU,
+    (uint64_t)0x3f52db867971eU, (uint64_t)0x3e305c53bc3beU
+  };
+
+/* [i]P for i = 0..15, P = [2^128]G, in extended coordinates (X, Y, Z = 1, T = XY) */
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_g_pow2_128_table_w4[320U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0x47ae60b7e824U, (uint64_t)0x1385ce47cbf90U,
+    (uint64_t)0x538a682639a17U, (uint64_t)0x1964a969cc270U, (uint64_t)0x4c27afff3c45fU,
+    (uint64_t)0x2bd114bf5a66bU, (uint64_t)0x3ca349893cb77U, (uint64_t)0x30a70ea4342f8U,
+    (uint64_t)0x43ecaf88f5b13U, (uint64_t)0x5f2c99e6526dcU, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0x731c946f1338aU, (uint64_t)0x4ccc75b53d3cU,
+    (uint64_t)0x6492da851e192U, (uint64_t)0x17ea70ab0003U, (uint64_t)0x5a164fd0bf46U,
+    (uint64_t)0x7d1b43224e085U, (uint64_t)0x651f7f44d3f9dU, (uint64_t)0x1f5bb93da54b1U,
+    (uint64_t)0x57bd040abfbc8U, (uint64_t)0x786be30733efdU, (uint64_t)0x30712c63e2736U,
+    (uint64_t)0x7d673ad37c9d5U, (uint64_t)0x3f4211ca9f022U, (uint64_t)0x42d9a138766eaU,
+    (uint64_t)0x653a5f772f349U, (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0x4e817719f64c8U, (uint64_t)0x2aaf757adc018U,
+    (uint64_t)0x74f63b25b13b9U, (uint64_t)0x74586c8334d2dU, (uint64_t)0x12c73ed34d313U,
+    (uint64_t)0x5ca89f193c7c7U, (uint64_t)0x190eadb296624U, (uint64_t)0x613c26eba92ebU,
+    (uint64_t)0x28e517e9d52c5U, (uint64_t)0x9c186afb8339U, (uint64_t)0x49a357f7b062fU,
+    (uint64_t)0x577daa9fe2346U, (uint64_t)0x61928780aa0a9U, (uint64_t)0x1a9c9a34ad8a4U,
+    (uint64_t)0x6137b0746027bU, (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0x562410e8ef362U, (uint64_t)0x7e7115a47163U, (uint64_t)0x63082b8bba0edU,
+    (uint64_t)0x6c576f02a36f1U, (uint64_t)0x572c78d37f263U, (uint64_t)0x22f04c2eaa13U,
+    (uint64_t)0x57d69a3366d97U, (uint64_t)0x72376731a9341U, (uint64_t)0x499efc4abc0adU,
+    (uint64_t)0x21fee4804968aU, (uint64_t)0xd3e930901700U, (uint64_t)0x7512e5846260cU,
+    (uint64_t)0x2160ce6f694d9U, (uint64_t)0x28ea0b62ed0a8U, (uint64_t)0x500b7740072cbU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0xa584e1b381f8U, (uint64_t)0x2dc40f2fe1bb0U, (uint64_t)0x7a252afa919c4U,
+    (uint64_t)0x7f8344713f782U, (uint64_t)0x198588f68c188U, (uint64_t)0x1e3a2b12d4f17U,
+    (uint64_t)0x4b2e7932aa923U, (uint64_t)0x22727a3b68433U, (uint64_t)0x415c09f01b2eU,
+    (uint64_t)0x4a2e1f96eee4eU, (uint64_t)0x4b832ac846fc4U, (uint64_t)0x22e66b4cc889aU,
+    (uint64_t)0x77c36a3708a79U, (uint64_t)0x62dc64a88c45fU, (uint64_t)0x6c3f24822e185U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0xb2d34c797678U, (uint64_t)0x6b7b48f082a56U, (uint64_t)0x320892791968aU,
+    (uint64_t)0x130d94db67890U, (uint64_t)0x2ddebaccef8ddU, (uint64_t)0x1449ec0ec3464U,
+    (uint64_t)0x54da0a6d415e8U, (uint64_t)0x27490d51894c3U, (uint64_t)0x3a33578cadec3U,
+    (uint64_t)0x5dbd3bf95494dU, (uint64_t)0x4e1c737e25b77U, (uint64_t)0x54f6f73f1826fU,
+    (uint64_t)0x264aae68d0b38U, (uint64_t)0x5d8431e6c6054U, (uint64_t)0x56f5f77776e9fU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x4643a2e2f2569U, (uint64_t)0x611669774e72U, (uint64_t)0x6e17d81aef50eU,
+    (uint64_t)0x60a92020f5168U, (uint64_t)0x5844f533bb02bU, (uint64_t)0xbadc76ed5685U,
+    (uint64_t)0x35fa4ebc2326eU, (uint64_t)0x5dc73aed63804U, (uint64_t)0x1e078f96abefcU,
+    (uint64_t)0x4b3702044575dU, (uint64_t)0x27acd289b820U, (uint64_t)0x1f5f99c524904U,
+    (uint64_t)0x581aabf8db72cU, (uint64_t)0x17a97a13d4072U, (uint64_t)0x54333c50acf33U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x271da3c1535e8U, (uint64_t)0x50808b29d87a9U, (uint64_t)0x11653cf3c08eU,
+    (uint64_t)0xee45253cfdc0U, (uint64_t)0x1d1cecdf260f8U, (uint64_t)0x7136e1146b3dfU,
+    (uint64_t)0x59e3baac9c516U, (uint64_t)0x25223e30d62b6U, (uint64_t)0x5b57250cc032fU,
+    (uint64_t)0x77fe8a5d490afU, (uint64_t)0x5c5afa5f50246U, (uint64_t)0x7c146a8b74daeU,
+    (uint64_t)0x48636448ab327U, (uint64_t)0x18b45600199caU, (uint64_t)0x3c530f01e039fU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x566861b52ad2cU, (uint64_t)0x752b00120dfc5U, (uint64_t)0x73bad60eb6373U,
+    (uint64_t)0x40fc2927931ffU, (uint64_t)0x25a2c58c77260U, (uint64_t)0x35c8de42dce20U,
+    (uint64_t)0x4f3903f2d597fU, (uint64_t)0x3dd85b13817fdU, (uint64_t)0x19ccf62218b91U,
+    (uint64_t)0x3df71993fb635U, (uint64_t)0x722692a09fa98U, (uint64_t)0x5439e0021cf78U,
+    (uint64_t)0x51c729edb2aaU, (uint64_t)0x69ce48b27d832U, (uint64_t)0x7dcf8776aa205U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0xcb8d6970e9b5U, (uint64_t)0x1e291b140584aU, (uint64_t)0x607784546a446U,
+    (uint64_t)0xf74fa2c522beU, (uint64_t)0x46c49dfefb5beU, (uint64_t)0xcddd479736b0U,
+    (uint64_t)0x216ab397f0497U, (uint64_t)0x1e1f35503332aU, (uint64_t)0x6f3f6da3a0cf9U,
+    (uint64_t)0x8f8726bcbbdeU, (uint64_t)0x2aefea8b4c884U, (uint64_t)0x5d470b1df666fU,
+    (uint64_t)0x25d20223888c0U, (uint64_t)0x3dc111cc068U, (uint64_t)0x11f808ca3d11fU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x181684b2460b6U, (uint64_t)0x4e00bfc81618cU, (uint64_t)0x615fe58d16190U,
+    (uint64_t)0x3d554d029d535U, (uint64_t)0x308a2fc2d525bU, (uint64_t)0x2e9ccb983430cU,
+    (uint64_t)0x4c8d99999422dU, (uint64_t)0x7549b92767f0cU, (uint64_t)0x68f157021163bU,
+    (uint64_t)0x4cf0cb74c7099U, (uint64_t)0x507c5e74f9735U, (uint64_t)0x1c5016a149617U,
+    (uint64_t)0x7ca26a562ea69U, (uint64_t)0x30dc2fa516024U, (uint64_t)0x5df4e013e64U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x68bbe81be9cc8U, (uint64_t)0x6d87286f756c8U, (uint64_t)0x3f807a456a8fU,
+    (uint64_t)0x701ac2b9e248eU, (uint64_t)0x25e0b22e23b82U, (uint64_t)0x5f4ed0d8b6abU,
+    (uint64_t)0x371a4b0a6056cU, (uint64_t)0x570359ac26890U, (uint64_t)0x61f05be0bd307U,
+    (uint64_t)0x54d6778da5f0fU, (uint64_t)0x2806f9009c619U, (uint64_t)0x675cf4e8fcfd1U,
+    (uint64_t)0x48df9ce5e08e4U, (uint64_t)0x4ecc62b32ac58U, (uint64_t)0x5f988a1f2c959U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x47545bc03c212U, (uint64_t)0x63a742f44ee6bU, (uint64_t)0x5735298f03895U,
+    (uint64_t)0x25e3cda9e8ca9U, (uint64_t)0x28ae8803cb684U, (uint64_t)0x14382c7d59993U,
+    (uint64_t)0x7ae9d998c6fb0U, (uint64_t)0x2599ebd8e7a64U, (uint64_t)0x6a67d4c5972U,
+    (uint64_t)0x390414491821bU, (uint64_t)0x3facbdff0df5aU, (uint64_t)0x2b4be0de64279U,
+    (uint64_t)0x6de9ff12603a1U, (uint64_t)0x78ebbb820348bU, (uint64_t)0x69710b1edcd36U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x4e273fb7ae6bU, (uint64_t)0x349abbea2b788U, (uint64_t)0x24a4e6a4b330dU,
+    (uint64_t)0xc75513396fe7U, (uint64_t)0x7eb4c6c7e9177U, (uint64_t)0x682e2c99e70f0U,
+    (uint64_t)0x404469b48712cU, (uint64_t)0x64667988eeefU, (uint64_t)0x40539d99c51bdU,
+    (uint64_t)0x1432670aad334U, (uint64_t)0x2cfced8a71cd3U, (uint64_t)0x3a90088ba560bU,
+    (uint64_t)0x321b83e07eceaU, (uint64_t)0x597b7bd55183eU, (uint64_t)0x6ef2e391ba981U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x7120e749c98baU, (uint64_t)0x2064fa141e024U, (uint64_t)0x34fe13bbecea0U,
+    (uint64_t)0x169b35efc6baU, (uint64_t)0x4a7b37baf1f65U, (uint64_t)0x7d1ff333057e4U,
+    (uint64_t)0x5576fdf5ab79fU, (uint64_t)0x6b385a10d53e8U, (uint64_t)0x40892bfbfb2d6U,
+    (uint64_t)0x29b0c323e8469U, (uint64_t)0x60930c75ce1cU, (uint64_t)0x5cd42b095b8efU,
+    (uint64_t)0x66c89b07042b5U, (uint64_t)0x2e5c6e0a952e8U, (uint64_t)0x39a797181bd8aU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x25af544a9a94bU, (uint64_t)0x7578b03b6c66cU, (uint64_t)0x52bd498306d8U,
+    (uint64_t)0x154bac09b10d1U, (uint64_t)0x4446f2c6af923U
+  };
+
+/* [i]P for i = 0..15, P = [2^192]G, in extended coordinates (X, Y, Z = 1, T = XY) */
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_g_pow2_192_table_w4[320U] =
+  {
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)1U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0x2d644c7dad28dU, (uint64_t)0x43703afa4db6fU,
+    (uint64_t)0x1f85df5ea777bU, (uint64_t)0x73e16c6821b8eU, (uint64_t)0x1bc7af1e38185U,
+    (uint64_t)0x2f65900314833U, (uint64_t)0x24c6364e1f95eU, (uint64_t)0x57701247409f8U,
+    (uint64_t)0x797bd2f77c3bcU, (uint64_t)0x61d909d855661U, (uint64_t)1U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0x45216636c2c7U, (uint64_t)0x6cadbcfdf0a37U,
+    (uint64_t)0x47c3ef66ee3c8U, (uint64_t)0x522665b326f25U, (uint64_t)0x1a340b8054b8fU,
+    (uint64_t)0x1938218028354U, (uint64_t)0x6bb1b54fa00f3U, (uint64_t)0x6e28f67cbea25U,
+    (uint64_t)0x4b5e9141aad35U, (uint64_t)0x6bce245f8c25U, (uint64_t)0x4955188a3c065U,
+    (uint64_t)0x161bd0f1292dfU, (uint64_t)0x1d521630b2506U, (uint64_t)0x6d06495669788U,
+    (uint64_t)0x3d26989cdd0f6U, (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0U, (uint64_t)0x365eb8eb94b17U, (uint64_t)0x18452cd8dbe9U, (uint64_t)0xd790b46bf270U,
+    (uint64_t)0x78813093349c2U, (uint64_t)0x7a9f6260e653aU, (uint64_t)0x589041b29662fU,
+    (uint64_t)0x1d6fbadddcfd7U, (uint64_t)0x1fff2d032c3bcU, (uint64_t)0x2f7b21e1d64e1U,
+    (uint64_t)0x7665908aaf444U, (uint64_t)0x3a00e4b704ca1U, (uint64_t)0x71715f4826e10U,
+    (uint64_t)0x40ad025948864U, (uint64_t)0x2a3670bfc0327U, (uint64_t)0x4ed18a7c50da4U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x54343b9ec13bbU, (uint64_t)0x15437f0d48d06U, (uint64_t)0x366c6c241874bU,
+    (uint64_t)0x6e66e4600d1c1U, (uint64_t)0x6bb9cf0f2d4dbU, (uint64_t)0x5954e6c16d4f7U,
+    (uint64_t)0x7ca457221ebb3U, (uint64_t)0x69398c394d173U, (uint64_t)0x554841a79f99dU,
+    (uint64_t)0xa09b36eb5a04U, (uint64_t)0x2eb0fa35ed926U, (uint64_t)0x49a86e7641e74U,
+    (uint64_t)0x3b54cf41b3a7bU, (uint64_t)0x85125b7595d7U, (uint64_t)0x3aa47fd60fa31U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x3b1cc6b04c053U, (uint64_t)0x13e65c5705fc4U, (uint64_t)0x7f81640bc9a65U,
+    (uint64_t)0x6ac534fc04217U, (uint64_t)0x3bd5dfb4b4648U, (uint64_t)0x4d5451113735eU,
+    (uint64_t)0x2574dcfa41233U, (uint64_t)0x55926182e858bU, (uint64_t)0x6b540645ad45fU,
+    (uint64_t)0x1c71ce37638e6U, (uint64_t)0xfee129e406cbU, (uint64_t)0x7e88f52e59c7dU,
+    (uint64_t)0x2833edf503460U, (uint64_t)0x166921edd6bcdU, (uint64_t)0x7880cc1c2003bU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x30eaefc5832acU, (uint64_t)0x7bb8bc02f05U, (uint64_t)0x10ee994d38e57U,
+    (uint64_t)0xc32dd003212eU, (uint64_t)0x79030a4774645U, (uint64_t)0x39e7f74cbc8d6U,
+    (uint64_t)0x8d90a5963263U, (uint64_t)0x70b3f944839e5U, (uint64_t)0x7bec4bd417c4aU,
+    (uint64_t)0x3c607a84c1df2U, (uint64_t)0x79a86ba3cea68U, (uint64_t)0x42e6340c19d4eU,
+    (uint64_t)0x76fb861261f82U, (uint64_t)0x51d11c25d5a44U, (uint64_t)0x34518ad109941U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x3c6c9e37345dU, (uint64_t)0x7081214e622b1U, (uint64_t)0x60ece5ba974a8U,
+    (uint64_t)0x179f8768deed4U, (uint64_t)0x727055e32e57U, (uint64_t)0x2f417ffbe2da0U,
+    (uint64_t)0x4d4c71c738621U, (uint64_t)0x5bbdfc4e85ff1U, (uint64_t)0x6331ffc9c6eb0U,
+    (uint64_t)0x89b6cd02000bU, (uint64_t)0x16f13e8ceb88U, (uint64_t)0x4f9b762547cf1U,
+    (uint64_t)0x72995f90f2f92U, (uint64_t)0x7ec5a1c6f7e88U, (uint64_t)0x66ef7206aa36dU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x478374da76d28U, (uint64_t)0x5344ef62175f4U, (uint64_t)0x78f681d66e834U,
+    (uint64_t)0x1fda3b879848dU, (uint64_t)0xd2c585f51161U, (uint64_t)0x6b2d6fc2c9fdbU,
+    (uint64_t)0x5b0e0cf4a45c3U, (uint64_t)0x1de41b4adca18U, (uint64_t)0x6b07c3d5aa1a3U,
+    (uint64_t)0x79e9d5b60917U, (uint64_t)0x1381c04c78797U, (uint64_t)0x79470b8eb0720U,
+    (uint64_t)0x2fe8895900193U, (uint64_t)0x5229893654a28U, (uint64_t)0x16512951d2240U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x1b9bb33b94e2aU, (uint64_t)0x471701c32b888U, (uint64_t)0x7201f9f3e4791U,
+    (uint64_t)0x9c9665f45f28U, (uint64_t)0x18a2cd789580bU, (uint64_t)0x54ba615e7bacfU,
+    (uint64_t)0x4e5177009b7b9U, (uint64_t)0x735e62946071dU, (uint64_t)0x6115696f90eaU,
+    (uint64_t)0x14445439305d0U, (uint64_t)0x200515d0477bcU, (uint64_t)0x157fafd10b1ddU,
+    (uint64_t)0x2e35626b9af26U, (uint64_t)0x6a69f71b080cfU, (uint64_t)0x2ab36d724a6ecU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x46e2ce7ceecabU, (uint64_t)0x5b697fb2f2e3aU, (uint64_t)0x43723380b355bU,
+    (uint64_t)0x1594187a6aa3aU, (uint64_t)0x3768f1d146014U, (uint64_t)0x87787e2dd7b8U,
+    (uint64_t)0x7bb442643ef2U, (uint64_t)0x70221dc40c4e7U, (uint64_t)0x10e30d662465aU,
+    (uint64_t)0x7b23a7dce9a09U, (uint64_t)0x2040bc9616570U, (uint64_t)0x39cf90f92e9c2U,
+    (uint64_t)0x2edbe7e0547abU, (uint64_t)0x30189d6ee99fbU, (uint64_t)0x77a7fbafce1bcU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x25b1a1380ed31U, (uint64_t)0x70dbb6d788f3dU, (uint64_t)0x510ca8a63cb2dU,
+    (uint64_t)0xfec9668bc1ddU, (uint64_t)0x678006f65af05U, (uint64_t)0x13e2d3b4b1d5cU,
+    (uint64_t)0x8985fcb81ee5U, (uint64_t)0x1988a1a828025U, (uint64_t)0xa01a7d870114U,
+    (uint64_t)0x488953fd41867U, (uint64_t)0x399223384410U, (uint64_t)0x14223f9006beU,
+    (uint64_t)0x50f09050a657dU, (uint64_t)0x292378430245dU, (uint64_t)0x7bd340fdf6e04U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0xec1fcde050f2U, (uint64_t)0x4898e6bcf3408U, (uint64_t)0x4c6e0a7708771U,
+    (uint64_t)0x68b1dcb7e3c7fU, (uint64_t)0x602833b0f078bU, (uint64_t)0x3403b4621d719U,
+    (uint64_t)0x3015b2e7b4c3eU, (uint64_t)0x5115565bbd38bU, (uint64_t)0x3f631614c3f31U,
+    (uint64_t)0x2396f9d65dc6bU, (uint64_t)0x6d8b42d583ddeU, (uint64_t)0x777423d7bfc3bU,
+    (uint64_t)0x48c1559a710a7U, (uint64_t)0x698034ab91fabU, (uint64_t)0x675952b2e020eU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x72ab1e3bcf96bU, (uint64_t)0x6f4bde8068edbU, (uint64_t)0x4f5b5bada9c40U,
+    (uint64_t)0x485bc50a03394U, (uint64_t)0x415d255a9d532U, (uint64_t)0x657b3ace3c6f8U,
+    (uint64_t)0x366a7ba42314dU, (uint64_t)0x29eb30543f7f7U, (uint64_t)0x1b6c2a1d320d3U,
+    (uint64_t)0x229f80407ae62U, (uint64_t)0x3f16fe3db85b0U, (uint64_t)0x7cd85cb93b208U,
+    (uint64_t)0x7a019da637748U, (uint64_t)0x4f4880eb525e0U, (uint64_t)0x1d44ec76d45e6U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x5f8864731bfcbU, (uint64_t)0x7ab32c19376cdU, (uint64_t)0x339acb66b1bdeU,
+    (uint64_t)0x28a92de1eb77aU, (uint64_t)0x76a4d6aa450ebU, (uint64_t)0xcc1a47ce93c4U,
+    (uint64_t)0x3393627feb977U, (uint64_t)0x1eb4e9e334c2cU, (uint64_t)0x496d2855b1681U,
+    (uint64_t)0x4c7cb3e8f525aU, (uint64_t)0x18cd592e65741U, (uint64_t)0x296915f5154fdU,
+    (uint64_t)0xe85466180265U, (uint64_t)0x2ee9f744c36abU, (uint64_t)0x4c957905c63cbU,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x3578a80d634dbU, (uint64_t)0x6b064354f9c85U, (uint64_t)0xfb9d2c116f8fU,
+    (uint64_t)0x5c1966ac524c7U, (uint64_t)0x7ed22b364f0d8U, (uint64_t)0xdc27e0016faaU,
+    (uint64_t)0x5c13389191dadU, (uint64_t)0x440264d63e1c5U, (uint64_t)0xe2d56486f232U,
+    (uint64_t)0x2a4b994aa61f7U, (uint64_t)0x57486d74dda9aU, (uint64_t)0x7984da5d06098U,
+    (uint64_t)0x5f05e86ec0601U, (uint64_t)0x61bbb3c0adce8U, (uint64_t)0x13a4a860954e7U,
+    (uint64_t)1U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U, (uint64_t)0U,
+    (uint64_t)0x3af37d41878bU, (uint64_t)0x21320c8533a02U, (uint64_t)0x4f99d4d5b0067U,
+    (uint64_t)0x6dc96bcafbb01U, (uint64_t)0x55f69782ed38bU
+  };
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Ed25519_PrecompTable_H_DEFINED
+#endif
@@ -24,6 +24,10 @@
 
 #include "Hacl_Frodo_KEM.h"
 
+#include "Hacl_SHA3_Vec256.h"
+#include "Hacl_Frodo_Vec256.h"
+#include "EverCrypt_AutoConfig2.h"
+
 static inline void matrix_add(uint32_t n1, uint32_t n2, uint16_t *a, uint16_t *b)
 {
   for (uint32_t i0 = (uint32_t)0U; i0 < n1; i0++)
@@ -49,6 +53,14 @@ static inline void matrix_sub(uint32_t n1, uint32_t n2, uint16_t *a, uint16_t *b
 static inline void
 matrix_mul(uint32_t n1, uint32_t n2, uint32_t n3, uint16_t *a, uint16_t *b, uint16_t *c)
 {
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    Hacl_Frodo_Vec256_matrix_mul(n1, n2, n3, a, b, c);
+    return;
+  }
+  #endif
   for (uint32_t i0 = (uint32_t)0U; i0 < n1; i0++)
   {
     for (uint32_t i1 = (uint32_t)0U; i1 < n3; i1++)
@@ -69,6 +81,14 @@ matrix_mul(uint32_t n1, uint32_t n2, uint32_t n3, uint16_t *a, uint16_t *b, uint
 static inline void
 matrix_mul_s(uint32_t n1, uint32_t n2, uint32_t n3, uint16_t *a, uint16_t *b, uint16_t *c)
 {
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    Hacl_Frodo_Vec256_matrix_mul_s(n1, n2, n3, a, b, c);
+    return;
+  }
+  #endif
   for (uint32_t i0 = (uint32_t)0U; i0 < n1; i0++)
   {
     for (uint32_t i1 = (uint32_t)0U; i1 < n3; i1++)
@@ -131,7 +151,41 @@ frodo_gen_matrix_cshake(uint32_t n, uint32_t seed_len, uint8_t *seed, uint16_t *
   uint8_t r[(uint32_t)2U * n];
   memset(r, 0U, (uint32_t)2U * n * sizeof (uint8_t));
   memset(res, 0U, n * n * sizeof (uint16_t));
-  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  uint32_t n4 = (uint32_t)0U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2)
+  {
+    n4 = n / (uint32_t)4U;
+    KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)8U * n);
+    uint8_t r4[(uint32_t)8U * n];
+    memset(r4, 0U, (uint32_t)8U * n * sizeof (uint8_t));
+    uint8_t *r0 = r4;
+    uint8_t *r1 = r4 + (uint32_t)2U * n;
+    uint8_t *r2 = r4 + (uint32_t)4U * n;
+    uint8_t *r3 = r4 + (uint32_t)6U * n;
+    for (uint32_t i = (uint32_t)0U; i < n4; i++)
+    {
+      uint32_t ctr = (uint32_t)256U + (uint32_t)4U * i;
+      Hacl_SHA3_Vec256_cshake128_frodo4(seed_len,
+        seed,
+        seed,
+        seed,
+        seed,
+        (uint16_t)ctr,
+        (uint16_t)(ctr + (uint32_t)1U),
+        (uint16_t)(ctr + (uint32_t)2U),
+        (uint16_t)(ctr + (uint32_t)3U),
+        (uint32_t)2U * n,
+        r0,
+        r1,
+        r2,
+        r3);
+      matrix_from_lbytes((uint32_t)4U, n, r4, res + (uint32_t)4U * i * n);
+    }
+  }
+  #endif
+  for (uint32_t i = (uint32_t)4U * n4; i < n; i++)
   {
     uint32_t ctr = (uint32_t)256U + i;
     uint64_t s[25U] = { 0U };
@@ -0,0 +1,234 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Frodo_Vec256.h"
+
+/* The rows of b used by matrix_mul are visited in blocks of 128, one strip of
+   64 columns at a time, so that the 16KB sub-block of b being multiplied stays
+   in L1 while every row of a goes over it. */
+static uint32_t block_rows = (uint32_t)128U;
+
+static inline void
+matrix_mul_strip4(
+  uint32_t k0,
+  uint32_t k1,
+  uint32_t n3,
+  uint16_t *ai,
+  uint16_t *b,
+  uint16_t *ci
+)
+{
+  Lib_IntVector_Intrinsics_vec256 acc0 = Lib_IntVector_Intrinsics_vec256_load_le(ci);
+  Lib_IntVector_Intrinsics_vec256
+  acc1 = Lib_IntVector_Intrinsics_vec256_load_le(ci + (uint32_t)16U);
+  Lib_IntVector_Intrinsics_vec256
+  acc2 = Lib_IntVector_Intrinsics_vec256_load_le(ci + (uint32_t)32U);
+  Lib_IntVector_Intrinsics_vec256
+  acc3 = Lib_IntVector_Intrinsics_vec256_load_le(ci + (uint32_t)48U);
+  for (uint32_t k = k0; k < k1; k++)
+  {
+    Lib_IntVector_Intrinsics_vec256 aik = Lib_IntVector_Intrinsics_vec256_load16(ai[k]);
+    uint16_t *bk = b + k * n3;
+    Lib_IntVector_Intrinsics_vec256 b0 = Lib_IntVector_Intrinsics_vec256_load_le(bk);
+    Lib_IntVector_Intrinsics_vec256
+    b1 = Lib_IntVector_Intrinsics_vec256_load_le(bk + (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec256
+    b2 = Lib_IntVector_Intrinsics_vec256_load_le(bk + (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256
+    b3 = Lib_IntVector_Intrinsics_vec256_load_le(bk + (uint32_t)48U);
+    acc0 =
+      Lib_IntVector_Intrinsics_vec256_add16(acc0,
+        Lib_IntVector_Intrinsics_vec256_mul16(aik, b0));
+    acc1 =
+      Lib_IntVector_Intrinsics_vec256_add16(acc1,
+        Lib_IntVector_Intrinsics_vec256_mul16(aik, b1));
+    acc2 =
+      Lib_IntVector_Intrinsics_vec256_add16(acc2,
+        Lib_IntVector_Intrinsics_vec256_mul16(aik, b2));
+    acc3 =
+      Lib_IntVector_Intrinsics_vec256_add16(acc3,
+        Lib_IntVector_Intrinsics_vec256_mul16(aik, b3));
+  }
+  Lib_IntVector_Intrinsics_vec256_store_le(ci, acc0);
+  Lib_IntVector_Intrinsics_vec256_store_le(ci + (uint32_t)16U, acc1);
+  Lib_IntVector_Intrinsics_vec256_store_le(ci + (uint32_t)32U, acc2);
+  Lib_IntVector_Intrinsics_vec256_store_le(ci + (uint32_t)48U, acc3);
+}
+
+static inline void
+matrix_mul_strip1(
+  uint32_t k0,
+  uint32_t k1,
+  uint32_t n3,
+  uint16_t *ai,
+  uint16_t *b,
+  uint16_t *ci
+)
+{
+  Lib_IntVector_Intrinsics_vec256 acc = Lib_IntVector_Intrinsics_vec256_load_le(ci);
+  for (uint32_t k = k0; k < k1; k++)
+  {
+    Lib_IntVector_Intrinsics_vec256 aik = Lib_IntVector_Intrinsics_vec256_load16(ai[k]);
+    Lib_IntVector_Intrinsics_vec256 bk = Lib_IntVector_Intrinsics_vec256_load_le(b + k * n3);
+    acc =
+      Lib_IntVector_Intrinsics_vec256_add16(acc,
+        Lib_IntVector_Intrinsics_vec256_mul16(aik, bk));
+  }
+  Lib_IntVector_Intrinsics_vec256_store_le(ci, acc);
+}
+
+void
+Hacl_Frodo_Vec256_matrix_mul(
+  uint32_t n1,
+  uint32_t n2,
+  uint32_t n3,
+  uint16_t *a,
+  uint16_t *b,
+  uint16_t *c
+)
+{
+  memset(c, 0U, n1 * n3 * sizeof (uint16_t));
+  uint32_t j4 = n3 / (uint32_t)64U * (uint32_t)64U;
+  uint32_t j1 = n3 / (uint32_t)16U * (uint32_t)16U;
+  for (uint32_t k0 = (uint32_t)0U; k0 < n2; k0 = k0 + block_rows)
+  {
+    uint32_t k1;
+    if (n2 - k0 < block_rows)
+    {
+      k1 = n2;
+    }
+    else
+    {
+      k1 = k0 + block_rows;
+    }
+    for (uint32_t j = (uint32_t)0U; j < j4; j = j + (uint32_t)64U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < n1; i++)
+      {
+        matrix_mul_strip4(k0, k1, n3, a + i * n2, b + j, c + i * n3 + j);
+      }
+    }
+    for (uint32_t j = j4; j < j1; j = j + (uint32_t)16U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < n1; i++)
+      {
+        matrix_mul_strip1(k0, k1, n3, a + i * n2, b + j, c + i * n3 + j);
+      }
+    }
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < n1; i0++)
+  {
+    for (uint32_t i1 = j1; i1 < n3; i1++)
+    {
+      uint16_t res = (uint16_t)0U;
+      for (uint32_t i = (uint32_t)0U; i < n2; i++)
+      {
+        res = res + a[i0 * n2 + i] * b[i * n3 + i1];
+      }
+      c[i0 * n3 + i1] = res;
+    }
+  }
+}
+
+/* Eight dot products of the row ai against the rows b0, b0 + n2, ..., b0 + 7 * n2,
+   written to ci[0..7]. The eight 16-lane accumulators are summed horizontally
+   with three rounds of pairwise additions, which leave the partial sums of
+   accumulator t in lane t of each 128-bit half. */
+static inline void matrix_mul_s_row8(uint32_t n2, uint16_t *ai, uint16_t *b0, uint16_t *ci)
+{
+  Lib_IntVector_Intrinsics_vec256 acc[8U];
+  for (uint32_t t = (uint32_t)0U; t < (uint32_t)8U; t++)
+  {
+    acc[t] = Lib_IntVector_Intrinsics_vec256_zero;
+  }
+  uint32_t k1 = n2 / (uint32_t)16U * (uint32_t)16U;
+  for (uint32_t k = (uint32_t)0U; k < k1; k = k + (uint32_t)16U)
+  {
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_load_le(ai + k);
+    for (uint32_t t = (uint32_t)0U; t < (uint32_t)8U; t++)
+    {
+      Lib_IntVector_Intrinsics_vec256
+      y = Lib_IntVector_Intrinsics_vec256_load_le(b0 + t * n2 + k);
+      acc[t] =
+        Lib_IntVector_Intrinsics_vec256_add16(acc[t],
+          Lib_IntVector_Intrinsics_vec256_mul16(x, y));
+    }
+  }
+  Lib_IntVector_Intrinsics_vec256
+  h01 = Lib_IntVector_Intrinsics_vec256_hadd16(acc[0U], acc[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  h23 = Lib_IntVector_Intrinsics_vec256_hadd16(acc[2U], acc[3U]);
+  Lib_IntVector_Intrinsics_vec256
+  h45 = Lib_IntVector_Intrinsics_vec256_hadd16(acc[4U], acc[5U]);
+  Lib_IntVector_Intrinsics_vec256
+  h67 = Lib_IntVector_Intrinsics_vec256_hadd16(acc[6U], acc[7U]);
+  Lib_IntVector_Intrinsics_vec256 h0123 = Lib_IntVector_Intrinsics_vec256_hadd16(h01, h23);
+  Lib_IntVector_Intrinsics_vec256 h4567 = Lib_IntVector_Intrinsics_vec256_hadd16(h45, h67);
+  Lib_IntVector_Intrinsics_vec256 h = Lib_IntVector_Intrinsics_vec256_hadd16(h0123, h4567);
+  Lib_IntVector_Intrinsics_vec256
+  s =
+    Lib_IntVector_Intrinsics_vec256_add16(h,
+      Lib_IntVector_Intrinsics_vec256_interleave_high128(h, h));
+  uint16_t tmp[16U] = { 0U };
+  Lib_IntVector_Intrinsics_vec256_store_le(tmp, s);
+  for (uint32_t t = (uint32_t)0U; t < (uint32_t)8U; t++)
+  {
+    uint16_t res = tmp[t];
+    for (uint32_t k = k1; k < n2; k++)
+    {
+      res = res + ai[k] * b0[t * n2 + k];
+    }
+    ci[t] = res;
+  }
+}
+
+void
+Hacl_Frodo_Vec256_matrix_mul_s(
+  uint32_t n1,
+  uint32_t n2,
+  uint32_t n3,
+  uint16_t *a,
+  uint16_t *b,
+  uint16_t *c
+)
+{
+  uint32_t j8 = n3 / (uint32_t)8U * (uint32_t)8U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < n1; i0++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < j8; j = j + (uint32_t)8U)
+    {
+      matrix_mul_s_row8(n2, a + i0 * n2, b + j * n2, c + i0 * n3 + j);
+    }
+    for (uint32_t i1 = j8; i1 < n3; i1++)
+    {
+      uint16_t res = (uint16_t)0U;
+      for (uint32_t i = (uint32_t)0U; i < n2; i++)
+      {
+        res = res + a[i0 * n2 + i] * b[i1 * n2 + i];
+      }
+      c[i0 * n3 + i1] = res;
+    }
+  }
+}
+
@@ -0,0 +1,75 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Frodo_Vec256_H
+#define __Hacl_Frodo_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+
+/* Matrix products modulo 2^16 over row-major uint16_t matrices, computed on
+   16 lanes of 256-bit vectors. These functions require AVX2; Hacl_Frodo_KEM
+   only calls them after checking EverCrypt_AutoConfig2_has_avx2.
+
+   matrix_mul computes c = a * b for a of size n1 x n2 and b of size n2 x n3.
+   matrix_mul_s computes c = a * transpose(b) for a of size n1 x n2 and b of
+   size n3 x n2. c has size n1 x n3 and must not overlap a or b. */
+
+void
+Hacl_Frodo_Vec256_matrix_mul(
+  uint32_t n1,
+  uint32_t n2,
+  uint32_t n3,
+  uint16_t *a,
+  uint16_t *b,
+  uint16_t *c
+);
+
+void
+Hacl_Frodo_Vec256_matrix_mul_s(
+  uint32_t n1,
+  uint32_t n2,
+  uint32_t n3,
+  uint16_t *a,
+  uint16_t *b,
+  uint16_t *c
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Frodo_Vec256_H_DEFINED
+#endif
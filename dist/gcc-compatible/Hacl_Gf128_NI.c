@@ -0,0 +1,207 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+
+
+#include "Hacl_Gf128_NI.h"
+
+/* The 256-bit carry-less product of x and y, as out[0] (low) and out[1] (high). */
+static inline void
+clmul_wide(
+  Lib_IntVector_Intrinsics_vec128 *out,
+  Lib_IntVector_Intrinsics_vec128 x,
+  Lib_IntVector_Intrinsics_vec128 y
+)
+{
+  Lib_IntVector_Intrinsics_vec128 lo = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x00U);
+  Lib_IntVector_Intrinsics_vec128 m1 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x10U);
+  Lib_IntVector_Intrinsics_vec128 m2 = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x01U);
+  Lib_IntVector_Intrinsics_vec128 hi = Lib_IntVector_Intrinsics_ni_clmul(x, y, (uint8_t)0x11U);
+  Lib_IntVector_Intrinsics_vec128 m = Lib_IntVector_Intrinsics_vec128_xor(m1, m2);
+  out[0U] =
+    Lib_IntVector_Intrinsics_vec128_xor(lo,
+      Lib_IntVector_Intrinsics_vec128_shift_left(m, (uint32_t)64U));
+  out[1U] =
+    Lib_IntVector_Intrinsics_vec128_xor(hi,
+      Lib_IntVector_Intrinsics_vec128_shift_right(m, (uint32_t)64U));
+}
+
+/* Reduces a 256-bit product of bit-reflected operands: shift it left by one bit,
+   then fold the low half modulo x^128 + x^7 + x^2 + x + 1. */
+static inline Lib_IntVector_Intrinsics_vec128 reduce(Lib_IntVector_Intrinsics_vec128 *w)
+{
+  Lib_IntVector_Intrinsics_vec128 lo0 = w[0U];
+  Lib_IntVector_Intrinsics_vec128 hi0 = w[1U];
+  Lib_IntVector_Intrinsics_vec128
+  lc = Lib_IntVector_Intrinsics_vec128_shift_right64(lo0, (uint32_t)63U);
+  Lib_IntVector_Intrinsics_vec128
+  hc = Lib_IntVector_Intrinsics_vec128_shift_right64(hi0, (uint32_t)63U);
+  Lib_IntVector_Intrinsics_vec128
+  lo10 = Lib_IntVector_Intrinsics_vec128_shift_left64(lo0, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128
+  hi10 = Lib_IntVector_Intrinsics_vec128_shift_left64(hi0, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128
+  lo1 =
+    Lib_IntVector_Intrinsics_vec128_or(lo10,
+      Lib_IntVector_Intrinsics_vec128_shift_left(lc, (uint32_t)64U));
+  Lib_IntVector_Intrinsics_vec128
+  hi11 =
+    Lib_IntVector_Intrinsics_vec128_or(hi10,
+      Lib_IntVector_Intrinsics_vec128_shift_left(hc, (uint32_t)64U));
+  Lib_IntVector_Intrinsics_vec128
+  hi1 =
+    Lib_IntVector_Intrinsics_vec128_or(hi11,
+      Lib_IntVector_Intrinsics_vec128_shift_right(lc, (uint32_t)64U));
+  Lib_IntVector_Intrinsics_vec128
+  a0 = Lib_IntVector_Intrinsics_vec128_shift_left64(lo1, (uint32_t)63U);
+  Lib_IntVector_Intrinsics_vec128
+  a1 = Lib_IntVector_Intrinsics_vec128_shift_left64(lo1, (uint32_t)62U);
+  Lib_IntVector_Intrinsics_vec128
+  a2 = Lib_IntVector_Intrinsics_vec128_shift_left64(lo1, (uint32_t)57U);
+  Lib_IntVector_Intrinsics_vec128
+  a = Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_xor(a0, a1), a2);
+  Lib_IntVector_Intrinsics_vec128
+  lo2 =
+    Lib_IntVector_Intrinsics_vec128_xor(lo1,
+      Lib_IntVector_Intrinsics_vec128_shift_left(a, (uint32_t)64U));
+  Lib_IntVector_Intrinsics_vec128
+  b0 = Lib_IntVector_Intrinsics_vec128_shift_left64(lo2, (uint32_t)63U);
+  Lib_IntVector_Intrinsics_vec128
+  b1 = Lib_IntVector_Intrinsics_vec128_shift_left64(lo2, (uint32_t)62U);
+  Lib_IntVector_Intrinsics_vec128
+  b2 = Lib_IntVector_Intrinsics_vec128_shift_left64(lo2, (uint32_t)57U);
+  Lib_IntVector_Intrinsics_vec128
+  b = Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_xor(b0, b1), b2);
+  Lib_IntVector_Intrinsics_vec128
+  c0 = Lib_IntVector_Intrinsics_vec128_shift_right64(lo2, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec128
+  c1 = Lib_IntVector_Intrinsics_vec128_shift_right64(lo2, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec128
+  c2 = Lib_IntVector_Intrinsics_vec128_shift_right64(lo2, (uint32_t)7U);
+  Lib_IntVector_Intrinsics_vec128
+  c =
+    Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_xor(lo2, c0),
+      Lib_IntVector_Intrinsics_vec128_xor(c1, c2));
+  Lib_IntVector_Intrinsics_vec128 hi2 = Lib_IntVector_Intrinsics_vec128_xor(hi1, c);
+  return
+    Lib_IntVector_Intrinsics_vec128_xor(hi2,
+      Lib_IntVector_Intrinsics_vec128_shift_right(b, (uint32_t)64U));
+}
+
+static inline Lib_IntVector_Intrinsics_vec128
+fmul(Lib_IntVector_Intrinsics_vec128 x, Lib_IntVector_Intrinsics_vec128 y)
+{
+  Lib_IntVector_Intrinsics_vec128 w[2U];
+  for (uint32_t _i = 0U; _i < (uint32_t)2U; ++_i)
+    w[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  clmul_wide(w, x, y);
+  return reduce(w);
+}
+
+/* acc = (acc + b0) * H^4 + b1 * H^3 + b2 * H^2 + b3 * H, with a single reduction. */
+static inline void fmul_pre4(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *text)
+{
+  Lib_IntVector_Intrinsics_vec128 w[2U];
+  for (uint32_t _i = 0U; _i < (uint32_t)2U; ++_i)
+    w[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128 t[2U];
+  for (uint32_t _i = 0U; _i < (uint32_t)2U; ++_i)
+    t[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Lib_IntVector_Intrinsics_vec128
+  b0 =
+    Lib_IntVector_Intrinsics_vec128_xor(ctx[0U],
+      Lib_IntVector_Intrinsics_vec128_load_be(text));
+  clmul_wide(w, b0, ctx[1U]);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)4U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    bi = Lib_IntVector_Intrinsics_vec128_load_be(text + i * (uint32_t)16U);
+    clmul_wide(t, bi, ctx[i + (uint32_t)1U]);
+    w[0U] = Lib_IntVector_Intrinsics_vec128_xor(w[0U], t[0U]);
+    w[1U] = Lib_IntVector_Intrinsics_vec128_xor(w[1U], t[1U]);
+  }
+  ctx[0U] = reduce(w);
+}
+
+void Hacl_Gf128_NI_gcm_init(Lib_IntVector_Intrinsics_vec128 *ctx, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec128 h1 = Lib_IntVector_Intrinsics_vec128_load_be(key);
+  Lib_IntVector_Intrinsics_vec128 h2 = fmul(h1, h1);
+  Lib_IntVector_Intrinsics_vec128 h3 = fmul(h2, h1);
+  Lib_IntVector_Intrinsics_vec128 h4 = fmul(h3, h1);
+  ctx[0U] = Lib_IntVector_Intrinsics_vec128_zero;
+  ctx[1U] = h4;
+  ctx[2U] = h3;
+  ctx[3U] = h2;
+  ctx[4U] = h1;
+}
+
+void
+Hacl_Gf128_NI_gcm_update_blocks(Lib_IntVector_Intrinsics_vec128 *ctx, uint32_t len, uint8_t *text)
+{
+  uint32_t len4 = len / (uint32_t)64U * (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < len4 / (uint32_t)64U; i++)
+  {
+    fmul_pre4(ctx, text + i * (uint32_t)64U);
+  }
+  uint32_t nb = (len - len4) / (uint32_t)16U;
+  uint8_t *rem = text + len4;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    acc =
+      Lib_IntVector_Intrinsics_vec128_xor(ctx[0U],
+        Lib_IntVector_Intrinsics_vec128_load_be(rem + i * (uint32_t)16U));
+    ctx[0U] = fmul(acc, ctx[4U]);
+  }
+}
+
+void
+Hacl_Gf128_NI_gcm_update_padded(Lib_IntVector_Intrinsics_vec128 *ctx, uint32_t len, uint8_t *text)
+{
+  uint32_t len0 = len / (uint32_t)16U * (uint32_t)16U;
+  Hacl_Gf128_NI_gcm_update_blocks(ctx, len0, text);
+  if (len0 < len)
+  {
+    uint8_t last[16U] = { 0U };
+    memcpy(last, text + len0, (len - len0) * sizeof (uint8_t));
+    Hacl_Gf128_NI_gcm_update_blocks(ctx, (uint32_t)16U, last);
+  }
+}
+
+void Hacl_Gf128_NI_gcm_emit(uint8_t *tag, Lib_IntVector_Intrinsics_vec128 *ctx)
+{
+  Lib_IntVector_Intrinsics_vec128_store_be(tag, ctx[0U]);
+}
+
+void Hacl_Gf128_NI_ghash(uint8_t *tag, uint32_t len, uint8_t *text, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec128 ctx[5U];
+  for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  Hacl_Gf128_NI_gcm_init(ctx, key);
+  Hacl_Gf128_NI_gcm_update_padded(ctx, len, text);
+  Hacl_Gf128_NI_gcm_emit(tag, ctx);
+}
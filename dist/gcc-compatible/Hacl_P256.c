@@ -24,6 +24,8 @@
 
 #include "Hacl_P256.h"
 
+#include "Hacl_P256_PrecompTable.h"
+
 static uint64_t isZero_uint64_CT(uint64_t *f)
 {
   uint64_t a0 = f[0U];
@@ -1499,127 +1501,104 @@ scalarMultiplicationL(uint64_t *p, uint64_t *result, uint8_t *scalar, uint64_t *
   norm(q, result, buff);
 }
 
-static void
-scalarMultiplicationC(
-  uint64_t *p,
-  uint64_t *result,
-  const uint8_t *scalar,
-  uint64_t *tempBuffer
-)
+static void precomp_get_consttime(const uint64_t *table, uint64_t bits_l, uint64_t *tmp)
 {
-  uint64_t *q = tempBuffer;
-  zero_buffer(q);
-  uint64_t *buff = tempBuffer + (uint32_t)12U;
-  pointToDomain(p, result);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+  memcpy(tmp, (uint64_t *)table, (uint32_t)12U * sizeof (uint64_t));
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)15U; i0++)
   {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, result);
-    point_add(q, result, result, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, result);
+    uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i0 + (uint32_t)1U));
+    const uint64_t *res_j = table + (i0 + (uint32_t)1U) * (uint32_t)12U;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)12U; i++)
+    {
+      uint64_t *os = tmp;
+      uint64_t x = (c & res_j[i]) | (~c & tmp[i]);
+      os[i] = x;
+    }
   }
-  norm(q, result, buff);
 }
 
-static void uploadBasePoint(uint64_t *p)
+static const
+uint64_t
+prime256order_buffer[4U] =
+  {
+    (uint64_t)17562291160714782033U,
+    (uint64_t)13611842547513532036U,
+    (uint64_t)18446744073709551615U,
+    (uint64_t)18446744069414584320U
+  };
+
+static void reduction_prime_2prime_order(uint64_t *x, uint64_t *result)
 {
-  p[0U] = (uint64_t)8784043285714375740U;
-  p[1U] = (uint64_t)8483257759279461889U;
-  p[2U] = (uint64_t)8789745728267363600U;
-  p[3U] = (uint64_t)1770019616739251654U;
-  p[4U] = (uint64_t)15992936863339206154U;
-  p[5U] = (uint64_t)10037038012062884956U;
-  p[6U] = (uint64_t)15197544864945402661U;
-  p[7U] = (uint64_t)9615747158586711429U;
-  p[8U] = (uint64_t)1U;
-  p[9U] = (uint64_t)18446744069414584320U;
-  p[10U] = (uint64_t)18446744073709551615U;
-  p[11U] = (uint64_t)4294967294U;
+  uint64_t tempBuffer[4U] = { 0U };
+  uint64_t c = sub4_il(x, prime256order_buffer, tempBuffer);
+  cmovznz4(c, tempBuffer, x, result);
 }
 
-static void
-scalarMultiplicationWithoutNorm(
-  uint64_t *p,
-  uint64_t *result,
-  uint8_t *scalar,
-  uint64_t *tempBuffer
-)
-{
-  uint64_t *q = tempBuffer;
-  zero_buffer(q);
-  uint64_t *buff = tempBuffer + (uint32_t)12U;
-  pointToDomain(p, result);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+/*
+  Fixed-base scalar multiplication by G, in constant time.
+
+  The scalar (big-endian) is split into four 64-bit chunks r1..r4 and
+  [r1]G + [r2][2^64]G + [r3][2^128]G + [r4][2^192]G is computed with a shared
+  4-bit window over the precomputed tables of Hacl_P256_PrecompTable.h.
+  point_add is not complete, but for scalars below the group order the
+  accumulator can never be equal to the table point being added, so the
+  exceptional doubling case does not occur. The scalar is therefore first
+  reduced modulo the order; since it is below 2^256 < 2n, one conditional
+  subtraction suffices, and [k]G = [k mod n]G.
+*/
+static void point_mul_g(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
+{
+  uint64_t tmp[12U] = { 0U };
+  uint64_t scalarAsFelem[4U] = { 0U };
+  scalarAsFelem[0U] = load64_be(scalar + (uint32_t)24U);
+  scalarAsFelem[1U] = load64_be(scalar + (uint32_t)16U);
+  scalarAsFelem[2U] = load64_be(scalar + (uint32_t)8U);
+  scalarAsFelem[3U] = load64_be(scalar);
+  reduction_prime_2prime_order(scalarAsFelem, scalarAsFelem);
+  uint64_t r1 = scalarAsFelem[0U];
+  uint64_t r2 = scalarAsFelem[1U];
+  uint64_t r3 = scalarAsFelem[2U];
+  uint64_t r4 = scalarAsFelem[3U];
+  zero_buffer(result);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
   {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, result);
-    point_add(q, result, result, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, result);
+    for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+    {
+      point_double(result, result, tempBuffer);
+    }
+    uint32_t k = (uint32_t)64U - (uint32_t)4U * i - (uint32_t)4U;
+    uint64_t bits_l = r4 >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_P256_PrecompTable_precomp_g_pow2_192_table_w4, bits_l, tmp);
+    point_add(result, tmp, result, tempBuffer);
+    uint64_t bits_l0 = r3 >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_P256_PrecompTable_precomp_g_pow2_128_table_w4, bits_l0, tmp);
+    point_add(result, tmp, result, tempBuffer);
+    uint64_t bits_l1 = r2 >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_P256_PrecompTable_precomp_g_pow2_64_table_w4, bits_l1, tmp);
+    point_add(result, tmp, result, tempBuffer);
+    uint64_t bits_l2 = r1 >> k & (uint64_t)15U;
+    precomp_get_consttime(Hacl_P256_PrecompTable_precomp_basepoint_table_w4, bits_l2, tmp);
+    point_add(result, tmp, result, tempBuffer);
   }
-  copy_point(q, result);
 }
 
 void
 Hacl_Impl_P256_Core_secretToPublic(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
 {
-  uint64_t basePoint[12U] = { 0U };
-  uploadBasePoint(basePoint);
   uint64_t *q = tempBuffer;
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  zero_buffer(q);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
-  {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, basePoint);
-    point_add(q, basePoint, basePoint, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, basePoint);
-  }
+  point_mul_g(q, scalar, buff);
   norm(q, result, buff);
 }
 
 static void secretToPublicWithoutNorm(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
 {
-  uint64_t basePoint[12U] = { 0U };
-  uploadBasePoint(basePoint);
   uint64_t *q = tempBuffer;
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  zero_buffer(q);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
-  {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, basePoint);
-    point_add(q, basePoint, basePoint, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, basePoint);
-  }
+  point_mul_g(q, scalar, buff);
   copy_point(q, result);
 }
 
-static const
-uint64_t
-prime256order_buffer[4U] =
-  {
-    (uint64_t)17562291160714782033U,
-    (uint64_t)13611842547513532036U,
-    (uint64_t)18446744073709551615U,
-    (uint64_t)18446744069414584320U
-  };
-
 static const
 uint8_t
 order_inverse_buffer[32U] =
@@ -1702,13 +1681,6 @@ static void reduction_prime_2prime_with_carry(uint64_t *x, uint64_t *result)
   cmovznz4(carry, tempBuffer, x_, result);
 }
 
-static void reduction_prime_2prime_order(uint64_t *x, uint64_t *result)
-{
-  uint64_t tempBuffer[4U] = { 0U };
-  uint64_t c = sub4_il(x, prime256order_buffer, tempBuffer);
-  cmovznz4(c, tempBuffer, x, result);
-}
-
 static void montgomery_multiplication_ecdsa_module(uint64_t *a, uint64_t *b, uint64_t *result)
 {
   uint64_t t[8U] = { 0U };
@@ -1864,6 +1836,182 @@ static bool isPointAtInfinityPublic(uint64_t *p)
   return z0_zero && z1_zero && z2_zero && z3_zero;
 }
 
+/*
+  This code is not side channel resistant
+*/
+static bool point_equal_vartime(uint64_t *p, uint64_t *q)
+{
+  uint64_t tmp[24U] = { 0U };
+  uint64_t *pZ2 = tmp;
+  uint64_t *qZ2 = tmp + (uint32_t)4U;
+  uint64_t *pZ3 = tmp + (uint32_t)8U;
+  uint64_t *qZ3 = tmp + (uint32_t)12U;
+  uint64_t *a = tmp + (uint32_t)16U;
+  uint64_t *b = tmp + (uint32_t)20U;
+  montgomery_square_buffer(p + (uint32_t)8U, pZ2);
+  montgomery_square_buffer(q + (uint32_t)8U, qZ2);
+  montgomery_multiplication_buffer(p, qZ2, a);
+  montgomery_multiplication_buffer(q, pZ2, b);
+  if (compare_felem(a, b) == (uint64_t)0U)
+  {
+    return false;
+  }
+  montgomery_multiplication_buffer(pZ2, p + (uint32_t)8U, pZ3);
+  montgomery_multiplication_buffer(qZ2, q + (uint32_t)8U, qZ3);
+  montgomery_multiplication_buffer(p + (uint32_t)4U, qZ3, a);
+  montgomery_multiplication_buffer(q + (uint32_t)4U, pZ3, b);
+  return !(compare_felem(a, b) == (uint64_t)0U);
+}
+
+/*
+  This code is not side channel resistant
+
+  point_add returns the point at infinity when both inputs are the same
+  point; this wrapper detects that case and doubles instead.
+*/
+static void point_add_vartime(uint64_t *p, uint64_t *q, uint64_t *result, uint64_t *tempBuffer)
+{
+  uint64_t sum[12U] = { 0U };
+  point_add(p, q, sum, tempBuffer);
+  if
+  (
+    isPointAtInfinityPublic(sum)
+    && !isPointAtInfinityPublic(p)
+    && !isPointAtInfinityPublic(q)
+    && point_equal_vartime(p, q)
+  )
+  {
+    point_double(q, result, tempBuffer);
+  }
+  else
+  {
+    copy_point(sum, result);
+  }
+}
+
+/*
+  Signed sliding-window recoding of a big-endian scalar: r[i] is 0 or odd in
+  [-15, 15] and sum r[i] 2^i is the scalar. Scalars are up to 256 bits wide,
+  so one extra digit is used for the final carry.
+*/
+static void recode_slide_vartime(int8_t *r, uint8_t *a)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+  {
+    r[i] =
+      (int8_t)(a[(uint32_t)31U - (i >> (uint32_t)3U)] >> (i & (uint32_t)7U) & (uint8_t)1U);
+  }
+  r[256U] = (int8_t)0;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)257U; i++)
+  {
+    if (r[i] != (int8_t)0)
+    {
+      for (uint32_t b = (uint32_t)1U; b <= (uint32_t)6U && i + b < (uint32_t)257U; b++)
+      {
+        if (r[i + b] != (int8_t)0)
+        {
+          int32_t rb = (int32_t)r[i + b] << b;
+          if ((int32_t)r[i] + rb <= (int32_t)15)
+          {
+            r[i] = (int8_t)((int32_t)r[i] + rb);
+            r[i + b] = (int8_t)0;
+          }
+          else if ((int32_t)r[i] - rb >= (int32_t)-15)
+          {
+            r[i] = (int8_t)((int32_t)r[i] - rb);
+            for (uint32_t k = i + b; k < (uint32_t)257U; k++)
+            {
+              if (r[k] == (int8_t)0)
+              {
+                r[k] = (int8_t)1;
+                break;
+              }
+              r[k] = (int8_t)0;
+            }
+          }
+          else
+          {
+            break;
+          }
+        }
+      }
+    }
+  }
+}
+
+static void
+point_add_digit_vartime(uint64_t *out, const uint64_t *table, int8_t d, uint64_t *tempBuffer)
+{
+  uint64_t tmp[12U] = { 0U };
+  uint64_t zero[4U] = { 0U };
+  if (d > (int8_t)0)
+  {
+    memcpy(tmp, (uint64_t *)table + (uint32_t)d * (uint32_t)12U, (uint32_t)12U * sizeof (uint64_t));
+    point_add_vartime(out, tmp, out, tempBuffer);
+  }
+  else if (d < (int8_t)0)
+  {
+    memcpy(tmp,
+      (uint64_t *)table + (uint32_t)-d * (uint32_t)12U,
+      (uint32_t)12U * sizeof (uint64_t));
+    p256_sub(zero, tmp + (uint32_t)4U, tmp + (uint32_t)4U);
+    point_add_vartime(out, tmp, out, tempBuffer);
+  }
+}
+
+/*
+  This code is not side channel resistant
+
+  Computes [u1]G + [u2]Q with a single interleaved double-and-add chain
+  (Shamir's trick) over signed sliding windows of both scalars. Odd multiples
+  of G are taken from the fixed-base table of Hacl_P256_PrecompTable.h; those
+  of Q are computed on the fly. q is an affine point not in the Montgomery
+  domain, as produced by bufferToJac.
+*/
+static void
+point_mul_double_g_vartime(
+  uint64_t *result,
+  uint8_t *u1,
+  uint8_t *u2,
+  uint64_t *q,
+  uint64_t *tempBuffer
+)
+{
+  int8_t u1slide[257U] = { 0U };
+  int8_t u2slide[257U] = { 0U };
+  recode_slide_vartime(u1slide, u1);
+  recode_slide_vartime(u2slide, u2);
+  /* table_q[i] = [i]q for odd i in [1, 15]; even entries are unused */
+  uint64_t table_q[192U] = { 0U };
+  uint64_t q2[12U] = { 0U };
+  pointToDomain(q, table_q + (uint32_t)12U);
+  point_double(table_q + (uint32_t)12U, q2, tempBuffer);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    point_add(table_q + ((uint32_t)2U * i - (uint32_t)1U) * (uint32_t)12U,
+      q2,
+      table_q + ((uint32_t)2U * i + (uint32_t)1U) * (uint32_t)12U,
+      tempBuffer);
+  }
+  zero_buffer(result);
+  uint32_t top = (uint32_t)257U;
+  while (top > (uint32_t)0U && u1slide[top - (uint32_t)1U] == (int8_t)0
+    && u2slide[top - (uint32_t)1U] == (int8_t)0)
+  {
+    top--;
+  }
+  for (uint32_t i = top; i > (uint32_t)0U; i--)
+  {
+    uint32_t j = i - (uint32_t)1U;
+    point_double(result, result, tempBuffer);
+    point_add_digit_vartime(result,
+      Hacl_P256_PrecompTable_precomp_basepoint_table_w4,
+      u1slide[j],
+      tempBuffer);
+    point_add_digit_vartime(result, table_q, u2slide[j], tempBuffer);
+  }
+}
+
 /*
   This code is not side channel resistant
 */
@@ -1914,9 +2062,8 @@ static bool isCoordinateValid(uint64_t *p)
 static bool isOrderCorrect(uint64_t *p, uint64_t *tempBuffer)
 {
   uint64_t multResult[12U] = { 0U };
-  uint64_t pBuffer[12U] = { 0U };
-  memcpy(pBuffer, p, (uint32_t)12U * sizeof (uint64_t));
-  scalarMultiplicationC(pBuffer, multResult, order_buffer, tempBuffer);
+  uint8_t zero[32U] = { 0U };
+  point_mul_double_g_vartime(multResult, zero, (uint8_t *)order_buffer, p, tempBuffer);
   bool result = isPointAtInfinityPublic(multResult);
   return result;
 }
@@ -2190,15 +2337,8 @@ ecdsa_verification_(
   Hacl_Impl_P256_LowLevel_toUint8(u1, bufferU1);
   Hacl_Impl_P256_LowLevel_toUint8(u2, bufferU2);
   uint64_t pointSum[12U] = { 0U };
-  uint64_t points[24U] = { 0U };
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  uint64_t *pointU1G = points;
-  uint64_t *pointU2Q0 = points + (uint32_t)12U;
-  secretToPublicWithoutNorm(pointU1G, bufferU1, tempBuffer);
-  scalarMultiplicationWithoutNorm(publicKeyBuffer, pointU2Q0, bufferU2, tempBuffer);
-  uint64_t *pointU1G0 = points;
-  uint64_t *pointU2Q = points + (uint32_t)12U;
-  point_add(pointU1G0, pointU2Q, pointSum, buff);
+  point_mul_double_g_vartime(pointSum, bufferU1, bufferU2, publicKeyBuffer, buff);
   norm(pointSum, pointSum, buff);
   bool resultIsPAI = isPointAtInfinityPublic(pointSum);
   uint64_t *xCoordinateSum = pointSum;
@@ -0,0 +1,99 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_SHA2_Vec256_H
+#define __Hacl_SHA2_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+
+/* Multi-buffer SHA-256 (8 lanes of 32-bit words) and SHA-512 (4 lanes of
+   64-bit words) on 256-bit vectors. These functions require AVX2; callers
+   that need runtime dispatch should go through EverCrypt_Hash_hash_256_multi
+   and EverCrypt_Hash_hash_512_multi instead.
+
+   A SHA-256 lane state is 64 words, word j of lane i being stored at
+   st[8 * j + i]; a SHA-512 lane state is 32 words laid out the same way with
+   4 lanes. The update functions consume n_blocks consecutive blocks from each
+   of the lane pointers in blocks. */
+
+void Hacl_SHA2_Vec256_sha256_init8(uint32_t *st);
+
+void Hacl_SHA2_Vec256_sha256_update8(uint32_t *st, uint8_t **blocks, uint32_t n_blocks);
+
+void
+Hacl_SHA2_Vec256_sha256_update_last8(
+  uint32_t *st,
+  uint64_t prev_len,
+  uint8_t **last,
+  uint32_t last_len
+);
+
+void Hacl_SHA2_Vec256_sha256_finish8(uint32_t *st, uint8_t **dst);
+
+/* Hashes 8 messages of the same length. */
+void Hacl_SHA2_Vec256_sha256_8(uint8_t **dst, uint32_t input_len, uint8_t **inputs);
+
+/* Hashes n messages of arbitrary lengths, 8 at a time. Lanes finish
+   independently, so messages of similar lengths make the best use of the
+   vector width. */
+void
+Hacl_SHA2_Vec256_sha256_multi(uint32_t n, uint8_t **inputs, uint32_t *lens, uint8_t **dst);
+
+void Hacl_SHA2_Vec256_sha512_init4(uint64_t *st);
+
+void Hacl_SHA2_Vec256_sha512_update4(uint64_t *st, uint8_t **blocks, uint32_t n_blocks);
+
+void
+Hacl_SHA2_Vec256_sha512_update_last4(
+  uint64_t *st,
+  uint64_t prev_len,
+  uint8_t **last,
+  uint32_t last_len
+);
+
+void Hacl_SHA2_Vec256_sha512_finish4(uint64_t *st, uint8_t **dst);
+
+void Hacl_SHA2_Vec256_sha512_4(uint8_t **dst, uint32_t input_len, uint8_t **inputs);
+
+void
+Hacl_SHA2_Vec256_sha512_multi(uint32_t n, uint8_t **inputs, uint32_t *lens, uint8_t **dst);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_SHA2_Vec256_H_DEFINED
+#endif
@@ -147,6 +147,12 @@ void Hacl_Impl_SHA3_storeState(uint32_t rateInBytes, uint64_t *s, uint8_t *res)
   Lib_Memzero0_memzero(b, (uint32_t)200U * sizeof (b[0U]));
 }
 
+void Hacl_Impl_SHA3_absorb_inner(uint32_t rateInBytes, uint8_t *block, uint64_t *s)
+{
+  Hacl_Impl_SHA3_loadState(rateInBytes, block, s);
+  Hacl_Impl_SHA3_state_permute(s);
+}
+
 void
 Hacl_Impl_SHA3_absorb(
   uint64_t *s,
@@ -161,8 +167,7 @@ Hacl_Impl_SHA3_absorb(
   for (uint32_t i = (uint32_t)0U; i < nb; i++)
   {
     uint8_t *block = input + i * rateInBytes;
-    Hacl_Impl_SHA3_loadState(rateInBytes, block, s);
-    Hacl_Impl_SHA3_state_permute(s);
+    Hacl_Impl_SHA3_absorb_inner(rateInBytes, block, s);
   }
   uint8_t *last = input + nb * rateInBytes;
   KRML_CHECK_SIZE(sizeof (uint8_t), rateInBytes);
@@ -0,0 +1,419 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_SHA3_Vec256.h"
+
+static const
+uint64_t
+keccak_rndc[24U] =
+  {
+    (uint64_t)0x0000000000000001U, (uint64_t)0x0000000000008082U, (uint64_t)0x800000000000808aU,
+    (uint64_t)0x8000000080008000U, (uint64_t)0x000000000000808bU, (uint64_t)0x0000000080000001U,
+    (uint64_t)0x8000000080008081U, (uint64_t)0x8000000000008009U, (uint64_t)0x000000000000008aU,
+    (uint64_t)0x0000000000000088U, (uint64_t)0x0000000080008009U, (uint64_t)0x000000008000000aU,
+    (uint64_t)0x000000008000808bU, (uint64_t)0x800000000000008bU, (uint64_t)0x8000000000008089U,
+    (uint64_t)0x8000000000008003U, (uint64_t)0x8000000000008002U, (uint64_t)0x8000000000000080U,
+    (uint64_t)0x000000000000800aU, (uint64_t)0x800000008000000aU, (uint64_t)0x8000000080008081U,
+    (uint64_t)0x8000000000008080U, (uint64_t)0x0000000080000001U, (uint64_t)0x8000000080008008U
+  };
+
+static inline void transpose4x4(Lib_IntVector_Intrinsics_vec256 *v)
+{
+  Lib_IntVector_Intrinsics_vec256 v0 = v[0U];
+  Lib_IntVector_Intrinsics_vec256 v1 = v[1U];
+  Lib_IntVector_Intrinsics_vec256 v2 = v[2U];
+  Lib_IntVector_Intrinsics_vec256 v3 = v[3U];
+  Lib_IntVector_Intrinsics_vec256 t0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0, v1);
+  Lib_IntVector_Intrinsics_vec256 t1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0, v1);
+  Lib_IntVector_Intrinsics_vec256 t2 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2, v3);
+  Lib_IntVector_Intrinsics_vec256 t3 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2, v3);
+  v[0U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(t0, t2);
+  v[1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(t1, t3);
+  v[2U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(t0, t2);
+  v[3U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(t1, t3);
+}
+
+void Hacl_SHA3_Vec256_state_permute4(Lib_IntVector_Intrinsics_vec256 *s)
+{
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)24U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256 b[5U];
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+    {
+      b[i] =
+        Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)0U],
+          Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)5U],
+            Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)10U],
+              Lib_IntVector_Intrinsics_vec256_xor(s[i + (uint32_t)15U], s[i + (uint32_t)20U]))));
+    }
+    for (uint32_t i1 = (uint32_t)0U; i1 < (uint32_t)5U; i1++)
+    {
+      Lib_IntVector_Intrinsics_vec256 uu____0 = b[(i1 + (uint32_t)4U) % (uint32_t)5U];
+      Lib_IntVector_Intrinsics_vec256
+      _D =
+        Lib_IntVector_Intrinsics_vec256_xor(uu____0,
+          Lib_IntVector_Intrinsics_vec256_rotate_left64(b[(i1 + (uint32_t)1U) % (uint32_t)5U],
+            (uint32_t)1U));
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+      {
+        s[i1 + (uint32_t)5U * i] =
+          Lib_IntVector_Intrinsics_vec256_xor(s[i1 + (uint32_t)5U * i], _D);
+      }
+    }
+    Lib_IntVector_Intrinsics_vec256 x = s[1U];
+    Lib_IntVector_Intrinsics_vec256 t0 = s[10U];
+    s[10U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(x, (uint32_t)1U);
+    Lib_IntVector_Intrinsics_vec256 t1 = s[7U];
+    s[7U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t0, (uint32_t)3U);
+    Lib_IntVector_Intrinsics_vec256 t2 = s[11U];
+    s[11U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t1, (uint32_t)6U);
+    Lib_IntVector_Intrinsics_vec256 t3 = s[17U];
+    s[17U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t2, (uint32_t)10U);
+    Lib_IntVector_Intrinsics_vec256 t4 = s[18U];
+    s[18U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t3, (uint32_t)15U);
+    Lib_IntVector_Intrinsics_vec256 t5 = s[3U];
+    s[3U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t4, (uint32_t)21U);
+    Lib_IntVector_Intrinsics_vec256 t6 = s[5U];
+    s[5U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t5, (uint32_t)28U);
+    Lib_IntVector_Intrinsics_vec256 t7 = s[16U];
+    s[16U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t6, (uint32_t)36U);
+    Lib_IntVector_Intrinsics_vec256 t8 = s[8U];
+    s[8U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t7, (uint32_t)45U);
+    Lib_IntVector_Intrinsics_vec256 t9 = s[21U];
+    s[21U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t8, (uint32_t)55U);
+    Lib_IntVector_Intrinsics_vec256 t10 = s[24U];
+    s[24U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t9, (uint32_t)2U);
+    Lib_IntVector_Intrinsics_vec256 t11 = s[4U];
+    s[4U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t10, (uint32_t)14U);
+    Lib_IntVector_Intrinsics_vec256 t12 = s[15U];
+    s[15U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t11, (uint32_t)27U);
+    Lib_IntVector_Intrinsics_vec256 t13 = s[23U];
+    s[23U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t12, (uint32_t)41U);
+    Lib_IntVector_Intrinsics_vec256 t14 = s[19U];
+    s[19U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t13, (uint32_t)56U);
+    Lib_IntVector_Intrinsics_vec256 t15 = s[13U];
+    s[13U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t14, (uint32_t)8U);
+    Lib_IntVector_Intrinsics_vec256 t16 = s[12U];
+    s[12U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t15, (uint32_t)25U);
+    Lib_IntVector_Intrinsics_vec256 t17 = s[2U];
+    s[2U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t16, (uint32_t)43U);
+    Lib_IntVector_Intrinsics_vec256 t18 = s[20U];
+    s[20U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t17, (uint32_t)62U);
+    Lib_IntVector_Intrinsics_vec256 t19 = s[14U];
+    s[14U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t18, (uint32_t)18U);
+    Lib_IntVector_Intrinsics_vec256 t20 = s[22U];
+    s[22U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t19, (uint32_t)39U);
+    Lib_IntVector_Intrinsics_vec256 t21 = s[9U];
+    s[9U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t20, (uint32_t)61U);
+    Lib_IntVector_Intrinsics_vec256 t22 = s[6U];
+    s[6U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t21, (uint32_t)20U);
+    s[1U] = Lib_IntVector_Intrinsics_vec256_rotate_left64(t22, (uint32_t)44U);
+    Lib_IntVector_Intrinsics_vec256 b1[25U];
+    memcpy(b1, s, (uint32_t)25U * sizeof (Lib_IntVector_Intrinsics_vec256));
+    for (uint32_t i1 = (uint32_t)0U; i1 < (uint32_t)5U; i1++)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+      {
+        s[i + (uint32_t)5U * i1] =
+          Lib_IntVector_Intrinsics_vec256_xor(b1[i + (uint32_t)5U * i1],
+            Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(b1[(i
+                  + (uint32_t)1U)
+                % (uint32_t)5U
+                + (uint32_t)5U * i1]),
+              b1[(i + (uint32_t)2U) % (uint32_t)5U + (uint32_t)5U * i1]));
+      }
+    }
+    Lib_IntVector_Intrinsics_vec256 c = Lib_IntVector_Intrinsics_vec256_load64(keccak_rndc[i0]);
+    s[0U] = Lib_IntVector_Intrinsics_vec256_xor(s[0U], c);
+  }
+}
+
+void
+Hacl_SHA3_Vec256_loadState4(
+  uint32_t rateInBytes,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3,
+  Lib_IntVector_Intrinsics_vec256 *s
+)
+{
+  uint8_t b[896U] = { 0U };
+  memcpy(b, b0, rateInBytes * sizeof (uint8_t));
+  memcpy(b + (uint32_t)224U, b1, rateInBytes * sizeof (uint8_t));
+  memcpy(b + (uint32_t)448U, b2, rateInBytes * sizeof (uint8_t));
+  memcpy(b + (uint32_t)672U, b3, rateInBytes * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)7U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 v[4U];
+    v[0U] = Lib_IntVector_Intrinsics_vec256_load_le(b + (uint32_t)32U * i);
+    v[1U] = Lib_IntVector_Intrinsics_vec256_load_le(b + (uint32_t)224U + (uint32_t)32U * i);
+    v[2U] = Lib_IntVector_Intrinsics_vec256_load_le(b + (uint32_t)448U + (uint32_t)32U * i);
+    v[3U] = Lib_IntVector_Intrinsics_vec256_load_le(b + (uint32_t)672U + (uint32_t)32U * i);
+    transpose4x4(v);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      if ((uint32_t)4U * i + j < (uint32_t)25U)
+      {
+        s[(uint32_t)4U * i + j] =
+          Lib_IntVector_Intrinsics_vec256_xor(s[(uint32_t)4U * i + j], v[j]);
+      }
+    }
+  }
+  Lib_Memzero0_memzero(b, (uint32_t)896U * sizeof (b[0U]));
+}
+
+void
+Hacl_SHA3_Vec256_storeState4(
+  uint32_t rateInBytes,
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3
+)
+{
+  uint8_t b[896U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)7U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 v[4U];
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      if ((uint32_t)4U * i + j < (uint32_t)25U)
+      {
+        v[j] = s[(uint32_t)4U * i + j];
+      }
+      else
+      {
+        v[j] = Lib_IntVector_Intrinsics_vec256_zero;
+      }
+    }
+    transpose4x4(v);
+    Lib_IntVector_Intrinsics_vec256_store_le(b + (uint32_t)32U * i, v[0U]);
+    Lib_IntVector_Intrinsics_vec256_store_le(b + (uint32_t)224U + (uint32_t)32U * i, v[1U]);
+    Lib_IntVector_Intrinsics_vec256_store_le(b + (uint32_t)448U + (uint32_t)32U * i, v[2U]);
+    Lib_IntVector_Intrinsics_vec256_store_le(b + (uint32_t)672U + (uint32_t)32U * i, v[3U]);
+  }
+  memcpy(b0, b, rateInBytes * sizeof (uint8_t));
+  memcpy(b1, b + (uint32_t)224U, rateInBytes * sizeof (uint8_t));
+  memcpy(b2, b + (uint32_t)448U, rateInBytes * sizeof (uint8_t));
+  memcpy(b3, b + (uint32_t)672U, rateInBytes * sizeof (uint8_t));
+  Lib_Memzero0_memzero(b, (uint32_t)896U * sizeof (b[0U]));
+}
+
+void
+Hacl_SHA3_Vec256_absorb4(
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t delimitedSuffix
+)
+{
+  uint32_t nb = inputByteLen / rateInBytes;
+  uint32_t rem = inputByteLen % rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    Hacl_SHA3_Vec256_loadState4(rateInBytes,
+      input0 + i * rateInBytes,
+      input1 + i * rateInBytes,
+      input2 + i * rateInBytes,
+      input3 + i * rateInBytes,
+      s);
+    Hacl_SHA3_Vec256_state_permute4(s);
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)4U * rateInBytes);
+  uint8_t b[(uint32_t)4U * rateInBytes];
+  memset(b, 0U, (uint32_t)4U * rateInBytes * sizeof (uint8_t));
+  uint8_t *b0 = b;
+  uint8_t *b1 = b + rateInBytes;
+  uint8_t *b2 = b + (uint32_t)2U * rateInBytes;
+  uint8_t *b3 = b + (uint32_t)3U * rateInBytes;
+  memcpy(b0, input0 + nb * rateInBytes, rem * sizeof (uint8_t));
+  memcpy(b1, input1 + nb * rateInBytes, rem * sizeof (uint8_t));
+  memcpy(b2, input2 + nb * rateInBytes, rem * sizeof (uint8_t));
+  memcpy(b3, input3 + nb * rateInBytes, rem * sizeof (uint8_t));
+  b0[rem] = delimitedSuffix;
+  b1[rem] = delimitedSuffix;
+  b2[rem] = delimitedSuffix;
+  b3[rem] = delimitedSuffix;
+  Hacl_SHA3_Vec256_loadState4(rateInBytes, b0, b1, b2, b3, s);
+  if (!((delimitedSuffix & (uint8_t)0x80U) == (uint8_t)0U) && rem == rateInBytes - (uint32_t)1U)
+  {
+    Hacl_SHA3_Vec256_state_permute4(s);
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), rateInBytes);
+  uint8_t b10[rateInBytes];
+  memset(b10, 0U, rateInBytes * sizeof (uint8_t));
+  b10[rateInBytes - (uint32_t)1U] = (uint8_t)0x80U;
+  Hacl_SHA3_Vec256_loadState4(rateInBytes, b10, b10, b10, b10, s);
+  Hacl_SHA3_Vec256_state_permute4(s);
+  Lib_Memzero0_memzero(b, (uint32_t)4U * rateInBytes * sizeof (b[0U]));
+}
+
+void
+Hacl_SHA3_Vec256_squeeze4(
+  Lib_IntVector_Intrinsics_vec256 *s,
+  uint32_t rateInBytes,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  uint32_t outBlocks = outputByteLen / rateInBytes;
+  uint32_t remOut = outputByteLen % rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < outBlocks; i++)
+  {
+    Hacl_SHA3_Vec256_storeState4(rateInBytes,
+      s,
+      output0 + i * rateInBytes,
+      output1 + i * rateInBytes,
+      output2 + i * rateInBytes,
+      output3 + i * rateInBytes);
+    Hacl_SHA3_Vec256_state_permute4(s);
+  }
+  uint32_t ofs = outputByteLen - remOut;
+  Hacl_SHA3_Vec256_storeState4(remOut,
+    s,
+    output0 + ofs,
+    output1 + ofs,
+    output2 + ofs,
+    output3 + ofs);
+}
+
+void
+Hacl_SHA3_Vec256_keccak4(
+  uint32_t rate,
+  uint32_t capacity,
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t delimitedSuffix,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  uint32_t rateInBytes = rate / (uint32_t)8U;
+  Lib_IntVector_Intrinsics_vec256 s[25U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)25U; i++)
+  {
+    s[i] = Lib_IntVector_Intrinsics_vec256_zero;
+  }
+  Hacl_SHA3_Vec256_absorb4(s,
+    rateInBytes,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    delimitedSuffix);
+  Hacl_SHA3_Vec256_squeeze4(s, rateInBytes, outputByteLen, output0, output1, output2, output3);
+}
+
+void
+Hacl_SHA3_Vec256_shake128_4(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Hacl_SHA3_Vec256_keccak4((uint32_t)1344U,
+    (uint32_t)256U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint8_t)0x1FU,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
+void
+Hacl_SHA3_Vec256_cshake128_frodo4(
+  uint32_t inputByteLen,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint16_t ctr0,
+  uint16_t ctr1,
+  uint16_t ctr2,
+  uint16_t ctr3,
+  uint32_t outputByteLen,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Lib_IntVector_Intrinsics_vec256 s[25U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)25U; i++)
+  {
+    s[i] = Lib_IntVector_Intrinsics_vec256_zero;
+  }
+  s[0U] =
+    Lib_IntVector_Intrinsics_vec256_load64s((uint64_t)0x10010001a801U
+      | (uint64_t)ctr0 << (uint32_t)48U,
+      (uint64_t)0x10010001a801U | (uint64_t)ctr1 << (uint32_t)48U,
+      (uint64_t)0x10010001a801U | (uint64_t)ctr2 << (uint32_t)48U,
+      (uint64_t)0x10010001a801U | (uint64_t)ctr3 << (uint32_t)48U);
+  Hacl_SHA3_Vec256_state_permute4(s);
+  Hacl_SHA3_Vec256_absorb4(s,
+    (uint32_t)168U,
+    inputByteLen,
+    input0,
+    input1,
+    input2,
+    input3,
+    (uint8_t)0x04U);
+  Hacl_SHA3_Vec256_squeeze4(s,
+    (uint32_t)168U,
+    outputByteLen,
+    output0,
+    output1,
+    output2,
+    output3);
+}
+
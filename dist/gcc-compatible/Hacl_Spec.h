@@ -47,6 +47,12 @@ extern "C" {
 #define Spec_Hash_Definitions_MD5 5
 #define Spec_Hash_Definitions_Blake2S 6
 #define Spec_Hash_Definitions_Blake2B 7
+#define Spec_Hash_Definitions_SHA3_256 8
+#define Spec_Hash_Definitions_SHA3_224 9
+#define Spec_Hash_Definitions_SHA3_384 10
+#define Spec_Hash_Definitions_SHA3_512 11
+#define Spec_Hash_Definitions_Shake128 12
+#define Spec_Hash_Definitions_Shake256 13
 
 typedef uint8_t Spec_Hash_Definitions_hash_alg;
 
@@ -71,6 +77,8 @@ typedef uint8_t Spec_Agile_Cipher_cipher_alg;
 #define Spec_Cipher_Expansion_Hacl_CHACHA20 0
 #define Spec_Cipher_Expansion_Vale_AES128 1
 #define Spec_Cipher_Expansion_Vale_AES256 2
+#define Spec_Cipher_Expansion_Hacl_AES128 3
+#define Spec_Cipher_Expansion_Hacl_AES256 4
 
 typedef uint8_t Spec_Cipher_Expansion_impl;
 
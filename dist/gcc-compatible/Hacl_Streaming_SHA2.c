@@ -24,6 +24,9 @@
 
 #include "Hacl_Streaming_SHA2.h"
 
+#include "Hacl_SHA2_Vec256.h"
+#include "EverCrypt_AutoConfig2.h"
+
 typedef struct Hacl_Streaming_Functor_state_s___uint32_t_____s
 {
   uint32_t *block_state;
@@ -506,6 +509,238 @@ void Hacl_Streaming_SHA2_free_256(Hacl_Streaming_Functor_state_s___uint32_t____
   KRML_HOST_FREE(s);
 }
 
+typedef struct Hacl_Streaming_SHA2_state_256_x8_s
+{
+  bool vec256;
+  uint32_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+Hacl_Streaming_SHA2_state_256_x8;
+
+/* The lanes run on the AVX2 kernels of Hacl_SHA2_Vec256 when the target and
+   the CPU have them, and otherwise one after the other on the scalar code, lane
+   i at block_state + 8 * i. The two layouts differ, so the choice is made once
+   at creation and kept in the state. */
+static bool lanes_vec256()
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  return EverCrypt_AutoConfig2_has_avx2();
+  #else
+  return false;
+  #endif
+}
+
+static void init_256_lanes(bool vec256, uint32_t *st)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (vec256)
+  {
+    Hacl_SHA2_Vec256_sha256_init8(st);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Hacl_Hash_Core_SHA2_init_256(st + i * (uint32_t)8U);
+  }
+}
+
+static void update_256_lanes(bool vec256, uint32_t *st, uint8_t **blocks, uint32_t n_blocks)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (vec256)
+  {
+    Hacl_SHA2_Vec256_sha256_update8(st, blocks, n_blocks);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Hacl_Hash_SHA2_update_multi_256(st + i * (uint32_t)8U, blocks[i], n_blocks);
+  }
+}
+
+static void
+update_last_256_lanes(
+  bool vec256,
+  uint32_t *st,
+  uint64_t prev_len,
+  uint8_t **last,
+  uint32_t last_len
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (vec256)
+  {
+    Hacl_SHA2_Vec256_sha256_update_last8(st, prev_len, last, last_len);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Hacl_Hash_SHA2_update_last_256(st + i * (uint32_t)8U, prev_len, last[i], last_len);
+  }
+}
+
+static void finish_256_lanes(bool vec256, uint32_t *st, uint8_t **dst)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (vec256)
+  {
+    Hacl_SHA2_Vec256_sha256_finish8(st, dst);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    Hacl_Hash_Core_SHA2_finish_256(st + i * (uint32_t)8U, dst[i]);
+  }
+}
+
+Hacl_Streaming_SHA2_state_256_x8 *Hacl_Streaming_SHA2_create_in_256_x8()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)512U, sizeof (uint8_t));
+  uint32_t *block_state = KRML_HOST_CALLOC((uint32_t)64U, sizeof (uint32_t));
+  bool vec256 = lanes_vec256();
+  Hacl_Streaming_SHA2_state_256_x8
+  s =
+    {
+      .vec256 = vec256,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = (uint64_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA2_state_256_x8), (uint32_t)1U);
+  Hacl_Streaming_SHA2_state_256_x8
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA2_state_256_x8));
+  p[0U] = s;
+  init_256_lanes(vec256, block_state);
+  return p;
+}
+
+void Hacl_Streaming_SHA2_init_256_x8(Hacl_Streaming_SHA2_state_256_x8 *s)
+{
+  Hacl_Streaming_SHA2_state_256_x8 scrut = *s;
+  bool vec256 = scrut.vec256;
+  uint8_t *buf = scrut.buf;
+  uint32_t *block_state = scrut.block_state;
+  init_256_lanes(vec256, block_state);
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA2_state_256_x8){
+        .vec256 = vec256,
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+}
+
+void
+Hacl_Streaming_SHA2_update_256_x8(
+  Hacl_Streaming_SHA2_state_256_x8 *p,
+  uint8_t **data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA2_state_256_x8 s = *p;
+  bool vec256 = s.vec256;
+  uint32_t *block_state = s.block_state;
+  uint8_t *buf = s.buf;
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)64U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)64U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)64U);
+  }
+  uint8_t *bufs[8U];
+  uint8_t *src[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    bufs[i] = buf + i * (uint32_t)64U;
+    src[i] = data[i];
+  }
+  uint32_t rest = len;
+  if (sz > (uint32_t)0U && rest > (uint32_t)64U - sz)
+  {
+    uint32_t diff = (uint32_t)64U - sz;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      memcpy(bufs[i] + sz, src[i], diff * sizeof (uint8_t));
+      src[i] = src[i] + diff;
+    }
+    update_256_lanes(vec256, block_state, bufs, (uint32_t)1U);
+    rest = rest - diff;
+    sz = (uint32_t)0U;
+  }
+  if (sz == (uint32_t)0U && rest > (uint32_t)0U)
+  {
+    uint32_t n_blocks = (rest - (uint32_t)1U) / (uint32_t)64U;
+    update_256_lanes(vec256, block_state, src, n_blocks);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+    {
+      src[i] = src[i] + n_blocks * (uint32_t)64U;
+    }
+    rest = rest - n_blocks * (uint32_t)64U;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    memcpy(bufs[i] + sz, src[i], rest * sizeof (uint8_t));
+  }
+  p[0U] =
+    (
+      (Hacl_Streaming_SHA2_state_256_x8){
+        .vec256 = vec256,
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = total_len + (uint64_t)len
+      }
+    );
+}
+
+void Hacl_Streaming_SHA2_finish_256_x8(Hacl_Streaming_SHA2_state_256_x8 *p, uint8_t **dst)
+{
+  Hacl_Streaming_SHA2_state_256_x8 scrut = *p;
+  bool vec256 = scrut.vec256;
+  uint32_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)64U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)64U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)64U);
+  }
+  uint8_t *bufs[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    bufs[i] = buf_ + i * (uint32_t)64U;
+  }
+  uint32_t tmp_block_state[64U] = { 0U };
+  memcpy(tmp_block_state, block_state, (uint32_t)64U * sizeof (uint32_t));
+  uint64_t prev_len = total_len - (uint64_t)r;
+  update_last_256_lanes(vec256, tmp_block_state, prev_len, bufs, r);
+  finish_256_lanes(vec256, tmp_block_state, dst);
+}
+
+void Hacl_Streaming_SHA2_free_256_x8(Hacl_Streaming_SHA2_state_256_x8 *s)
+{
+  Hacl_Streaming_SHA2_state_256_x8 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint32_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
 typedef struct Hacl_Streaming_Functor_state_s___uint64_t_____s
 {
   uint64_t *block_state;
@@ -994,3 +1229,225 @@ void Hacl_Streaming_SHA2_free_512(Hacl_Streaming_Functor_state_s___uint64_t____
   KRML_HOST_FREE(s);
 }
 
+typedef struct Hacl_Streaming_SHA2_state_512_x4_s
+{
+  bool vec256;
+  uint64_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+Hacl_Streaming_SHA2_state_512_x4;
+
+static void init_512_lanes(bool vec256, uint64_t *st)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (vec256)
+  {
+    Hacl_SHA2_Vec256_sha512_init4(st);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Hacl_Hash_Core_SHA2_init_512(st + i * (uint32_t)8U);
+  }
+}
+
+static void update_512_lanes(bool vec256, uint64_t *st, uint8_t **blocks, uint32_t n_blocks)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (vec256)
+  {
+    Hacl_SHA2_Vec256_sha512_update4(st, blocks, n_blocks);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Hacl_Hash_SHA2_update_multi_512(st + i * (uint32_t)8U, blocks[i], n_blocks);
+  }
+}
+
+static void
+update_last_512_lanes(
+  bool vec256,
+  uint64_t *st,
+  uint64_t prev_len,
+  uint8_t **last,
+  uint32_t last_len
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (vec256)
+  {
+    Hacl_SHA2_Vec256_sha512_update_last4(st, prev_len, last, last_len);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Hacl_Hash_SHA2_update_last_512(st + i * (uint32_t)8U,
+      FStar_UInt128_uint64_to_uint128(prev_len),
+      last[i],
+      last_len);
+  }
+}
+
+static void finish_512_lanes(bool vec256, uint64_t *st, uint8_t **dst)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (vec256)
+  {
+    Hacl_SHA2_Vec256_sha512_finish4(st, dst);
+    return;
+  }
+  #endif
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    Hacl_Hash_Core_SHA2_finish_512(st + i * (uint32_t)8U, dst[i]);
+  }
+}
+
+Hacl_Streaming_SHA2_state_512_x4 *Hacl_Streaming_SHA2_create_in_512_x4()
+{
+  uint8_t *buf = KRML_HOST_CALLOC((uint32_t)512U, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint64_t));
+  bool vec256 = lanes_vec256();
+  Hacl_Streaming_SHA2_state_512_x4
+  s =
+    {
+      .vec256 = vec256,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = (uint64_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA2_state_512_x4), (uint32_t)1U);
+  Hacl_Streaming_SHA2_state_512_x4
+  *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA2_state_512_x4));
+  p[0U] = s;
+  init_512_lanes(vec256, block_state);
+  return p;
+}
+
+void Hacl_Streaming_SHA2_init_512_x4(Hacl_Streaming_SHA2_state_512_x4 *s)
+{
+  Hacl_Streaming_SHA2_state_512_x4 scrut = *s;
+  bool vec256 = scrut.vec256;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  init_512_lanes(vec256, block_state);
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA2_state_512_x4){
+        .vec256 = vec256,
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+}
+
+void
+Hacl_Streaming_SHA2_update_512_x4(
+  Hacl_Streaming_SHA2_state_512_x4 *p,
+  uint8_t **data,
+  uint32_t len
+)
+{
+  Hacl_Streaming_SHA2_state_512_x4 s = *p;
+  bool vec256 = s.vec256;
+  uint64_t *block_state = s.block_state;
+  uint8_t *buf = s.buf;
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  if (total_len % (uint64_t)(uint32_t)128U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = (uint32_t)128U;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)(uint32_t)128U);
+  }
+  uint8_t *bufs[4U];
+  uint8_t *src[4U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    bufs[i] = buf + i * (uint32_t)128U;
+    src[i] = data[i];
+  }
+  uint32_t rest = len;
+  if (sz > (uint32_t)0U && rest > (uint32_t)128U - sz)
+  {
+    uint32_t diff = (uint32_t)128U - sz;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      memcpy(bufs[i] + sz, src[i], diff * sizeof (uint8_t));
+      src[i] = src[i] + diff;
+    }
+    update_512_lanes(vec256, block_state, bufs, (uint32_t)1U);
+    rest = rest - diff;
+    sz = (uint32_t)0U;
+  }
+  if (sz == (uint32_t)0U && rest > (uint32_t)0U)
+  {
+    uint32_t n_blocks = (rest - (uint32_t)1U) / (uint32_t)128U;
+    update_512_lanes(vec256, block_state, src, n_blocks);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+    {
+      src[i] = src[i] + n_blocks * (uint32_t)128U;
+    }
+    rest = rest - n_blocks * (uint32_t)128U;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    memcpy(bufs[i] + sz, src[i], rest * sizeof (uint8_t));
+  }
+  p[0U] =
+    (
+      (Hacl_Streaming_SHA2_state_512_x4){
+        .vec256 = vec256,
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = total_len + (uint64_t)len
+      }
+    );
+}
+
+void Hacl_Streaming_SHA2_finish_512_x4(Hacl_Streaming_SHA2_state_512_x4 *p, uint8_t **dst)
+{
+  Hacl_Streaming_SHA2_state_512_x4 scrut = *p;
+  bool vec256 = scrut.vec256;
+  uint64_t *block_state = scrut.block_state;
+  uint8_t *buf_ = scrut.buf;
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)(uint32_t)128U == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = (uint32_t)128U;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)(uint32_t)128U);
+  }
+  uint8_t *bufs[4U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    bufs[i] = buf_ + i * (uint32_t)128U;
+  }
+  uint64_t tmp_block_state[32U] = { 0U };
+  memcpy(tmp_block_state, block_state, (uint32_t)32U * sizeof (uint64_t));
+  uint64_t prev_len = total_len - (uint64_t)r;
+  update_last_512_lanes(vec256, tmp_block_state, prev_len, bufs, r);
+  finish_512_lanes(vec256, tmp_block_state, dst);
+}
+
+void Hacl_Streaming_SHA2_free_512_x4(Hacl_Streaming_SHA2_state_512_x4 *s)
+{
+  Hacl_Streaming_SHA2_state_512_x4 scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
@@ -75,6 +75,27 @@ Hacl_Streaming_SHA2_finish_256(Hacl_Streaming_Functor_state_s___uint32_t____ *p,
 
 void Hacl_Streaming_SHA2_free_256(Hacl_Streaming_Functor_state_s___uint32_t____ *s);
 
+/* Multi-message mode: eight SHA-256 computations advanced in lockstep by the
+   multi-buffer kernels of Hacl_SHA2_Vec256 on AVX2, and lane by lane elsewhere.
+   Each update appends len bytes from data[i] to message i, and finish writes
+   digest i to dst[i]. */
+typedef struct Hacl_Streaming_SHA2_state_256_x8_s Hacl_Streaming_SHA2_state_256_x8;
+
+Hacl_Streaming_SHA2_state_256_x8 *Hacl_Streaming_SHA2_create_in_256_x8();
+
+void Hacl_Streaming_SHA2_init_256_x8(Hacl_Streaming_SHA2_state_256_x8 *s);
+
+void
+Hacl_Streaming_SHA2_update_256_x8(
+  Hacl_Streaming_SHA2_state_256_x8 *p,
+  uint8_t **data,
+  uint32_t len
+);
+
+void Hacl_Streaming_SHA2_finish_256_x8(Hacl_Streaming_SHA2_state_256_x8 *p, uint8_t **dst);
+
+void Hacl_Streaming_SHA2_free_256_x8(Hacl_Streaming_SHA2_state_256_x8 *s);
+
 typedef struct Hacl_Streaming_Functor_state_s___uint64_t_____s
 Hacl_Streaming_Functor_state_s___uint64_t____;
 
@@ -110,6 +131,24 @@ Hacl_Streaming_SHA2_finish_512(Hacl_Streaming_Functor_state_s___uint64_t____ *p,
 
 void Hacl_Streaming_SHA2_free_512(Hacl_Streaming_Functor_state_s___uint64_t____ *s);
 
+/* Four SHA-512 computations advanced in lockstep; see the SHA-256 variant. */
+typedef struct Hacl_Streaming_SHA2_state_512_x4_s Hacl_Streaming_SHA2_state_512_x4;
+
+Hacl_Streaming_SHA2_state_512_x4 *Hacl_Streaming_SHA2_create_in_512_x4();
+
+void Hacl_Streaming_SHA2_init_512_x4(Hacl_Streaming_SHA2_state_512_x4 *s);
+
+void
+Hacl_Streaming_SHA2_update_512_x4(
+  Hacl_Streaming_SHA2_state_512_x4 *p,
+  uint8_t **data,
+  uint32_t len
+);
+
+void Hacl_Streaming_SHA2_finish_512_x4(Hacl_Streaming_SHA2_state_512_x4 *p, uint8_t **dst);
+
+void Hacl_Streaming_SHA2_free_512_x4(Hacl_Streaming_SHA2_state_512_x4 *s);
+
 #if defined(__cplusplus)
 }
 #endif
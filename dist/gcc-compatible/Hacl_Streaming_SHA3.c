@@ -0,0 +1,285 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Streaming_SHA3.h"
+
+struct Hacl_Streaming_SHA3_state_s
+{
+  Spec_Hash_Definitions_hash_alg alg;
+  uint64_t *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+  bool squeezing;
+  uint32_t squeezed;
+};
+
+static uint8_t suffix(Spec_Hash_Definitions_hash_alg a)
+{
+  if (a == Spec_Hash_Definitions_Shake128 || a == Spec_Hash_Definitions_Shake256)
+  {
+    return (uint8_t)0x1FU;
+  }
+  return (uint8_t)0x06U;
+}
+
+static void abort_squeezing()
+{
+  KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
+    __FILE__,
+    __LINE__,
+    "Hacl_Streaming_SHA3: the state has started squeezing");
+  KRML_HOST_EXIT(255U);
+}
+
+Hacl_Streaming_SHA3_state *Hacl_Streaming_SHA3_create_in(Spec_Hash_Definitions_hash_alg a)
+{
+  uint32_t rateInBytes = Hacl_Hash_Definitions_block_len(a);
+  KRML_CHECK_SIZE(sizeof (uint8_t), rateInBytes);
+  uint8_t *buf = KRML_HOST_CALLOC(rateInBytes, sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state
+  s =
+    {
+      .alg = a,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = (uint64_t)0U,
+      .squeezing = false,
+      .squeezed = (uint32_t)0U
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state));
+  p[0U] = s;
+  return p;
+}
+
+void Hacl_Streaming_SHA3_init(Hacl_Streaming_SHA3_state *s)
+{
+  Hacl_Streaming_SHA3_state scrut = *s;
+  memset(scrut.block_state, 0U, (uint32_t)25U * sizeof (uint64_t));
+  s[0U] =
+    (
+      (Hacl_Streaming_SHA3_state){
+        .alg = scrut.alg,
+        .block_state = scrut.block_state,
+        .buf = scrut.buf,
+        .total_len = (uint64_t)0U,
+        .squeezing = false,
+        .squeezed = (uint32_t)0U
+      }
+    );
+}
+
+void Hacl_Streaming_SHA3_update(Hacl_Streaming_SHA3_state *p, uint8_t *data, uint32_t len)
+{
+  Hacl_Streaming_SHA3_state s = *p;
+  if (s.squeezing)
+  {
+    abort_squeezing();
+  }
+  uint32_t rateInBytes = Hacl_Hash_Definitions_block_len(s.alg);
+  uint64_t total_len = s.total_len;
+  uint32_t sz;
+  if (total_len % (uint64_t)rateInBytes == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    sz = rateInBytes;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)rateInBytes);
+  }
+  if (len <= rateInBytes - sz)
+  {
+    memcpy(s.buf + sz, data, len * sizeof (uint8_t));
+    p->total_len = total_len + (uint64_t)len;
+    return;
+  }
+  /* Complete the buffered block and absorb it, then absorb all the full blocks
+     of data but the last one, which stays buffered along with any remainder. */
+  uint32_t diff = rateInBytes - sz;
+  if (!(sz == (uint32_t)0U))
+  {
+    memcpy(s.buf + sz, data, diff * sizeof (uint8_t));
+    Hacl_Impl_SHA3_absorb_inner(rateInBytes, s.buf, s.block_state);
+  }
+  else
+  {
+    diff = (uint32_t)0U;
+  }
+  uint32_t len1 = len - diff;
+  uint8_t *data1 = data + diff;
+  uint32_t ite;
+  if (len1 % rateInBytes == (uint32_t)0U && len1 > (uint32_t)0U)
+  {
+    ite = rateInBytes;
+  }
+  else
+  {
+    ite = len1 % rateInBytes;
+  }
+  uint32_t n_blocks = (len1 - ite) / rateInBytes;
+  for (uint32_t i = (uint32_t)0U; i < n_blocks; i++)
+  {
+    Hacl_Impl_SHA3_absorb_inner(rateInBytes, data1 + i * rateInBytes, s.block_state);
+  }
+  memcpy(s.buf, data1 + n_blocks * rateInBytes, ite * sizeof (uint8_t));
+  p->total_len = total_len + (uint64_t)len;
+}
+
+void Hacl_Streaming_SHA3_finish(Hacl_Streaming_SHA3_state *p, uint8_t *dst)
+{
+  Hacl_Streaming_SHA3_state scrut = *p;
+  if (scrut.squeezing)
+  {
+    abort_squeezing();
+  }
+  uint32_t rateInBytes = Hacl_Hash_Definitions_block_len(scrut.alg);
+  uint64_t total_len = scrut.total_len;
+  uint32_t r;
+  if (total_len % (uint64_t)rateInBytes == (uint64_t)0U && total_len > (uint64_t)0U)
+  {
+    r = rateInBytes;
+  }
+  else
+  {
+    r = (uint32_t)(total_len % (uint64_t)rateInBytes);
+  }
+  uint64_t tmp_block_state[25U] = { 0U };
+  memcpy(tmp_block_state, scrut.block_state, (uint32_t)25U * sizeof (uint64_t));
+  Hacl_Impl_SHA3_absorb(tmp_block_state, rateInBytes, r, scrut.buf, suffix(scrut.alg));
+  Hacl_Impl_SHA3_squeeze(tmp_block_state,
+    rateInBytes,
+    Hacl_Hash_Definitions_hash_len(scrut.alg),
+    dst);
+  Lib_Memzero0_memzero(tmp_block_state, (uint32_t)25U * sizeof (tmp_block_state[0U]));
+}
+
+void Hacl_Streaming_SHA3_squeeze(Hacl_Streaming_SHA3_state *p, uint8_t *dst, uint32_t len)
+{
+  Hacl_Streaming_SHA3_state scrut = *p;
+  uint32_t rateInBytes = Hacl_Hash_Definitions_block_len(scrut.alg);
+  uint64_t *s = scrut.block_state;
+  uint8_t *buf = scrut.buf;
+  uint32_t squeezed = scrut.squeezed;
+  if (!scrut.squeezing)
+  {
+    /* Pad and absorb the buffered input; buf then holds the first output
+       block, of which nothing has been returned yet. */
+    uint64_t total_len = scrut.total_len;
+    uint32_t r;
+    if (total_len % (uint64_t)rateInBytes == (uint64_t)0U && total_len > (uint64_t)0U)
+    {
+      r = rateInBytes;
+    }
+    else
+    {
+      r = (uint32_t)(total_len % (uint64_t)rateInBytes);
+    }
+    Hacl_Impl_SHA3_absorb(s, rateInBytes, r, buf, suffix(scrut.alg));
+    Hacl_Impl_SHA3_storeState(rateInBytes, s, buf);
+    squeezed = (uint32_t)0U;
+  }
+  uint32_t avail = rateInBytes - squeezed;
+  if (len <= avail)
+  {
+    memcpy(dst, buf + squeezed, len * sizeof (uint8_t));
+    squeezed = squeezed + len;
+  }
+  else
+  {
+    memcpy(dst, buf + squeezed, avail * sizeof (uint8_t));
+    uint32_t len1 = len - avail;
+    uint8_t *dst1 = dst + avail;
+    uint32_t n_blocks = len1 / rateInBytes;
+    uint32_t rem = len1 % rateInBytes;
+    for (uint32_t i = (uint32_t)0U; i < n_blocks; i++)
+    {
+      Hacl_Impl_SHA3_state_permute(s);
+      Hacl_Impl_SHA3_storeState(rateInBytes, s, dst1 + i * rateInBytes);
+    }
+    if (rem == (uint32_t)0U)
+    {
+      /* The last block went straight to dst: mark buf as used up, the next
+         call permutes before returning anything. */
+      squeezed = rateInBytes;
+    }
+    else
+    {
+      Hacl_Impl_SHA3_state_permute(s);
+      Hacl_Impl_SHA3_storeState(rateInBytes, s, buf);
+      memcpy(dst1 + n_blocks * rateInBytes, buf, rem * sizeof (uint8_t));
+      squeezed = rem;
+    }
+  }
+  p->squeezing = true;
+  p->squeezed = squeezed;
+}
+
+Hacl_Streaming_SHA3_state *Hacl_Streaming_SHA3_copy(Hacl_Streaming_SHA3_state *s0)
+{
+  Hacl_Streaming_SHA3_state scrut = *s0;
+  uint32_t rateInBytes = Hacl_Hash_Definitions_block_len(scrut.alg);
+  KRML_CHECK_SIZE(sizeof (uint8_t), rateInBytes);
+  uint8_t *buf = KRML_HOST_CALLOC(rateInBytes, sizeof (uint8_t));
+  memcpy(buf, scrut.buf, rateInBytes * sizeof (uint8_t));
+  uint64_t *block_state = KRML_HOST_CALLOC((uint32_t)25U, sizeof (uint64_t));
+  memcpy(block_state, scrut.block_state, (uint32_t)25U * sizeof (uint64_t));
+  Hacl_Streaming_SHA3_state
+  s =
+    {
+      .alg = scrut.alg,
+      .block_state = block_state,
+      .buf = buf,
+      .total_len = scrut.total_len,
+      .squeezing = scrut.squeezing,
+      .squeezed = scrut.squeezed
+    };
+  KRML_CHECK_SIZE(sizeof (Hacl_Streaming_SHA3_state), (uint32_t)1U);
+  Hacl_Streaming_SHA3_state *p = KRML_HOST_MALLOC(sizeof (Hacl_Streaming_SHA3_state));
+  p[0U] = s;
+  return p;
+}
+
+Spec_Hash_Definitions_hash_alg Hacl_Streaming_SHA3_get_alg(Hacl_Streaming_SHA3_state *s)
+{
+  return s->alg;
+}
+
+bool Hacl_Streaming_SHA3_is_shake(Hacl_Streaming_SHA3_state *s)
+{
+  Spec_Hash_Definitions_hash_alg a = s->alg;
+  return a == Spec_Hash_Definitions_Shake128 || a == Spec_Hash_Definitions_Shake256;
+}
+
+void Hacl_Streaming_SHA3_free(Hacl_Streaming_SHA3_state *s)
+{
+  Hacl_Streaming_SHA3_state scrut = *s;
+  uint8_t *buf = scrut.buf;
+  uint64_t *block_state = scrut.block_state;
+  Lib_Memzero0_memzero(block_state, (uint32_t)25U * sizeof (block_state[0U]));
+  KRML_HOST_FREE(block_state);
+  KRML_HOST_FREE(buf);
+  KRML_HOST_FREE(s);
+}
+
@@ -0,0 +1,85 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Streaming_SHA3_H
+#define __Hacl_Streaming_SHA3_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Spec.h"
+#include "Hacl_Hash.h"
+#include "Hacl_SHA3.h"
+
+/* Incremental SHA3-224/256/384/512 and SHAKE128/256, for any of the
+   Spec_Hash_Definitions_SHA3_* and Spec_Hash_Definitions_Shake* algorithms.
+
+   Input is absorbed with update, buffering at most one rate-sized block, so
+   that inputs of any total length can be hashed in pieces. finish leaves the
+   state untouched and can be called at any point to obtain the digest of the
+   input so far; for the SHAKE variants it produces Hacl_Hash_Definitions_hash_len
+   bytes.
+
+   squeeze ends the absorbing phase and returns the next len bytes of the
+   output stream; successive calls continue the same stream, so that an XOF
+   output of any length can be produced in pieces. Once squeeze has been
+   called, neither update nor finish may be called until the state is reset
+   with init. */
+
+typedef struct Hacl_Streaming_SHA3_state_s Hacl_Streaming_SHA3_state;
+
+Hacl_Streaming_SHA3_state *Hacl_Streaming_SHA3_create_in(Spec_Hash_Definitions_hash_alg a);
+
+void Hacl_Streaming_SHA3_init(Hacl_Streaming_SHA3_state *s);
+
+void Hacl_Streaming_SHA3_update(Hacl_Streaming_SHA3_state *p, uint8_t *data, uint32_t len);
+
+void Hacl_Streaming_SHA3_finish(Hacl_Streaming_SHA3_state *p, uint8_t *dst);
+
+void Hacl_Streaming_SHA3_squeeze(Hacl_Streaming_SHA3_state *p, uint8_t *dst, uint32_t len);
+
+Hacl_Streaming_SHA3_state *Hacl_Streaming_SHA3_copy(Hacl_Streaming_SHA3_state *s0);
+
+Spec_Hash_Definitions_hash_alg Hacl_Streaming_SHA3_get_alg(Hacl_Streaming_SHA3_state *s);
+
+bool Hacl_Streaming_SHA3_is_shake(Hacl_Streaming_SHA3_state *s);
+
+void Hacl_Streaming_SHA3_free(Hacl_Streaming_SHA3_state *s);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Streaming_SHA3_H_DEFINED
+#endif
@@ -22,8 +22,24 @@
  */
 
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include "MerkleTree.h"
 
+#include "Hacl_SHA2_Vec256.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#define MERKLE_TREE_MAPPED 0
+#else
+#define MERKLE_TREE_MAPPED 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 static uint8_t *hash_r_alloc(uint32_t s)
 {
   KRML_CHECK_SIZE(sizeof (uint8_t), s);
@@ -117,6 +133,527 @@ static void hash_vec_r_free(uint32_t hsz, MerkleTree_Low_Datastructures_hash_vec
     v);
 }
 
+/* The hashes of a tree level live in a single slab of hsz * cap bytes, grown
+   by doubling and shrunk by halving once less than a quarter of it is in use.
+   With MERKLE_TREE_HUGEPAGE_ARENA defined (Linux only), slabs of 2 MiB or
+   more are mapped directly in whole huge pages and advised to be backed by
+   transparent huge pages; smaller slabs always come from the heap. */
+
+#define MERKLE_TREE_HUGEPAGE_SIZE ((uint64_t)2097152U)
+
+#if defined(MERKLE_TREE_HUGEPAGE_ARENA) && defined(__linux__)
+static size_t hash_slab_map_len(uint64_t len)
+{
+  uint64_t mask = MERKLE_TREE_HUGEPAGE_SIZE - (uint64_t)1U;
+  return (size_t)((len + mask) & ~mask);
+}
+#endif
+
+static uint8_t *hash_slab_buf_alloc(uint32_t hsz, uint64_t cap)
+{
+  uint64_t len = (uint64_t)hsz * (uint64_t)cap;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  #if defined(MERKLE_TREE_HUGEPAGE_ARENA) && defined(__linux__)
+  if (len >= MERKLE_TREE_HUGEPAGE_SIZE)
+  {
+    size_t mlen = hash_slab_map_len(len);
+    void *buf = mmap(NULL, mlen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buf == MAP_FAILED)
+    {
+      KRML_HOST_PRINTF("Merkle tree arena allocation failed at %s:%d\n", __FILE__, __LINE__);
+      KRML_HOST_EXIT(255U);
+    }
+    #if defined(MADV_HUGEPAGE)
+    madvise(buf, mlen, MADV_HUGEPAGE);
+    #endif
+    return (uint8_t *)buf;
+  }
+  #endif
+  uint8_t *buf = KRML_HOST_MALLOC((size_t)len);
+  return buf;
+}
+
+static void hash_slab_buf_free(uint32_t hsz, uint64_t cap, uint8_t *buf)
+{
+  if (buf == NULL)
+  {
+    return;
+  }
+  #if defined(MERKLE_TREE_HUGEPAGE_ARENA) && defined(__linux__)
+  uint64_t len = (uint64_t)hsz * (uint64_t)cap;
+  if (len >= MERKLE_TREE_HUGEPAGE_SIZE)
+  {
+    munmap(buf, hash_slab_map_len(len));
+    return;
+  }
+  #endif
+  KRML_HOST_FREE(buf);
+}
+
+/* In trees created by mt_create_mapped, a slab is instead a window onto the
+   shared mapping of an append-only level file: front hashes at the start of
+   the file have been flushed, and the window begins right after them. Such
+   slabs only grow, by extending the file, and flushing just moves the
+   window; the space of flushed hashes is returned to the file system by
+   MerkleTree_Low_Persistent_mt_sync. */
+
+struct MerkleTree_Low_Datastructures_hash_file_s
+{
+  int fd;
+  uint8_t *map;
+  uint64_t len;
+  uint64_t front;
+  uint64_t punched;
+};
+
+struct MerkleTree_Low_Persistent_store_s { int dir_fd; };
+
+#define MERKLE_TREE_FILE_MIN_CAP ((uint32_t)1024U)
+
+/* Snapshots published by mt_publish share the level slabs of the tree, and own
+   copies of its rightmost hashes and root. Published snapshots form a list,
+   oldest first, that only the writer walks. A buffer that the writer stops
+   using is retired onto the newest snapshot, which is the last one that may
+   read it, and freed along with it: snapshots are freed oldest first, once
+   released by all readers.
+
+   A reader may load the current snapshot and be preempted before pinning it
+   with refs. To never free a snapshot under such a reader, acquisitions are
+   counted in acquiring[epoch % 2] while they run. The writer advances epoch
+   whenever the other counter is zero, i.e. once the acquisitions that began
+   two epochs ago have completed. A snapshot that stopped being current in
+   epoch e may thus only be held unpinned before epoch e + 2 begins, after
+   which refs alone decides when it is freed. Readers that keep acquiring
+   only ever delay reclamation by the length of one acquisition. */
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define MERKLE_TREE_ATOMIC_ADD(p, d) \
+  ((uint32_t)_InterlockedExchangeAdd((volatile long *)(p), (long)(d)) + (uint32_t)(d))
+#define MERKLE_TREE_ATOMIC_LOAD(p) ((uint32_t)_InterlockedOr((volatile long *)(p), 0L))
+#define MERKLE_TREE_ATOMIC_LOAD_PTR(p) \
+  _InterlockedCompareExchangePointer((void *volatile *)(p), NULL, NULL)
+#define MERKLE_TREE_ATOMIC_STORE_PTR(p, v) \
+  _InterlockedExchangePointer((void *volatile *)(p), (void *)(v))
+#else
+#define MERKLE_TREE_ATOMIC_ADD(p, d) __atomic_add_fetch((p), (d), __ATOMIC_SEQ_CST)
+#define MERKLE_TREE_ATOMIC_LOAD(p) __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define MERKLE_TREE_ATOMIC_LOAD_PTR(p) __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define MERKLE_TREE_ATOMIC_STORE_PTR(p, v) __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#endif
+
+typedef struct snapshot_retired_s
+{
+  uint8_t *vs;
+  uint32_t cap;
+  struct snapshot_retired_s *next;
+}
+snapshot_retired;
+
+struct MerkleTree_Low_Snapshot_snapshot_s
+{
+  uint32_t hash_size;
+  uint64_t offset;
+  uint32_t i;
+  uint32_t j;
+  MerkleTree_Low_Datastructures_hash_vv hs;
+  MerkleTree_Low_Datastructures_hash_vec rhs;
+  uint8_t *mroot;
+  uint32_t refs;
+  uint32_t epoch;
+  snapshot_retired *retired;
+  MerkleTree_Low_Snapshot_snapshot *next;
+};
+
+struct MerkleTree_Low_Snapshot_publisher_s
+{
+  uint32_t hash_size;
+  MerkleTree_Low_Snapshot_snapshot *current;
+  uint32_t epoch;
+  uint32_t acquiring[2U];
+  MerkleTree_Low_Snapshot_snapshot *oldest;
+  MerkleTree_Low_Snapshot_snapshot *newest;
+};
+
+static void snapshot_retire(MerkleTree_Low_Snapshot_publisher *pub, uint32_t cap, uint8_t *vs)
+{
+  if (vs == NULL)
+  {
+    return;
+  }
+  KRML_CHECK_SIZE(sizeof (snapshot_retired), (uint32_t)1U);
+  snapshot_retired *r = KRML_HOST_MALLOC(sizeof (snapshot_retired));
+  r->vs = vs;
+  r->cap = cap;
+  r->next = pub->newest->retired;
+  pub->newest->retired = r;
+}
+
+static void snapshot_free(uint32_t hsz, MerkleTree_Low_Snapshot_snapshot *snap)
+{
+  snapshot_retired *r = snap->retired;
+  while (r != NULL)
+  {
+    snapshot_retired *next = r->next;
+    hash_slab_buf_free(hsz, r->cap, r->vs);
+    KRML_HOST_FREE(r);
+    r = next;
+  }
+  KRML_HOST_FREE(snap->hs.vs);
+  KRML_HOST_FREE(snap->rhs.vs[0U]);
+  KRML_HOST_FREE(snap->rhs.vs);
+  KRML_HOST_FREE(snap->mroot);
+  KRML_HOST_FREE(snap);
+}
+
+/* Advances the epoch as far as readers allow, then frees the snapshots that
+   are no longer current and that no reader holds, oldest first. Called by the
+   writer only. */
+static void snapshot_reclaim(MerkleTree_Low_Snapshot_publisher *pub)
+{
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)2U; k++)
+  {
+    uint32_t e = pub->epoch;
+    if
+    (
+      MERKLE_TREE_ATOMIC_LOAD(&pub->acquiring[(e + (uint32_t)1U) % (uint32_t)2U])
+      != (uint32_t)0U
+    )
+    {
+      break;
+    }
+    MERKLE_TREE_ATOMIC_ADD(&pub->epoch, (uint32_t)1U);
+  }
+  while
+  (
+    pub->oldest
+    != pub->newest
+    && pub->epoch - pub->oldest->epoch >= (uint32_t)2U
+    && MERKLE_TREE_ATOMIC_LOAD(&pub->oldest->refs) == (uint32_t)0U
+  )
+  {
+    MerkleTree_Low_Snapshot_snapshot *next = pub->oldest->next;
+    snapshot_free(pub->hash_size, pub->oldest);
+    pub->oldest = next;
+  }
+}
+
+/* Frees the publisher and all its snapshots, which must have been released. */
+static void snapshot_publisher_free(MerkleTree_Low_Snapshot_publisher *pub)
+{
+  MerkleTree_Low_Snapshot_snapshot *snap = pub->oldest;
+  while (snap != NULL)
+  {
+    MerkleTree_Low_Snapshot_snapshot *next = snap->next;
+    snapshot_free(pub->hash_size, snap);
+    snap = next;
+  }
+  KRML_HOST_FREE(pub);
+}
+
+#if MERKLE_TREE_MAPPED
+static void hash_file_fail(const char *op)
+{
+  KRML_HOST_PRINTF("Merkle tree level file %s failed at %s:%d\n", op, __FILE__, __LINE__);
+  KRML_HOST_EXIT(255U);
+}
+
+/* Extends the file to nlen bytes and maps all of it. */
+static void hash_file_grow(MerkleTree_Low_Datastructures_hash_file *f, uint64_t nlen)
+{
+  if (ftruncate(f->fd, (off_t)nlen) != 0)
+  {
+    hash_file_fail("ftruncate");
+  }
+  void *map;
+  if (f->map == NULL)
+  {
+    map = mmap(NULL, (size_t)nlen, PROT_READ | PROT_WRITE, MAP_SHARED, f->fd, 0);
+  }
+  else
+  {
+    #if defined(__linux__)
+    map = mremap(f->map, (size_t)f->len, (size_t)nlen, MREMAP_MAYMOVE);
+    #else
+    munmap(f->map, (size_t)f->len);
+    map = mmap(NULL, (size_t)nlen, PROT_READ | PROT_WRITE, MAP_SHARED, f->fd, 0);
+    #endif
+  }
+  if (map == MAP_FAILED)
+  {
+    hash_file_fail("mmap");
+  }
+  f->map = (uint8_t *)map;
+  f->len = nlen;
+}
+
+static MerkleTree_Low_Datastructures_hash_slab
+hash_file_reserve(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab vec, uint32_t n)
+{
+  MerkleTree_Low_Datastructures_hash_file *f = vec.file;
+  uint32_t ncap = vec.cap;
+  if (ncap < MERKLE_TREE_FILE_MIN_CAP)
+  {
+    ncap = MERKLE_TREE_FILE_MIN_CAP;
+  }
+  while (ncap - vec.sz < n)
+  {
+    ncap = LowStar_Vector_new_capacity(ncap);
+  }
+  hash_file_grow(f, (f->front + (uint64_t)ncap) * (uint64_t)hsz);
+  return
+    (
+      (MerkleTree_Low_Datastructures_hash_slab){
+        .sz = vec.sz,
+        .cap = ncap,
+        .vs = f->map + f->front * (uint64_t)hsz,
+        .file = f,
+        .pub = vec.pub
+      }
+    );
+}
+
+static MerkleTree_Low_Datastructures_hash_slab
+hash_file_flush(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab vec, uint32_t ofs)
+{
+  MerkleTree_Low_Datastructures_hash_file *f = vec.file;
+  f->front = f->front + (uint64_t)ofs;
+  return
+    (
+      (MerkleTree_Low_Datastructures_hash_slab){
+        .sz = vec.sz - ofs,
+        .cap = vec.cap - ofs,
+        .vs = vec.vs + (uint64_t)ofs * (uint64_t)hsz,
+        .file = f,
+        .pub = vec.pub
+      }
+    );
+}
+
+static void hash_file_close(MerkleTree_Low_Datastructures_hash_file *f)
+{
+  if (f->map != NULL)
+  {
+    munmap(f->map, (size_t)f->len);
+  }
+  close(f->fd);
+  KRML_HOST_FREE(f);
+}
+#endif
+
+static MerkleTree_Low_Datastructures_hash_slab hash_slab_r_alloc(uint32_t hsz)
+{
+  return
+    (
+      (MerkleTree_Low_Datastructures_hash_slab){
+        .sz = (uint32_t)0U,
+        .cap = (uint32_t)0U,
+        .vs = NULL,
+        .file = NULL,
+        .pub = NULL
+      }
+    );
+}
+
+static void hash_slab_r_free(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab v)
+{
+  #if MERKLE_TREE_MAPPED
+  if (v.file != NULL)
+  {
+    hash_file_close(v.file);
+    return;
+  }
+  #endif
+  hash_slab_buf_free(hsz, v.cap, v.vs);
+}
+
+static uint8_t
+*hash_slab_index(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab vec, uint32_t i)
+{
+  return vec.vs + (uint64_t)i * (uint64_t)hsz;
+}
+
+/* Releases the buffer of a slab being replaced: snapshots published since it
+   was allocated may still read it, so it is handed to the publisher if any. */
+static void hash_slab_release(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab vec)
+{
+  if (vec.pub != NULL)
+  {
+    snapshot_retire(vec.pub, vec.cap, vec.vs);
+    return;
+  }
+  hash_slab_buf_free(hsz, vec.cap, vec.vs);
+}
+
+/* Copies the n hashes of vec from index ofs to a fresh slab with room for
+   ncap >= n of them, and releases vec. */
+static MerkleTree_Low_Datastructures_hash_slab
+hash_slab_move(
+  uint32_t hsz,
+  MerkleTree_Low_Datastructures_hash_slab vec,
+  uint32_t ofs,
+  uint32_t n,
+  uint32_t ncap
+)
+{
+  uint8_t *nvs = hash_slab_buf_alloc(hsz, ncap);
+  if (n > (uint32_t)0U)
+  {
+    memcpy(nvs,
+      vec.vs + (uint64_t)ofs * (uint64_t)hsz,
+      (uint64_t)n * (uint64_t)hsz * sizeof (uint8_t));
+  }
+  hash_slab_release(hsz, vec);
+  return
+    (
+      (MerkleTree_Low_Datastructures_hash_slab){
+        .sz = n,
+        .cap = ncap,
+        .vs = nvs,
+        .file = NULL,
+        .pub = vec.pub
+      }
+    );
+}
+
+/* Moves the hashes of vec to a fresh slab with room for ncap >= vec.sz. */
+static MerkleTree_Low_Datastructures_hash_slab
+hash_slab_resize(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab vec, uint32_t ncap)
+{
+  return hash_slab_move(hsz, vec, (uint32_t)0U, vec.sz, ncap);
+}
+
+/* Makes room for n more hashes; n <= uint32_32_max - vec.sz. */
+static MerkleTree_Low_Datastructures_hash_slab
+hash_slab_reserve(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab vec, uint32_t n)
+{
+  if (n <= vec.cap - vec.sz)
+  {
+    return vec;
+  }
+  #if MERKLE_TREE_MAPPED
+  if (vec.file != NULL)
+  {
+    return hash_file_reserve(hsz, vec, n);
+  }
+  #endif
+  uint32_t ncap = vec.cap;
+  while (ncap - vec.sz < n)
+  {
+    ncap = LowStar_Vector_new_capacity(ncap);
+  }
+  return hash_slab_resize(hsz, vec, ncap);
+}
+
+/* The capacity a slab of sz hashes with room for cap of them is shrunk to. */
+static uint32_t hash_slab_fit_cap(uint32_t sz, uint32_t cap)
+{
+  uint32_t ncap = cap;
+  while (sz < ncap / (uint32_t)4U)
+  {
+    ncap = ncap / (uint32_t)2U;
+  }
+  return ncap;
+}
+
+/* Level files never shrink, so mapped slabs are left as they are. */
+static MerkleTree_Low_Datastructures_hash_slab
+hash_slab_fit(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab vec)
+{
+  if (vec.file != NULL || vec.sz >= vec.cap / (uint32_t)4U)
+  {
+    return vec;
+  }
+  return hash_slab_resize(hsz, vec, hash_slab_fit_cap(vec.sz, vec.cap));
+}
+
+static MerkleTree_Low_Datastructures_hash_slab
+hash_slab_insert_copy(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab vec, uint8_t *v)
+{
+  MerkleTree_Low_Datastructures_hash_slab rv = hash_slab_reserve(hsz, vec, (uint32_t)1U);
+  hash_copy(hsz, v, hash_slab_index(hsz, rv, rv.sz));
+  return
+    (
+      (MerkleTree_Low_Datastructures_hash_slab){
+        .sz = rv.sz + (uint32_t)1U,
+        .cap = rv.cap,
+        .vs = rv.vs,
+        .file = rv.file,
+        .pub = rv.pub
+      }
+    );
+}
+
+/* Drops the first ofs hashes of vec. Once published, the remaining hashes are
+   copied to a fresh slab instead of being shifted under readers' feet. */
+static MerkleTree_Low_Datastructures_hash_slab
+hash_slab_flush(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab vec, uint32_t ofs)
+{
+  if (ofs == (uint32_t)0U)
+  {
+    return vec;
+  }
+  #if MERKLE_TREE_MAPPED
+  if (vec.file != NULL)
+  {
+    return hash_file_flush(hsz, vec, ofs < vec.sz ? ofs : vec.sz);
+  }
+  #endif
+  uint32_t n_shifted = (uint32_t)0U;
+  if (ofs < vec.sz)
+  {
+    n_shifted = vec.sz - ofs;
+  }
+  if (vec.pub != NULL)
+  {
+    return hash_slab_move(hsz, vec, ofs, n_shifted, hash_slab_fit_cap(n_shifted, vec.cap));
+  }
+  if (n_shifted > (uint32_t)0U)
+  {
+    memmove(vec.vs,
+      hash_slab_index(hsz, vec, ofs),
+      (uint64_t)n_shifted * (uint64_t)hsz * sizeof (uint8_t));
+  }
+  return
+    hash_slab_fit(hsz,
+      (
+        (MerkleTree_Low_Datastructures_hash_slab){
+          .sz = n_shifted,
+          .cap = vec.cap,
+          .vs = vec.vs,
+          .file = NULL,
+          .pub = vec.pub
+        }
+      ));
+}
+
+/* Keeps the first new_size hashes of vec. Once published, they are copied to
+   a fresh slab, as the dropped ones would otherwise be overwritten in place by
+   later insertions. */
+static MerkleTree_Low_Datastructures_hash_slab
+hash_slab_shrink(uint32_t hsz, MerkleTree_Low_Datastructures_hash_slab vec, uint32_t new_size)
+{
+  if (new_size >= vec.sz)
+  {
+    return vec;
+  }
+  if (vec.pub != NULL)
+  {
+    return hash_slab_move(hsz, vec, (uint32_t)0U, new_size, hash_slab_fit_cap(new_size, vec.cap));
+  }
+  return
+    hash_slab_fit(hsz,
+      (
+        (MerkleTree_Low_Datastructures_hash_slab){
+          .sz = new_size,
+          .cap = vec.cap,
+          .vs = vec.vs,
+          .file = vec.file,
+          .pub = vec.pub
+        }
+      ));
+}
+
 /*
   Constructor for hashes
 */
@@ -198,7 +735,7 @@ inline void mt_path_insert(MerkleTree_Low_path *path1, uint8_t *hash1)
   MerkleTree_Low_path pth = *path1;
   MerkleTree_Low_Datastructures_hash_vec pv = pth.hashes;
   MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, hash1);
-  *path1 = ((MerkleTree_Low_path){ .hash_size = hash_size, .hashes = ipv });
+  *path1 = ((MerkleTree_Low_path){ .hash_size = hash_size, .hashes = ipv, .buf = pth.buf });
 }
 
 /*
@@ -222,6 +759,47 @@ inline bool mt_get_path_step_pre(const MerkleTree_Low_path *path1, uint32_t i)
   return MerkleTree_Low_mt_get_path_step_pre(path1, i);
 }
 
+/*
+  Constructor for proofs
+*/
+inline MerkleTree_Low_proof *mt_init_proof(uint32_t hash_size)
+{
+  return MerkleTree_Low_init_proof(hash_size);
+}
+
+/*
+  Destructor for proofs
+*/
+inline void mt_free_proof(MerkleTree_Low_proof *proof1)
+{
+  MerkleTree_Low_free_proof(proof1);
+}
+
+/*
+  Length of a proof
+
+  @param[in] p Proof
+
+  return The number of hashes in the proof
+*/
+inline uint32_t mt_get_proof_length(const MerkleTree_Low_proof *proof1)
+{
+  return MerkleTree_Low_mt_get_proof_length(proof1);
+}
+
+/*
+  Get step on a proof
+
+  @param[in] p Proof
+  @param[in] i Proof step index, less than mt_get_proof_length(p)
+
+  return The hash at step i of p
+*/
+inline uint8_t *mt_get_proof_step(const MerkleTree_Low_proof *proof1, uint32_t i)
+{
+  return MerkleTree_Low_mt_get_proof_step(proof1, i);
+}
+
 /*
   Construction with custom hash functions
 
@@ -244,10 +822,13 @@ inline MerkleTree_Low_merkle_tree
   Destruction
 
   @param[in]  mt  The Merkle tree
+
+  return false if mt is persistent and its final mt_sync failed, true
+  otherwise; the tree is freed in both cases
 */
-inline void mt_free(MerkleTree_Low_merkle_tree *mt)
+inline bool mt_free(MerkleTree_Low_merkle_tree *mt)
 {
-  MerkleTree_Low_mt_free(mt);
+  return MerkleTree_Low_mt_free(mt);
 }
 
 /*
@@ -271,6 +852,30 @@ inline bool mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v)
   return MerkleTree_Low_mt_insert_pre(mt, v);
 }
 
+/*
+  Batch insertion
+
+  @param[in]  mt      The Merkle tree
+  @param[in]  n       The number of hashes to insert
+  @param[in]  leaves  n hashes of hash_size bytes each, stored contiguously
+
+ Note: Equivalent to n calls to mt_insert, except that the content of leaves is
+ left untouched.
+*/
+inline void mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves)
+{
+  MerkleTree_Low_mt_insert_batch(mt, n, leaves);
+}
+
+/*
+  Precondition predicate for mt_insert_batch
+*/
+inline bool
+mt_insert_batch_pre(const MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves)
+{
+  return MerkleTree_Low_mt_insert_batch_pre(mt, n, leaves);
+}
+
 /*
   Getting the Merkle root
 
@@ -301,8 +906,8 @@ inline bool mt_get_root_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *root)
   return The number of elements in the tree
 
   Notes:
-  - The resulting path contains pointers to hashes in the tree, not copies of
-    the hash values.
+  - The resulting path holds copies of the hashes, so it stays valid when the
+    tree is later modified.
   - idx must be within the currently held indices in the tree (past the
     last flush index).
 */
@@ -430,50 +1035,219 @@ mt_verify_pre(
 }
 
 /*
-  Serialization size
+  Getting a consistency proof
 
-  @param[in]  mt   The Merkle tree
+  @param[in]  mt      The Merkle tree
+  @param[in]  old_max The maximum index + 1 of the tree in an earlier version
+  @param[out] proof   The proof that that version is a prefix of the tree
+  @param[out] root    The Merkle root
 
-  return the number of bytes required to serialize the tree
+  return The number of elements in the tree
+
+  Notes:
+  - The proof is that of RFC 6962, section 2.1.2, for the trees built here,
+    whose hash of internal nodes is hash_fun.
+  - The subtrees covered by the proof must not have been flushed; the proof is
+    empty when old_max is the current size of the tree.
 */
-inline uint64_t mt_serialize_size(const MerkleTree_Low_merkle_tree *mt)
+inline uint32_t
+mt_get_consistency(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  MerkleTree_Low_proof *proof1,
+  uint8_t *root
+)
 {
-  return MerkleTree_Low_Serialization_mt_serialize_size(mt);
+  return MerkleTree_Low_mt_get_consistency(mt, old_max, proof1, root);
 }
 
 /*
-  Merkle tree serialization
-
-  @param[in]  mt   The Merkle tree
-  @param[out] buf  The buffer to serialize the tree into
-  @param[in]  len  Length of buf
-
-  return the number of bytes written
-
-  Note: buf must be a buffer of size mt_serialize_size(mt) or larger, but
-  smaller than 2^32 (larger buffers are currently not supported).
+  Precondition predicate for mt_get_consistency
 */
-inline uint64_t mt_serialize(const MerkleTree_Low_merkle_tree *mt, uint8_t *buf, uint64_t len)
+inline bool
+mt_get_consistency_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  const MerkleTree_Low_proof *proof1,
+  uint8_t *root
+)
 {
-  return MerkleTree_Low_Serialization_mt_serialize(mt, buf, len);
+  return MerkleTree_Low_mt_get_consistency_pre(mt, old_max, proof1, root);
 }
 
 /*
-  Merkle tree deserialization
-
-  @param[in]  expected_hash_size Expected hash size to match hash_fun
-  @param[in]  buf  The buffer to deserialize the tree from
-  @param[in]  len  Length of buf
-  @param[in]  hash_fun Hash function
+  Client-side verification of a consistency proof
 
-  return pointer to the new tree if successful, NULL otherwise
+  @param[in]  mt       The Merkle tree
+  @param[in]  old_max  The maximum index + 1 of the earlier version
+  @param[in]  old_root The Merkle root of the earlier version
+  @param[in]  max      The maximum index + 1 of the tree when the proof was generated
+  @param[in]  root     The Merkle root of the tree when the proof was generated
+  @param[in]  proof    The consistency proof to verify
 
-  Note: buf must point to an allocated buffer.
+  return true if the verification succeeded, false otherwise
 */
-inline MerkleTree_Low_merkle_tree
-*mt_deserialize(
-  const uint8_t *buf,
-  uint64_t len,
+inline bool
+mt_verify_consistency(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  uint8_t *old_root,
+  uint64_t max,
+  uint8_t *root,
+  const MerkleTree_Low_proof *proof1
+)
+{
+  return MerkleTree_Low_mt_verify_consistency(mt, old_max, old_root, max, root, proof1);
+}
+
+/*
+  Precondition predicate for mt_verify_consistency
+*/
+inline bool
+mt_verify_consistency_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  uint8_t *old_root,
+  uint64_t max,
+  uint8_t *root,
+  const MerkleTree_Low_proof *proof1
+)
+{
+  return MerkleTree_Low_mt_verify_consistency_pre(mt, old_max, old_root, max, root, proof1);
+}
+
+/*
+  Getting a Merkle proof for several hashes at once
+
+  @param[in]  mt    The Merkle tree
+  @param[in]  n     The number of target hashes
+  @param[in]  idxs  The indices of the target hashes, in increasing order
+  @param[out] proof A resulting proof that starts with the n target hashes
+  @param[out] root  The Merkle root
+
+  return The number of elements in the tree
+
+  Notes:
+  - After the target hashes, the proof holds the root of every maximal
+    subtree that contains none of them, from left to right. Interior nodes
+    shared by the paths of several targets thus appear once, if at all.
+  - The indices must be within the currently held indices in the tree.
+*/
+inline uint32_t
+mt_get_multi_proof(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  MerkleTree_Low_proof *proof1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_get_multi_proof(mt, n, idxs, proof1, root);
+}
+
+/*
+  Precondition predicate for mt_get_multi_proof
+*/
+inline bool
+mt_get_multi_proof_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  const MerkleTree_Low_proof *proof1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_get_multi_proof_pre(mt, n, idxs, proof1, root);
+}
+
+/*
+  Client-side verification of a proof for several hashes
+
+  @param[in]  mt    The Merkle tree
+  @param[in]  n     The number of target hashes
+  @param[in]  idxs  The indices of the target hashes, in increasing order
+  @param[in]  max   The maximum index + 1 of the tree when the proof was generated
+  @param[in]  proof The proof to verify
+  @param[in]  root
+
+  return true if the verification succeeded, false otherwise
+
+  Note: As for mt_verify, the target hashes are those the proof starts with.
+*/
+inline bool
+mt_verify_multi_proof(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint64_t max,
+  const MerkleTree_Low_proof *proof1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_verify_multi_proof(mt, n, idxs, max, proof1, root);
+}
+
+/*
+  Precondition predicate for mt_verify_multi_proof
+*/
+inline bool
+mt_verify_multi_proof_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint64_t max,
+  const MerkleTree_Low_proof *proof1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_mt_verify_multi_proof_pre(mt, n, idxs, max, proof1, root);
+}
+
+/*
+  Serialization size
+
+  @param[in]  mt   The Merkle tree
+
+  return the number of bytes required to serialize the tree
+*/
+inline uint64_t mt_serialize_size(const MerkleTree_Low_merkle_tree *mt)
+{
+  return MerkleTree_Low_Serialization_mt_serialize_size(mt);
+}
+
+/*
+  Merkle tree serialization
+
+  @param[in]  mt   The Merkle tree
+  @param[out] buf  The buffer to serialize the tree into
+  @param[in]  len  Length of buf
+
+  return the number of bytes written
+
+  Note: buf must be a buffer of size mt_serialize_size(mt) or larger, but
+  smaller than 2^32 (larger buffers are currently not supported).
+*/
+inline uint64_t mt_serialize(const MerkleTree_Low_merkle_tree *mt, uint8_t *buf, uint64_t len)
+{
+  return MerkleTree_Low_Serialization_mt_serialize(mt, buf, len);
+}
+
+/*
+  Merkle tree deserialization
+
+  @param[in]  expected_hash_size Expected hash size to match hash_fun
+  @param[in]  buf  The buffer to deserialize the tree from
+  @param[in]  len  Length of buf
+  @param[in]  hash_fun Hash function
+
+  return pointer to the new tree if successful, NULL otherwise
+
+  Note: buf must point to an allocated buffer.
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_deserialize(
+  const uint8_t *buf,
+  uint64_t len,
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 )
 {
@@ -509,6 +1283,235 @@ inline MerkleTree_Low_path *mt_deserialize_path(const uint8_t *buf, uint64_t len
   return MerkleTree_Low_Serialization_mt_deserialize_path(buf, len);
 }
 
+/*
+  Proof serialization
+
+  @param[in]  proof The proof
+  @param[out] buf   The buffer to serialize the proof into
+  @param[in]  len   Length of buf
+
+  return the number of bytes written
+
+  Note: The format is that of mt_serialize_path for a path with the same hashes.
+*/
+inline uint64_t mt_serialize_proof(const MerkleTree_Low_proof *proof1, uint8_t *buf, uint64_t len)
+{
+  return MerkleTree_Low_Serialization_mt_serialize_proof(proof1, buf, len);
+}
+
+/*
+  Proof deserialization
+
+  @param[in]  buf  The buffer to deserialize the proof from
+  @param[in]  len  Length of buf
+
+  return pointer to the new proof if successful, NULL otherwise
+*/
+inline MerkleTree_Low_proof *mt_deserialize_proof(const uint8_t *buf, uint64_t len)
+{
+  return MerkleTree_Low_Serialization_mt_deserialize_proof(buf, len);
+}
+
+/*
+  Construction of a persistent tree with custom hash functions
+
+  @param[in]  dir       An existing directory that does not hold a tree yet
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  init      The initial hash
+  @param[in]  hash_fun  Hash function
+
+  return The new Merkle tree, or NULL if the tree files could not be created
+
+  Notes:
+  - Each level is kept in its own memory-mapped, append-only file in dir.
+    Hashes are written in place; no copy of the tree lives on the heap.
+  - The tree is made durable by mt_sync (and by mt_free, which calls it).
+    After a crash, mt_open_mapped returns the tree as of the last successful
+    mt_sync, with one exception: hashes are written in place through a
+    shared mapping, so insertions that follow an mt_retract_to to below the
+    last synced size overwrite synced hashes, and a crash before the next
+    mt_sync then leaves a corrupted tree. Calling mt_sync right after such a
+    retraction avoids this.
+  - Hashes dropped by mt_flush_to are returned to the file system (by
+    punching holes, where supported) once the next mt_sync has succeeded.
+  - Not supported on Windows, where NULL is returned.
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_create_mapped_custom(
+  const char *dir,
+  uint32_t hash_size,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low_Persistent_mt_create(dir, hash_size, init, hash_fun);
+}
+
+/*
+  Open a persistent tree
+
+  @param[in]  dir      The directory of a tree created by mt_create_mapped
+  @param[in]  hash_fun Hash function
+
+  return The tree as of its last mt_sync, or NULL if dir does not hold a
+  valid tree
+
+  Note: Only the tree metadata is read; the level files are mapped, not read,
+  so opening takes constant time whatever the size of the tree.
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_open_mapped(const char *dir, void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2))
+{
+  return MerkleTree_Low_Persistent_mt_open(dir, hash_fun);
+}
+
+/*
+  Persist a tree created by mt_create_mapped or opened with mt_open_mapped
+
+  @param[in]  mt   The Merkle tree
+
+  return true if the tree is durably stored, false on I/O error
+
+  Note: This is a no-op returning true for trees that live on the heap.
+*/
+inline bool mt_sync(const MerkleTree_Low_merkle_tree *mt)
+{
+  return MerkleTree_Low_Persistent_mt_sync(mt);
+}
+
+/*
+  Publish a snapshot of the tree for concurrent readers
+
+  @param[in]  mt   The Merkle tree
+
+  return The publisher of mt, or NULL for trees created by mt_create_mapped
+  or opened with mt_open_mapped
+
+  Notes:
+  - The publisher is created by the first call and is the same for the
+    lifetime of the tree. Every call replaces the published snapshot by one
+    of the current state of the tree (its root, bounds and levels).
+  - Any number of threads may call mt_snapshot_acquire on the publisher, and
+    mt_get_path_at on the snapshots they acquire, without locking, while a
+    single writer keeps calling mt_insert, mt_insert_batch, mt_flush_to,
+    mt_retract_to, mt_get_root and mt_publish on mt. Only mt must not be
+    shared between threads.
+  - Once a tree has been published, hashes still visible to some snapshot are
+    copied rather than moved or overwritten; the writer frees them in the
+    first mt_publish after the last snapshot that can see them has been
+    released.
+  - All snapshots must be released before mt_free is called, and the
+    publisher must not be used afterwards.
+*/
+inline MerkleTree_Low_Snapshot_publisher *mt_publish(MerkleTree_Low_merkle_tree *mt)
+{
+  return MerkleTree_Low_Snapshot_mt_publish(mt);
+}
+
+/*
+  Acquire the most recently published snapshot
+
+  @param[in]  pub  The publisher of a tree
+
+  return The snapshot, to be released with mt_snapshot_release
+
+  Note: Lock-free; may be called from any thread.
+*/
+inline const MerkleTree_Low_Snapshot_snapshot
+*mt_snapshot_acquire(MerkleTree_Low_Snapshot_publisher *pub)
+{
+  return MerkleTree_Low_Snapshot_acquire(pub);
+}
+
+/*
+  Release a snapshot acquired with mt_snapshot_acquire
+
+  @param[in]  snap The snapshot
+*/
+inline void mt_snapshot_release(const MerkleTree_Low_Snapshot_snapshot *snap)
+{
+  MerkleTree_Low_Snapshot_release(snap);
+}
+
+/*
+  Number of snapshots of a publisher that have not been freed yet
+
+  @param[in]  pub  The publisher of a tree
+
+  return The number of snapshots published on pub and not yet freed, the
+  current one included
+
+  Note: Like mt_publish, this may only be called by the writer.
+*/
+inline uint32_t mt_snapshot_pending(const MerkleTree_Low_Snapshot_publisher *pub)
+{
+  return MerkleTree_Low_Snapshot_pending(pub);
+}
+
+/*
+  Number of elements in a snapshot
+
+  @param[in]  snap The snapshot
+
+  return The index + 1 of the last hash in the snapshot, which is the max to
+  pass to mt_verify for the paths obtained from it
+*/
+inline uint64_t mt_snapshot_size(const MerkleTree_Low_Snapshot_snapshot *snap)
+{
+  return MerkleTree_Low_Snapshot_size(snap);
+}
+
+/*
+  Getting the Merkle root of a snapshot
+
+  @param[in]  snap The snapshot
+  @param[out] root The Merkle root
+*/
+inline void mt_snapshot_get_root(const MerkleTree_Low_Snapshot_snapshot *snap, uint8_t *root)
+{
+  MerkleTree_Low_Snapshot_get_root(snap, root);
+}
+
+/*
+  Getting a Merkle path from a snapshot
+
+  @param[in]  snap The snapshot
+  @param[in]  idx  The index of the target hash
+  @param[out] path A resulting Merkle path that contains the leaf hash.
+  @param[out] root The Merkle root of the snapshot
+
+  return The number of elements in the tree, as for mt_get_path
+
+  Notes:
+  - As for mt_get_path, the path holds copies of the hashes, and stays valid
+    after the snapshot is released.
+  - idx must be within the indices held by the snapshot.
+*/
+inline uint32_t
+mt_get_path_at(
+  const MerkleTree_Low_Snapshot_snapshot *snap,
+  uint64_t idx,
+  MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_Snapshot_mt_get_path_at(snap, idx, path1, root);
+}
+
+/*
+  Precondition predicate for mt_get_path_at
+*/
+inline bool
+mt_get_path_at_pre(
+  const MerkleTree_Low_Snapshot_snapshot *snap,
+  uint64_t idx,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low_Snapshot_mt_get_path_at_pre(snap, idx, path1, root);
+}
+
 /*
   Default hash function
 */
@@ -657,22 +1660,294 @@ inline MerkleTree_Low_merkle_tree *mt_create(uint8_t *init)
   return MerkleTree_Low_mt_create_custom((uint32_t)32U, init, mt_sha256_compress);
 }
 
-uint32_t MerkleTree_Low_uint32_32_max = (uint32_t)4294967295U;
+/*
+  Construction of a persistent tree wired to sha256 from EverCrypt
 
-uint64_t MerkleTree_Low_uint32_max = (uint64_t)4294967295U;
+  @param[in]  dir   An existing directory that does not hold a tree yet
+  @param[in]  init  The initial hash
 
-uint64_t MerkleTree_Low_uint64_max = (uint64_t)18446744073709551615U;
+  return The new Merkle tree, or NULL if the tree files could not be created
+*/
+inline MerkleTree_Low_merkle_tree *mt_create_mapped(const char *dir, uint8_t *init)
+{
+  return MerkleTree_Low_Persistent_mt_create(dir, (uint32_t)32U, init, mt_sha256_compress);
+}
 
-uint64_t MerkleTree_Low_offset_range_limit = (uint64_t)4294967295U;
+/*
+  The mt64_ functions below work on trees with 64-bit indices and behave as
+  their mt_ counterparts, except that every index is a uint64_t: such a tree
+  can hold more than 2^32 leaves, and mt64_verify accepts any tgt < max.
+  Batch insertion and memory-mapped storage are only offered for trees with
+  32-bit indices.
+*/
 
-uint32_t MerkleTree_Low_merkle_tree_size_lg = (uint32_t)32U;
+/*
+  Construction of a tree with 64-bit indices and custom hash functions
 
-bool MerkleTree_Low_uu___is_MT(MerkleTree_Low_merkle_tree projectee)
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree
+*/
+inline MerkleTree_Low64_merkle_tree
+*mt64_create_custom(
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
 {
-  return true;
+  return MerkleTree_Low64_mt_create_custom(hash_size, i, hash_fun);
 }
 
-uint32_t MerkleTree_Low___proj__MT__item__hash_size(MerkleTree_Low_merkle_tree projectee)
+/*
+  Construction of a tree with 64-bit indices wired to sha256 from EverCrypt
+
+  @param[in]  init   The initial hash
+*/
+inline MerkleTree_Low64_merkle_tree *mt64_create(uint8_t *init)
+{
+  return MerkleTree_Low64_mt_create_custom((uint32_t)32U, init, mt_sha256_compress);
+}
+
+/*
+  Destruction
+
+  @param[in]  mt  The Merkle tree
+*/
+inline void mt64_free(MerkleTree_Low64_merkle_tree *mt)
+{
+  MerkleTree_Low64_mt_free(mt);
+}
+
+/*
+  Insertion
+
+  @param[in]  mt  The Merkle tree
+  @param[in]  v   The tree does not take ownership of the hash, it makes a copy of its content.
+
+ Note: The content of the hash will be overwritten with an arbitrary value.
+*/
+inline void mt64_insert(MerkleTree_Low64_merkle_tree *mt, uint8_t *v)
+{
+  MerkleTree_Low64_mt_insert(mt, v);
+}
+
+/*
+  Precondition predicate for mt64_insert
+*/
+inline bool mt64_insert_pre(const MerkleTree_Low64_merkle_tree *mt, uint8_t *v)
+{
+  return MerkleTree_Low64_mt_insert_pre(mt, v);
+}
+
+/*
+  Getting the Merkle root
+
+  @param[in]  mt   The Merkle tree
+  @param[out] root The Merkle root
+*/
+inline void mt64_get_root(const MerkleTree_Low64_merkle_tree *mt, uint8_t *root)
+{
+  MerkleTree_Low64_mt_get_root(mt, root);
+}
+
+/*
+  Getting a Merkle path
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  idx  The index of the target hash
+  @param[out] path A resulting Merkle path that contains the leaf hash.
+  @param[out] root The Merkle root
+
+  return The number of elements in the tree
+
+  Note: As for mt_get_path, the path holds copies of the hashes.
+*/
+inline uint64_t
+mt64_get_path(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t idx,
+  MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low64_mt_get_path(mt, idx, path1, root);
+}
+
+/*
+  Precondition predicate for mt64_get_path
+*/
+inline bool
+mt64_get_path_pre(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t idx,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low64_mt_get_path_pre(mt, idx, path1, root);
+}
+
+/*
+  Flush the Merkle tree
+
+  @param[in]  mt   The Merkle tree
+*/
+inline void mt64_flush(MerkleTree_Low64_merkle_tree *mt)
+{
+  MerkleTree_Low64_mt_flush(mt);
+}
+
+/*
+  Precondition predicate for mt64_flush
+*/
+inline bool mt64_flush_pre(const MerkleTree_Low64_merkle_tree *mt)
+{
+  return MerkleTree_Low64_mt_flush_pre(mt);
+}
+
+/*
+  Flush the Merkle tree up to a given index
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  idx  The index up to which to flush the tree
+*/
+inline void mt64_flush_to(MerkleTree_Low64_merkle_tree *mt, uint64_t idx)
+{
+  MerkleTree_Low64_mt_flush_to(mt, idx);
+}
+
+/*
+  Precondition predicate for mt64_flush_to
+*/
+inline bool mt64_flush_to_pre(const MerkleTree_Low64_merkle_tree *mt, uint64_t idx)
+{
+  return MerkleTree_Low64_mt_flush_to_pre(mt, idx);
+}
+
+/*
+  Retract the Merkle tree down to a given index
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  idx  The index to retract the tree to
+
+ Note: The element and idx will remain in the tree.
+*/
+inline void mt64_retract_to(MerkleTree_Low64_merkle_tree *mt, uint64_t idx)
+{
+  MerkleTree_Low64_mt_retract_to(mt, idx);
+}
+
+/*
+  Precondition predicate for mt64_retract_to
+*/
+inline bool mt64_retract_to_pre(const MerkleTree_Low64_merkle_tree *mt, uint64_t idx)
+{
+  return MerkleTree_Low64_mt_retract_to_pre(mt, idx);
+}
+
+/*
+  Client-side verification
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  tgt  The index of the target hash
+  @param[in]  max  The maximum index + 1 of the tree when the path was generated
+  @param[in]  path The Merkle path to verify
+  @param[in]  root
+
+  return true if the verification succeeded, false otherwise
+*/
+inline bool
+mt64_verify(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t tgt,
+  uint64_t max,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low64_mt_verify(mt, tgt, max, path1, root);
+}
+
+/*
+  Precondition predicate for mt64_verify
+*/
+inline bool
+mt64_verify_pre(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t tgt,
+  uint64_t max,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+)
+{
+  return MerkleTree_Low64_mt_verify_pre(mt, tgt, max, path1, root);
+}
+
+/*
+  Serialization size
+
+  @param[in]  mt   The Merkle tree
+
+  return the number of bytes required to serialize the tree
+*/
+inline uint64_t mt64_serialize_size(const MerkleTree_Low64_merkle_tree *mt)
+{
+  return MerkleTree_Low64_Serialization_mt_serialize_size(mt);
+}
+
+/*
+  Merkle tree serialization
+
+  @param[in]  mt   The Merkle tree
+  @param[out] buf  The buffer to serialize the tree into
+  @param[in]  len  Length of buf
+
+  return the number of bytes written
+
+  Note: The format (version 2) differs from that of mt_serialize: indices and
+  level sizes are 64 bits wide, and buffers may exceed 2^32 bytes.
+*/
+inline uint64_t mt64_serialize(const MerkleTree_Low64_merkle_tree *mt, uint8_t *buf, uint64_t len)
+{
+  return MerkleTree_Low64_Serialization_mt_serialize(mt, buf, len);
+}
+
+/*
+  Merkle tree deserialization
+
+  @param[in]  buf  The buffer to deserialize the tree from
+  @param[in]  len  Length of buf
+  @param[in]  hash_fun Hash function
+
+  return pointer to the new tree if successful, NULL otherwise
+*/
+inline MerkleTree_Low64_merkle_tree
+*mt64_deserialize(
+  const uint8_t *buf,
+  uint64_t len,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low64_Serialization_mt_deserialize(buf, len, hash_fun);
+}
+
+uint32_t MerkleTree_Low_uint32_32_max = (uint32_t)4294967295U;
+
+uint64_t MerkleTree_Low_uint32_max = (uint64_t)4294967295U;
+
+uint64_t MerkleTree_Low_uint64_max = (uint64_t)18446744073709551615U;
+
+uint64_t MerkleTree_Low_offset_range_limit = (uint64_t)4294967295U;
+
+uint32_t MerkleTree_Low_merkle_tree_size_lg = (uint32_t)32U;
+
+bool MerkleTree_Low_uu___is_MT(MerkleTree_Low_merkle_tree projectee)
+{
+  return true;
+}
+
+uint32_t MerkleTree_Low___proj__MT__item__hash_size(MerkleTree_Low_merkle_tree projectee)
 {
   return projectee.hash_size;
 }
@@ -755,12 +2030,12 @@ uint32_t MerkleTree_Low_offset_of(uint32_t i)
 static MerkleTree_Low_Datastructures_hash_vv
 alloc_rid__LowStar_Vector_vector_str__uint8_t_(
   uint32_t len,
-  MerkleTree_Low_Datastructures_hash_vec v
+  MerkleTree_Low_Datastructures_hash_slab v
 )
 {
-  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Datastructures_hash_vec), len);
-  MerkleTree_Low_Datastructures_hash_vec
-  *buf = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_Datastructures_hash_vec) * len);
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Datastructures_hash_slab), len);
+  MerkleTree_Low_Datastructures_hash_slab
+  *buf = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_Datastructures_hash_slab) * len);
   for (uint32_t _i = 0U; _i < len; ++_i)
     buf[_i] = v;
   return ((MerkleTree_Low_Datastructures_hash_vv){ .sz = len, .cap = len, .vs = buf });
@@ -775,11 +2050,20 @@ typedef struct regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec_s
 }
 regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec;
 
+typedef struct regional__uint32_t_MerkleTree_Low_Datastructures_hash_slab_s
+{
+  uint32_t state;
+  MerkleTree_Low_Datastructures_hash_slab dummy;
+  MerkleTree_Low_Datastructures_hash_slab (*r_alloc)(uint32_t x0);
+  void (*r_free)(uint32_t x0, MerkleTree_Low_Datastructures_hash_slab x1);
+}
+regional__uint32_t_MerkleTree_Low_Datastructures_hash_slab;
+
 static void
 assign__LowStar_Vector_vector_str__uint8_t_(
   MerkleTree_Low_Datastructures_hash_vv vec,
   uint32_t i,
-  MerkleTree_Low_Datastructures_hash_vec v
+  MerkleTree_Low_Datastructures_hash_slab v
 )
 {
   (vec.vs + i)[0U] = v;
@@ -787,14 +2071,14 @@ assign__LowStar_Vector_vector_str__uint8_t_(
 
 static void
 alloc___LowStar_Vector_vector_str__uint8_t__uint32_t(
-  regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec rg,
+  regional__uint32_t_MerkleTree_Low_Datastructures_hash_slab rg,
   MerkleTree_Low_Datastructures_hash_vv rv,
   uint32_t cidx
 )
 {
   if (!(cidx == (uint32_t)0U))
   {
-    MerkleTree_Low_Datastructures_hash_vec v = rg.r_alloc(rg.state);
+    MerkleTree_Low_Datastructures_hash_slab v = rg.r_alloc(rg.state);
     assign__LowStar_Vector_vector_str__uint8_t_(rv, cidx - (uint32_t)1U, v);
     alloc___LowStar_Vector_vector_str__uint8_t__uint32_t(rg, rv, cidx - (uint32_t)1U);
     return;
@@ -803,7 +2087,7 @@ alloc___LowStar_Vector_vector_str__uint8_t__uint32_t(
 
 static MerkleTree_Low_Datastructures_hash_vv
 alloc_rid__LowStar_Vector_vector_str__uint8_t__uint32_t(
-  regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec rg,
+  regional__uint32_t_MerkleTree_Low_Datastructures_hash_slab rg,
   uint32_t len
 )
 {
@@ -858,11 +2142,17 @@ static MerkleTree_Low_merkle_tree
   MerkleTree_Low_Datastructures_hash_vv
   hs =
     alloc_rid__LowStar_Vector_vector_str__uint8_t__uint32_t((
-        (regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec){
+        (regional__uint32_t_MerkleTree_Low_Datastructures_hash_slab){
           .state = hsz,
-          .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
-          .r_alloc = hash_vec_r_alloc,
-          .r_free = hash_vec_r_free
+          .dummy = {
+            .sz = (uint32_t)0U,
+            .cap = (uint32_t)0U,
+            .vs = NULL,
+            .file = NULL,
+            .pub = NULL
+          },
+          .r_alloc = hash_slab_r_alloc,
+          .r_free = hash_slab_r_free
         }
       ),
       (uint32_t)32U);
@@ -896,13 +2186,14 @@ static MerkleTree_Low_merkle_tree
         .rhs_ok = false,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .store = NULL
       }
     );
   return mt;
 }
 
-static MerkleTree_Low_Datastructures_hash_vec
+static MerkleTree_Low_Datastructures_hash_slab
 index__LowStar_Vector_vector_str__uint8_t_(
   MerkleTree_Low_Datastructures_hash_vv vec,
   uint32_t i
@@ -913,12 +2204,12 @@ index__LowStar_Vector_vector_str__uint8_t_(
 
 static void
 free_elems__LowStar_Vector_vector_str__uint8_t__uint32_t(
-  regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec rg,
+  regional__uint32_t_MerkleTree_Low_Datastructures_hash_slab rg,
   MerkleTree_Low_Datastructures_hash_vv rv,
   uint32_t idx
 )
 {
-  MerkleTree_Low_Datastructures_hash_vec
+  MerkleTree_Low_Datastructures_hash_slab
   uu____0 = index__LowStar_Vector_vector_str__uint8_t_(rv, idx);
   rg.r_free(rg.state, uu____0);
   if (idx != (uint32_t)0U)
@@ -936,7 +2227,7 @@ free__LowStar_Vector_vector_str__uint8_t_(MerkleTree_Low_Datastructures_hash_vv
 
 static void
 free__LowStar_Vector_vector_str__uint8_t__uint32_t(
-  regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec rg,
+  regional__uint32_t_MerkleTree_Low_Datastructures_hash_slab rg,
   MerkleTree_Low_Datastructures_hash_vv rv
 )
 {
@@ -947,15 +2238,34 @@ free__LowStar_Vector_vector_str__uint8_t__uint32_t(
   free__LowStar_Vector_vector_str__uint8_t_(rv);
 }
 
-void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt)
+bool MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt)
 {
   MerkleTree_Low_merkle_tree mtv = *mt;
+  if (mtv.hs.vs[0U].pub != NULL)
+  {
+    snapshot_publisher_free(mtv.hs.vs[0U].pub);
+  }
+  bool synced = true;
+  if (mtv.store != NULL)
+  {
+    synced = MerkleTree_Low_Persistent_mt_sync(mt);
+    #if MERKLE_TREE_MAPPED
+    close(mtv.store->dir_fd);
+    #endif
+    KRML_HOST_FREE(mtv.store);
+  }
   free__LowStar_Vector_vector_str__uint8_t__uint32_t((
-      (regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec){
+      (regional__uint32_t_MerkleTree_Low_Datastructures_hash_slab){
         .state = mtv.hash_size,
-        .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
-        .r_alloc = hash_vec_r_alloc,
-        .r_free = hash_vec_r_free
+        .dummy = {
+          .sz = (uint32_t)0U,
+          .cap = (uint32_t)0U,
+          .vs = NULL,
+          .file = NULL,
+          .pub = NULL
+        },
+        .r_alloc = hash_slab_r_alloc,
+        .r_free = hash_slab_r_free
       }
     ),
     mtv.hs);
@@ -974,39 +2284,14 @@ void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt)
   x0 = { .state = mtv.hash_size, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
   x00.r_free(x0.state, mtv.mroot);
   KRML_HOST_FREE(mt);
-}
-
-static MerkleTree_Low_Datastructures_hash_vec
-insert___uint8_t__uint32_t(MerkleTree_Low_Datastructures_hash_vec rv, uint8_t *v)
-{
-  MerkleTree_Low_Datastructures_hash_vec irv = insert___uint8_t_(rv, v);
-  return irv;
-}
-
-#define Cpy 0
-
-typedef uint8_t copyable__uint32_t__uint8_t__tags;
-
-typedef void (*copyable__uint32_t__uint8_t_)(uint32_t x0, uint8_t *x1, uint8_t *x2);
-
-static MerkleTree_Low_Datastructures_hash_vec
-insert_copy___uint8_t__uint32_t(
-  regional__uint32_t__uint8_t_ rg,
-  void (*cp)(uint32_t x0, uint8_t *x1, uint8_t *x2),
-  MerkleTree_Low_Datastructures_hash_vec rv,
-  uint8_t *v
-)
-{
-  uint8_t *nv = rg.r_alloc(rg.state);
-  cp(rg.state, v, nv);
-  return insert___uint8_t__uint32_t(rv, nv);
+  return synced;
 }
 
 static void
 assign__LowStar_Vector_vector_str__uint8_t__uint32_t(
   MerkleTree_Low_Datastructures_hash_vv rv,
   uint32_t i,
-  MerkleTree_Low_Datastructures_hash_vec v
+  MerkleTree_Low_Datastructures_hash_slab v
 )
 {
   assign__LowStar_Vector_vector_str__uint8_t_(rv, i, v);
@@ -1022,27 +2307,12 @@ insert_(
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 )
 {
-  MerkleTree_Low_Datastructures_hash_vec
-  uu____0 = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-  MerkleTree_Low_Datastructures_hash_vec
-  ihv =
-    insert_copy___uint8_t__uint32_t((
-        (regional__uint32_t__uint8_t_){
-          .state = hsz,
-          .dummy = NULL,
-          .r_alloc = hash_r_alloc,
-          .r_free = hash_r_free
-        }
-      ),
-      hash_copy,
-      uu____0,
-      acc);
+  MerkleTree_Low_Datastructures_hash_slab
+  ihv = hash_slab_insert_copy(hsz, index__LowStar_Vector_vector_str__uint8_t_(hs, lv), acc);
   assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, ihv);
   if (j % (uint32_t)2U == (uint32_t)1U)
   {
-    MerkleTree_Low_Datastructures_hash_vec
-    lvhs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-    hash_fun(index___uint8_t_(lvhs, lvhs.sz - (uint32_t)2U), acc, acc);
+    hash_fun(hash_slab_index(hsz, ihv, ihv.sz - (uint32_t)2U), acc, acc);
     insert_(hsz, lv + (uint32_t)1U, j / (uint32_t)2U, hs, acc, hash_fun);
     return;
   }
@@ -1075,24 +2345,187 @@ void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
         .rhs_ok = false,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
       }
     );
 }
 
-MerkleTree_Low_merkle_tree
-*MerkleTree_Low_mt_create_custom(
-  uint32_t hsz,
-  uint8_t *init,
-  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+bool
+MerkleTree_Low_mt_insert_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  uint8_t *leaves
 )
 {
-  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
-  MerkleTree_Low_mt_insert(mt, init);
-  return mt;
+  MerkleTree_Low_merkle_tree mt1 = *(MerkleTree_Low_merkle_tree *)mt;
+  return
+    n
+    <= MerkleTree_Low_uint32_32_max - mt1.j
+    && MerkleTree_Low_uint64_max - mt1.offset >= (uint64_t)mt1.j + (uint64_t)n;
+}
+
+/* Same as n calls to mt_sha256_compress on the 64-byte blocks blocks[64 * i],
+   i.e. one unpadded SHA-256 compression from the initial state per block. The
+   blocks are compressed eight at a time by the AVX2 kernels of Hacl_SHA2_Vec256
+   unless the SHA extensions are available, in which case one at a time through
+   EverCrypt_Hash_update_multi_256 is faster. */
+static void sha256_compress_multi(uint32_t n, uint8_t *blocks, uint8_t **dst)
+{
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  uint32_t n_vec = (uint32_t)0U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2 && !(has_shaext && has_sse))
+  {
+    n_vec = n / (uint32_t)8U * (uint32_t)8U;
+    for (uint32_t i0 = (uint32_t)0U; i0 < n_vec; i0 = i0 + (uint32_t)8U)
+    {
+      uint32_t st[64U] = { 0U };
+      uint8_t *b[8U];
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+      {
+        b[i] = blocks + (i0 + i) * (uint32_t)64U;
+      }
+      Hacl_SHA2_Vec256_sha256_init8(st);
+      Hacl_SHA2_Vec256_sha256_update8(st, b, (uint32_t)1U);
+      Hacl_SHA2_Vec256_sha256_finish8(st, dst + i0);
+    }
+  }
+  #endif
+  for (uint32_t i = n_vec; i < n; i++)
+  {
+    uint32_t st[8U] = { 0U };
+    Hacl_Hash_Core_SHA2_init_256(st);
+    EverCrypt_Hash_update_multi_256(st, blocks + i * (uint32_t)64U, (uint32_t)1U);
+    Hacl_Hash_Core_SHA2_finish_256(st, dst[i]);
+  }
 }
 
-bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee)
+static void
+insert_level_batch(
+  uint32_t hsz,
+  uint32_t lv,
+  uint32_t j0,
+  uint32_t j1,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_Datastructures_hash_slab
+  lvhs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
+  uint32_t base = j1 - lvhs.sz;
+  uint32_t k0 = j0 / (uint32_t)2U;
+  uint32_t k1 = j1 / (uint32_t)2U;
+  MerkleTree_Low_Datastructures_hash_slab
+  uvhs =
+    hash_slab_reserve(hsz,
+      index__LowStar_Vector_vector_str__uint8_t_(hs, lv + (uint32_t)1U),
+      k1 - k0);
+  bool multi = hash_fun == mt_sha256_compress && hsz == (uint32_t)32U;
+  uint8_t *dst[64U];
+  uint32_t k = k0;
+  while (k < k1)
+  {
+    uint32_t c = k1 - k;
+    if (c > (uint32_t)64U)
+    {
+      c = (uint32_t)64U;
+    }
+    for (uint32_t i = (uint32_t)0U; i < c; i++)
+    {
+      dst[i] = hash_slab_index(hsz, uvhs, uvhs.sz + k - k0 + i);
+      if (!multi)
+      {
+        uint8_t *left = hash_slab_index(hsz, lvhs, (uint32_t)2U * (k + i) - base);
+        hash_fun(left, left + hsz, dst[i]);
+      }
+    }
+    if (multi)
+    {
+      sha256_compress_multi(c, hash_slab_index(hsz, lvhs, (uint32_t)2U * k - base), dst);
+    }
+    k = k + c;
+  }
+  assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs,
+    lv + (uint32_t)1U,
+    (
+      (MerkleTree_Low_Datastructures_hash_slab){
+        .sz = uvhs.sz + k1 - k0,
+        .cap = uvhs.cap,
+        .vs = uvhs.vs,
+        .file = uvhs.file,
+        .pub = uvhs.pub
+      }
+    ));
+}
+
+void MerkleTree_Low_mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
+  uint32_t hsz = mtv.hash_size;
+  MerkleTree_Low_Datastructures_hash_slab
+  lvhs = hash_slab_reserve(hsz, index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U), n);
+  if (n > (uint32_t)0U)
+  {
+    memcpy(hash_slab_index(hsz, lvhs, lvhs.sz),
+      leaves,
+      (uint64_t)n * (uint64_t)hsz * sizeof (uint8_t));
+  }
+  assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs,
+    (uint32_t)0U,
+    (
+      (MerkleTree_Low_Datastructures_hash_slab){
+        .sz = lvhs.sz + n,
+        .cap = lvhs.cap,
+        .vs = lvhs.vs,
+        .file = lvhs.file,
+        .pub = lvhs.pub
+      }
+    ));
+  uint32_t lv = (uint32_t)0U;
+  uint32_t j0 = mtv.j;
+  uint32_t j1 = mtv.j + n;
+  while (j1 / (uint32_t)2U > j0 / (uint32_t)2U)
+  {
+    insert_level_batch(hsz, lv, j0, j1, hs, mtv.hash_fun);
+    lv++;
+    j0 = j0 / (uint32_t)2U;
+    j1 = j1 / (uint32_t)2U;
+  }
+  *mt
+  =
+    (
+      (MerkleTree_Low_merkle_tree){
+        .hash_size = mtv.hash_size,
+        .offset = mtv.offset,
+        .i = mtv.i,
+        .j = mtv.j + n,
+        .hs = mtv.hs,
+        .rhs_ok = false,
+        .rhs = mtv.rhs,
+        .mroot = mtv.mroot,
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
+      }
+    );
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
+  MerkleTree_Low_mt_insert(mt, init);
+  return mt;
+}
+
+bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee)
 {
   return true;
 }
@@ -1128,7 +2561,15 @@ MerkleTree_Low_path *MerkleTree_Low_init_path(uint32_t hsz)
     };
   KRML_CHECK_SIZE(sizeof (MerkleTree_Low_path), (uint32_t)1U);
   MerkleTree_Low_path *buf = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_path));
-  buf[0U] = ((MerkleTree_Low_path){ .hash_size = hsz, .hashes = x00.r_alloc(x0.state) });
+  buf[0U]
+  =
+    (
+      (MerkleTree_Low_path){
+        .hash_size = hsz,
+        .hashes = x00.r_alloc(x0.state),
+        .buf = NULL
+      }
+    );
   return buf;
 }
 
@@ -1143,16 +2584,68 @@ void MerkleTree_Low_clear_path(MerkleTree_Low_path *p)
 {
   MerkleTree_Low_path pv = *p;
   *p
-  = ((MerkleTree_Low_path){ .hash_size = pv.hash_size, .hashes = clear___uint8_t_(pv.hashes) });
+  =
+    (
+      (MerkleTree_Low_path){
+        .hash_size = pv.hash_size,
+        .hashes = clear___uint8_t_(pv.hashes),
+        .buf = pv.buf
+      }
+    );
 }
 
 void MerkleTree_Low_free_path(MerkleTree_Low_path *p)
 {
   MerkleTree_Low_path pv = *p;
   free___uint8_t_(pv.hashes);
+  KRML_HOST_FREE(pv.buf);
+  KRML_HOST_FREE(p);
+}
+
+MerkleTree_Low_proof *MerkleTree_Low_init_proof(uint32_t hsz)
+{
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_proof), (uint32_t)1U);
+  MerkleTree_Low_proof *buf = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_proof));
+  buf[0U]
+  =
+    (
+      (MerkleTree_Low_proof){
+        .hash_size = hsz,
+        .sz = (uint32_t)0U,
+        .cap = (uint32_t)0U,
+        .hs = NULL
+      }
+    );
+  return buf;
+}
+
+void MerkleTree_Low_free_proof(MerkleTree_Low_proof *p)
+{
+  KRML_HOST_FREE(p->hs);
   KRML_HOST_FREE(p);
 }
 
+/* Appends a copy of h to p. */
+static void proof_insert(MerkleTree_Low_proof *p, uint8_t *h)
+{
+  uint64_t hsz = (uint64_t)p->hash_size;
+  if (p->sz == p->cap)
+  {
+    uint32_t ncap = LowStar_Vector_new_capacity(p->cap);
+    KRML_CHECK_SIZE(sizeof (uint8_t), (uint64_t)ncap * hsz);
+    uint8_t *nhs = KRML_HOST_MALLOC((uint64_t)ncap * hsz);
+    if (p->sz > (uint32_t)0U)
+    {
+      memcpy(nhs, p->hs, (uint64_t)p->sz * hsz * sizeof (uint8_t));
+    }
+    KRML_HOST_FREE(p->hs);
+    p->hs = nhs;
+    p->cap = ncap;
+  }
+  hash_copy(p->hash_size, h, p->hs + (uint64_t)p->sz * hsz);
+  p->sz = p->sz + (uint32_t)1U;
+}
+
 static void
 assign_copy___uint8_t__uint32_t(
   regional__uint32_t__uint8_t_ rg,
@@ -1209,7 +2702,7 @@ construct_rhs(
         rhs,
         lv,
         acc);
-      hash_fun(index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
+      hash_fun(hash_slab_index(hsz, index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
           j - (uint32_t)1U - ofs),
         acc,
         acc);
@@ -1217,7 +2710,9 @@ construct_rhs(
     else
     {
       hash_copy(hsz,
-        index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv), j - (uint32_t)1U - ofs),
+        hash_slab_index(hsz,
+          index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
+          j - (uint32_t)1U - ofs),
         acc);
     }
     construct_rhs(hsz,
@@ -1271,7 +2766,8 @@ void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *r
         .rhs_ok = true,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .store = mtv.store
       }
     );
 }
@@ -1281,7 +2777,35 @@ void MerkleTree_Low_mt_path_insert(uint32_t hsz, MerkleTree_Low_path *p, uint8_t
   MerkleTree_Low_path pth = *p;
   MerkleTree_Low_Datastructures_hash_vec pv = pth.hashes;
   MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, hp);
-  *p = ((MerkleTree_Low_path){ .hash_size = hsz, .hashes = ipv });
+  *p = ((MerkleTree_Low_path){ .hash_size = hsz, .hashes = ipv, .buf = pth.buf });
+}
+
+/* A path filled by mt_get_path has room in buf for the longest path: the leaf
+   plus one hash per level of a tree with 64-bit indices. */
+#define MERKLE_TREE_PATH_CAP ((uint32_t)65U)
+
+/* Appends a copy of the hash h to p, which mt_get_path_pre requires to start
+   out empty; the copy lives in p->buf, so that the path does not depend on
+   the tree or snapshot it was extracted from. */
+static void path_insert(MerkleTree_Low_path *p, uint8_t *h)
+{
+  MerkleTree_Low_path pth = *p;
+  uint32_t hsz = pth.hash_size;
+  if (pth.hashes.sz >= MERKLE_TREE_PATH_CAP)
+  {
+    KRML_HOST_EPRINTF("Merkle path overflow at %s:%d\n", __FILE__, __LINE__);
+    KRML_HOST_EXIT(255U);
+  }
+  uint8_t *buf = pth.buf;
+  if (buf == NULL)
+  {
+    KRML_CHECK_SIZE(sizeof (uint8_t), (uint64_t)MERKLE_TREE_PATH_CAP * (uint64_t)hsz);
+    buf = KRML_HOST_MALLOC((uint64_t)MERKLE_TREE_PATH_CAP * (uint64_t)hsz * sizeof (uint8_t));
+  }
+  uint8_t *dst = buf + (uint64_t)pth.hashes.sz * (uint64_t)hsz;
+  hash_copy(hsz, h, dst);
+  MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pth.hashes, dst);
+  *p = ((MerkleTree_Low_path){ .hash_size = hsz, .hashes = ipv, .buf = buf });
 }
 
 static uint32_t mt_path_length_step(uint32_t k, uint32_t j, bool actd)
@@ -1335,6 +2859,16 @@ uint8_t *MerkleTree_Low_mt_get_path_step(const MerkleTree_Low_path *p, uint32_t
   return index___uint8_t_(pd.hashes, i);
 }
 
+uint32_t MerkleTree_Low_mt_get_proof_length(const MerkleTree_Low_proof *p)
+{
+  return p->sz;
+}
+
+uint8_t *MerkleTree_Low_mt_get_proof_step(const MerkleTree_Low_proof *p, uint32_t i)
+{
+  return p->hs + (uint64_t)i * (uint64_t)p->hash_size;
+}
+
 static void
 mt_get_path_(
   uint32_t hsz,
@@ -1357,12 +2891,9 @@ mt_get_path_(
     {
       uint8_t
       *uu____0 =
-        index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
+        hash_slab_index(hsz, index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
           k - (uint32_t)1U - ofs1);
-      MerkleTree_Low_path pth1 = *p;
-      MerkleTree_Low_Datastructures_hash_vec pv = pth1.hashes;
-      MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, uu____0);
-      *p = ((MerkleTree_Low_path){ .hash_size = hsz, .hashes = ipv });
+      path_insert(p, uu____0);
     }
     else if (!(k == j))
     {
@@ -1371,22 +2902,16 @@ mt_get_path_(
         if (actd)
         {
           uint8_t *uu____1 = index___uint8_t_(rhs, lv);
-          MerkleTree_Low_path pth1 = *p;
-          MerkleTree_Low_Datastructures_hash_vec pv = pth1.hashes;
-          MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, uu____1);
-          *p = ((MerkleTree_Low_path){ .hash_size = hsz, .hashes = ipv });
+          path_insert(p, uu____1);
         }
       }
       else
       {
         uint8_t
         *uu____2 =
-          index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
+          hash_slab_index(hsz, index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
             k + (uint32_t)1U - ofs1);
-        MerkleTree_Low_path pth1 = *p;
-        MerkleTree_Low_Datastructures_hash_vec pv = pth1.hashes;
-        MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, uu____2);
-        *p = ((MerkleTree_Low_path){ .hash_size = hsz, .hashes = ipv });
+        path_insert(p, uu____2);
       }
     }
     bool ite;
@@ -1455,12 +2980,11 @@ MerkleTree_Low_mt_get_path(
   MerkleTree_Low_Datastructures_hash_vec rhs = mtv.rhs;
   uint8_t
   *ih =
-    index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U),
+    hash_slab_index(hsz1, index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U),
       idx1 - ofs);
   MerkleTree_Low_path pth = *p;
-  MerkleTree_Low_Datastructures_hash_vec pv = pth.hashes;
-  MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, ih);
-  *p = ((MerkleTree_Low_path){ .hash_size = hsz1, .hashes = ipv });
+  *p = ((MerkleTree_Low_path){ .hash_size = hsz1, .hashes = pth.hashes, .buf = pth.buf });
+  path_insert(p, ih);
   mt_get_path_(mtv.hash_size, (uint32_t)0U, hs, rhs, i, j, idx1, p, false);
   return j;
 }
@@ -1479,55 +3003,8 @@ mt_flush_to_(
   if (!(oi == opi))
   {
     uint32_t ofs = oi - opi;
-    MerkleTree_Low_Datastructures_hash_vec
-    hvec = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-    if (!(ofs == (uint32_t)0U))
-    {
-      free_elems___uint8_t__uint32_t((
-          (regional__uint32_t__uint8_t_){
-            .state = hsz,
-            .dummy = NULL,
-            .r_alloc = hash_r_alloc,
-            .r_free = hash_r_free
-          }
-        ),
-        hvec,
-        ofs - (uint32_t)1U);
-    }
-    MerkleTree_Low_Datastructures_hash_vec frv;
-    if (ofs >= hvec.sz)
-    {
-      frv =
-        (
-          (MerkleTree_Low_Datastructures_hash_vec){
-            .sz = (uint32_t)0U,
-            .cap = hvec.cap,
-            .vs = hvec.vs
-          }
-        );
-    }
-    else if (ofs == (uint32_t)0U)
-    {
-      frv = hvec;
-    }
-    else
-    {
-      uint32_t n_shifted = hvec.sz - ofs;
-      for (uint32_t i0 = (uint32_t)0U; i0 < n_shifted; i0++)
-      {
-        uint8_t *uu____0 = hvec.vs[ofs + i0];
-        hvec.vs[(uint32_t)0U + i0] = uu____0;
-      }
-      frv =
-        (
-          (MerkleTree_Low_Datastructures_hash_vec){
-            .sz = n_shifted,
-            .cap = hvec.cap,
-            .vs = hvec.vs
-          }
-        );
-    }
-    MerkleTree_Low_Datastructures_hash_vec flushed = frv;
+    MerkleTree_Low_Datastructures_hash_slab
+    flushed = hash_slab_flush(hsz, index__LowStar_Vector_vector_str__uint8_t_(hs, lv), ofs);
     assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, flushed);
     mt_flush_to_(hsz, lv + (uint32_t)1U, hs, pi / (uint32_t)2U, i / (uint32_t)2U);
     return;
@@ -1565,7 +3042,8 @@ void MerkleTree_Low_mt_flush_to(MerkleTree_Low_merkle_tree *mt, uint64_t idx)
         .rhs_ok = mtv.rhs_ok,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
       }
     );
 }
@@ -1586,46 +3064,6 @@ void MerkleTree_Low_mt_flush(MerkleTree_Low_merkle_tree *mt)
   MerkleTree_Low_mt_flush_to(mt, jo);
 }
 
-static void
-free_elems_from___uint8_t__uint32_t(
-  regional__uint32_t__uint8_t_ rg,
-  MerkleTree_Low_Datastructures_hash_vec rv,
-  uint32_t idx
-)
-{
-  uint8_t *uu____0 = index___uint8_t_(rv, idx);
-  rg.r_free(rg.state, uu____0);
-  if (idx + (uint32_t)1U < rv.sz)
-  {
-    free_elems_from___uint8_t__uint32_t(rg, rv, idx + (uint32_t)1U);
-    return;
-  }
-}
-
-static MerkleTree_Low_Datastructures_hash_vec
-shrink___uint8_t_(MerkleTree_Low_Datastructures_hash_vec vec, uint32_t new_size)
-{
-  return
-    ((MerkleTree_Low_Datastructures_hash_vec){ .sz = new_size, .cap = vec.cap, .vs = vec.vs });
-}
-
-static MerkleTree_Low_Datastructures_hash_vec
-shrink___uint8_t__uint32_t(
-  regional__uint32_t__uint8_t_ rg,
-  MerkleTree_Low_Datastructures_hash_vec rv,
-  uint32_t new_size
-)
-{
-  uint32_t size = rv.sz;
-  if (new_size >= size)
-  {
-    return rv;
-  }
-  free_elems_from___uint8_t__uint32_t(rg, rv, new_size);
-  MerkleTree_Low_Datastructures_hash_vec frv = shrink___uint8_t_(rv, new_size);
-  return frv;
-}
-
 static void
 mt_retract_to_(
   uint32_t hsz,
@@ -1638,22 +3076,10 @@ mt_retract_to_(
 {
   if (!(lv >= hs.sz))
   {
-    MerkleTree_Low_Datastructures_hash_vec
+    MerkleTree_Low_Datastructures_hash_slab
     hvec = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-    uint32_t old_len = j - MerkleTree_Low_offset_of(i);
     uint32_t new_len = s - MerkleTree_Low_offset_of(i);
-    MerkleTree_Low_Datastructures_hash_vec
-    retracted =
-      shrink___uint8_t__uint32_t((
-          (regional__uint32_t__uint8_t_){
-            .state = hsz,
-            .dummy = NULL,
-            .r_alloc = hash_r_alloc,
-            .r_free = hash_r_free
-          }
-        ),
-        hvec,
-        new_len);
+    MerkleTree_Low_Datastructures_hash_slab retracted = hash_slab_shrink(hsz, hvec, new_len);
     assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, retracted);
     if (lv + (uint32_t)1U < hs.sz)
     {
@@ -1699,7 +3125,8 @@ void MerkleTree_Low_mt_retract_to(MerkleTree_Low_merkle_tree *mt, uint64_t r)
         .rhs_ok = false,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .store = mtv.store
       }
     );
 }
@@ -1819,552 +3246,685 @@ MerkleTree_Low_mt_verify(
   return r;
 }
 
-typedef struct __bool_uint32_t_s
-{
-  bool fst;
-  uint32_t snd;
-}
-__bool_uint32_t;
+/* Consistency and multi-leaf proofs follow RFC 6962, section 2.1: the Merkle
+   tree hash MTH of a range of leaves splits it at the largest power of two
+   below its size, which is the shape of the trees built here, where the last
+   node of an odd-sized level is carried up unhashed. The MTH of an aligned
+   range whose size is a power of two is a node held in the levels; that of
+   any other range is recomputed. Ranges are relative to the tree offset. */
 
-static __bool_uint32_t serialize_bool(bool ok, bool x, uint8_t *buf, uint32_t sz, uint32_t pos)
+static uint32_t proof_split(uint32_t n)
 {
-  if (!ok || pos >= sz)
-  {
-    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
-  }
-  uint8_t ite;
-  if (x)
-  {
-    ite = (uint8_t)1U;
-  }
-  else
+  uint32_t k = (uint32_t)1U;
+  while (k < n - k)
   {
-    ite = (uint8_t)0U;
+    k = k + k;
   }
-  buf[pos] = ite;
-  return ((__bool_uint32_t){ .fst = true, .snd = pos + (uint32_t)1U });
+  return k;
 }
 
-static __bool_uint32_t
-serialize_uint8_t(bool ok, uint8_t x, uint8_t *buf, uint32_t sz, uint32_t pos)
+static bool proof_complete(uint32_t n)
 {
-  if (!ok || pos >= sz)
+  return (n & (n - (uint32_t)1U)) == (uint32_t)0U;
+}
+
+static uint32_t proof_level(uint32_t n)
+{
+  uint32_t lv = (uint32_t)0U;
+  while ((uint32_t)1U << lv < n)
   {
-    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+    lv++;
   }
-  buf[pos] = x;
-  return ((__bool_uint32_t){ .fst = true, .snd = pos + (uint32_t)1U });
+  return lv;
 }
 
-static __bool_uint32_t
-serialize_uint16_t(bool ok, uint16_t x, uint8_t *buf, uint32_t sz, uint32_t pos)
+/* Whether the tree still holds the nodes that MTH(lo, hi) is computed from. */
+static bool proof_node_pre(uint32_t i, uint32_t lo, uint32_t hi)
 {
-  __bool_uint32_t scrut = serialize_uint8_t(ok, (uint8_t)(x >> (uint32_t)8U), buf, sz, pos);
-  bool ok1 = scrut.fst;
-  uint32_t pos1 = scrut.snd;
-  return serialize_uint8_t(ok1, (uint8_t)x, buf, sz, pos1);
+  uint32_t n = hi - lo;
+  if (proof_complete(n))
+  {
+    uint32_t lv = proof_level(n);
+    return lo >> lv >= MerkleTree_Low_offset_of(i >> lv);
+  }
+  uint32_t k = proof_split(n);
+  return proof_node_pre(i, lo, lo + k) && proof_node_pre(i, lo + k, hi);
 }
 
-static __bool_uint32_t
-serialize_uint32_t(bool ok, uint32_t x, uint8_t *buf, uint32_t sz, uint32_t pos)
+static void
+proof_node(
+  uint32_t hsz,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  uint32_t i,
+  uint32_t lo,
+  uint32_t hi,
+  uint8_t *dst,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
 {
-  __bool_uint32_t scrut = serialize_uint16_t(ok, (uint16_t)(x >> (uint32_t)16U), buf, sz, pos);
-  bool ok1 = scrut.fst;
-  uint32_t pos1 = scrut.snd;
-  return serialize_uint16_t(ok1, (uint16_t)x, buf, sz, pos1);
+  uint32_t n = hi - lo;
+  if (proof_complete(n))
+  {
+    uint32_t lv = proof_level(n);
+    hash_copy(hsz,
+      hash_slab_index(hsz,
+        index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
+        (lo >> lv) - MerkleTree_Low_offset_of(i >> lv)),
+      dst);
+    return;
+  }
+  uint32_t k = proof_split(n);
+  uint8_t *lh = MerkleTree_Low_Hashfunctions_init_hash(hsz);
+  proof_node(hsz, hs, i, lo, lo + k, lh, hash_fun);
+  proof_node(hsz, hs, i, lo + k, hi, dst, hash_fun);
+  hash_fun(lh, dst, dst);
+  MerkleTree_Low_Hashfunctions_free_hash(lh);
 }
 
-static __bool_uint32_t
-serialize_uint64_t(bool ok, uint64_t x, uint8_t *buf, uint32_t sz, uint32_t pos)
+static bool proof_hash_eq(uint32_t hsz, uint8_t *h1, uint8_t *h2)
 {
-  __bool_uint32_t scrut = serialize_uint32_t(ok, (uint32_t)(x >> (uint32_t)32U), buf, sz, pos);
-  bool ok1 = scrut.fst;
-  uint32_t pos1 = scrut.snd;
-  return serialize_uint32_t(ok1, (uint32_t)x, buf, sz, pos1);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < hsz; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(h1[i], h2[i]);
+    res = uu____0 & res;
+  }
+  return res == (uint8_t)255U;
 }
 
-static __bool_uint32_t
-(*serialize_offset_t)(bool x0, uint64_t x1, uint8_t *x2, uint32_t x3, uint32_t x4) =
-  serialize_uint64_t;
-
-static __bool_uint32_t
-serialize_hash_i(
-  uint32_t hash_size,
-  bool ok,
-  uint8_t *x,
-  uint8_t *buf,
-  uint32_t sz,
-  uint32_t pos,
-  uint32_t i
-)
+/* SUBPROOF(m, D[lo:hi], b) of RFC 6962, section 2.1.2. */
+static uint32_t mt_consistency_length(uint32_t m, uint32_t n, bool b)
 {
-  if (!ok || pos >= sz)
+  if (m == n)
   {
-    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+    if (b)
+    {
+      return (uint32_t)0U;
+    }
+    return (uint32_t)1U;
   }
-  uint8_t b = x[i];
-  __bool_uint32_t scrut = serialize_uint8_t(ok, b, buf, sz, pos);
-  bool ok1 = scrut.fst;
-  uint32_t pos1 = scrut.snd;
-  uint32_t j = i + (uint32_t)1U;
-  if (j < hash_size)
+  uint32_t k = proof_split(n);
+  if (m <= k)
   {
-    return serialize_hash_i(hash_size, ok1, x, buf, sz, pos1, j);
+    return mt_consistency_length(m, k, b) + (uint32_t)1U;
   }
-  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+  return mt_consistency_length(m - k, n - k, false) + (uint32_t)1U;
 }
 
-static __bool_uint32_t
-serialize_hash(
-  uint32_t hash_size,
-  bool ok,
-  uint8_t *x,
-  uint8_t *buf,
-  uint32_t sz,
-  uint32_t pos
-)
+static bool mt_get_consistency_pre_(uint32_t i, uint32_t m, uint32_t lo, uint32_t hi, bool b)
 {
-  if (!ok || pos >= sz)
+  uint32_t n = hi - lo;
+  if (m == n)
   {
-    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+    return b || proof_node_pre(i, lo, hi);
   }
-  return serialize_hash_i(hash_size, ok, x, buf, sz, pos, (uint32_t)0U);
+  uint32_t k = proof_split(n);
+  if (m <= k)
+  {
+    return mt_get_consistency_pre_(i, m, lo, lo + k, b) && proof_node_pre(i, lo + k, hi);
+  }
+  return mt_get_consistency_pre_(i, m - k, lo + k, hi, false) && proof_node_pre(i, lo, lo + k);
 }
 
-static __bool_uint32_t
-serialize_hash_vec_i(
-  uint32_t hash_size,
-  bool ok,
-  MerkleTree_Low_Datastructures_hash_vec x,
-  uint8_t *buf,
-  uint32_t sz,
-  uint32_t pos,
-  uint32_t i
+static void
+mt_get_consistency_(
+  uint32_t hsz,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  uint32_t i,
+  uint32_t m,
+  uint32_t lo,
+  uint32_t hi,
+  bool b,
+  MerkleTree_Low_proof *p,
+  uint8_t *acc,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 )
 {
-  if (!ok || pos >= sz)
+  uint32_t n = hi - lo;
+  if (m == n)
   {
-    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+    if (!b)
+    {
+      proof_node(hsz, hs, i, lo, hi, acc, hash_fun);
+      proof_insert(p, acc);
+    }
+    return;
   }
-  uint8_t *vi = index___uint8_t_(x, i);
-  __bool_uint32_t scrut = serialize_hash(hash_size, ok, vi, buf, sz, pos);
-  bool ok1 = scrut.fst;
-  uint32_t pos1 = scrut.snd;
-  uint32_t j = i + (uint32_t)1U;
-  if (j < x.sz)
+  uint32_t k = proof_split(n);
+  if (m <= k)
   {
-    return serialize_hash_vec_i(hash_size, ok1, x, buf, sz, pos1, j);
+    mt_get_consistency_(hsz, hs, i, m, lo, lo + k, b, p, acc, hash_fun);
+    proof_node(hsz, hs, i, lo + k, hi, acc, hash_fun);
+    proof_insert(p, acc);
+    return;
   }
-  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+  mt_get_consistency_(hsz, hs, i, m - k, lo + k, hi, false, p, acc, hash_fun);
+  proof_node(hsz, hs, i, lo, lo + k, acc, hash_fun);
+  proof_insert(p, acc);
 }
 
-static __bool_uint32_t
-serialize_hash_vec(
-  uint32_t hash_size,
-  bool ok,
-  MerkleTree_Low_Datastructures_hash_vec x,
-  uint8_t *buf,
-  uint32_t sz,
-  uint32_t pos
+bool
+MerkleTree_Low_mt_get_consistency_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  const MerkleTree_Low_proof *p,
+  uint8_t *root
 )
 {
-  if (!ok || pos >= sz)
-  {
-    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
-  }
-  __bool_uint32_t scrut = serialize_uint32_t(ok, x.sz, buf, sz, pos);
-  bool ok1 = scrut.fst;
-  uint32_t pos1 = scrut.snd;
-  if (ok1 && x.sz > (uint32_t)0U)
-  {
-    return serialize_hash_vec_i(hash_size, ok1, x, buf, sz, pos1, (uint32_t)0U);
-  }
-  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  return
+    old_max
+    > mtv.offset
+    && old_max - mtv.offset <= (uint64_t)mtv.j
+    && p->hash_size == mtv.hash_size
+    && p->sz == (uint32_t)0U
+    && mt_get_consistency_pre_(mtv.i, (uint32_t)(old_max - mtv.offset), (uint32_t)0U, mtv.j, true);
 }
 
-static uint64_t
-hash_vv_bytes_i(uint32_t hash_size, MerkleTree_Low_Datastructures_hash_vv vv, uint32_t i)
+uint32_t
+MerkleTree_Low_mt_get_consistency(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  MerkleTree_Low_proof *p,
+  uint8_t *root
+)
 {
-  if (i >= vv.sz)
-  {
-    return (uint64_t)4U;
-  }
-  MerkleTree_Low_Datastructures_hash_vec vvi = index__LowStar_Vector_vector_str__uint8_t_(vv, i);
-  uint64_t vs_hs = (uint64_t)vvi.sz * (uint64_t)hash_size;
-  uint64_t r;
-  if (MerkleTree_Low_uint64_max - vs_hs >= (uint64_t)4U)
+  MerkleTree_Low_mt_get_root(mt, root);
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  uint32_t hsz = mtv.hash_size;
+  uint8_t *acc = MerkleTree_Low_Hashfunctions_init_hash(hsz);
+  mt_get_consistency_(hsz,
+    mtv.hs,
+    mtv.i,
+    (uint32_t)(old_max - mtv.offset),
+    (uint32_t)0U,
+    mtv.j,
+    true,
+    p,
+    acc,
+    mtv.hash_fun);
+  MerkleTree_Low_Hashfunctions_free_hash(acc);
+  return mtv.j;
+}
+
+/* Recomputes, from the proof hashes from ppos on, the roots of the first m
+   leaves (into oacc) and of all n leaves (into nacc) of a range; returns the
+   position of the next proof hash. */
+static uint32_t
+mt_verify_consistency_(
+  uint32_t hsz,
+  uint32_t m,
+  uint32_t n,
+  bool b,
+  const MerkleTree_Low_proof *p,
+  uint32_t ppos,
+  uint8_t *old_rt,
+  uint8_t *oacc,
+  uint8_t *nacc,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  if (m == n)
   {
-    r = vs_hs + (uint64_t)4U;
+    if (b)
+    {
+      hash_copy(hsz, old_rt, oacc);
+      hash_copy(hsz, old_rt, nacc);
+      return ppos;
+    }
+    hash_copy(hsz, MerkleTree_Low_mt_get_proof_step(p, ppos), oacc);
+    hash_copy(hsz, MerkleTree_Low_mt_get_proof_step(p, ppos), nacc);
+    return ppos + (uint32_t)1U;
   }
-  else
+  uint32_t k = proof_split(n);
+  if (m <= k)
   {
-    r = MerkleTree_Low_uint64_max;
+    uint32_t pos = mt_verify_consistency_(hsz, m, k, b, p, ppos, old_rt, oacc, nacc, hash_fun);
+    hash_fun(nacc, MerkleTree_Low_mt_get_proof_step(p, pos), nacc);
+    return pos + (uint32_t)1U;
   }
-  uint64_t rest = hash_vv_bytes_i(hash_size, vv, i + (uint32_t)1U);
-  if (MerkleTree_Low_uint64_max - r >= rest)
+  uint32_t
+  pos = mt_verify_consistency_(hsz, m - k, n - k, false, p, ppos, old_rt, oacc, nacc, hash_fun);
+  uint8_t *phash = MerkleTree_Low_mt_get_proof_step(p, pos);
+  hash_fun(phash, oacc, oacc);
+  hash_fun(phash, nacc, nacc);
+  return pos + (uint32_t)1U;
+}
+
+bool
+MerkleTree_Low_mt_verify_consistency_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  uint8_t *old_rt,
+  uint64_t max,
+  uint8_t *rt,
+  const MerkleTree_Low_proof *p
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  return
+    old_max
+    > mtv.offset
+    && old_max <= max
+    && max - mtv.offset <= MerkleTree_Low_offset_range_limit
+    && p->hash_size == mtv.hash_size
+    &&
+      p->sz
+      ==
+        mt_consistency_length((uint32_t)(old_max - mtv.offset),
+          (uint32_t)(max - mtv.offset),
+          true);
+}
+
+bool
+MerkleTree_Low_mt_verify_consistency(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  uint8_t *old_rt,
+  uint64_t max,
+  uint8_t *rt,
+  const MerkleTree_Low_proof *p
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  uint32_t hsz = mtv.hash_size;
+  uint8_t *oacc = MerkleTree_Low_Hashfunctions_init_hash(hsz);
+  uint8_t *nacc = MerkleTree_Low_Hashfunctions_init_hash(hsz);
+  mt_verify_consistency_(hsz,
+    (uint32_t)(old_max - mtv.offset),
+    (uint32_t)(max - mtv.offset),
+    true,
+    p,
+    (uint32_t)0U,
+    old_rt,
+    oacc,
+    nacc,
+    mtv.hash_fun);
+  bool r = proof_hash_eq(hsz, oacc, old_rt) && proof_hash_eq(hsz, nacc, rt);
+  MerkleTree_Low_Hashfunctions_free_hash(oacc);
+  MerkleTree_Low_Hashfunctions_free_hash(nacc);
+  return r;
+}
+
+/* Whether the range [lo, hi) holds the next target, idxs[pos]. */
+static bool
+multi_proof_hit(uint64_t ofs, uint32_t n, const uint64_t *idxs, uint32_t pos, uint32_t hi)
+{
+  return pos < n && idxs[pos] - ofs < (uint64_t)hi;
+}
+
+static bool multi_proof_sorted(uint32_t n, const uint64_t *idxs)
+{
+  for (uint32_t k = (uint32_t)1U; k < n; k++)
   {
-    return r + rest;
+    if (idxs[k - (uint32_t)1U] >= idxs[k])
+    {
+      return false;
+    }
   }
-  return MerkleTree_Low_uint64_max;
+  return true;
 }
 
-static __bool_uint32_t
-serialize_hash_vv_i(
-  uint32_t hash_size,
-  bool ok,
-  MerkleTree_Low_Datastructures_hash_vv x,
-  uint8_t *buf,
-  uint32_t sz,
-  uint32_t pos,
-  uint32_t i
+/* Counts the subtree roots in a multi-leaf proof for the targets from *pos on
+   within [lo, hi), and advances *pos past these targets. If held, also checks
+   that the tree still holds the nodes these roots are computed from. */
+static uint32_t
+mt_multi_proof_length(
+  uint32_t i,
+  bool held,
+  uint64_t ofs,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint32_t *pos,
+  uint32_t lo,
+  uint32_t hi,
+  bool *ok
 )
 {
-  if (!ok || pos >= sz)
+  if (!multi_proof_hit(ofs, n, idxs, *pos, hi))
   {
-    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+    if (held && !proof_node_pre(i, lo, hi))
+    {
+      *ok = false;
+    }
+    return (uint32_t)1U;
   }
-  MerkleTree_Low_Datastructures_hash_vec vi = index__LowStar_Vector_vector_str__uint8_t_(x, i);
-  __bool_uint32_t scrut = serialize_hash_vec(hash_size, ok, vi, buf, sz, pos);
-  bool ok1 = scrut.fst;
-  uint32_t pos1 = scrut.snd;
-  uint32_t j = i + (uint32_t)1U;
-  if (j < x.sz)
+  if (hi - lo == (uint32_t)1U)
   {
-    return serialize_hash_vv_i(hash_size, ok1, x, buf, sz, pos1, j);
+    *pos = *pos + (uint32_t)1U;
+    return (uint32_t)0U;
   }
-  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+  uint32_t k = proof_split(hi - lo);
+  uint32_t l = mt_multi_proof_length(i, held, ofs, n, idxs, pos, lo, lo + k, ok);
+  return l + mt_multi_proof_length(i, held, ofs, n, idxs, pos, lo + k, hi, ok);
 }
 
-static __bool_uint32_t
-serialize_hash_vv(
-  uint32_t hash_size,
-  bool ok,
-  MerkleTree_Low_Datastructures_hash_vv x,
-  uint8_t *buf,
-  uint32_t sz,
-  uint32_t pos
+static void
+mt_get_multi_proof_(
+  uint32_t hsz,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  uint32_t i,
+  uint64_t ofs,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint32_t *pos,
+  uint32_t lo,
+  uint32_t hi,
+  MerkleTree_Low_proof *p,
+  uint8_t *acc,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 )
 {
-  if (!ok || pos >= sz)
+  if (!multi_proof_hit(ofs, n, idxs, *pos, hi))
   {
-    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+    proof_node(hsz, hs, i, lo, hi, acc, hash_fun);
+    proof_insert(p, acc);
+    return;
   }
-  __bool_uint32_t scrut = serialize_uint32_t(ok, x.sz, buf, sz, pos);
-  bool ok1 = scrut.fst;
-  uint32_t pos1 = scrut.snd;
-  if (x.sz > (uint32_t)0U)
+  if (hi - lo == (uint32_t)1U)
   {
-    return serialize_hash_vv_i(hash_size, ok1, x, buf, sz, pos1, (uint32_t)0U);
+    *pos = *pos + (uint32_t)1U;
+    return;
   }
-  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+  uint32_t k = proof_split(hi - lo);
+  mt_get_multi_proof_(hsz, hs, i, ofs, n, idxs, pos, lo, lo + k, p, acc, hash_fun);
+  mt_get_multi_proof_(hsz, hs, i, ofs, n, idxs, pos, lo + k, hi, p, acc, hash_fun);
 }
 
-typedef struct __bool_uint32_t_bool_s
+bool
+MerkleTree_Low_mt_get_multi_proof_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  const MerkleTree_Low_proof *p,
+  uint8_t *root
+)
 {
-  bool fst;
-  uint32_t snd;
-  bool thd;
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  if
+  (
+    !(n
+    > (uint32_t)0U
+    && multi_proof_sorted(n, idxs)
+    && idxs[0U] >= mtv.offset + (uint64_t)mtv.i
+    && idxs[n - (uint32_t)1U] < mtv.offset + (uint64_t)mtv.j
+    && p->hash_size == mtv.hash_size
+    && p->sz == (uint32_t)0U)
+  )
+  {
+    return false;
+  }
+  bool ok = true;
+  uint32_t pos = (uint32_t)0U;
+  mt_multi_proof_length(mtv.i, true, mtv.offset, n, idxs, &pos, (uint32_t)0U, mtv.j, &ok);
+  return ok;
 }
-__bool_uint32_t_bool;
 
-static __bool_uint32_t_bool
-deserialize_bool(bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+uint32_t
+MerkleTree_Low_mt_get_multi_proof(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  MerkleTree_Low_proof *p,
+  uint8_t *root
+)
 {
-  if (!ok || pos >= sz)
+  MerkleTree_Low_mt_get_root(mt, root);
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  uint32_t hsz = mtv.hash_size;
+  uint32_t ofs = MerkleTree_Low_offset_of(mtv.i);
+  MerkleTree_Low_Datastructures_hash_slab
+  lv0 = index__LowStar_Vector_vector_str__uint8_t_(mtv.hs, (uint32_t)0U);
+  for (uint32_t k = (uint32_t)0U; k < n; k++)
   {
-    return ((__bool_uint32_t_bool){ .fst = false, .snd = pos, .thd = false });
+    proof_insert(p, hash_slab_index(hsz, lv0, (uint32_t)(idxs[k] - mtv.offset) - ofs));
   }
-  bool sw;
-  switch (buf[pos])
+  uint8_t *acc = MerkleTree_Low_Hashfunctions_init_hash(hsz);
+  uint32_t pos = (uint32_t)0U;
+  mt_get_multi_proof_(hsz,
+    mtv.hs,
+    mtv.i,
+    mtv.offset,
+    n,
+    idxs,
+    &pos,
+    (uint32_t)0U,
+    mtv.j,
+    p,
+    acc,
+    mtv.hash_fun);
+  MerkleTree_Low_Hashfunctions_free_hash(acc);
+  return mtv.j;
+}
+
+/* Recomputes MTH(lo, hi) into acc, taking target hashes from *lpos on and
+   subtree roots from *spos on in the proof. */
+static void
+mt_verify_multi_proof_(
+  uint32_t hsz,
+  uint64_t ofs,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint32_t *lpos,
+  uint32_t *spos,
+  uint32_t lo,
+  uint32_t hi,
+  const MerkleTree_Low_proof *p,
+  uint8_t *acc,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  if (!multi_proof_hit(ofs, n, idxs, *lpos, hi))
   {
-    case 0U:
-      {
-        sw = false;
-        break;
-      }
-    default:
-      {
-        sw = true;
-      }
+    hash_copy(hsz, MerkleTree_Low_mt_get_proof_step(p, n + *spos), acc);
+    *spos = *spos + (uint32_t)1U;
+    return;
   }
-  return ((__bool_uint32_t_bool){ .fst = true, .snd = pos + (uint32_t)1U, .thd = sw });
+  if (hi - lo == (uint32_t)1U)
+  {
+    hash_copy(hsz, MerkleTree_Low_mt_get_proof_step(p, *lpos), acc);
+    *lpos = *lpos + (uint32_t)1U;
+    return;
+  }
+  uint32_t k = proof_split(hi - lo);
+  uint8_t *lh = MerkleTree_Low_Hashfunctions_init_hash(hsz);
+  mt_verify_multi_proof_(hsz, ofs, n, idxs, lpos, spos, lo, lo + k, p, lh, hash_fun);
+  mt_verify_multi_proof_(hsz, ofs, n, idxs, lpos, spos, lo + k, hi, p, acc, hash_fun);
+  hash_fun(lh, acc, acc);
+  MerkleTree_Low_Hashfunctions_free_hash(lh);
 }
 
-typedef struct __bool_uint32_t_uint8_t_s
+bool
+MerkleTree_Low_mt_verify_multi_proof_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint64_t max,
+  const MerkleTree_Low_proof *p,
+  uint8_t *rt
+)
 {
-  bool fst;
-  uint32_t snd;
-  uint8_t thd;
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  if
+  (
+    !(n
+    > (uint32_t)0U
+    && multi_proof_sorted(n, idxs)
+    && idxs[0U] >= mtv.offset
+    && idxs[n - (uint32_t)1U] < max
+    && max - mtv.offset <= MerkleTree_Low_offset_range_limit
+    && p->hash_size == mtv.hash_size)
+  )
+  {
+    return false;
+  }
+  bool ok = true;
+  uint32_t pos = (uint32_t)0U;
+  uint32_t
+  len =
+    mt_multi_proof_length((uint32_t)0U,
+      false,
+      mtv.offset,
+      n,
+      idxs,
+      &pos,
+      (uint32_t)0U,
+      (uint32_t)(max - mtv.offset),
+      &ok);
+  return p->sz == n + len;
 }
-__bool_uint32_t_uint8_t;
 
-static __bool_uint32_t_uint8_t
-deserialize_uint8_t(bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+bool
+MerkleTree_Low_mt_verify_multi_proof(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint64_t max,
+  const MerkleTree_Low_proof *p,
+  uint8_t *rt
+)
 {
-  if (!ok || pos >= sz)
-  {
-    return ((__bool_uint32_t_uint8_t){ .fst = false, .snd = pos, .thd = (uint8_t)0U });
-  }
-  return ((__bool_uint32_t_uint8_t){ .fst = true, .snd = pos + (uint32_t)1U, .thd = buf[pos] });
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  uint32_t hsz = mtv.hash_size;
+  uint8_t *acc = MerkleTree_Low_Hashfunctions_init_hash(hsz);
+  uint32_t lpos = (uint32_t)0U;
+  uint32_t spos = (uint32_t)0U;
+  mt_verify_multi_proof_(hsz,
+    mtv.offset,
+    n,
+    idxs,
+    &lpos,
+    &spos,
+    (uint32_t)0U,
+    (uint32_t)(max - mtv.offset),
+    p,
+    acc,
+    mtv.hash_fun);
+  bool r = proof_hash_eq(hsz, acc, rt);
+  MerkleTree_Low_Hashfunctions_free_hash(acc);
+  return r;
 }
 
-typedef struct __bool_uint32_t_uint16_t_s
+typedef struct __bool_uint32_t_s
 {
   bool fst;
   uint32_t snd;
-  uint16_t thd;
 }
-__bool_uint32_t_uint16_t;
+__bool_uint32_t;
 
-static __bool_uint32_t_uint16_t
-deserialize_uint16_t(bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+static __bool_uint32_t serialize_bool(bool ok, bool x, uint8_t *buf, uint32_t sz, uint32_t pos)
 {
   if (!ok || pos >= sz)
   {
-    return ((__bool_uint32_t_uint16_t){ .fst = false, .snd = pos, .thd = (uint16_t)0U });
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
   }
-  __bool_uint32_t_uint8_t scrut0 = deserialize_uint8_t(ok, buf, sz, pos);
-  bool ok1 = scrut0.fst;
-  uint32_t pos1 = scrut0.snd;
-  uint8_t b0 = scrut0.thd;
-  __bool_uint32_t_uint8_t scrut = deserialize_uint8_t(ok1, buf, sz, pos1);
-  bool ok2 = scrut.fst;
-  uint32_t pos2 = scrut.snd;
-  uint8_t b1 = scrut.thd;
-  return
-    (
-      (__bool_uint32_t_uint16_t){
-        .fst = ok2,
-        .snd = pos2,
-        .thd = ((uint16_t)b0 << (uint32_t)8U) + (uint16_t)b1
-      }
-    );
-}
-
-typedef struct __bool_uint32_t_uint32_t_s
-{
-  bool fst;
-  uint32_t snd;
-  uint32_t thd;
+  uint8_t ite;
+  if (x)
+  {
+    ite = (uint8_t)1U;
+  }
+  else
+  {
+    ite = (uint8_t)0U;
+  }
+  buf[pos] = ite;
+  return ((__bool_uint32_t){ .fst = true, .snd = pos + (uint32_t)1U });
 }
-__bool_uint32_t_uint32_t;
 
-static __bool_uint32_t_uint32_t
-deserialize_uint32_t(bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+static __bool_uint32_t
+serialize_uint8_t(bool ok, uint8_t x, uint8_t *buf, uint32_t sz, uint32_t pos)
 {
   if (!ok || pos >= sz)
   {
-    return ((__bool_uint32_t_uint32_t){ .fst = false, .snd = pos, .thd = (uint32_t)0U });
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
   }
-  __bool_uint32_t_uint16_t scrut0 = deserialize_uint16_t(ok, buf, sz, pos);
-  bool ok1 = scrut0.fst;
-  uint32_t pos1 = scrut0.snd;
-  uint16_t b0 = scrut0.thd;
-  __bool_uint32_t_uint16_t scrut = deserialize_uint16_t(ok1, buf, sz, pos1);
-  bool ok2 = scrut.fst;
-  uint32_t pos2 = scrut.snd;
-  uint16_t b1 = scrut.thd;
-  return
-    (
-      (__bool_uint32_t_uint32_t){
-        .fst = ok2,
-        .snd = pos2,
-        .thd = ((uint32_t)b0 << (uint32_t)16U) + (uint32_t)b1
-      }
-    );
+  buf[pos] = x;
+  return ((__bool_uint32_t){ .fst = true, .snd = pos + (uint32_t)1U });
 }
 
-typedef struct __bool_uint32_t_uint64_t_s
+static __bool_uint32_t
+serialize_uint16_t(bool ok, uint16_t x, uint8_t *buf, uint32_t sz, uint32_t pos)
 {
-  bool fst;
-  uint32_t snd;
-  uint64_t thd;
+  __bool_uint32_t scrut = serialize_uint8_t(ok, (uint8_t)(x >> (uint32_t)8U), buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
+  return serialize_uint8_t(ok1, (uint8_t)x, buf, sz, pos1);
 }
-__bool_uint32_t_uint64_t;
 
-static __bool_uint32_t_uint64_t
-deserialize_uint64_t(bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+static __bool_uint32_t
+serialize_uint32_t(bool ok, uint32_t x, uint8_t *buf, uint32_t sz, uint32_t pos)
 {
-  if (!ok || pos >= sz)
-  {
-    return ((__bool_uint32_t_uint64_t){ .fst = false, .snd = pos, .thd = (uint64_t)0U });
-  }
-  __bool_uint32_t_uint32_t scrut0 = deserialize_uint32_t(ok, buf, sz, pos);
-  bool ok1 = scrut0.fst;
-  uint32_t pos1 = scrut0.snd;
-  uint32_t b0 = scrut0.thd;
-  __bool_uint32_t_uint32_t scrut = deserialize_uint32_t(ok1, buf, sz, pos1);
-  bool ok2 = scrut.fst;
-  uint32_t pos2 = scrut.snd;
-  uint32_t b1 = scrut.thd;
-  return
-    (
-      (__bool_uint32_t_uint64_t){
-        .fst = ok2,
-        .snd = pos2,
-        .thd = ((uint64_t)b0 << (uint32_t)32U) + (uint64_t)b1
-      }
-    );
+  __bool_uint32_t scrut = serialize_uint16_t(ok, (uint16_t)(x >> (uint32_t)16U), buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
+  return serialize_uint16_t(ok1, (uint16_t)x, buf, sz, pos1);
 }
 
-static __bool_uint32_t_uint64_t
-(*deserialize_offset_t)(bool x0, const uint8_t *x1, uint32_t x2, uint32_t x3) =
-  deserialize_uint64_t;
-
-static __bool_uint32_t_uint32_t
-(*deserialize_index_t)(bool x0, const uint8_t *x1, uint32_t x2, uint32_t x3) =
-  deserialize_uint32_t;
-
-typedef struct __bool_uint32_t__uint8_t__s
+static __bool_uint32_t
+serialize_uint64_t(bool ok, uint64_t x, uint8_t *buf, uint32_t sz, uint32_t pos)
 {
-  bool fst;
-  uint32_t snd;
-  uint8_t *thd;
+  __bool_uint32_t scrut = serialize_uint32_t(ok, (uint32_t)(x >> (uint32_t)32U), buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
+  return serialize_uint32_t(ok1, (uint32_t)x, buf, sz, pos1);
 }
-__bool_uint32_t__uint8_t_;
 
-static __bool_uint32_t__uint8_t_
-deserialize_hash(uint32_t hash_size, bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
-{
-  regional__uint32_t__uint8_t_
-  rg = { .state = hash_size, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
-  if (!ok || pos >= sz)
-  {
-    return ((__bool_uint32_t__uint8_t_){ .fst = false, .snd = pos, .thd = rg.dummy });
-  }
-  if (sz - pos < hash_size)
-  {
-    return ((__bool_uint32_t__uint8_t_){ .fst = false, .snd = pos, .thd = rg.dummy });
-  }
-  uint8_t *hash = rg.r_alloc(rg.state);
-  memcpy(hash, (uint8_t *)buf + pos, hash_size * sizeof (uint8_t));
-  return ((__bool_uint32_t__uint8_t_){ .fst = true, .snd = pos + hash_size, .thd = hash });
-}
+static __bool_uint32_t
+(*serialize_offset_t)(bool x0, uint64_t x1, uint8_t *x2, uint32_t x3, uint32_t x4) =
+  serialize_uint64_t;
 
 static __bool_uint32_t
-deserialize_hash_vec_i(
+serialize_hash_i(
   uint32_t hash_size,
   bool ok,
-  const uint8_t *buf,
+  uint8_t *x,
+  uint8_t *buf,
   uint32_t sz,
   uint32_t pos,
-  MerkleTree_Low_Datastructures_hash_vec res,
   uint32_t i
 )
 {
   if (!ok || pos >= sz)
   {
-    return ((__bool_uint32_t){ .fst = false, .snd = pos });
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
   }
-  __bool_uint32_t__uint8_t_ scrut = deserialize_hash(hash_size, ok, buf, sz, pos);
+  uint8_t b = x[i];
+  __bool_uint32_t scrut = serialize_uint8_t(ok, b, buf, sz, pos);
   bool ok1 = scrut.fst;
   uint32_t pos1 = scrut.snd;
-  uint8_t *h = scrut.thd;
-  if (!ok1)
-  {
-    return ((__bool_uint32_t){ .fst = false, .snd = pos1 });
-  }
-  assign___uint8_t_(res, i, h);
   uint32_t j = i + (uint32_t)1U;
-  if (j < res.sz)
+  if (j < hash_size)
   {
-    return deserialize_hash_vec_i(hash_size, ok1, buf, sz, pos1, res, j);
+    return serialize_hash_i(hash_size, ok1, x, buf, sz, pos1, j);
   }
-  return ((__bool_uint32_t){ .fst = true, .snd = pos1 });
-}
-
-static MerkleTree_Low_Datastructures_hash_vec alloc___uint8_t_(uint32_t len, uint8_t *v)
-{
-  return alloc_rid___uint8_t_(len, v);
-}
-
-typedef struct __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec_s
-{
-  bool fst;
-  uint32_t snd;
-  MerkleTree_Low_Datastructures_hash_vec thd;
+  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
 }
-__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec;
 
-static __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec
-deserialize_hash_vec(
+static __bool_uint32_t
+serialize_hash(
   uint32_t hash_size,
   bool ok,
-  const uint8_t *buf,
+  uint8_t *x,
+  uint8_t *buf,
   uint32_t sz,
   uint32_t pos
 )
 {
-  regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec
-  rg =
-    {
-      .state = hash_size,
-      .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
-      .r_alloc = hash_vec_r_alloc,
-      .r_free = hash_vec_r_free
-    };
   if (!ok || pos >= sz)
   {
-    return
-      (
-        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec){
-          .fst = false,
-          .snd = pos,
-          .thd = rg.dummy
-        }
-      );
-  }
-  __bool_uint32_t_uint32_t scrut0 = deserialize_uint32_t(ok, buf, sz, pos);
-  bool ok1 = scrut0.fst;
-  uint32_t pos1 = scrut0.snd;
-  uint32_t n = scrut0.thd;
-  if (!ok1)
-  {
-    return
-      (
-        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec){
-          .fst = false,
-          .snd = pos1,
-          .thd = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }
-        }
-      );
-  }
-  if (n == (uint32_t)0U)
-  {
-    return
-      (
-        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec){
-          .fst = true,
-          .snd = pos1,
-          .thd = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }
-        }
-      );
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
   }
-  regional__uint32_t__uint8_t_
-  hrg = { .state = hash_size, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
-  MerkleTree_Low_Datastructures_hash_vec res = alloc___uint8_t_(n, hrg.dummy);
-  __bool_uint32_t
-  scrut = deserialize_hash_vec_i(hash_size, ok1, buf, sz, pos1, res, (uint32_t)0U);
-  bool ok2 = scrut.fst;
-  uint32_t pos2 = scrut.snd;
-  return
-    (
-      (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec){
-        .fst = ok2,
-        .snd = pos2,
-        .thd = res
-      }
-    );
+  return serialize_hash_i(hash_size, ok, x, buf, sz, pos, (uint32_t)0U);
 }
 
 static __bool_uint32_t
-deserialize_hash_vv_i(
+serialize_hash_vec_i(
   uint32_t hash_size,
   bool ok,
-  const uint8_t *buf,
+  MerkleTree_Low_Datastructures_hash_vec x,
+  uint8_t *buf,
   uint32_t sz,
   uint32_t pos,
-  MerkleTree_Low_Datastructures_hash_vv res,
   uint32_t i
 )
 {
@@ -2372,300 +3932,2093 @@ deserialize_hash_vv_i(
   {
     return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
   }
-  __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec
-  scrut = deserialize_hash_vec(hash_size, ok, buf, sz, pos);
+  uint8_t *vi = index___uint8_t_(x, i);
+  __bool_uint32_t scrut = serialize_hash(hash_size, ok, vi, buf, sz, pos);
   bool ok1 = scrut.fst;
   uint32_t pos1 = scrut.snd;
-  MerkleTree_Low_Datastructures_hash_vec hv = scrut.thd;
-  if (!ok1)
-  {
-    return ((__bool_uint32_t){ .fst = false, .snd = pos1 });
+  uint32_t j = i + (uint32_t)1U;
+  if (j < x.sz)
+  {
+    return serialize_hash_vec_i(hash_size, ok1, x, buf, sz, pos1, j);
   }
-  assign__LowStar_Vector_vector_str__uint8_t_(res, i, hv);
+  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+}
+
+static __bool_uint32_t
+serialize_hash_vec(
+  uint32_t hash_size,
+  bool ok,
+  MerkleTree_Low_Datastructures_hash_vec x,
+  uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos
+)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+  }
+  __bool_uint32_t scrut = serialize_uint32_t(ok, x.sz, buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
+  if (ok1 && x.sz > (uint32_t)0U)
+  {
+    return serialize_hash_vec_i(hash_size, ok1, x, buf, sz, pos1, (uint32_t)0U);
+  }
+  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+}
+
+static __bool_uint32_t
+serialize_hash_slab(
+  uint32_t hash_size,
+  bool ok,
+  MerkleTree_Low_Datastructures_hash_slab x,
+  uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos
+)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+  }
+  __bool_uint32_t scrut = serialize_uint32_t(ok, x.sz, buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
+  for (uint32_t i = (uint32_t)0U; ok1 && i < x.sz; i++)
+  {
+    __bool_uint32_t
+    scrut0 = serialize_hash(hash_size, ok1, hash_slab_index(hash_size, x, i), buf, sz, pos1);
+    ok1 = scrut0.fst;
+    pos1 = scrut0.snd;
+  }
+  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+}
+
+static uint64_t
+hash_vv_bytes_i(uint32_t hash_size, MerkleTree_Low_Datastructures_hash_vv vv, uint32_t i)
+{
+  if (i >= vv.sz)
+  {
+    return (uint64_t)4U;
+  }
+  MerkleTree_Low_Datastructures_hash_slab vvi = index__LowStar_Vector_vector_str__uint8_t_(vv, i);
+  uint64_t vs_hs = (uint64_t)vvi.sz * (uint64_t)hash_size;
+  uint64_t r;
+  if (MerkleTree_Low_uint64_max - vs_hs >= (uint64_t)4U)
+  {
+    r = vs_hs + (uint64_t)4U;
+  }
+  else
+  {
+    r = MerkleTree_Low_uint64_max;
+  }
+  uint64_t rest = hash_vv_bytes_i(hash_size, vv, i + (uint32_t)1U);
+  if (MerkleTree_Low_uint64_max - r >= rest)
+  {
+    return r + rest;
+  }
+  return MerkleTree_Low_uint64_max;
+}
+
+static __bool_uint32_t
+serialize_hash_vv_i(
+  uint32_t hash_size,
+  bool ok,
+  MerkleTree_Low_Datastructures_hash_vv x,
+  uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos,
+  uint32_t i
+)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+  }
+  MerkleTree_Low_Datastructures_hash_slab vi = index__LowStar_Vector_vector_str__uint8_t_(x, i);
+  __bool_uint32_t scrut = serialize_hash_slab(hash_size, ok, vi, buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
   uint32_t j = i + (uint32_t)1U;
-  if (j == res.sz)
+  if (j < x.sz)
   {
-    return ((__bool_uint32_t){ .fst = true, .snd = pos1 });
+    return serialize_hash_vv_i(hash_size, ok1, x, buf, sz, pos1, j);
   }
-  return deserialize_hash_vv_i(hash_size, ok1, buf, sz, pos1, res, j);
+  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+}
+
+static __bool_uint32_t
+serialize_hash_vv(
+  uint32_t hash_size,
+  bool ok,
+  MerkleTree_Low_Datastructures_hash_vv x,
+  uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos
+)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+  }
+  __bool_uint32_t scrut = serialize_uint32_t(ok, x.sz, buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
+  if (x.sz > (uint32_t)0U)
+  {
+    return serialize_hash_vv_i(hash_size, ok1, x, buf, sz, pos1, (uint32_t)0U);
+  }
+  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+}
+
+typedef struct __bool_uint32_t_bool_s
+{
+  bool fst;
+  uint32_t snd;
+  bool thd;
+}
+__bool_uint32_t_bool;
+
+static __bool_uint32_t_bool
+deserialize_bool(bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t_bool){ .fst = false, .snd = pos, .thd = false });
+  }
+  bool sw;
+  switch (buf[pos])
+  {
+    case 0U:
+      {
+        sw = false;
+        break;
+      }
+    default:
+      {
+        sw = true;
+      }
+  }
+  return ((__bool_uint32_t_bool){ .fst = true, .snd = pos + (uint32_t)1U, .thd = sw });
+}
+
+typedef struct __bool_uint32_t_uint8_t_s
+{
+  bool fst;
+  uint32_t snd;
+  uint8_t thd;
+}
+__bool_uint32_t_uint8_t;
+
+static __bool_uint32_t_uint8_t
+deserialize_uint8_t(bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t_uint8_t){ .fst = false, .snd = pos, .thd = (uint8_t)0U });
+  }
+  return ((__bool_uint32_t_uint8_t){ .fst = true, .snd = pos + (uint32_t)1U, .thd = buf[pos] });
+}
+
+typedef struct __bool_uint32_t_uint16_t_s
+{
+  bool fst;
+  uint32_t snd;
+  uint16_t thd;
+}
+__bool_uint32_t_uint16_t;
+
+static __bool_uint32_t_uint16_t
+deserialize_uint16_t(bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t_uint16_t){ .fst = false, .snd = pos, .thd = (uint16_t)0U });
+  }
+  __bool_uint32_t_uint8_t scrut0 = deserialize_uint8_t(ok, buf, sz, pos);
+  bool ok1 = scrut0.fst;
+  uint32_t pos1 = scrut0.snd;
+  uint8_t b0 = scrut0.thd;
+  __bool_uint32_t_uint8_t scrut = deserialize_uint8_t(ok1, buf, sz, pos1);
+  bool ok2 = scrut.fst;
+  uint32_t pos2 = scrut.snd;
+  uint8_t b1 = scrut.thd;
+  return
+    (
+      (__bool_uint32_t_uint16_t){
+        .fst = ok2,
+        .snd = pos2,
+        .thd = ((uint16_t)b0 << (uint32_t)8U) + (uint16_t)b1
+      }
+    );
+}
+
+typedef struct __bool_uint32_t_uint32_t_s
+{
+  bool fst;
+  uint32_t snd;
+  uint32_t thd;
+}
+__bool_uint32_t_uint32_t;
+
+static __bool_uint32_t_uint32_t
+deserialize_uint32_t(bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t_uint32_t){ .fst = false, .snd = pos, .thd = (uint32_t)0U });
+  }
+  __bool_uint32_t_uint16_t scrut0 = deserialize_uint16_t(ok, buf, sz, pos);
+  bool ok1 = scrut0.fst;
+  uint32_t pos1 = scrut0.snd;
+  uint16_t b0 = scrut0.thd;
+  __bool_uint32_t_uint16_t scrut = deserialize_uint16_t(ok1, buf, sz, pos1);
+  bool ok2 = scrut.fst;
+  uint32_t pos2 = scrut.snd;
+  uint16_t b1 = scrut.thd;
+  return
+    (
+      (__bool_uint32_t_uint32_t){
+        .fst = ok2,
+        .snd = pos2,
+        .thd = ((uint32_t)b0 << (uint32_t)16U) + (uint32_t)b1
+      }
+    );
+}
+
+typedef struct __bool_uint32_t_uint64_t_s
+{
+  bool fst;
+  uint32_t snd;
+  uint64_t thd;
+}
+__bool_uint32_t_uint64_t;
+
+static __bool_uint32_t_uint64_t
+deserialize_uint64_t(bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t_uint64_t){ .fst = false, .snd = pos, .thd = (uint64_t)0U });
+  }
+  __bool_uint32_t_uint32_t scrut0 = deserialize_uint32_t(ok, buf, sz, pos);
+  bool ok1 = scrut0.fst;
+  uint32_t pos1 = scrut0.snd;
+  uint32_t b0 = scrut0.thd;
+  __bool_uint32_t_uint32_t scrut = deserialize_uint32_t(ok1, buf, sz, pos1);
+  bool ok2 = scrut.fst;
+  uint32_t pos2 = scrut.snd;
+  uint32_t b1 = scrut.thd;
+  return
+    (
+      (__bool_uint32_t_uint64_t){
+        .fst = ok2,
+        .snd = pos2,
+        .thd = ((uint64_t)b0 << (uint32_t)32U) + (uint64_t)b1
+      }
+    );
+}
+
+static __bool_uint32_t_uint64_t
+(*deserialize_offset_t)(bool x0, const uint8_t *x1, uint32_t x2, uint32_t x3) =
+  deserialize_uint64_t;
+
+static __bool_uint32_t_uint32_t
+(*deserialize_index_t)(bool x0, const uint8_t *x1, uint32_t x2, uint32_t x3) =
+  deserialize_uint32_t;
+
+typedef struct __bool_uint32_t__uint8_t__s
+{
+  bool fst;
+  uint32_t snd;
+  uint8_t *thd;
+}
+__bool_uint32_t__uint8_t_;
+
+static __bool_uint32_t__uint8_t_
+deserialize_hash(uint32_t hash_size, bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+{
+  regional__uint32_t__uint8_t_
+  rg = { .state = hash_size, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t__uint8_t_){ .fst = false, .snd = pos, .thd = rg.dummy });
+  }
+  if (sz - pos < hash_size)
+  {
+    return ((__bool_uint32_t__uint8_t_){ .fst = false, .snd = pos, .thd = rg.dummy });
+  }
+  uint8_t *hash = rg.r_alloc(rg.state);
+  memcpy(hash, (uint8_t *)buf + pos, hash_size * sizeof (uint8_t));
+  return ((__bool_uint32_t__uint8_t_){ .fst = true, .snd = pos + hash_size, .thd = hash });
+}
+
+static __bool_uint32_t
+deserialize_hash_vec_i(
+  uint32_t hash_size,
+  bool ok,
+  const uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos,
+  MerkleTree_Low_Datastructures_hash_vec res,
+  uint32_t i
+)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = pos });
+  }
+  __bool_uint32_t__uint8_t_ scrut = deserialize_hash(hash_size, ok, buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
+  uint8_t *h = scrut.thd;
+  if (!ok1)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = pos1 });
+  }
+  assign___uint8_t_(res, i, h);
+  uint32_t j = i + (uint32_t)1U;
+  if (j < res.sz)
+  {
+    return deserialize_hash_vec_i(hash_size, ok1, buf, sz, pos1, res, j);
+  }
+  return ((__bool_uint32_t){ .fst = true, .snd = pos1 });
+}
+
+static MerkleTree_Low_Datastructures_hash_vec alloc___uint8_t_(uint32_t len, uint8_t *v)
+{
+  return alloc_rid___uint8_t_(len, v);
+}
+
+typedef struct __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec_s
+{
+  bool fst;
+  uint32_t snd;
+  MerkleTree_Low_Datastructures_hash_vec thd;
+}
+__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec;
+
+static __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec
+deserialize_hash_vec(
+  uint32_t hash_size,
+  bool ok,
+  const uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos
+)
+{
+  regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec
+  rg =
+    {
+      .state = hash_size,
+      .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
+      .r_alloc = hash_vec_r_alloc,
+      .r_free = hash_vec_r_free
+    };
+  if (!ok || pos >= sz)
+  {
+    return
+      (
+        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec){
+          .fst = false,
+          .snd = pos,
+          .thd = rg.dummy
+        }
+      );
+  }
+  __bool_uint32_t_uint32_t scrut0 = deserialize_uint32_t(ok, buf, sz, pos);
+  bool ok1 = scrut0.fst;
+  uint32_t pos1 = scrut0.snd;
+  uint32_t n = scrut0.thd;
+  if (!ok1)
+  {
+    return
+      (
+        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec){
+          .fst = false,
+          .snd = pos1,
+          .thd = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }
+        }
+      );
+  }
+  if (n == (uint32_t)0U)
+  {
+    return
+      (
+        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec){
+          .fst = true,
+          .snd = pos1,
+          .thd = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }
+        }
+      );
+  }
+  regional__uint32_t__uint8_t_
+  hrg = { .state = hash_size, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
+  MerkleTree_Low_Datastructures_hash_vec res = alloc___uint8_t_(n, hrg.dummy);
+  __bool_uint32_t
+  scrut = deserialize_hash_vec_i(hash_size, ok1, buf, sz, pos1, res, (uint32_t)0U);
+  bool ok2 = scrut.fst;
+  uint32_t pos2 = scrut.snd;
+  return
+    (
+      (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec){
+        .fst = ok2,
+        .snd = pos2,
+        .thd = res
+      }
+    );
+}
+
+typedef struct __bool_uint32_t_MerkleTree_Low_Datastructures_hash_slab_s
+{
+  bool fst;
+  uint32_t snd;
+  MerkleTree_Low_Datastructures_hash_slab thd;
+}
+__bool_uint32_t_MerkleTree_Low_Datastructures_hash_slab;
+
+static __bool_uint32_t_MerkleTree_Low_Datastructures_hash_slab
+deserialize_hash_slab(
+  uint32_t hash_size,
+  bool ok,
+  const uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos
+)
+{
+  MerkleTree_Low_Datastructures_hash_slab empty = hash_slab_r_alloc(hash_size);
+  if (!ok || pos >= sz)
+  {
+    return
+      (
+        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_slab){
+          .fst = false,
+          .snd = pos,
+          .thd = empty
+        }
+      );
+  }
+  __bool_uint32_t_uint32_t scrut = deserialize_uint32_t(ok, buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
+  uint32_t n = scrut.thd;
+  if (!ok1 || (uint64_t)(sz - pos1) < (uint64_t)n * (uint64_t)hash_size)
+  {
+    return
+      (
+        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_slab){
+          .fst = false,
+          .snd = pos1,
+          .thd = empty
+        }
+      );
+  }
+  if (n == (uint32_t)0U)
+  {
+    return
+      (
+        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_slab){
+          .fst = true,
+          .snd = pos1,
+          .thd = empty
+        }
+      );
+  }
+  uint8_t *vs = hash_slab_buf_alloc(hash_size, n);
+  memcpy(vs, (uint8_t *)buf + pos1, (uint64_t)n * (uint64_t)hash_size * sizeof (uint8_t));
+  return
+    (
+      (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_slab){
+        .fst = true,
+        .snd = pos1 + n * hash_size,
+        .thd = { .sz = n, .cap = n, .vs = vs, .file = NULL, .pub = NULL }
+      }
+    );
+}
+
+static __bool_uint32_t
+deserialize_hash_vv_i(
+  uint32_t hash_size,
+  bool ok,
+  const uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos,
+  MerkleTree_Low_Datastructures_hash_vv res,
+  uint32_t i
+)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+  }
+  __bool_uint32_t_MerkleTree_Low_Datastructures_hash_slab
+  scrut = deserialize_hash_slab(hash_size, ok, buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
+  MerkleTree_Low_Datastructures_hash_slab hv = scrut.thd;
+  if (!ok1)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = pos1 });
+  }
+  assign__LowStar_Vector_vector_str__uint8_t_(res, i, hv);
+  uint32_t j = i + (uint32_t)1U;
+  if (j == res.sz)
+  {
+    return ((__bool_uint32_t){ .fst = true, .snd = pos1 });
+  }
+  return deserialize_hash_vv_i(hash_size, ok1, buf, sz, pos1, res, j);
+}
+
+static MerkleTree_Low_Datastructures_hash_vv
+alloc__LowStar_Vector_vector_str__uint8_t_(
+  uint32_t len,
+  MerkleTree_Low_Datastructures_hash_slab v
+)
+{
+  return alloc_rid__LowStar_Vector_vector_str__uint8_t_(len, v);
+}
+
+typedef struct __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv_s
+{
+  bool fst;
+  uint32_t snd;
+  MerkleTree_Low_Datastructures_hash_vv thd;
+}
+__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv;
+
+static __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv
+deserialize_hash_vv(uint32_t hash_size, bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+{
+  if (!ok || pos >= sz)
+  {
+    return
+      (
+        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv){
+          .fst = false,
+          .snd = pos,
+          .thd = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }
+        }
+      );
+  }
+  __bool_uint32_t_uint32_t scrut0 = deserialize_uint32_t(ok, buf, sz, pos);
+  bool ok1 = scrut0.fst;
+  uint32_t pos1 = scrut0.snd;
+  uint32_t n = scrut0.thd;
+  if (!ok1)
+  {
+    return
+      (
+        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv){
+          .fst = false,
+          .snd = pos1,
+          .thd = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }
+        }
+      );
+  }
+  if (n == (uint32_t)0U)
+  {
+    return
+      (
+        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv){
+          .fst = true,
+          .snd = pos1,
+          .thd = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }
+        }
+      );
+  }
+  regional__uint32_t_MerkleTree_Low_Datastructures_hash_slab
+  rg =
+    {
+      .state = hash_size,
+      .dummy = {
+        .sz = (uint32_t)0U,
+        .cap = (uint32_t)0U,
+        .vs = NULL,
+        .file = NULL,
+        .pub = NULL
+      },
+      .r_alloc = hash_slab_r_alloc,
+      .r_free = hash_slab_r_free
+    };
+  MerkleTree_Low_Datastructures_hash_vv
+  res = alloc__LowStar_Vector_vector_str__uint8_t_(n, rg.dummy);
+  __bool_uint32_t
+  scrut = deserialize_hash_vv_i(hash_size, ok1, buf, sz, pos1, res, (uint32_t)0U);
+  bool ok2 = scrut.fst;
+  uint32_t pos2 = scrut.snd;
+  return
+    (
+      (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv){ .fst = ok2, .snd = pos2, .thd = res }
+    );
+}
+
+uint64_t MerkleTree_Low_Serialization_mt_serialize_size(const MerkleTree_Low_merkle_tree *mt)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
+  MerkleTree_Low_Datastructures_hash_vec rhs = mtv.rhs;
+  uint64_t hs_sz = hash_vv_bytes_i(mtv.hash_size, hs, (uint32_t)0U);
+  if (hs_sz < (uint64_t)4294967295U)
+  {
+    uint64_t vs_hs = (uint64_t)rhs.sz * (uint64_t)mtv.hash_size;
+    uint64_t ite;
+    if (MerkleTree_Low_uint64_max - vs_hs >= (uint64_t)4U)
+    {
+      ite = vs_hs + (uint64_t)4U;
+    }
+    else
+    {
+      ite = MerkleTree_Low_uint64_max;
+    }
+    return (uint64_t)21U + hs_sz + (uint64_t)1U + ite + (uint64_t)mtv.hash_size;
+  }
+  return MerkleTree_Low_uint64_max;
+}
+
+uint64_t
+MerkleTree_Low_Serialization_mt_serialize(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint8_t *output,
+  uint64_t sz
+)
+{
+  MerkleTree_Low_merkle_tree *mt1 = (MerkleTree_Low_merkle_tree *)mt;
+  uint32_t sz1 = (uint32_t)sz;
+  MerkleTree_Low_merkle_tree mtv = *mt1;
+  __bool_uint32_t scrut = serialize_uint8_t(true, (uint8_t)1U, output, sz1, (uint32_t)0U);
+  bool ok = scrut.fst;
+  uint32_t pos = scrut.snd;
+  __bool_uint32_t scrut0 = serialize_uint32_t(ok, mtv.hash_size, output, sz1, pos);
+  bool ok1 = scrut0.fst;
+  uint32_t pos1 = scrut0.snd;
+  __bool_uint32_t scrut1 = serialize_offset_t(ok1, mtv.offset, output, sz1, pos1);
+  bool ok2 = scrut1.fst;
+  uint32_t pos2 = scrut1.snd;
+  __bool_uint32_t scrut2 = serialize_uint32_t(ok2, mtv.i, output, sz1, pos2);
+  bool ok3 = scrut2.fst;
+  uint32_t pos3 = scrut2.snd;
+  __bool_uint32_t scrut3 = serialize_uint32_t(ok3, mtv.j, output, sz1, pos3);
+  bool ok4 = scrut3.fst;
+  uint32_t pos4 = scrut3.snd;
+  __bool_uint32_t scrut4 = serialize_hash_vv(mtv.hash_size, ok4, mtv.hs, output, sz1, pos4);
+  bool ok5 = scrut4.fst;
+  uint32_t pos5 = scrut4.snd;
+  __bool_uint32_t scrut5 = serialize_bool(ok5, mtv.rhs_ok, output, sz1, pos5);
+  bool ok6 = scrut5.fst;
+  uint32_t pos6 = scrut5.snd;
+  __bool_uint32_t scrut6 = serialize_hash_vec(mtv.hash_size, ok6, mtv.rhs, output, sz1, pos6);
+  bool ok7 = scrut6.fst;
+  uint32_t pos7 = scrut6.snd;
+  __bool_uint32_t scrut7 = serialize_hash(mtv.hash_size, ok7, mtv.mroot, output, sz1, pos7);
+  bool ok8 = scrut7.fst;
+  uint32_t pos8 = scrut7.snd;
+  if (ok8)
+  {
+    return (uint64_t)pos8;
+  }
+  return (uint64_t)0U;
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_Serialization_mt_deserialize(
+  const uint8_t *input,
+  uint64_t sz,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  uint32_t sz1 = (uint32_t)sz;
+  __bool_uint32_t_uint8_t scrut0 = deserialize_uint8_t(true, input, sz1, (uint32_t)0U);
+  bool ok = scrut0.fst;
+  uint32_t pos = scrut0.snd;
+  uint8_t format_version = scrut0.thd;
+  bool ok1 = ok && format_version == (uint8_t)1U;
+  __bool_uint32_t_uint32_t scrut1 = deserialize_uint32_t(ok1, input, sz1, pos);
+  bool ok2 = scrut1.fst;
+  uint32_t pos1 = scrut1.snd;
+  uint32_t hsz = scrut1.thd;
+  if (hsz == (uint32_t)0U)
+  {
+    return NULL;
+  }
+  __bool_uint32_t_uint64_t scrut2 = deserialize_offset_t(ok2, input, sz1, pos1);
+  bool ok3 = scrut2.fst;
+  uint32_t pos2 = scrut2.snd;
+  uint64_t offset = scrut2.thd;
+  __bool_uint32_t_uint32_t scrut3 = deserialize_index_t(ok3, input, sz1, pos2);
+  bool ok4 = scrut3.fst;
+  uint32_t pos3 = scrut3.snd;
+  uint32_t i = scrut3.thd;
+  __bool_uint32_t_uint32_t scrut4 = deserialize_index_t(ok4, input, sz1, pos3);
+  bool ok5 = scrut4.fst;
+  uint32_t pos4 = scrut4.snd;
+  uint32_t j = scrut4.thd;
+  __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv
+  scrut5 = deserialize_hash_vv(hsz, ok5, input, sz1, pos4);
+  bool ok6 = scrut5.fst;
+  uint32_t pos5 = scrut5.snd;
+  MerkleTree_Low_Datastructures_hash_vv hs = scrut5.thd;
+  __bool_uint32_t_bool scrut6 = deserialize_bool(ok6, input, sz1, pos5);
+  bool ok7 = scrut6.fst;
+  uint32_t pos6 = scrut6.snd;
+  bool rhs_ok = scrut6.thd;
+  __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec
+  scrut7 = deserialize_hash_vec(hsz, ok7, input, sz1, pos6);
+  bool ok8 = scrut7.fst;
+  uint32_t pos7 = scrut7.snd;
+  MerkleTree_Low_Datastructures_hash_vec rhs = scrut7.thd;
+  __bool_uint32_t__uint8_t_ scrut = deserialize_hash(hsz, ok8, input, sz1, pos7);
+  bool ok9 = scrut.fst;
+  uint8_t *mroot = scrut.thd;
+  if
+  (
+    !ok9
+    ||
+      !(j
+      >= i
+      && MerkleTree_Low_uint64_max - offset >= (uint64_t)j
+      && hs.sz == (uint32_t)32U
+      && rhs.sz == (uint32_t)32U)
+  )
+  {
+    return NULL;
+  }
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_merkle_tree), (uint32_t)1U);
+  MerkleTree_Low_merkle_tree *buf = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_merkle_tree));
+  buf[0U]
+  =
+    (
+      (MerkleTree_Low_merkle_tree){
+        .hash_size = hsz,
+        .offset = offset,
+        .i = i,
+        .j = j,
+        .hs = hs,
+        .rhs_ok = rhs_ok,
+        .rhs = rhs,
+        .mroot = mroot,
+        .hash_fun = hash_fun,
+        .store = NULL
+      }
+    );
+  return buf;
+}
+
+uint64_t
+MerkleTree_Low_Serialization_mt_serialize_path(
+  const MerkleTree_Low_path *p,
+  uint8_t *output,
+  uint64_t sz
+)
+{
+  MerkleTree_Low_path x0 = *(MerkleTree_Low_path *)p;
+  uint32_t hsz1 = x0.hash_size;
+  uint32_t sz1 = (uint32_t)sz;
+  MerkleTree_Low_path *ncp = (MerkleTree_Low_path *)p;
+  __bool_uint32_t scrut = serialize_uint32_t(true, hsz1, output, sz1, (uint32_t)0U);
+  bool ok = scrut.fst;
+  uint32_t pos = scrut.snd;
+  MerkleTree_Low_path ncpd = *ncp;
+  __bool_uint32_t scrut0 = serialize_hash_vec(hsz1, ok, ncpd.hashes, output, sz1, pos);
+  bool ok1 = scrut0.fst;
+  uint32_t pos1 = scrut0.snd;
+  if (ok1)
+  {
+    return (uint64_t)pos1;
+  }
+  return (uint64_t)0U;
+}
+
+MerkleTree_Low_path
+*MerkleTree_Low_Serialization_mt_deserialize_path(const uint8_t *input, uint64_t sz)
+{
+  uint32_t sz1 = (uint32_t)sz;
+  __bool_uint32_t_uint32_t scrut0 = deserialize_uint32_t(true, input, sz1, (uint32_t)0U);
+  bool ok = scrut0.fst;
+  uint32_t pos = scrut0.snd;
+  uint32_t hash_size = scrut0.thd;
+  if (!ok || hash_size == (uint32_t)0U)
+  {
+    return NULL;
+  }
+  __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec
+  scrut = deserialize_hash_vec(hash_size, ok, input, sz1, pos);
+  bool ok1 = scrut.fst;
+  MerkleTree_Low_Datastructures_hash_vec hs = scrut.thd;
+  if (!ok1)
+  {
+    return NULL;
+  }
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_path), (uint32_t)1U);
+  MerkleTree_Low_path *buf = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_path));
+  buf[0U] = ((MerkleTree_Low_path){ .hash_size = hash_size, .hashes = hs, .buf = NULL });
+  return buf;
+}
+
+uint64_t
+MerkleTree_Low_Serialization_mt_serialize_proof(
+  const MerkleTree_Low_proof *p,
+  uint8_t *output,
+  uint64_t sz
+)
+{
+  uint32_t hsz = p->hash_size;
+  uint32_t sz1 = (uint32_t)sz;
+  __bool_uint32_t scrut = serialize_uint32_t(true, hsz, output, sz1, (uint32_t)0U);
+  __bool_uint32_t scrut0 = serialize_uint32_t(scrut.fst, p->sz, output, sz1, scrut.snd);
+  bool ok = scrut0.fst;
+  uint32_t pos = scrut0.snd;
+  for (uint32_t k = (uint32_t)0U; k < p->sz; k++)
+  {
+    __bool_uint32_t
+    scrut1 =
+      serialize_hash(hsz, ok, MerkleTree_Low_mt_get_proof_step(p, k), output, sz1, pos);
+    ok = scrut1.fst;
+    pos = scrut1.snd;
+  }
+  if (ok)
+  {
+    return (uint64_t)pos;
+  }
+  return (uint64_t)0U;
+}
+
+MerkleTree_Low_proof
+*MerkleTree_Low_Serialization_mt_deserialize_proof(const uint8_t *input, uint64_t sz)
+{
+  uint32_t sz1 = (uint32_t)sz;
+  __bool_uint32_t_uint32_t scrut0 = deserialize_uint32_t(true, input, sz1, (uint32_t)0U);
+  uint32_t hash_size = scrut0.thd;
+  __bool_uint32_t_uint32_t scrut = deserialize_uint32_t(scrut0.fst, input, sz1, scrut0.snd);
+  bool ok = scrut.fst;
+  uint32_t pos = scrut.snd;
+  uint32_t n = scrut.thd;
+  if
+  (
+    !ok
+    || hash_size == (uint32_t)0U
+    || (uint64_t)n * (uint64_t)hash_size > (uint64_t)(sz1 - pos)
+  )
+  {
+    return NULL;
+  }
+  MerkleTree_Low_proof *p = MerkleTree_Low_init_proof(hash_size);
+  if (n > (uint32_t)0U)
+  {
+    KRML_CHECK_SIZE(sizeof (uint8_t), (uint64_t)n * (uint64_t)hash_size);
+    p->hs = KRML_HOST_MALLOC((uint64_t)n * (uint64_t)hash_size);
+    memcpy(p->hs, (uint8_t *)input + pos, (uint64_t)n * (uint64_t)hash_size * sizeof (uint8_t));
+    p->sz = n;
+    p->cap = n;
+  }
+  return p;
+}
+
+/* A persistent tree is a directory holding one file per level, "level00" to
+   "level31", and a "meta" file: the magic "MTMM", then (big-endian) a 32-bit
+   format version, the hash size, the 64-bit offset, i, j, and for each level
+   the 64-bit number of flushed hashes at the start of its file. The sizes of
+   the levels follow from i and j, so the hashes themselves are never read
+   when opening a tree. The meta file is replaced atomically by
+   MerkleTree_Low_Persistent_mt_sync once all levels have been written back. */
+
+#define MERKLE_TREE_META_VERSION ((uint32_t)1U)
+
+#define MERKLE_TREE_META_SIZE ((uint32_t)28U + (uint32_t)32U * (uint32_t)8U)
+
+#if MERKLE_TREE_MAPPED
+static MerkleTree_Low_Datastructures_hash_file
+*hash_file_open(int dir_fd, uint32_t lv, int flags)
+{
+  char name[16U];
+  snprintf(name, sizeof (name), "level%02u", lv);
+  int fd = openat(dir_fd, name, flags, 0644);
+  if (fd < 0)
+  {
+    return NULL;
+  }
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Datastructures_hash_file), (uint32_t)1U);
+  MerkleTree_Low_Datastructures_hash_file
+  *f = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_Datastructures_hash_file));
+  f->fd = fd;
+  f->map = NULL;
+  f->len = (uint64_t)0U;
+  f->front = (uint64_t)0U;
+  f->punched = (uint64_t)0U;
+  return f;
+}
+
+static bool persistent_write_meta(int dir_fd, MerkleTree_Low_merkle_tree mtv)
+{
+  uint8_t meta[MERKLE_TREE_META_SIZE];
+  memcpy(meta, "MTMM", (uint32_t)4U * sizeof (uint8_t));
+  store32_be(meta + (uint32_t)4U, MERKLE_TREE_META_VERSION);
+  store32_be(meta + (uint32_t)8U, mtv.hash_size);
+  store64_be(meta + (uint32_t)12U, mtv.offset);
+  store32_be(meta + (uint32_t)20U, mtv.i);
+  store32_be(meta + (uint32_t)24U, mtv.j);
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    store64_be(meta + (uint32_t)28U + lv * (uint32_t)8U, mtv.hs.vs[lv].file->front);
+  }
+  int fd = openat(dir_fd, "meta.tmp", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    return false;
+  }
+  bool ok = write(fd, meta, sizeof (meta)) == (ssize_t)sizeof (meta) && fsync(fd) == 0;
+  ok = close(fd) == 0 && ok;
+  return ok && renameat(dir_fd, "meta.tmp", dir_fd, "meta") == 0 && fsync(dir_fd) == 0;
+}
+
+/* Returns the whole pages of flushed hashes at the start of a level file to
+   the file system. This is best effort: where holes cannot be punched, the
+   space is only reclaimed when the tree is deleted. */
+static void hash_file_punch(uint32_t hsz, uint64_t page, MerkleTree_Low_Datastructures_hash_file *f)
+{
+  uint64_t target = f->front * (uint64_t)hsz / page * page;
+  if (target <= f->punched)
+  {
+    return;
+  }
+  #if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+  fallocate(f->fd,
+    FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+    (off_t)f->punched,
+    (off_t)(target - f->punched));
+  #endif
+  f->punched = target;
+}
+#endif
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_Persistent_mt_create(
+  const char *dir,
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  #if MERKLE_TREE_MAPPED
+  if (hsz == (uint32_t)0U)
+  {
+    return NULL;
+  }
+  int dir_fd = open(dir, O_RDONLY | O_DIRECTORY);
+  if (dir_fd < 0)
+  {
+    return NULL;
+  }
+  if (faccessat(dir_fd, "meta", F_OK, 0) == 0)
+  {
+    close(dir_fd);
+    return NULL;
+  }
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    MerkleTree_Low_Datastructures_hash_file
+    *f = hash_file_open(dir_fd, lv, O_RDWR | O_CREAT | O_TRUNC);
+    if (f == NULL)
+    {
+      MerkleTree_Low_mt_free(mt);
+      close(dir_fd);
+      return NULL;
+    }
+    mt->hs.vs[lv].file = f;
+  }
+  MerkleTree_Low_mt_insert(mt, init);
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Persistent_store), (uint32_t)1U);
+  MerkleTree_Low_Persistent_store
+  *store = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_Persistent_store));
+  store->dir_fd = dir_fd;
+  mt->store = store;
+  if (!MerkleTree_Low_Persistent_mt_sync(mt))
+  {
+    mt->store = NULL;
+    KRML_HOST_FREE(store);
+    MerkleTree_Low_mt_free(mt);
+    close(dir_fd);
+    return NULL;
+  }
+  return mt;
+  #else
+  return NULL;
+  #endif
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_Persistent_mt_open(
+  const char *dir,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  #if MERKLE_TREE_MAPPED
+  int dir_fd = open(dir, O_RDONLY | O_DIRECTORY);
+  if (dir_fd < 0)
+  {
+    return NULL;
+  }
+  uint8_t meta[MERKLE_TREE_META_SIZE];
+  int fd = openat(dir_fd, "meta", O_RDONLY);
+  bool ok = fd >= 0 && read(fd, meta, sizeof (meta)) == (ssize_t)sizeof (meta);
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+  if
+  (
+    !ok
+    ||
+      !(memcmp(meta, "MTMM", (uint32_t)4U * sizeof (uint8_t)) == 0
+      && load32_be(meta + (uint32_t)4U) == MERKLE_TREE_META_VERSION)
+  )
+  {
+    close(dir_fd);
+    return NULL;
+  }
+  uint32_t hsz = load32_be(meta + (uint32_t)8U);
+  uint64_t offset = load64_be(meta + (uint32_t)12U);
+  uint32_t i = load32_be(meta + (uint32_t)20U);
+  uint32_t j = load32_be(meta + (uint32_t)24U);
+  if (!(hsz > (uint32_t)0U && j >= i && MerkleTree_Low_uint64_max - offset >= (uint64_t)j))
+  {
+    close(dir_fd);
+    return NULL;
+  }
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
+  mt->offset = offset;
+  mt->i = i;
+  mt->j = j;
+  uint64_t page = (uint64_t)sysconf(_SC_PAGESIZE);
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    MerkleTree_Low_Datastructures_hash_file *f = hash_file_open(dir_fd, lv, O_RDWR);
+    if (f == NULL)
+    {
+      ok = false;
+      break;
+    }
+    mt->hs.vs[lv].file = f;
+    uint32_t sz = (j >> lv) - MerkleTree_Low_offset_of(i >> lv);
+    uint64_t front = load64_be(meta + (uint32_t)28U + lv * (uint32_t)8U);
+    struct stat st;
+    if (fstat(f->fd, &st) != 0)
+    {
+      ok = false;
+      break;
+    }
+    uint64_t nhashes = (uint64_t)st.st_size / (uint64_t)hsz;
+    if
+    (
+      front
+      > nhashes
+      || nhashes - front < (uint64_t)sz
+      || nhashes - front > (uint64_t)0xffffffffU
+    )
+    {
+      ok = false;
+      break;
+    }
+    f->front = front;
+    f->punched = front * (uint64_t)hsz / page * page;
+    if (st.st_size > (off_t)0)
+    {
+      void *map = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, f->fd, 0);
+      if (map == MAP_FAILED)
+      {
+        ok = false;
+        break;
+      }
+      f->map = (uint8_t *)map;
+      f->len = (uint64_t)st.st_size;
+      mt->hs.vs[lv].sz = sz;
+      mt->hs.vs[lv].cap = (uint32_t)(nhashes - front);
+      mt->hs.vs[lv].vs = f->map + front * (uint64_t)hsz;
+    }
+  }
+  if (!ok)
+  {
+    MerkleTree_Low_mt_free(mt);
+    close(dir_fd);
+    return NULL;
+  }
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Persistent_store), (uint32_t)1U);
+  MerkleTree_Low_Persistent_store
+  *store = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_Persistent_store));
+  store->dir_fd = dir_fd;
+  mt->store = store;
+  return mt;
+  #else
+  return NULL;
+  #endif
+}
+
+bool MerkleTree_Low_Persistent_mt_sync(const MerkleTree_Low_merkle_tree *mt)
+{
+  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
+  if (mtv.store == NULL)
+  {
+    return true;
+  }
+  #if MERKLE_TREE_MAPPED
+  uint64_t hsz = (uint64_t)mtv.hash_size;
+  uint64_t page = (uint64_t)sysconf(_SC_PAGESIZE);
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    MerkleTree_Low_Datastructures_hash_slab v = mtv.hs.vs[lv];
+    if (v.sz > (uint32_t)0U)
+    {
+      uint64_t start = v.file->front * hsz / page * page;
+      uint64_t end = (v.file->front + (uint64_t)v.sz) * hsz;
+      if (msync(v.file->map + start, (size_t)(end - start), MS_SYNC) != 0)
+      {
+        return false;
+      }
+    }
+  }
+  if (!persistent_write_meta(mtv.store->dir_fd, mtv))
+  {
+    return false;
+  }
+  for (uint32_t lv = (uint32_t)0U; lv < (uint32_t)32U; lv++)
+  {
+    hash_file_punch(mtv.hash_size, page, mtv.hs.vs[lv].file);
+  }
+  #endif
+  return true;
+}
+
+static MerkleTree_Low_Snapshot_snapshot *snapshot_create(MerkleTree_Low_merkle_tree *mt)
+{
+  uint32_t hsz = mt->hash_size;
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Snapshot_snapshot), (uint32_t)1U);
+  MerkleTree_Low_Snapshot_snapshot
+  *snap = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_Snapshot_snapshot));
+  snap->mroot = MerkleTree_Low_Hashfunctions_init_hash(hsz);
+  MerkleTree_Low_mt_get_root(mt, snap->mroot);
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  snap->hash_size = hsz;
+  snap->offset = mtv.offset;
+  snap->i = mtv.i;
+  snap->j = mtv.j;
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Datastructures_hash_slab), mtv.hs.sz);
+  MerkleTree_Low_Datastructures_hash_slab
+  *levels = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_Datastructures_hash_slab) * mtv.hs.sz);
+  memcpy(levels, mtv.hs.vs, sizeof (MerkleTree_Low_Datastructures_hash_slab) * mtv.hs.sz);
+  snap->hs =
+    ((MerkleTree_Low_Datastructures_hash_vv){ .sz = mtv.hs.sz, .cap = mtv.hs.sz, .vs = levels });
+  KRML_CHECK_SIZE(sizeof (uint8_t *), mtv.rhs.sz);
+  uint8_t **rhs = KRML_HOST_MALLOC(sizeof (uint8_t *) * mtv.rhs.sz);
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint64_t)mtv.rhs.sz * (uint64_t)hsz);
+  uint8_t *buf = KRML_HOST_MALLOC((uint64_t)mtv.rhs.sz * (uint64_t)hsz);
+  for (uint32_t lv = (uint32_t)0U; lv < mtv.rhs.sz; lv++)
+  {
+    rhs[lv] = buf + (uint64_t)lv * (uint64_t)hsz;
+    hash_copy(hsz, mtv.rhs.vs[lv], rhs[lv]);
+  }
+  snap->rhs =
+    ((MerkleTree_Low_Datastructures_hash_vec){ .sz = mtv.rhs.sz, .cap = mtv.rhs.sz, .vs = rhs });
+  snap->refs = (uint32_t)0U;
+  snap->epoch = (uint32_t)0U;
+  snap->retired = NULL;
+  snap->next = NULL;
+  return snap;
+}
+
+MerkleTree_Low_Snapshot_publisher
+*MerkleTree_Low_Snapshot_mt_publish(MerkleTree_Low_merkle_tree *mt)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  if (mtv.store != NULL)
+  {
+    return NULL;
+  }
+  MerkleTree_Low_Snapshot_publisher *pub = mtv.hs.vs[0U].pub;
+  MerkleTree_Low_Snapshot_snapshot *snap = snapshot_create(mt);
+  if (pub == NULL)
+  {
+    KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Snapshot_publisher), (uint32_t)1U);
+    pub = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_Snapshot_publisher));
+    pub->hash_size = mtv.hash_size;
+    pub->epoch = (uint32_t)0U;
+    pub->acquiring[0U] = (uint32_t)0U;
+    pub->acquiring[1U] = (uint32_t)0U;
+    pub->oldest = snap;
+    pub->newest = snap;
+    MERKLE_TREE_ATOMIC_STORE_PTR(&pub->current, snap);
+    for (uint32_t lv = (uint32_t)0U; lv < mtv.hs.sz; lv++)
+    {
+      mtv.hs.vs[lv].pub = pub;
+    }
+    return pub;
+  }
+  MerkleTree_Low_Snapshot_snapshot *prev = pub->newest;
+  prev->next = snap;
+  pub->newest = snap;
+  MERKLE_TREE_ATOMIC_STORE_PTR(&pub->current, snap);
+  prev->epoch = pub->epoch;
+  snapshot_reclaim(pub);
+  return pub;
+}
+
+const MerkleTree_Low_Snapshot_snapshot
+*MerkleTree_Low_Snapshot_acquire(MerkleTree_Low_Snapshot_publisher *pub)
+{
+  uint32_t *acquiring = &pub->acquiring[MERKLE_TREE_ATOMIC_LOAD(&pub->epoch) % (uint32_t)2U];
+  MERKLE_TREE_ATOMIC_ADD(acquiring, (uint32_t)1U);
+  MerkleTree_Low_Snapshot_snapshot
+  *snap = (MerkleTree_Low_Snapshot_snapshot *)MERKLE_TREE_ATOMIC_LOAD_PTR(&pub->current);
+  MERKLE_TREE_ATOMIC_ADD(&snap->refs, (uint32_t)1U);
+  MERKLE_TREE_ATOMIC_ADD(acquiring, (uint32_t)0xffffffffU);
+  return snap;
+}
+
+void MerkleTree_Low_Snapshot_release(const MerkleTree_Low_Snapshot_snapshot *snap)
+{
+  MerkleTree_Low_Snapshot_snapshot *snap1 = (MerkleTree_Low_Snapshot_snapshot *)snap;
+  MERKLE_TREE_ATOMIC_ADD(&snap1->refs, (uint32_t)0xffffffffU);
+}
+
+uint32_t MerkleTree_Low_Snapshot_pending(const MerkleTree_Low_Snapshot_publisher *pub)
+{
+  uint32_t n = (uint32_t)0U;
+  for (MerkleTree_Low_Snapshot_snapshot *snap = pub->oldest; snap != NULL; snap = snap->next)
+  {
+    n++;
+  }
+  return n;
+}
+
+uint64_t MerkleTree_Low_Snapshot_size(const MerkleTree_Low_Snapshot_snapshot *snap)
+{
+  return snap->offset + (uint64_t)snap->j;
+}
+
+void
+MerkleTree_Low_Snapshot_get_root(const MerkleTree_Low_Snapshot_snapshot *snap, uint8_t *root)
+{
+  hash_copy(snap->hash_size, snap->mroot, root);
+}
+
+bool
+MerkleTree_Low_Snapshot_mt_get_path_at_pre(
+  const MerkleTree_Low_Snapshot_snapshot *snap,
+  uint64_t idx,
+  const MerkleTree_Low_path *p,
+  uint8_t *root
+)
+{
+  MerkleTree_Low_path *p1 = (MerkleTree_Low_path *)p;
+  MerkleTree_Low_path uu____0 = *p1;
+  return
+    idx
+    >= snap->offset
+    && idx - snap->offset <= MerkleTree_Low_offset_range_limit
+    && uu____0.hash_size == snap->hash_size
+    &&
+      snap->i
+      <= (uint32_t)(idx - snap->offset)
+      && (uint32_t)(idx - snap->offset) < snap->j
+      && uu____0.hashes.sz == (uint32_t)0U;
+}
+
+uint32_t
+MerkleTree_Low_Snapshot_mt_get_path_at(
+  const MerkleTree_Low_Snapshot_snapshot *snap,
+  uint64_t idx,
+  MerkleTree_Low_path *p,
+  uint8_t *root
+)
+{
+  uint32_t hsz = snap->hash_size;
+  uint32_t idx1 = (uint32_t)(idx - snap->offset);
+  uint32_t ofs = MerkleTree_Low_offset_of(snap->i);
+  hash_copy(hsz, snap->mroot, root);
+  uint8_t
+  *ih =
+    hash_slab_index(hsz, index__LowStar_Vector_vector_str__uint8_t_(snap->hs, (uint32_t)0U),
+      idx1 - ofs);
+  MerkleTree_Low_path pth = *p;
+  *p = ((MerkleTree_Low_path){ .hash_size = hsz, .hashes = pth.hashes, .buf = pth.buf });
+  path_insert(p, ih);
+  mt_get_path_(hsz, (uint32_t)0U, snap->hs, snap->rhs, snap->i, snap->j, idx1, p, false);
+  return snap->j;
+}
+
+/* Trees with 64-bit indices. The algorithms are those of MerkleTree_Low, with
+   i and j widened to 64 bits and counted from the first leaf of the tree, and
+   one level per index bit. Levels are heap slabs with 64-bit sizes. */
+
+uint32_t MerkleTree_Low64_merkle_tree_size_lg = (uint32_t)64U;
+
+uint64_t MerkleTree_Low64_offset_of(uint64_t i)
+{
+  if (i % (uint64_t)2U == (uint64_t)0U)
+  {
+    return i;
+  }
+  return i - (uint64_t)1U;
+}
+
+static uint8_t
+*hash_slab64_index(uint32_t hsz, MerkleTree_Low64_Datastructures_hash_slab vec, uint64_t i)
+{
+  return vec.vs + i * (uint64_t)hsz;
+}
+
+static MerkleTree_Low64_Datastructures_hash_slab
+hash_slab64_resize(uint32_t hsz, MerkleTree_Low64_Datastructures_hash_slab vec, uint64_t ncap)
+{
+  uint8_t *nvs = hash_slab_buf_alloc(hsz, ncap);
+  if (vec.sz > (uint64_t)0U)
+  {
+    memcpy(nvs, vec.vs, vec.sz * (uint64_t)hsz * sizeof (uint8_t));
+  }
+  hash_slab_buf_free(hsz, vec.cap, vec.vs);
+  return ((MerkleTree_Low64_Datastructures_hash_slab){ .sz = vec.sz, .cap = ncap, .vs = nvs });
+}
+
+static MerkleTree_Low64_Datastructures_hash_slab
+hash_slab64_fit(uint32_t hsz, MerkleTree_Low64_Datastructures_hash_slab vec)
+{
+  if (vec.sz >= vec.cap / (uint64_t)4U)
+  {
+    return vec;
+  }
+  uint64_t ncap = vec.cap;
+  while (vec.sz < ncap / (uint64_t)4U)
+  {
+    ncap = ncap / (uint64_t)2U;
+  }
+  return hash_slab64_resize(hsz, vec, ncap);
+}
+
+static MerkleTree_Low64_Datastructures_hash_slab
+hash_slab64_insert_copy(
+  uint32_t hsz,
+  MerkleTree_Low64_Datastructures_hash_slab vec,
+  uint8_t *v
+)
+{
+  MerkleTree_Low64_Datastructures_hash_slab rv = vec;
+  if (vec.sz == vec.cap)
+  {
+    uint64_t ncap;
+    if (vec.cap == (uint64_t)0U)
+    {
+      ncap = (uint64_t)1U;
+    }
+    else
+    {
+      ncap = (uint64_t)2U * vec.cap;
+    }
+    rv = hash_slab64_resize(hsz, vec, ncap);
+  }
+  hash_copy(hsz, v, hash_slab64_index(hsz, rv, rv.sz));
+  return
+    (
+      (MerkleTree_Low64_Datastructures_hash_slab){
+        .sz = rv.sz + (uint64_t)1U,
+        .cap = rv.cap,
+        .vs = rv.vs
+      }
+    );
+}
+
+/* Drops the first ofs hashes of vec. */
+static MerkleTree_Low64_Datastructures_hash_slab
+hash_slab64_flush(uint32_t hsz, MerkleTree_Low64_Datastructures_hash_slab vec, uint64_t ofs)
+{
+  uint64_t n_shifted = (uint64_t)0U;
+  if (ofs < vec.sz)
+  {
+    n_shifted = vec.sz - ofs;
+    memmove(vec.vs,
+      hash_slab64_index(hsz, vec, ofs),
+      n_shifted * (uint64_t)hsz * sizeof (uint8_t));
+  }
+  return
+    hash_slab64_fit(hsz,
+      (
+        (MerkleTree_Low64_Datastructures_hash_slab){
+          .sz = n_shifted,
+          .cap = vec.cap,
+          .vs = vec.vs
+        }
+      ));
+}
+
+/* Keeps the first new_size hashes of vec. */
+static MerkleTree_Low64_Datastructures_hash_slab
+hash_slab64_shrink(
+  uint32_t hsz,
+  MerkleTree_Low64_Datastructures_hash_slab vec,
+  uint64_t new_size
+)
+{
+  if (new_size >= vec.sz)
+  {
+    return vec;
+  }
+  return
+    hash_slab64_fit(hsz,
+      (
+        (MerkleTree_Low64_Datastructures_hash_slab){
+          .sz = new_size,
+          .cap = vec.cap,
+          .vs = vec.vs
+        }
+      ));
+}
+
+static MerkleTree_Low64_merkle_tree
+*create_empty_mt64(uint32_t hsz, void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2))
+{
+  uint32_t lg = MerkleTree_Low64_merkle_tree_size_lg;
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low64_Datastructures_hash_slab), lg);
+  MerkleTree_Low64_Datastructures_hash_slab
+  *levels = KRML_HOST_CALLOC(lg, sizeof (MerkleTree_Low64_Datastructures_hash_slab));
+  MerkleTree_Low_Datastructures_hash_vec
+  rhs =
+    alloc_rid___uint8_t__uint32_t((
+        (regional__uint32_t__uint8_t_){
+          .state = hsz,
+          .dummy = NULL,
+          .r_alloc = hash_r_alloc,
+          .r_free = hash_r_free
+        }
+      ),
+      lg);
+  uint8_t *mroot = hash_r_alloc(hsz);
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low64_merkle_tree), (uint32_t)1U);
+  MerkleTree_Low64_merkle_tree *mt = KRML_HOST_MALLOC(sizeof (MerkleTree_Low64_merkle_tree));
+  mt[0U]
+  =
+    (
+      (MerkleTree_Low64_merkle_tree){
+        .hash_size = hsz,
+        .i = (uint64_t)0U,
+        .j = (uint64_t)0U,
+        .hs = { .sz = lg, .cap = lg, .vs = levels },
+        .rhs_ok = false,
+        .rhs = rhs,
+        .mroot = mroot,
+        .hash_fun = hash_fun
+      }
+    );
+  return mt;
+}
+
+void MerkleTree_Low64_mt_free(MerkleTree_Low64_merkle_tree *mt)
+{
+  MerkleTree_Low64_merkle_tree mtv = *mt;
+  for (uint32_t lv = (uint32_t)0U; lv < mtv.hs.sz; lv++)
+  {
+    hash_slab_buf_free(mtv.hash_size, mtv.hs.vs[lv].cap, mtv.hs.vs[lv].vs);
+  }
+  KRML_HOST_FREE(mtv.hs.vs);
+  free___uint8_t__uint32_t((
+      (regional__uint32_t__uint8_t_){
+        .state = mtv.hash_size,
+        .dummy = NULL,
+        .r_alloc = hash_r_alloc,
+        .r_free = hash_r_free
+      }
+    ),
+    mtv.rhs);
+  hash_r_free(mtv.hash_size, mtv.mroot);
+  KRML_HOST_FREE(mt);
+}
+
+static void
+insert64_(
+  uint32_t hsz,
+  uint32_t lv,
+  uint64_t j,
+  MerkleTree_Low64_Datastructures_hash_vv hs,
+  uint8_t *acc,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low64_Datastructures_hash_slab ihv = hash_slab64_insert_copy(hsz, hs.vs[lv], acc);
+  hs.vs[lv] = ihv;
+  if (j % (uint64_t)2U == (uint64_t)1U)
+  {
+    hash_fun(hash_slab64_index(hsz, ihv, ihv.sz - (uint64_t)2U), acc, acc);
+    insert64_(hsz, lv + (uint32_t)1U, j / (uint64_t)2U, hs, acc, hash_fun);
+    return;
+  }
+}
+
+bool MerkleTree_Low64_mt_insert_pre(const MerkleTree_Low64_merkle_tree *mt, uint8_t *v)
+{
+  MerkleTree_Low64_merkle_tree mt1 = *(MerkleTree_Low64_merkle_tree *)mt;
+  return mt1.j < MerkleTree_Low_uint64_max;
+}
+
+void MerkleTree_Low64_mt_insert(MerkleTree_Low64_merkle_tree *mt, uint8_t *v)
+{
+  MerkleTree_Low64_merkle_tree mtv = *mt;
+  insert64_(mtv.hash_size, (uint32_t)0U, mtv.j, mtv.hs, v, mtv.hash_fun);
+  mt->j = mtv.j + (uint64_t)1U;
+  mt->rhs_ok = false;
+}
+
+MerkleTree_Low64_merkle_tree
+*MerkleTree_Low64_mt_create_custom(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low64_merkle_tree *mt = create_empty_mt64(hsz, hash_fun);
+  MerkleTree_Low64_mt_insert(mt, init);
+  return mt;
+}
+
+static void
+construct_rhs64(
+  uint32_t hsz,
+  uint32_t lv,
+  MerkleTree_Low64_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_vec rhs,
+  uint64_t i,
+  uint64_t j,
+  uint8_t *acc,
+  bool actd,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  if (!(j == (uint64_t)0U))
+  {
+    uint64_t ofs = MerkleTree_Low64_offset_of(i);
+    if (j % (uint64_t)2U == (uint64_t)0U)
+    {
+      construct_rhs64(hsz,
+        lv + (uint32_t)1U,
+        hs,
+        rhs,
+        i / (uint64_t)2U,
+        j / (uint64_t)2U,
+        acc,
+        actd,
+        hash_fun);
+      return;
+    }
+    uint8_t *left = hash_slab64_index(hsz, hs.vs[lv], j - (uint64_t)1U - ofs);
+    if (actd)
+    {
+      hash_copy(hsz, acc, index___uint8_t_(rhs, lv));
+      hash_fun(left, acc, acc);
+    }
+    else
+    {
+      hash_copy(hsz, left, acc);
+    }
+    construct_rhs64(hsz,
+      lv + (uint32_t)1U,
+      hs,
+      rhs,
+      i / (uint64_t)2U,
+      j / (uint64_t)2U,
+      acc,
+      true,
+      hash_fun);
+    return;
+  }
+}
+
+void MerkleTree_Low64_mt_get_root(const MerkleTree_Low64_merkle_tree *mt, uint8_t *rt)
+{
+  MerkleTree_Low64_merkle_tree *mt1 = (MerkleTree_Low64_merkle_tree *)mt;
+  MerkleTree_Low64_merkle_tree mtv = *mt1;
+  if (mtv.rhs_ok)
+  {
+    hash_copy(mtv.hash_size, mtv.mroot, rt);
+    return;
+  }
+  construct_rhs64(mtv.hash_size,
+    (uint32_t)0U,
+    mtv.hs,
+    mtv.rhs,
+    mtv.i,
+    mtv.j,
+    rt,
+    false,
+    mtv.hash_fun);
+  hash_copy(mtv.hash_size, rt, mtv.mroot);
+  mt1->rhs_ok = true;
+}
+
+static uint32_t mt_path_length_step64(uint64_t k, uint64_t j, bool actd)
+{
+  if (j == (uint64_t)0U)
+  {
+    return (uint32_t)0U;
+  }
+  if (k % (uint64_t)2U == (uint64_t)0U)
+  {
+    if (j == k || (j == k + (uint64_t)1U && !actd))
+    {
+      return (uint32_t)0U;
+    }
+    return (uint32_t)1U;
+  }
+  return (uint32_t)1U;
+}
+
+static uint32_t mt_path_length64(uint32_t lv, uint64_t k, uint64_t j, bool actd)
+{
+  if (j == (uint64_t)0U)
+  {
+    return (uint32_t)0U;
+  }
+  bool nactd = actd || j % (uint64_t)2U == (uint64_t)1U;
+  return
+    mt_path_length_step64(k,
+      j,
+      actd)
+    + mt_path_length64(lv + (uint32_t)1U, k / (uint64_t)2U, j / (uint64_t)2U, nactd);
+}
+
+static void
+mt_get_path64_(
+  uint32_t hsz,
+  uint32_t lv,
+  MerkleTree_Low64_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_vec rhs,
+  uint64_t i,
+  uint64_t j,
+  uint64_t k,
+  MerkleTree_Low_path *p,
+  bool actd
+)
+{
+  if (!(j == (uint64_t)0U))
+  {
+    uint64_t ofs = MerkleTree_Low64_offset_of(i);
+    if (k % (uint64_t)2U == (uint64_t)1U)
+    {
+      path_insert(p, hash_slab64_index(hsz, hs.vs[lv], k - (uint64_t)1U - ofs));
+    }
+    else if (!(k == j))
+    {
+      if (k + (uint64_t)1U == j)
+      {
+        if (actd)
+        {
+          path_insert(p, index___uint8_t_(rhs, lv));
+        }
+      }
+      else
+      {
+        path_insert(p, hash_slab64_index(hsz, hs.vs[lv], k + (uint64_t)1U - ofs));
+      }
+    }
+    bool ite;
+    if (j % (uint64_t)2U == (uint64_t)0U)
+    {
+      ite = actd;
+    }
+    else
+    {
+      ite = true;
+    }
+    mt_get_path64_(hsz,
+      lv + (uint32_t)1U,
+      hs,
+      rhs,
+      i / (uint64_t)2U,
+      j / (uint64_t)2U,
+      k / (uint64_t)2U,
+      p,
+      ite);
+    return;
+  }
+}
+
+bool
+MerkleTree_Low64_mt_get_path_pre(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t idx,
+  const MerkleTree_Low_path *p,
+  uint8_t *root
+)
+{
+  MerkleTree_Low64_merkle_tree mtv = *(MerkleTree_Low64_merkle_tree *)mt;
+  MerkleTree_Low_path uu____0 = *(MerkleTree_Low_path *)p;
+  return
+    uu____0.hash_size
+    == mtv.hash_size
+    && mtv.i <= idx && idx < mtv.j
+    && uu____0.hashes.sz == (uint32_t)0U;
+}
+
+uint64_t
+MerkleTree_Low64_mt_get_path(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t idx,
+  MerkleTree_Low_path *p,
+  uint8_t *root
+)
+{
+  MerkleTree_Low64_mt_get_root(mt, root);
+  MerkleTree_Low64_merkle_tree mtv = *(MerkleTree_Low64_merkle_tree *)mt;
+  uint64_t ofs = MerkleTree_Low64_offset_of(mtv.i);
+  path_insert(p, hash_slab64_index(mtv.hash_size, mtv.hs.vs[0U], idx - ofs));
+  mt_get_path64_(mtv.hash_size, (uint32_t)0U, mtv.hs, mtv.rhs, mtv.i, mtv.j, idx, p, false);
+  return mtv.j;
+}
+
+static void
+mt_flush_to64_(
+  uint32_t hsz,
+  uint32_t lv,
+  MerkleTree_Low64_Datastructures_hash_vv hs,
+  uint64_t pi,
+  uint64_t i
+)
+{
+  uint64_t oi = MerkleTree_Low64_offset_of(i);
+  uint64_t opi = MerkleTree_Low64_offset_of(pi);
+  if (!(oi == opi))
+  {
+    hs.vs[lv] = hash_slab64_flush(hsz, hs.vs[lv], oi - opi);
+    mt_flush_to64_(hsz, lv + (uint32_t)1U, hs, pi / (uint64_t)2U, i / (uint64_t)2U);
+    return;
+  }
+}
+
+bool MerkleTree_Low64_mt_flush_to_pre(const MerkleTree_Low64_merkle_tree *mt, uint64_t idx)
+{
+  MerkleTree_Low64_merkle_tree mtv = *(MerkleTree_Low64_merkle_tree *)mt;
+  return idx >= mtv.i && idx < mtv.j;
+}
+
+void MerkleTree_Low64_mt_flush_to(MerkleTree_Low64_merkle_tree *mt, uint64_t idx)
+{
+  MerkleTree_Low64_merkle_tree mtv = *mt;
+  mt_flush_to64_(mtv.hash_size, (uint32_t)0U, mtv.hs, mtv.i, idx);
+  mt->i = idx;
+}
+
+bool MerkleTree_Low64_mt_flush_pre(const MerkleTree_Low64_merkle_tree *mt)
+{
+  MerkleTree_Low64_merkle_tree uu____0 = *(MerkleTree_Low64_merkle_tree *)mt;
+  return uu____0.j > uu____0.i;
+}
+
+void MerkleTree_Low64_mt_flush(MerkleTree_Low64_merkle_tree *mt)
+{
+  MerkleTree_Low64_mt_flush_to(mt, mt->j - (uint64_t)1U);
+}
+
+static void
+mt_retract_to64_(
+  uint32_t hsz,
+  MerkleTree_Low64_Datastructures_hash_vv hs,
+  uint32_t lv,
+  uint64_t i,
+  uint64_t s
+)
+{
+  if (!(lv >= hs.sz))
+  {
+    uint64_t new_len = s - MerkleTree_Low64_offset_of(i);
+    hs.vs[lv] = hash_slab64_shrink(hsz, hs.vs[lv], new_len);
+    mt_retract_to64_(hsz, hs, lv + (uint32_t)1U, i / (uint64_t)2U, s / (uint64_t)2U);
+    return;
+  }
+}
+
+bool MerkleTree_Low64_mt_retract_to_pre(const MerkleTree_Low64_merkle_tree *mt, uint64_t r)
+{
+  MerkleTree_Low64_merkle_tree mtv = *(MerkleTree_Low64_merkle_tree *)mt;
+  return mtv.i <= r && r < mtv.j;
+}
+
+void MerkleTree_Low64_mt_retract_to(MerkleTree_Low64_merkle_tree *mt, uint64_t r)
+{
+  MerkleTree_Low64_merkle_tree mtv = *mt;
+  mt_retract_to64_(mtv.hash_size, mtv.hs, (uint32_t)0U, mtv.i, r + (uint64_t)1U);
+  mt->j = r + (uint64_t)1U;
+  mt->rhs_ok = false;
+}
+
+static void
+mt_verify64_(
+  uint64_t k,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint32_t ppos,
+  uint8_t *acc,
+  bool actd,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_path *ncp = (MerkleTree_Low_path *)p;
+  if (!(j == (uint64_t)0U))
+  {
+    bool nactd = actd || j % (uint64_t)2U == (uint64_t)1U;
+    if (k % (uint64_t)2U == (uint64_t)0U)
+    {
+      if (j == k || (j == k + (uint64_t)1U && !actd))
+      {
+        mt_verify64_(k / (uint64_t)2U, j / (uint64_t)2U, p, ppos, acc, nactd, hash_fun);
+        return;
+      }
+      hash_fun(acc, index___uint8_t_(ncp->hashes, ppos), acc);
+    }
+    else
+    {
+      hash_fun(index___uint8_t_(ncp->hashes, ppos), acc, acc);
+    }
+    mt_verify64_(k / (uint64_t)2U,
+      j / (uint64_t)2U,
+      p,
+      ppos + (uint32_t)1U,
+      acc,
+      nactd,
+      hash_fun);
+    return;
+  }
+}
+
+bool
+MerkleTree_Low64_mt_verify_pre(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t k,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint8_t *rt
+)
+{
+  MerkleTree_Low64_merkle_tree mtv = *(MerkleTree_Low64_merkle_tree *)mt;
+  MerkleTree_Low_path uu____0 = *(MerkleTree_Low_path *)p;
+  return
+    k
+    < j
+    && mtv.hash_size == uu____0.hash_size
+    &&
+      uu____0.hashes.sz
+      == (uint32_t)1U + mt_path_length64((uint32_t)0U, k, j, false);
+}
+
+bool
+MerkleTree_Low64_mt_verify(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t k,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint8_t *rt
+)
+{
+  MerkleTree_Low64_merkle_tree mtv = *(MerkleTree_Low64_merkle_tree *)mt;
+  uint32_t hash_size = mtv.hash_size;
+  uint8_t *ih = hash_r_alloc(hash_size);
+  MerkleTree_Low_path pth = *(MerkleTree_Low_path *)p;
+  hash_copy(hash_size, index___uint8_t_(pth.hashes, (uint32_t)0U), ih);
+  mt_verify64_(k, j, p, (uint32_t)1U, ih, false, mtv.hash_fun);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < hash_size; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(ih[i], rt[i]);
+    res = uu____0 & res;
+  }
+  uint8_t z = res;
+  bool r = z == (uint8_t)255U;
+  hash_r_free(hash_size, ih);
+  return r;
 }
 
-static MerkleTree_Low_Datastructures_hash_vv
-alloc__LowStar_Vector_vector_str__uint8_t_(
-  uint32_t len,
-  MerkleTree_Low_Datastructures_hash_vec v
-)
-{
-  return alloc_rid__LowStar_Vector_vector_str__uint8_t_(len, v);
-}
+/* Format version 2, for trees with 64-bit indices: the version byte, the
+   hash size, i and j, the number of levels, then each level as a 64-bit
+   count followed by its hashes, the rhs_ok flag, rhs as a 32-bit count
+   followed by its hashes, and mroot. All integers are big-endian. Positions
+   are 64-bit, so trees of more than 4 GiB can be serialized. */
 
-typedef struct __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv_s
+typedef struct __bool_uint64_t_s
 {
   bool fst;
-  uint32_t snd;
-  MerkleTree_Low_Datastructures_hash_vv thd;
+  uint64_t snd;
 }
-__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv;
+__bool_uint64_t;
 
-static __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv
-deserialize_hash_vv(uint32_t hash_size, bool ok, const uint8_t *buf, uint32_t sz, uint32_t pos)
+static __bool_uint64_t
+serialize64_bytes(bool ok, const uint8_t *x, uint64_t n, uint8_t *buf, uint64_t sz, uint64_t pos)
 {
-  if (!ok || pos >= sz)
+  if (!ok || pos > sz || sz - pos < n)
   {
-    return
-      (
-        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv){
-          .fst = false,
-          .snd = pos,
-          .thd = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }
-        }
-      );
+    return ((__bool_uint64_t){ .fst = false, .snd = (uint64_t)0U });
   }
-  __bool_uint32_t_uint32_t scrut0 = deserialize_uint32_t(ok, buf, sz, pos);
-  bool ok1 = scrut0.fst;
-  uint32_t pos1 = scrut0.snd;
-  uint32_t n = scrut0.thd;
-  if (!ok1)
+  if (n > (uint64_t)0U)
   {
-    return
-      (
-        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv){
-          .fst = false,
-          .snd = pos1,
-          .thd = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }
-        }
-      );
+    memcpy(buf + pos, x, n * sizeof (uint8_t));
   }
-  if (n == (uint32_t)0U)
+  return ((__bool_uint64_t){ .fst = true, .snd = pos + n });
+}
+
+static __bool_uint64_t
+serialize64_uint32_t(bool ok, uint32_t x, uint8_t *buf, uint64_t sz, uint64_t pos)
+{
+  uint8_t b[4U];
+  store32_be(b, x);
+  return serialize64_bytes(ok, b, (uint64_t)4U, buf, sz, pos);
+}
+
+static __bool_uint64_t
+serialize64_uint64_t(bool ok, uint64_t x, uint8_t *buf, uint64_t sz, uint64_t pos)
+{
+  uint8_t b[8U];
+  store64_be(b, x);
+  return serialize64_bytes(ok, b, (uint64_t)8U, buf, sz, pos);
+}
+
+/* Returns pos + n if the n bytes at pos are within input, 0 otherwise. */
+static uint64_t deserialize64_skip(uint64_t sz, uint64_t pos, uint64_t n)
+{
+  if (pos == (uint64_t)0U || pos > sz || sz - pos < n)
   {
-    return
-      (
-        (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv){
-          .fst = true,
-          .snd = pos1,
-          .thd = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL }
-        }
-      );
+    return (uint64_t)0U;
   }
-  regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec
-  rg =
-    {
-      .state = hash_size,
-      .dummy = { .sz = (uint32_t)0U, .cap = (uint32_t)0U, .vs = NULL },
-      .r_alloc = hash_vec_r_alloc,
-      .r_free = hash_vec_r_free
-    };
-  MerkleTree_Low_Datastructures_hash_vv
-  res = alloc__LowStar_Vector_vector_str__uint8_t_(n, rg.dummy);
-  __bool_uint32_t
-  scrut = deserialize_hash_vv_i(hash_size, ok1, buf, sz, pos1, res, (uint32_t)0U);
-  bool ok2 = scrut.fst;
-  uint32_t pos2 = scrut.snd;
-  return
-    (
-      (__bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv){ .fst = ok2, .snd = pos2, .thd = res }
-    );
+  return pos + n;
 }
 
-uint64_t MerkleTree_Low_Serialization_mt_serialize_size(const MerkleTree_Low_merkle_tree *mt)
+uint64_t
+MerkleTree_Low64_Serialization_mt_serialize_size(const MerkleTree_Low64_merkle_tree *mt)
 {
-  MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
-  MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
-  MerkleTree_Low_Datastructures_hash_vec rhs = mtv.rhs;
-  uint64_t hs_sz = hash_vv_bytes_i(mtv.hash_size, hs, (uint32_t)0U);
-  if (hs_sz < (uint64_t)4294967295U)
+  MerkleTree_Low64_merkle_tree mtv = *(MerkleTree_Low64_merkle_tree *)mt;
+  uint64_t hsz = (uint64_t)mtv.hash_size;
+  uint64_t r = (uint64_t)25U + (uint64_t)1U + (uint64_t)4U + (uint64_t)mtv.rhs.sz * hsz + hsz;
+  for (uint32_t lv = (uint32_t)0U; lv < mtv.hs.sz; lv++)
   {
-    uint64_t vs_hs = (uint64_t)rhs.sz * (uint64_t)mtv.hash_size;
-    uint64_t ite;
-    if (MerkleTree_Low_uint64_max - vs_hs >= (uint64_t)4U)
-    {
-      ite = vs_hs + (uint64_t)4U;
-    }
-    else
+    uint64_t n = mtv.hs.vs[lv].sz;
+    if (n > (MerkleTree_Low_uint64_max - r - (uint64_t)8U) / hsz)
     {
-      ite = MerkleTree_Low_uint64_max;
+      return MerkleTree_Low_uint64_max;
     }
-    return (uint64_t)21U + hs_sz + (uint64_t)1U + ite + (uint64_t)mtv.hash_size;
+    r = r + (uint64_t)8U + n * hsz;
   }
-  return MerkleTree_Low_uint64_max;
+  return r;
 }
 
 uint64_t
-MerkleTree_Low_Serialization_mt_serialize(
-  const MerkleTree_Low_merkle_tree *mt,
+MerkleTree_Low64_Serialization_mt_serialize(
+  const MerkleTree_Low64_merkle_tree *mt,
   uint8_t *output,
   uint64_t sz
 )
 {
-  MerkleTree_Low_merkle_tree *mt1 = (MerkleTree_Low_merkle_tree *)mt;
-  uint32_t sz1 = (uint32_t)sz;
-  MerkleTree_Low_merkle_tree mtv = *mt1;
-  __bool_uint32_t scrut = serialize_uint8_t(true, (uint8_t)1U, output, sz1, (uint32_t)0U);
-  bool ok = scrut.fst;
-  uint32_t pos = scrut.snd;
-  __bool_uint32_t scrut0 = serialize_uint32_t(ok, mtv.hash_size, output, sz1, pos);
-  bool ok1 = scrut0.fst;
-  uint32_t pos1 = scrut0.snd;
-  __bool_uint32_t scrut1 = serialize_offset_t(ok1, mtv.offset, output, sz1, pos1);
-  bool ok2 = scrut1.fst;
-  uint32_t pos2 = scrut1.snd;
-  __bool_uint32_t scrut2 = serialize_uint32_t(ok2, mtv.i, output, sz1, pos2);
-  bool ok3 = scrut2.fst;
-  uint32_t pos3 = scrut2.snd;
-  __bool_uint32_t scrut3 = serialize_uint32_t(ok3, mtv.j, output, sz1, pos3);
-  bool ok4 = scrut3.fst;
-  uint32_t pos4 = scrut3.snd;
-  __bool_uint32_t scrut4 = serialize_hash_vv(mtv.hash_size, ok4, mtv.hs, output, sz1, pos4);
-  bool ok5 = scrut4.fst;
-  uint32_t pos5 = scrut4.snd;
-  __bool_uint32_t scrut5 = serialize_bool(ok5, mtv.rhs_ok, output, sz1, pos5);
-  bool ok6 = scrut5.fst;
-  uint32_t pos6 = scrut5.snd;
-  __bool_uint32_t scrut6 = serialize_hash_vec(mtv.hash_size, ok6, mtv.rhs, output, sz1, pos6);
-  bool ok7 = scrut6.fst;
-  uint32_t pos7 = scrut6.snd;
-  __bool_uint32_t scrut7 = serialize_hash(mtv.hash_size, ok7, mtv.mroot, output, sz1, pos7);
-  bool ok8 = scrut7.fst;
-  uint32_t pos8 = scrut7.snd;
-  if (ok8)
+  MerkleTree_Low64_merkle_tree mtv = *(MerkleTree_Low64_merkle_tree *)mt;
+  uint64_t hsz = (uint64_t)mtv.hash_size;
+  uint8_t version = (uint8_t)2U;
+  __bool_uint64_t r = serialize64_bytes(true, &version, (uint64_t)1U, output, sz, (uint64_t)0U);
+  r = serialize64_uint32_t(r.fst, mtv.hash_size, output, sz, r.snd);
+  r = serialize64_uint64_t(r.fst, mtv.i, output, sz, r.snd);
+  r = serialize64_uint64_t(r.fst, mtv.j, output, sz, r.snd);
+  r = serialize64_uint32_t(r.fst, mtv.hs.sz, output, sz, r.snd);
+  for (uint32_t lv = (uint32_t)0U; r.fst && lv < mtv.hs.sz; lv++)
   {
-    return (uint64_t)pos8;
+    MerkleTree_Low64_Datastructures_hash_slab v = mtv.hs.vs[lv];
+    r = serialize64_uint64_t(r.fst, v.sz, output, sz, r.snd);
+    if (r.fst && v.sz > (sz - r.snd) / hsz)
+    {
+      r = ((__bool_uint64_t){ .fst = false, .snd = (uint64_t)0U });
+    }
+    r = serialize64_bytes(r.fst, v.vs, v.sz * hsz, output, sz, r.snd);
+  }
+  uint8_t rhs_ok = (uint8_t)0U;
+  if (mtv.rhs_ok)
+  {
+    rhs_ok = (uint8_t)1U;
+  }
+  r = serialize64_bytes(r.fst, &rhs_ok, (uint64_t)1U, output, sz, r.snd);
+  r = serialize64_uint32_t(r.fst, mtv.rhs.sz, output, sz, r.snd);
+  for (uint32_t k = (uint32_t)0U; k < mtv.rhs.sz; k++)
+  {
+    r = serialize64_bytes(r.fst, index___uint8_t_(mtv.rhs, k), hsz, output, sz, r.snd);
+  }
+  r = serialize64_bytes(r.fst, mtv.mroot, hsz, output, sz, r.snd);
+  if (r.fst)
+  {
+    return r.snd;
   }
   return (uint64_t)0U;
 }
 
-MerkleTree_Low_merkle_tree
-*MerkleTree_Low_Serialization_mt_deserialize(
+MerkleTree_Low64_merkle_tree
+*MerkleTree_Low64_Serialization_mt_deserialize(
   const uint8_t *input,
   uint64_t sz,
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 )
 {
-  uint32_t sz1 = (uint32_t)sz;
-  __bool_uint32_t_uint8_t scrut0 = deserialize_uint8_t(true, input, sz1, (uint32_t)0U);
-  bool ok = scrut0.fst;
-  uint32_t pos = scrut0.snd;
-  uint8_t format_version = scrut0.thd;
-  bool ok1 = ok && format_version == (uint8_t)1U;
-  __bool_uint32_t_uint32_t scrut1 = deserialize_uint32_t(ok1, input, sz1, pos);
-  bool ok2 = scrut1.fst;
-  uint32_t pos1 = scrut1.snd;
-  uint32_t hsz = scrut1.thd;
-  if (hsz == (uint32_t)0U)
+  uint8_t *in = (uint8_t *)input;
+  uint32_t lg = MerkleTree_Low64_merkle_tree_size_lg;
+  uint64_t pos = deserialize64_skip(sz, (uint64_t)1U, (uint64_t)24U);
+  if (pos == (uint64_t)0U || in[0U] != (uint8_t)2U)
   {
     return NULL;
   }
-  __bool_uint32_t_uint64_t scrut2 = deserialize_offset_t(ok2, input, sz1, pos1);
-  bool ok3 = scrut2.fst;
-  uint32_t pos2 = scrut2.snd;
-  uint64_t offset = scrut2.thd;
-  __bool_uint32_t_uint32_t scrut3 = deserialize_index_t(ok3, input, sz1, pos2);
-  bool ok4 = scrut3.fst;
-  uint32_t pos3 = scrut3.snd;
-  uint32_t i = scrut3.thd;
-  __bool_uint32_t_uint32_t scrut4 = deserialize_index_t(ok4, input, sz1, pos3);
-  bool ok5 = scrut4.fst;
-  uint32_t pos4 = scrut4.snd;
-  uint32_t j = scrut4.thd;
-  __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vv
-  scrut5 = deserialize_hash_vv(hsz, ok5, input, sz1, pos4);
-  bool ok6 = scrut5.fst;
-  uint32_t pos5 = scrut5.snd;
-  MerkleTree_Low_Datastructures_hash_vv hs = scrut5.thd;
-  __bool_uint32_t_bool scrut6 = deserialize_bool(ok6, input, sz1, pos5);
-  bool ok7 = scrut6.fst;
-  uint32_t pos6 = scrut6.snd;
-  bool rhs_ok = scrut6.thd;
-  __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec
-  scrut7 = deserialize_hash_vec(hsz, ok7, input, sz1, pos6);
-  bool ok8 = scrut7.fst;
-  uint32_t pos7 = scrut7.snd;
-  MerkleTree_Low_Datastructures_hash_vec rhs = scrut7.thd;
-  __bool_uint32_t__uint8_t_ scrut = deserialize_hash(hsz, ok8, input, sz1, pos7);
-  bool ok9 = scrut.fst;
-  uint8_t *mroot = scrut.thd;
-  if
-  (
-    !ok9
-    ||
-      !(j
-      >= i
-      && MerkleTree_Low_uint64_max - offset >= (uint64_t)j
-      && hs.sz == (uint32_t)32U
-      && rhs.sz == (uint32_t)32U)
-  )
+  uint32_t hsz = load32_be(in + (uint32_t)1U);
+  uint64_t i = load64_be(in + (uint32_t)5U);
+  uint64_t j = load64_be(in + (uint32_t)13U);
+  uint32_t nlv = load32_be(in + (uint32_t)21U);
+  if (hsz == (uint32_t)0U || j < i || nlv != lg)
   {
     return NULL;
   }
-  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_merkle_tree), (uint32_t)1U);
-  MerkleTree_Low_merkle_tree *buf = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_merkle_tree));
-  buf[0U]
-  =
-    (
-      (MerkleTree_Low_merkle_tree){
-        .hash_size = hsz,
-        .offset = offset,
-        .i = i,
-        .j = j,
-        .hs = hs,
-        .rhs_ok = rhs_ok,
-        .rhs = rhs,
-        .mroot = mroot,
-        .hash_fun = hash_fun
-      }
-    );
-  return buf;
-}
-
-uint64_t
-MerkleTree_Low_Serialization_mt_serialize_path(
-  const MerkleTree_Low_path *p,
-  uint8_t *output,
-  uint64_t sz
-)
-{
-  MerkleTree_Low_path x0 = *(MerkleTree_Low_path *)p;
-  uint32_t hsz1 = x0.hash_size;
-  uint32_t sz1 = (uint32_t)sz;
-  MerkleTree_Low_path *ncp = (MerkleTree_Low_path *)p;
-  __bool_uint32_t scrut = serialize_uint32_t(true, hsz1, output, sz1, (uint32_t)0U);
-  bool ok = scrut.fst;
-  uint32_t pos = scrut.snd;
-  MerkleTree_Low_path ncpd = *ncp;
-  __bool_uint32_t scrut0 = serialize_hash_vec(hsz1, ok, ncpd.hashes, output, sz1, pos);
-  bool ok1 = scrut0.fst;
-  uint32_t pos1 = scrut0.snd;
-  if (ok1)
+  MerkleTree_Low64_merkle_tree *mt = create_empty_mt64(hsz, hash_fun);
+  mt->i = i;
+  mt->j = j;
+  for (uint32_t lv = (uint32_t)0U; lv < lg; lv++)
   {
-    return (uint64_t)pos1;
+    uint64_t n = (j >> lv) - MerkleTree_Low64_offset_of(i >> lv);
+    uint64_t npos = deserialize64_skip(sz, pos, (uint64_t)8U);
+    if
+    (
+      npos
+      == (uint64_t)0U
+      || load64_be(in + pos) != n
+      || n > (sz - npos) / (uint64_t)hsz
+    )
+    {
+      MerkleTree_Low64_mt_free(mt);
+      return NULL;
+    }
+    pos = npos;
+    if (n > (uint64_t)0U)
+    {
+      uint8_t *vs = hash_slab_buf_alloc(hsz, n);
+      memcpy(vs, in + pos, n * (uint64_t)hsz * sizeof (uint8_t));
+      mt->hs.vs[lv] = ((MerkleTree_Low64_Datastructures_hash_slab){ .sz = n, .cap = n, .vs = vs });
+      pos = pos + n * (uint64_t)hsz;
+    }
   }
-  return (uint64_t)0U;
-}
-
-MerkleTree_Low_path
-*MerkleTree_Low_Serialization_mt_deserialize_path(const uint8_t *input, uint64_t sz)
-{
-  uint32_t sz1 = (uint32_t)sz;
-  __bool_uint32_t_uint32_t scrut0 = deserialize_uint32_t(true, input, sz1, (uint32_t)0U);
-  bool ok = scrut0.fst;
-  uint32_t pos = scrut0.snd;
-  uint32_t hash_size = scrut0.thd;
-  if (!ok || hash_size == (uint32_t)0U)
+  uint64_t npos = deserialize64_skip(sz, pos, (uint64_t)5U);
+  if
+  (
+    npos
+    == (uint64_t)0U
+    || in[pos] > (uint8_t)1U
+    || load32_be(in + pos + (uint64_t)1U) != lg
+    || deserialize64_skip(sz, npos, (uint64_t)(lg + (uint32_t)1U) * (uint64_t)hsz)
+    == (uint64_t)0U
+  )
   {
+    MerkleTree_Low64_mt_free(mt);
     return NULL;
   }
-  __bool_uint32_t_MerkleTree_Low_Datastructures_hash_vec
-  scrut = deserialize_hash_vec(hash_size, ok, input, sz1, pos);
-  bool ok1 = scrut.fst;
-  MerkleTree_Low_Datastructures_hash_vec hs = scrut.thd;
-  if (!ok1)
+  mt->rhs_ok = in[pos] == (uint8_t)1U;
+  pos = npos;
+  for (uint32_t k = (uint32_t)0U; k < lg; k++)
   {
-    return NULL;
+    hash_copy(hsz, in + pos, index___uint8_t_(mt->rhs, k));
+    pos = pos + (uint64_t)hsz;
   }
-  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_path), (uint32_t)1U);
-  MerkleTree_Low_path *buf = KRML_HOST_MALLOC(sizeof (MerkleTree_Low_path));
-  buf[0U] = ((MerkleTree_Low_path){ .hash_size = hash_size, .hashes = hs });
-  return buf;
+  hash_copy(hsz, in + pos, mt->mroot);
+  return mt;
 }
 
 uint8_t *MerkleTree_Low_Hashfunctions_init_hash(uint32_t hsz)
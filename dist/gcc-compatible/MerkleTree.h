@@ -55,10 +55,16 @@ typedef uint64_t offset_t;
 
 typedef uint32_t index_t;
 
+/*
+  A path: hashes points to its hash_size-byte hashes. The hashes that
+  mt_get_path and its variants extract are copied into buf, which the path
+  owns; it is NULL until the path is first filled that way.
+*/
 typedef struct MerkleTree_Low_path_s
 {
   uint32_t hash_size;
   MerkleTree_Low_Datastructures_hash_vec hashes;
+  uint8_t *buf;
 }
 MerkleTree_Low_path;
 
@@ -68,14 +74,63 @@ typedef MerkleTree_Low_path *path_p;
 
 typedef const MerkleTree_Low_path *const_path_p;
 
+/*
+  A proof holding its own copies of sz hashes of hash_size bytes each, stored
+  contiguously with room for cap of them. Unlike paths, consistency and
+  multi-leaf proofs include hashes of subtrees that the tree does not store,
+  which are computed when the proof is generated.
+*/
+typedef struct MerkleTree_Low_proof_s
+{
+  uint32_t hash_size;
+  uint32_t sz;
+  uint32_t cap;
+  uint8_t *hs;
+}
+MerkleTree_Low_proof;
+
+typedef MerkleTree_Low_proof proof;
+
+typedef MerkleTree_Low_proof *proof_p;
+
+typedef const MerkleTree_Low_proof *const_proof_p;
+
+typedef struct MerkleTree_Low_Datastructures_hash_file_s MerkleTree_Low_Datastructures_hash_file;
+
+typedef struct MerkleTree_Low_Snapshot_publisher_s MerkleTree_Low_Snapshot_publisher;
+
+typedef struct MerkleTree_Low_Snapshot_snapshot_s MerkleTree_Low_Snapshot_snapshot;
+
+/*
+  One level of a tree: sz hashes of hash_size bytes each, stored contiguously
+  in a slab with room for cap of them. Building MerkleTree.c with
+  MERKLE_TREE_HUGEPAGE_ARENA defined (Linux only) maps slabs of 2 MiB or more
+  with transparent huge pages. In trees created by mt_create_mapped, file is
+  the memory-mapped level file that holds the slab; it is NULL otherwise.
+  Once mt_publish has been called on the tree, pub is its publisher, and
+  hashes that published snapshots may still read are never moved or
+  overwritten in place; it is NULL otherwise.
+*/
+typedef struct MerkleTree_Low_Datastructures_hash_slab_s
+{
+  uint32_t sz;
+  uint32_t cap;
+  uint8_t *vs;
+  MerkleTree_Low_Datastructures_hash_file *file;
+  MerkleTree_Low_Snapshot_publisher *pub;
+}
+MerkleTree_Low_Datastructures_hash_slab;
+
 typedef struct MerkleTree_Low_Datastructures_hash_vv_s
 {
   uint32_t sz;
   uint32_t cap;
-  MerkleTree_Low_Datastructures_hash_vec *vs;
+  MerkleTree_Low_Datastructures_hash_slab *vs;
 }
 MerkleTree_Low_Datastructures_hash_vv;
 
+typedef struct MerkleTree_Low_Persistent_store_s MerkleTree_Low_Persistent_store;
+
 typedef struct MerkleTree_Low_merkle_tree_s
 {
   uint32_t hash_size;
@@ -87,6 +142,7 @@ typedef struct MerkleTree_Low_merkle_tree_s
   MerkleTree_Low_Datastructures_hash_vec rhs;
   uint8_t *mroot;
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+  MerkleTree_Low_Persistent_store *store;
 }
 MerkleTree_Low_merkle_tree;
 
@@ -96,6 +152,51 @@ typedef MerkleTree_Low_merkle_tree *mt_p;
 
 typedef const MerkleTree_Low_merkle_tree *const_mt_p;
 
+/*
+  One level of a tree with 64-bit indices: as MerkleTree_Low_Datastructures_hash_slab,
+  but sized to hold more than 2^32 hashes.
+*/
+typedef struct MerkleTree_Low64_Datastructures_hash_slab_s
+{
+  uint64_t sz;
+  uint64_t cap;
+  uint8_t *vs;
+}
+MerkleTree_Low64_Datastructures_hash_slab;
+
+typedef struct MerkleTree_Low64_Datastructures_hash_vv_s
+{
+  uint32_t sz;
+  uint32_t cap;
+  MerkleTree_Low64_Datastructures_hash_slab *vs;
+}
+MerkleTree_Low64_Datastructures_hash_vv;
+
+/*
+  A tree with 64-bit indices. Unlike MerkleTree_Low_merkle_tree, i and j are
+  the absolute indices of the first unflushed leaf and of the next leaf, so
+  there is no offset and no limit of 2^32 leaves; hs has one level per index
+  bit. Paths are MerkleTree_Low_path values, shared with 32-bit trees.
+*/
+typedef struct MerkleTree_Low64_merkle_tree_s
+{
+  uint32_t hash_size;
+  uint64_t i;
+  uint64_t j;
+  MerkleTree_Low64_Datastructures_hash_vv hs;
+  bool rhs_ok;
+  MerkleTree_Low_Datastructures_hash_vec rhs;
+  uint8_t *mroot;
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+}
+MerkleTree_Low64_merkle_tree;
+
+typedef MerkleTree_Low64_merkle_tree merkle_tree64;
+
+typedef MerkleTree_Low64_merkle_tree *mt64_p;
+
+typedef const MerkleTree_Low64_merkle_tree *const_mt64_p;
+
 /*
   Constructor for hashes
 */
@@ -148,6 +249,35 @@ uint8_t *mt_get_path_step(const MerkleTree_Low_path *path1, uint32_t i);
 */
 bool mt_get_path_step_pre(const MerkleTree_Low_path *path1, uint32_t i);
 
+/*
+  Constructor for proofs
+*/
+MerkleTree_Low_proof *mt_init_proof(uint32_t hash_size);
+
+/*
+  Destructor for proofs
+*/
+void mt_free_proof(MerkleTree_Low_proof *proof1);
+
+/*
+  Length of a proof
+
+  @param[in] p Proof
+
+  return The number of hashes in the proof
+*/
+uint32_t mt_get_proof_length(const MerkleTree_Low_proof *proof1);
+
+/*
+  Get step on a proof
+
+  @param[in] p Proof
+  @param[in] i Proof step index, less than mt_get_proof_length(p)
+
+  return The hash at step i of p
+*/
+uint8_t *mt_get_proof_step(const MerkleTree_Low_proof *proof1, uint32_t i);
+
 /*
   Construction with custom hash functions
 
@@ -167,8 +297,11 @@ MerkleTree_Low_merkle_tree
   Destruction
 
   @param[in]  mt  The Merkle tree
+
+  return false if mt is persistent and its final mt_sync failed, true
+  otherwise; the tree is freed in both cases
 */
-void mt_free(MerkleTree_Low_merkle_tree *mt);
+bool mt_free(MerkleTree_Low_merkle_tree *mt);
 
 /*
   Insertion
@@ -185,6 +318,23 @@ void mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 */
 bool mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
+/*
+  Batch insertion
+
+  @param[in]  mt      The Merkle tree
+  @param[in]  n       The number of hashes to insert
+  @param[in]  leaves  n hashes of hash_size bytes each, stored contiguously
+
+ Note: Equivalent to n calls to mt_insert, except that the content of leaves is
+ left untouched.
+*/
+void mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves);
+
+/*
+  Precondition predicate for mt_insert_batch
+*/
+bool mt_insert_batch_pre(const MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves);
+
 /*
   Getting the Merkle root
 
@@ -209,8 +359,8 @@ bool mt_get_root_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *root);
   return The number of elements in the tree
 
   Notes:
-  - The resulting path contains pointers to hashes in the tree, not copies of
-    the hash values.
+  - The resulting path holds copies of the hashes, so it stays valid when the
+    tree is later modified.
   - idx must be within the currently held indices in the tree (past the
     last flush index).
 */
@@ -307,6 +457,151 @@ mt_verify_pre(
   uint8_t *root
 );
 
+/*
+  Getting a consistency proof
+
+  @param[in]  mt      The Merkle tree
+  @param[in]  old_max The maximum index + 1 of the tree in an earlier version
+  @param[out] proof   The proof that that version is a prefix of the tree
+  @param[out] root    The Merkle root
+
+  return The number of elements in the tree
+
+  Notes:
+  - The proof is that of RFC 6962, section 2.1.2, for the trees built here,
+    whose hash of internal nodes is hash_fun.
+  - The subtrees covered by the proof must not have been flushed; the proof is
+    empty when old_max is the current size of the tree.
+*/
+uint32_t
+mt_get_consistency(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  MerkleTree_Low_proof *proof1,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt_get_consistency
+*/
+bool
+mt_get_consistency_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  const MerkleTree_Low_proof *proof1,
+  uint8_t *root
+);
+
+/*
+  Client-side verification of a consistency proof
+
+  @param[in]  mt       The Merkle tree
+  @param[in]  old_max  The maximum index + 1 of the earlier version
+  @param[in]  old_root The Merkle root of the earlier version
+  @param[in]  max      The maximum index + 1 of the tree when the proof was generated
+  @param[in]  root     The Merkle root of the tree when the proof was generated
+  @param[in]  proof    The consistency proof to verify
+
+  return true if the verification succeeded, false otherwise
+*/
+bool
+mt_verify_consistency(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  uint8_t *old_root,
+  uint64_t max,
+  uint8_t *root,
+  const MerkleTree_Low_proof *proof1
+);
+
+/*
+  Precondition predicate for mt_verify_consistency
+*/
+bool
+mt_verify_consistency_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  uint8_t *old_root,
+  uint64_t max,
+  uint8_t *root,
+  const MerkleTree_Low_proof *proof1
+);
+
+/*
+  Getting a Merkle proof for several hashes at once
+
+  @param[in]  mt    The Merkle tree
+  @param[in]  n     The number of target hashes
+  @param[in]  idxs  The indices of the target hashes, in increasing order
+  @param[out] proof A resulting proof that starts with the n target hashes
+  @param[out] root  The Merkle root
+
+  return The number of elements in the tree
+
+  Notes:
+  - After the target hashes, the proof holds the root of every maximal
+    subtree that contains none of them, from left to right. Interior nodes
+    shared by the paths of several targets thus appear once, if at all.
+  - The indices must be within the currently held indices in the tree.
+*/
+uint32_t
+mt_get_multi_proof(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  MerkleTree_Low_proof *proof1,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt_get_multi_proof
+*/
+bool
+mt_get_multi_proof_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  const MerkleTree_Low_proof *proof1,
+  uint8_t *root
+);
+
+/*
+  Client-side verification of a proof for several hashes
+
+  @param[in]  mt    The Merkle tree
+  @param[in]  n     The number of target hashes
+  @param[in]  idxs  The indices of the target hashes, in increasing order
+  @param[in]  max   The maximum index + 1 of the tree when the proof was generated
+  @param[in]  proof The proof to verify
+  @param[in]  root
+
+  return true if the verification succeeded, false otherwise
+
+  Note: As for mt_verify, the target hashes are those the proof starts with.
+*/
+bool
+mt_verify_multi_proof(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint64_t max,
+  const MerkleTree_Low_proof *proof1,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt_verify_multi_proof
+*/
+bool
+mt_verify_multi_proof_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint64_t max,
+  const MerkleTree_Low_proof *proof1,
+  uint8_t *root
+);
+
 /*
   Serialization size
 
@@ -372,120 +667,539 @@ uint64_t mt_serialize_path(const MerkleTree_Low_path *path1, uint8_t *buf, uint6
 */
 MerkleTree_Low_path *mt_deserialize_path(const uint8_t *buf, uint64_t len);
 
-typedef MerkleTree_Low_merkle_tree *mt_p0;
-
 /*
-  Default hash function
+  Proof serialization
+
+  @param[in]  proof The proof
+  @param[out] buf   The buffer to serialize the proof into
+  @param[in]  len   Length of buf
+
+  return the number of bytes written
+
+  Note: The format is that of mt_serialize_path for a path with the same hashes.
 */
-void mt_sha256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst);
+uint64_t mt_serialize_proof(const MerkleTree_Low_proof *proof1, uint8_t *buf, uint64_t len);
 
 /*
-  Construction wired to sha256 from EverCrypt
+  Proof deserialization
 
-  @param[in]  init   The initial hash
+  @param[in]  buf  The buffer to deserialize the proof from
+  @param[in]  len  Length of buf
+
+  return pointer to the new proof if successful, NULL otherwise
 */
-MerkleTree_Low_merkle_tree *mt_create(uint8_t *init);
+MerkleTree_Low_proof *mt_deserialize_proof(const uint8_t *buf, uint64_t len);
 
-typedef uint32_t MerkleTree_Low_index_t;
+/*
+  Construction of a persistent tree with custom hash functions
 
-extern uint32_t MerkleTree_Low_uint32_32_max;
+  @param[in]  dir       An existing directory that does not hold a tree yet
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  init      The initial hash
+  @param[in]  hash_fun  Hash function
 
-extern uint64_t MerkleTree_Low_uint32_max;
+  return The new Merkle tree, or NULL if the tree files could not be created
 
-extern uint64_t MerkleTree_Low_uint64_max;
+  Notes:
+  - Each level is kept in its own memory-mapped, append-only file in dir.
+    Hashes are written in place; no copy of the tree lives on the heap.
+  - The tree is made durable by mt_sync (and by mt_free, which calls it).
+    After a crash, mt_open_mapped returns the tree as of the last successful
+    mt_sync, with one exception: hashes are written in place through a
+    shared mapping, so insertions that follow an mt_retract_to to below the
+    last synced size overwrite synced hashes, and a crash before the next
+    mt_sync then leaves a corrupted tree. Calling mt_sync right after such a
+    retraction avoids this.
+  - Hashes dropped by mt_flush_to are returned to the file system (by
+    punching holes, where supported) once the next mt_sync has succeeded.
+  - Not supported on Windows, where NULL is returned.
+*/
+MerkleTree_Low_merkle_tree
+*mt_create_mapped_custom(
+  const char *dir,
+  uint32_t hash_size,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
 
-extern uint64_t MerkleTree_Low_offset_range_limit;
+/*
+  Construction of a persistent tree wired to sha256 from EverCrypt
 
-typedef uint64_t MerkleTree_Low_offset_t;
+  @param[in]  dir   An existing directory that does not hold a tree yet
+  @param[in]  init  The initial hash
 
-extern uint32_t MerkleTree_Low_merkle_tree_size_lg;
+  return The new Merkle tree, or NULL if the tree files could not be created
+*/
+MerkleTree_Low_merkle_tree *mt_create_mapped(const char *dir, uint8_t *init);
 
-bool MerkleTree_Low_uu___is_MT(MerkleTree_Low_merkle_tree projectee);
+/*
+  Open a persistent tree
 
-uint32_t MerkleTree_Low___proj__MT__item__hash_size(MerkleTree_Low_merkle_tree projectee);
+  @param[in]  dir      The directory of a tree created by mt_create_mapped
+  @param[in]  hash_fun Hash function
 
-uint64_t MerkleTree_Low___proj__MT__item__offset(MerkleTree_Low_merkle_tree projectee);
+  return The tree as of its last mt_sync, or NULL if dir does not hold a
+  valid tree
 
-uint32_t MerkleTree_Low___proj__MT__item__i(MerkleTree_Low_merkle_tree projectee);
+  Note: Only the tree metadata is read; the level files are mapped, not read,
+  so opening takes constant time whatever the size of the tree.
+*/
+MerkleTree_Low_merkle_tree
+*mt_open_mapped(const char *dir, void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2));
 
-uint32_t MerkleTree_Low___proj__MT__item__j(MerkleTree_Low_merkle_tree projectee);
+/*
+  Persist a tree created by mt_create_mapped or opened with mt_open_mapped
 
-MerkleTree_Low_Datastructures_hash_vv
-MerkleTree_Low___proj__MT__item__hs(MerkleTree_Low_merkle_tree projectee);
+  @param[in]  mt   The Merkle tree
 
-bool MerkleTree_Low___proj__MT__item__rhs_ok(MerkleTree_Low_merkle_tree projectee);
+  return true if the tree is durably stored, false on I/O error
 
-MerkleTree_Low_Datastructures_hash_vec
-MerkleTree_Low___proj__MT__item__rhs(MerkleTree_Low_merkle_tree projectee);
+  Note: This is a no-op returning true for trees that live on the heap.
+*/
+bool mt_sync(const MerkleTree_Low_merkle_tree *mt);
 
-uint8_t *MerkleTree_Low___proj__MT__item__mroot(MerkleTree_Low_merkle_tree projectee);
+/*
+  Publish a snapshot of the tree for concurrent readers
 
-void
-(*MerkleTree_Low___proj__MT__item__hash_fun(MerkleTree_Low_merkle_tree projectee))(
-  uint8_t *x0,
-  uint8_t *x1,
-  uint8_t *x2
-);
+  @param[in]  mt   The Merkle tree
 
-typedef MerkleTree_Low_merkle_tree *MerkleTree_Low_mt_p;
+  return The publisher of mt, or NULL for trees created by mt_create_mapped
+  or opened with mt_open_mapped
 
-typedef const MerkleTree_Low_merkle_tree *MerkleTree_Low_const_mt_p;
+  Notes:
+  - The publisher is created by the first call and is the same for the
+    lifetime of the tree. Every call replaces the published snapshot by one
+    of the current state of the tree (its root, bounds and levels).
+  - Any number of threads may call mt_snapshot_acquire on the publisher, and
+    mt_get_path_at on the snapshots they acquire, without locking, while a
+    single writer keeps calling mt_insert, mt_insert_batch, mt_flush_to,
+    mt_retract_to, mt_get_root and mt_publish on mt. Only mt must not be
+    shared between threads.
+  - Once a tree has been published, hashes still visible to some snapshot are
+    copied rather than moved or overwritten; the writer frees them in the
+    first mt_publish after the last snapshot that can see them has been
+    released.
+  - All snapshots must be released before mt_free is called, and the
+    publisher must not be used afterwards.
+*/
+MerkleTree_Low_Snapshot_publisher *mt_publish(MerkleTree_Low_merkle_tree *mt);
 
-bool
-MerkleTree_Low_merkle_tree_conditions(
-  uint64_t offset,
-  uint32_t i,
-  uint32_t j,
-  MerkleTree_Low_Datastructures_hash_vv hs,
-  bool rhs_ok,
-  MerkleTree_Low_Datastructures_hash_vec rhs,
-  uint8_t *mroot
-);
+/*
+  Acquire the most recently published snapshot
 
-uint32_t MerkleTree_Low_offset_of(uint32_t i);
+  @param[in]  pub  The publisher of a tree
 
-void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt);
+  return The snapshot, to be released with mt_snapshot_release
 
-bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v);
+  Note: Lock-free; may be called from any thread.
+*/
+const MerkleTree_Low_Snapshot_snapshot
+*mt_snapshot_acquire(MerkleTree_Low_Snapshot_publisher *pub);
 
-void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
+/*
+  Release a snapshot acquired with mt_snapshot_acquire
 
-MerkleTree_Low_merkle_tree
-*MerkleTree_Low_mt_create_custom(
-  uint32_t hsz,
-  uint8_t *init,
-  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
-);
+  @param[in]  snap The snapshot
+*/
+void mt_snapshot_release(const MerkleTree_Low_Snapshot_snapshot *snap);
 
-bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee);
+/*
+  Number of snapshots of a publisher that have not been freed yet
 
-uint32_t MerkleTree_Low___proj__Path__item__hash_size(MerkleTree_Low_path projectee);
+  @param[in]  pub  The publisher of a tree
 
-MerkleTree_Low_Datastructures_hash_vec
-MerkleTree_Low___proj__Path__item__hashes(MerkleTree_Low_path projectee);
+  return The number of snapshots published on pub and not yet freed, the
+  current one included
 
-typedef MerkleTree_Low_path *MerkleTree_Low_path_p;
+  Note: Like mt_publish, this may only be called by the writer.
+*/
+uint32_t mt_snapshot_pending(const MerkleTree_Low_Snapshot_publisher *pub);
 
-typedef const MerkleTree_Low_path *MerkleTree_Low_const_path_p;
+/*
+  Number of elements in a snapshot
 
-MerkleTree_Low_path *MerkleTree_Low_init_path(uint32_t hsz);
+  @param[in]  snap The snapshot
 
-void MerkleTree_Low_clear_path(MerkleTree_Low_path *p);
+  return The index + 1 of the last hash in the snapshot, which is the max to
+  pass to mt_verify for the paths obtained from it
+*/
+uint64_t mt_snapshot_size(const MerkleTree_Low_Snapshot_snapshot *snap);
 
-void MerkleTree_Low_free_path(MerkleTree_Low_path *p);
+/*
+  Getting the Merkle root of a snapshot
 
-bool MerkleTree_Low_mt_get_root_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *rt);
+  @param[in]  snap The snapshot
+  @param[out] root The Merkle root
+*/
+void mt_snapshot_get_root(const MerkleTree_Low_Snapshot_snapshot *snap, uint8_t *root);
 
-void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *rt);
+/*
+  Getting a Merkle path from a snapshot
 
-void MerkleTree_Low_mt_path_insert(uint32_t hsz, MerkleTree_Low_path *p, uint8_t *hp);
+  @param[in]  snap The snapshot
+  @param[in]  idx  The index of the target hash
+  @param[out] path A resulting Merkle path that contains the leaf hash.
+  @param[out] root The Merkle root of the snapshot
 
-uint32_t MerkleTree_Low_mt_get_path_length(const MerkleTree_Low_path *p);
+  return The number of elements in the tree, as for mt_get_path
+
+  Notes:
+  - As for mt_get_path, the path holds copies of the hashes, and stays valid
+    after the snapshot is released.
+  - idx must be within the indices held by the snapshot.
+*/
+uint32_t
+mt_get_path_at(
+  const MerkleTree_Low_Snapshot_snapshot *snap,
+  uint64_t idx,
+  MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt_get_path_at
+*/
+bool
+mt_get_path_at_pre(
+  const MerkleTree_Low_Snapshot_snapshot *snap,
+  uint64_t idx,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
+typedef MerkleTree_Low_merkle_tree *mt_p0;
+
+/*
+  Default hash function
+*/
+void mt_sha256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst);
+
+/*
+  Construction wired to sha256 from EverCrypt
+
+  @param[in]  init   The initial hash
+*/
+MerkleTree_Low_merkle_tree *mt_create(uint8_t *init);
+
+/*
+  The mt64_ functions below work on trees with 64-bit indices and behave as
+  their mt_ counterparts, except that every index is a uint64_t: such a tree
+  can hold more than 2^32 leaves, and mt64_verify accepts any tgt < max.
+  Batch insertion and memory-mapped storage are only offered for trees with
+  32-bit indices.
+*/
+
+/*
+  Construction of a tree with 64-bit indices and custom hash functions
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree
+*/
+MerkleTree_Low64_merkle_tree
+*mt64_create_custom(
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+/*
+  Construction of a tree with 64-bit indices wired to sha256 from EverCrypt
+
+  @param[in]  init   The initial hash
+*/
+MerkleTree_Low64_merkle_tree *mt64_create(uint8_t *init);
+
+/*
+  Destruction
+
+  @param[in]  mt  The Merkle tree
+*/
+void mt64_free(MerkleTree_Low64_merkle_tree *mt);
+
+/*
+  Insertion
+
+  @param[in]  mt  The Merkle tree
+  @param[in]  v   The tree does not take ownership of the hash, it makes a copy of its content.
+
+ Note: The content of the hash will be overwritten with an arbitrary value.
+*/
+void mt64_insert(MerkleTree_Low64_merkle_tree *mt, uint8_t *v);
+
+/*
+  Precondition predicate for mt64_insert
+*/
+bool mt64_insert_pre(const MerkleTree_Low64_merkle_tree *mt, uint8_t *v);
+
+/*
+  Getting the Merkle root
+
+  @param[in]  mt   The Merkle tree
+  @param[out] root The Merkle root
+*/
+void mt64_get_root(const MerkleTree_Low64_merkle_tree *mt, uint8_t *root);
+
+/*
+  Getting a Merkle path
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  idx  The index of the target hash
+  @param[out] path A resulting Merkle path that contains the leaf hash.
+  @param[out] root The Merkle root
+
+  return The number of elements in the tree
+
+  Note: As for mt_get_path, the path holds copies of the hashes.
+*/
+uint64_t
+mt64_get_path(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t idx,
+  MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt64_get_path
+*/
+bool
+mt64_get_path_pre(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t idx,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
+/*
+  Flush the Merkle tree
+
+  @param[in]  mt   The Merkle tree
+*/
+void mt64_flush(MerkleTree_Low64_merkle_tree *mt);
+
+/*
+  Precondition predicate for mt64_flush
+*/
+bool mt64_flush_pre(const MerkleTree_Low64_merkle_tree *mt);
+
+/*
+  Flush the Merkle tree up to a given index
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  idx  The index up to which to flush the tree
+*/
+void mt64_flush_to(MerkleTree_Low64_merkle_tree *mt, uint64_t idx);
+
+/*
+  Precondition predicate for mt64_flush_to
+*/
+bool mt64_flush_to_pre(const MerkleTree_Low64_merkle_tree *mt, uint64_t idx);
+
+/*
+  Retract the Merkle tree down to a given index
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  idx  The index to retract the tree to
+
+ Note: The element and idx will remain in the tree.
+*/
+void mt64_retract_to(MerkleTree_Low64_merkle_tree *mt, uint64_t idx);
+
+/*
+  Precondition predicate for mt64_retract_to
+*/
+bool mt64_retract_to_pre(const MerkleTree_Low64_merkle_tree *mt, uint64_t idx);
+
+/*
+  Client-side verification
+
+  @param[in]  mt   The Merkle tree
+  @param[in]  tgt  The index of the target hash
+  @param[in]  max  The maximum index + 1 of the tree when the path was generated
+  @param[in]  path The Merkle path to verify
+  @param[in]  root
+
+  return true if the verification succeeded, false otherwise
+*/
+bool
+mt64_verify(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t tgt,
+  uint64_t max,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
+/*
+  Precondition predicate for mt64_verify
+*/
+bool
+mt64_verify_pre(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t tgt,
+  uint64_t max,
+  const MerkleTree_Low_path *path1,
+  uint8_t *root
+);
+
+/*
+  Serialization size
+
+  @param[in]  mt   The Merkle tree
+
+  return the number of bytes required to serialize the tree
+*/
+uint64_t mt64_serialize_size(const MerkleTree_Low64_merkle_tree *mt);
+
+/*
+  Merkle tree serialization
+
+  @param[in]  mt   The Merkle tree
+  @param[out] buf  The buffer to serialize the tree into
+  @param[in]  len  Length of buf
+
+  return the number of bytes written
+
+  Note: The format (version 2) differs from that of mt_serialize: indices and
+  level sizes are 64 bits wide, and buffers may exceed 2^32 bytes.
+*/
+uint64_t mt64_serialize(const MerkleTree_Low64_merkle_tree *mt, uint8_t *buf, uint64_t len);
+
+/*
+  Merkle tree deserialization
+
+  @param[in]  buf  The buffer to deserialize the tree from
+  @param[in]  len  Length of buf
+  @param[in]  hash_fun Hash function
+
+  return pointer to the new tree if successful, NULL otherwise
+*/
+MerkleTree_Low64_merkle_tree
+*mt64_deserialize(
+  const uint8_t *buf,
+  uint64_t len,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+typedef uint32_t MerkleTree_Low_index_t;
+
+extern uint32_t MerkleTree_Low_uint32_32_max;
+
+extern uint64_t MerkleTree_Low_uint32_max;
+
+extern uint64_t MerkleTree_Low_uint64_max;
+
+extern uint64_t MerkleTree_Low_offset_range_limit;
+
+typedef uint64_t MerkleTree_Low_offset_t;
+
+extern uint32_t MerkleTree_Low_merkle_tree_size_lg;
+
+bool MerkleTree_Low_uu___is_MT(MerkleTree_Low_merkle_tree projectee);
+
+uint32_t MerkleTree_Low___proj__MT__item__hash_size(MerkleTree_Low_merkle_tree projectee);
+
+uint64_t MerkleTree_Low___proj__MT__item__offset(MerkleTree_Low_merkle_tree projectee);
+
+uint32_t MerkleTree_Low___proj__MT__item__i(MerkleTree_Low_merkle_tree projectee);
+
+uint32_t MerkleTree_Low___proj__MT__item__j(MerkleTree_Low_merkle_tree projectee);
+
+MerkleTree_Low_Datastructures_hash_vv
+MerkleTree_Low___proj__MT__item__hs(MerkleTree_Low_merkle_tree projectee);
+
+bool MerkleTree_Low___proj__MT__item__rhs_ok(MerkleTree_Low_merkle_tree projectee);
+
+MerkleTree_Low_Datastructures_hash_vec
+MerkleTree_Low___proj__MT__item__rhs(MerkleTree_Low_merkle_tree projectee);
+
+uint8_t *MerkleTree_Low___proj__MT__item__mroot(MerkleTree_Low_merkle_tree projectee);
+
+void
+(*MerkleTree_Low___proj__MT__item__hash_fun(MerkleTree_Low_merkle_tree projectee))(
+  uint8_t *x0,
+  uint8_t *x1,
+  uint8_t *x2
+);
+
+typedef MerkleTree_Low_merkle_tree *MerkleTree_Low_mt_p;
+
+typedef const MerkleTree_Low_merkle_tree *MerkleTree_Low_const_mt_p;
+
+bool
+MerkleTree_Low_merkle_tree_conditions(
+  uint64_t offset,
+  uint32_t i,
+  uint32_t j,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  bool rhs_ok,
+  MerkleTree_Low_Datastructures_hash_vec rhs,
+  uint8_t *mroot
+);
+
+uint32_t MerkleTree_Low_offset_of(uint32_t i);
+
+bool MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt);
+
+bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v);
+
+void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
+
+bool
+MerkleTree_Low_mt_insert_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  uint8_t *leaves
+);
+
+void MerkleTree_Low_mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint32_t n, uint8_t *leaves);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee);
+
+uint32_t MerkleTree_Low___proj__Path__item__hash_size(MerkleTree_Low_path projectee);
+
+MerkleTree_Low_Datastructures_hash_vec
+MerkleTree_Low___proj__Path__item__hashes(MerkleTree_Low_path projectee);
+
+typedef MerkleTree_Low_path *MerkleTree_Low_path_p;
+
+typedef const MerkleTree_Low_path *MerkleTree_Low_const_path_p;
+
+MerkleTree_Low_path *MerkleTree_Low_init_path(uint32_t hsz);
+
+void MerkleTree_Low_clear_path(MerkleTree_Low_path *p);
+
+void MerkleTree_Low_free_path(MerkleTree_Low_path *p);
+
+MerkleTree_Low_proof *MerkleTree_Low_init_proof(uint32_t hsz);
+
+void MerkleTree_Low_free_proof(MerkleTree_Low_proof *p);
+
+bool MerkleTree_Low_mt_get_root_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *rt);
+
+void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *rt);
+
+void MerkleTree_Low_mt_path_insert(uint32_t hsz, MerkleTree_Low_path *p, uint8_t *hp);
+
+uint32_t MerkleTree_Low_mt_get_path_length(const MerkleTree_Low_path *p);
 
 bool MerkleTree_Low_mt_get_path_step_pre(const MerkleTree_Low_path *p, uint32_t i);
 
 uint8_t *MerkleTree_Low_mt_get_path_step(const MerkleTree_Low_path *p, uint32_t i);
 
+uint32_t MerkleTree_Low_mt_get_proof_length(const MerkleTree_Low_proof *p);
+
+uint8_t *MerkleTree_Low_mt_get_proof_step(const MerkleTree_Low_proof *p, uint32_t i);
+
 bool
 MerkleTree_Low_mt_get_path_pre(
   const MerkleTree_Low_merkle_tree *mt,
@@ -532,6 +1246,80 @@ MerkleTree_Low_mt_verify(
   uint8_t *rt
 );
 
+bool
+MerkleTree_Low_mt_get_consistency_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  const MerkleTree_Low_proof *p,
+  uint8_t *root
+);
+
+uint32_t
+MerkleTree_Low_mt_get_consistency(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  MerkleTree_Low_proof *p,
+  uint8_t *root
+);
+
+bool
+MerkleTree_Low_mt_verify_consistency_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  uint8_t *old_rt,
+  uint64_t max,
+  uint8_t *rt,
+  const MerkleTree_Low_proof *p
+);
+
+bool
+MerkleTree_Low_mt_verify_consistency(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t old_max,
+  uint8_t *old_rt,
+  uint64_t max,
+  uint8_t *rt,
+  const MerkleTree_Low_proof *p
+);
+
+bool
+MerkleTree_Low_mt_get_multi_proof_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  const MerkleTree_Low_proof *p,
+  uint8_t *root
+);
+
+uint32_t
+MerkleTree_Low_mt_get_multi_proof(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  MerkleTree_Low_proof *p,
+  uint8_t *root
+);
+
+bool
+MerkleTree_Low_mt_verify_multi_proof_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint64_t max,
+  const MerkleTree_Low_proof *p,
+  uint8_t *rt
+);
+
+bool
+MerkleTree_Low_mt_verify_multi_proof(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t n,
+  const uint64_t *idxs,
+  uint64_t max,
+  const MerkleTree_Low_proof *p,
+  uint8_t *rt
+);
+
 typedef uint8_t MerkleTree_Low_Serialization_uint8_t;
 
 typedef uint16_t MerkleTree_Low_Serialization_uint16_t;
@@ -570,6 +1358,145 @@ MerkleTree_Low_Serialization_mt_serialize_path(
 MerkleTree_Low_path
 *MerkleTree_Low_Serialization_mt_deserialize_path(const uint8_t *input, uint64_t sz);
 
+uint64_t
+MerkleTree_Low_Serialization_mt_serialize_proof(
+  const MerkleTree_Low_proof *p,
+  uint8_t *output,
+  uint64_t sz
+);
+
+MerkleTree_Low_proof
+*MerkleTree_Low_Serialization_mt_deserialize_proof(const uint8_t *input, uint64_t sz);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_Persistent_mt_create(
+  const char *dir,
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_Persistent_mt_open(
+  const char *dir,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+bool MerkleTree_Low_Persistent_mt_sync(const MerkleTree_Low_merkle_tree *mt);
+
+MerkleTree_Low_Snapshot_publisher
+*MerkleTree_Low_Snapshot_mt_publish(MerkleTree_Low_merkle_tree *mt);
+
+const MerkleTree_Low_Snapshot_snapshot
+*MerkleTree_Low_Snapshot_acquire(MerkleTree_Low_Snapshot_publisher *pub);
+
+void MerkleTree_Low_Snapshot_release(const MerkleTree_Low_Snapshot_snapshot *snap);
+
+uint32_t MerkleTree_Low_Snapshot_pending(const MerkleTree_Low_Snapshot_publisher *pub);
+
+uint64_t MerkleTree_Low_Snapshot_size(const MerkleTree_Low_Snapshot_snapshot *snap);
+
+void
+MerkleTree_Low_Snapshot_get_root(const MerkleTree_Low_Snapshot_snapshot *snap, uint8_t *root);
+
+bool
+MerkleTree_Low_Snapshot_mt_get_path_at_pre(
+  const MerkleTree_Low_Snapshot_snapshot *snap,
+  uint64_t idx,
+  const MerkleTree_Low_path *p,
+  uint8_t *root
+);
+
+uint32_t
+MerkleTree_Low_Snapshot_mt_get_path_at(
+  const MerkleTree_Low_Snapshot_snapshot *snap,
+  uint64_t idx,
+  MerkleTree_Low_path *p,
+  uint8_t *root
+);
+
+extern uint32_t MerkleTree_Low64_merkle_tree_size_lg;
+
+uint64_t MerkleTree_Low64_offset_of(uint64_t i);
+
+MerkleTree_Low64_merkle_tree
+*MerkleTree_Low64_mt_create_custom(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+void MerkleTree_Low64_mt_free(MerkleTree_Low64_merkle_tree *mt);
+
+bool MerkleTree_Low64_mt_insert_pre(const MerkleTree_Low64_merkle_tree *mt, uint8_t *v);
+
+void MerkleTree_Low64_mt_insert(MerkleTree_Low64_merkle_tree *mt, uint8_t *v);
+
+void MerkleTree_Low64_mt_get_root(const MerkleTree_Low64_merkle_tree *mt, uint8_t *rt);
+
+bool
+MerkleTree_Low64_mt_get_path_pre(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t idx,
+  const MerkleTree_Low_path *p,
+  uint8_t *root
+);
+
+uint64_t
+MerkleTree_Low64_mt_get_path(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t idx,
+  MerkleTree_Low_path *p,
+  uint8_t *root
+);
+
+bool MerkleTree_Low64_mt_flush_to_pre(const MerkleTree_Low64_merkle_tree *mt, uint64_t idx);
+
+void MerkleTree_Low64_mt_flush_to(MerkleTree_Low64_merkle_tree *mt, uint64_t idx);
+
+bool MerkleTree_Low64_mt_flush_pre(const MerkleTree_Low64_merkle_tree *mt);
+
+void MerkleTree_Low64_mt_flush(MerkleTree_Low64_merkle_tree *mt);
+
+bool MerkleTree_Low64_mt_retract_to_pre(const MerkleTree_Low64_merkle_tree *mt, uint64_t r);
+
+void MerkleTree_Low64_mt_retract_to(MerkleTree_Low64_merkle_tree *mt, uint64_t r);
+
+bool
+MerkleTree_Low64_mt_verify_pre(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t k,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint8_t *rt
+);
+
+bool
+MerkleTree_Low64_mt_verify(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint64_t k,
+  uint64_t j,
+  const MerkleTree_Low_path *p,
+  uint8_t *rt
+);
+
+uint64_t
+MerkleTree_Low64_Serialization_mt_serialize_size(const MerkleTree_Low64_merkle_tree *mt);
+
+uint64_t
+MerkleTree_Low64_Serialization_mt_serialize(
+  const MerkleTree_Low64_merkle_tree *mt,
+  uint8_t *output,
+  uint64_t sz
+);
+
+MerkleTree_Low64_merkle_tree
+*MerkleTree_Low64_Serialization_mt_deserialize(
+  const uint8_t *input,
+  uint64_t sz,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
 uint8_t *MerkleTree_Low_Hashfunctions_init_hash(uint32_t hsz);
 
 void MerkleTree_Low_Hashfunctions_free_hash(uint8_t *h);
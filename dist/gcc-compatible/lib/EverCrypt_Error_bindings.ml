@@ -17,4 +17,8 @@ module Bindings(F:Cstubs.FOREIGN) =
       Unsigned.UInt8.of_int 4
     let everCrypt_Error_error_code_EverCrypt_Error_DecodeError =
       Unsigned.UInt8.of_int 5
+    let everCrypt_Error_error_code_EverCrypt_Error_MaximumLengthExceeded =
+      Unsigned.UInt8.of_int 6
+    let everCrypt_Error_error_code_EverCrypt_Error_InvalidState =
+      Unsigned.UInt8.of_int 7
   end
\ No newline at end of file
@@ -30,6 +30,10 @@ module Bindings(F:Cstubs.FOREIGN) =
       Unsigned.UInt8.of_int 1
     let spec_Cipher_Expansion_impl_Spec_Cipher_Expansion_Vale_AES256 =
       Unsigned.UInt8.of_int 2
+    let spec_Cipher_Expansion_impl_Spec_Cipher_Expansion_Hacl_AES128 =
+      Unsigned.UInt8.of_int 3
+    let spec_Cipher_Expansion_impl_Spec_Cipher_Expansion_Hacl_AES256 =
+      Unsigned.UInt8.of_int 4
     type spec_Agile_Cipher_cipher_alg = Unsigned.UInt8.t
     let spec_Agile_Cipher_cipher_alg =
       typedef uint8_t "Spec_Agile_Cipher_cipher_alg"
@@ -28,6 +28,7 @@
 
 #include "timing.h"
 #include "EverCrypt.h"
+#include "quic_provider.h"
 
 // How long to measure for KB/s figures
 #define MEASUREMENT_TIME 2
@@ -128,6 +129,79 @@ void bench_hash(Spec_Hash_Definitions_hash_alg a, const unsigned char *alg, size
   free(plain);
 }
 
+// Per-packet cost of QUIC packet protection: quic_crypto_encrypt/decrypt
+// reuse the AEAD state of the quic_key, while EXP re-expands the raw key
+// for every packet as the provider used to do.
+void bench_quic(mitls_aead a, Spec_Agile_AEAD_alg aa, const unsigned char *alg, size_t plain_len)
+{
+  unsigned char key[32] = {0}, iv[12] = {0}, pne[32] = {0}, ad[32] = {0};
+  unsigned char *plain = calloc(1, 2048);
+  unsigned char *cipher = calloc(1, 2048 + 16);
+  quic_key *k;
+  uint64_t sn = 0;
+
+  if(!quic_crypto_create(&k, a, key, iv, pne))
+  {
+    printf("QUIC %s: unsupported\n", alg);
+    free(plain);
+    free(cipher);
+    return;
+  }
+
+  char title[128];
+  sprintf(title, "QUIC ENC %s[%4d]", alg, plain_len);
+
+  TIME_AND_TSC(title, plain_len,
+    quic_crypto_encrypt(k, cipher, sn++, ad, sizeof(ad), plain, plain_len);
+  );
+
+  sprintf(title, "QUIC DEC %s[%4d]", alg, plain_len);
+  quic_crypto_encrypt(k, cipher, 0, ad, sizeof(ad), plain, plain_len);
+
+  TIME_AND_TSC(title, plain_len,
+    quic_crypto_decrypt(k, plain, 0, ad, sizeof(ad), cipher, plain_len + 16);
+  );
+
+  quic_packet packets[32];
+  size_t batch_len = 32 * plain_len;
+  for(int j = 0; j < 32; j++)
+    packets[j] = (quic_packet){ j, ad, sizeof(ad), plain, plain_len, cipher };
+
+  sprintf(title, "QUIC ENC32 %s[%4d]", alg, plain_len);
+
+  TIME_AND_TSC(title, batch_len,
+    quic_crypto_encrypt_batch(k, packets, 32);
+  );
+
+  const unsigned char *samples[32];
+  unsigned char masks[32 * 5];
+  for(int j = 0; j < 32; j++)
+    samples[j] = cipher;
+
+  sprintf(title, "QUIC HP %s", alg);
+
+  TIME_AND_TSC(title, 16,
+    quic_crypto_hp_mask(k, cipher, masks);
+  );
+
+  sprintf(title, "QUIC HP32 %s", alg);
+
+  TIME_AND_TSC(title, 32 * 16,
+    quic_crypto_hp_mask_batch(k, samples, 32, masks);
+  );
+
+  sprintf(title, "EXP ENC %s[%4d]", alg, plain_len);
+
+  TIME_AND_TSC(title, plain_len,
+    EverCrypt_AEAD_encrypt_expand(aa, key, iv, 12, ad, sizeof(ad), plain, plain_len,
+      cipher, cipher + plain_len);
+  );
+
+  quic_crypto_free_key(k);
+  free(plain);
+  free(cipher);
+}
+
 void run() //EverCrypt_AutoConfig_cfg cfg)
 {
   /*
@@ -151,6 +225,14 @@ void run() //EverCrypt_AutoConfig_cfg cfg)
   */
   EverCrypt_AutoConfig2_init();
   size_t i;
+  size_t packets[] = { 64, 128, 256, 512, 1024, 1350 };
+
+  for(i=0; i<sizeof(packets)/sizeof(packets[0]); i++)
+    bench_quic(TLS_aead_AES_128_GCM, Spec_Agile_AEAD_AES128_GCM, "AES128-GCM", packets[i]);
+  for(i=0; i<sizeof(packets)/sizeof(packets[0]); i++)
+    bench_quic(TLS_aead_AES_256_GCM, Spec_Agile_AEAD_AES256_GCM, "AES256-GCM", packets[i]);
+  for(i=0; i<sizeof(packets)/sizeof(packets[0]); i++)
+    bench_quic(TLS_aead_CHACHA20_POLY1305, Spec_Agile_AEAD_CHACHA20_POLY1305, "CHA20-P1305", packets[i]);
 
   for(i=4; i<=65536; i<<=1)
     bench_aead(Spec_AEAD_AES128_GCM, "AES128-GCM", i);
@@ -16,12 +16,12 @@
 typedef struct quic_key {
   mitls_aead alg;
   unsigned char key[32];
+  // Expanded AEAD key, created once per quic_key and reused for every packet
+  EverCrypt_AEAD_state_s *aead;
   unsigned char static_iv[12];
-  union {
-    unsigned char case_chacha20[32];
-    EverCrypt_aes128_key case_aes128;
-    EverCrypt_aes256_key case_aes256;
-  } pne;
+  // Header protection key: expanded once for AES, raw for ChaCha20
+  EverCrypt_Cipher_aes_state_s *pne_aes;
+  unsigned char pne_chacha20[32];
 } quic_key;
 
 #if DEBUG
@@ -55,6 +55,10 @@ static void dump_secret(const quic_secret *s)
   (a == TLS_hash_SHA256 ? Spec_Hash_Definitions_SHA2_256 : \
      (a == TLS_hash_SHA384 ? Spec_Hash_Definitions_SHA2_384 : Spec_Hash_Definitions_SHA2_512))
 
+#define CONVERT_AEAD(a) \
+  (a == TLS_aead_AES_128_GCM ? Spec_Agile_AEAD_AES128_GCM : \
+     (a == TLS_aead_AES_256_GCM ? Spec_Agile_AEAD_AES256_GCM : Spec_Agile_AEAD_CHACHA20_POLY1305))
+
 int MITLS_CALLCONV quic_crypto_hash(quic_hash a, /*out*/ unsigned char *hash, const unsigned char *data, size_t len)
 {
   if(a < TLS_hash_SHA256) return 0;
@@ -205,8 +209,36 @@ int MITLS_CALLCONV quic_derive_initial_secrets(quic_secret *client_in, quic_secr
   return 1;
 }
 
+static int create_pne(quic_key *key, const unsigned char *pne_key)
+{
+  key->pne_aes = NULL;
+  if(key->alg == TLS_aead_CHACHA20_POLY1305)
+  {
+    memcpy(key->pne_chacha20, pne_key, 32);
+    return 1;
+  }
+  Spec_Agile_Cipher_cipher_alg a = key->alg == TLS_aead_AES_128_GCM ?
+    Spec_Agile_Cipher_AES128 : Spec_Agile_Cipher_AES256;
+  return EverCrypt_Cipher_aes_create_in(a, &key->pne_aes, (uint8_t*)pne_key) == EverCrypt_Error_Success;
+}
+
+// HKDF-Expand-Label from a PRK whose HMAC key schedule is already computed
+static int expand_label(EverCrypt_HMAC_state_s *prk, quic_hash h, unsigned char *out, uint32_t out_len, const char *label)
+{
+  unsigned char info[259] = {0};
+  size_t info_len;
+
+  if(!quic_crypto_hkdf_label(h, info, &info_len, label, out_len))
+    return 0;
+  EverCrypt_HKDF_expand_keyed(prk, (uint8_t*) out, info, info_len, out_len);
+  return 1;
+}
+
 int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secret)
 {
+  if(secret->hash < TLS_hash_SHA256)
+    return 0;
+
   quic_key *key = KRML_HOST_MALLOC(sizeof(quic_key));
   if(!key) return 0;
   key->alg = secret->ae;
@@ -214,24 +246,26 @@ int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secre
   uint32_t klen = (secret->ae == TLS_aead_AES_128_GCM ? 16 : 32);
   uint32_t slen = (secret->hash == TLS_hash_SHA256 ? 32 : (secret->hash == TLS_hash_SHA384 ? 48 : 64));
 
-  unsigned char info[259] = {0};
   unsigned char pnkey[32];
-  size_t info_len;
-
-  if(!quic_crypto_hkdf_label(secret->hash, info, &info_len, "key", klen))
-    return 0;
-  if(!quic_crypto_hkdf_expand(secret->hash, key->key, klen, (uint8_t *) secret->secret, slen, info, info_len))
-    return 0;
+  EverCrypt_HMAC_state_s *prk;
 
-  if(!quic_crypto_hkdf_label(secret->hash, info, &info_len, "iv", 12))
-    return 0;
-  if(!quic_crypto_hkdf_expand(secret->hash, key->static_iv, 12, (uint8_t *) secret->secret, slen, info, info_len))
+  // The three labels are expanded from the same secret: compute its HMAC key schedule once
+  if(EverCrypt_HMAC_create_in(CONVERT_ALG(secret->hash), &prk, (uint8_t *) secret->secret, slen) != EverCrypt_Error_Success)
+  {
+    KRML_HOST_FREE(key);
     return 0;
+  }
 
-  if(!quic_crypto_hkdf_label(secret->hash, info, &info_len, "pn", klen))
-    return 0;
-  if(!quic_crypto_hkdf_expand(secret->hash, pnkey, klen, (uint8_t *) secret->secret, slen, info, info_len))
+  int ok = expand_label(prk, secret->hash, key->key, klen, "key")
+    && expand_label(prk, secret->hash, key->static_iv, 12, "iv")
+    && expand_label(prk, secret->hash, pnkey, klen, "pn");
+  // Wipes the schedule, which is as sensitive as the secret itself
+  EverCrypt_HMAC_free(prk);
+  if(!ok)
+  {
+    KRML_HOST_FREE(key);
     return 0;
+  }
 
 #if DEBUG
    printf("KEY: "); dump(key->key, klen);
@@ -239,17 +273,17 @@ int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secre
    printf("PNE: "); dump(pnkey, klen);
 #endif
 
-   if(key->alg == TLS_aead_AES_128_GCM)
-   {
-     key->pne.case_aes128 = EverCrypt_aes128_create(pnkey);
-   }
-   else if(key->alg == TLS_aead_AES_256_GCM)
+   if(EverCrypt_AEAD_create_in(CONVERT_AEAD(key->alg), &key->aead, key->key) != EverCrypt_Error_Success)
    {
-     key->pne.case_aes256 = EverCrypt_aes256_create(pnkey);
+     KRML_HOST_FREE(key);
+     return 0;
    }
-   else if(key->alg == TLS_aead_CHACHA20_POLY1305)
+
+   if(!create_pne(key, pnkey))
    {
-     memcpy(key->pne.case_chacha20, pnkey, 32);
+     EverCrypt_AEAD_free(key->aead);
+     KRML_HOST_FREE(key);
+     return 0;
    }
 
   *k = key;
@@ -272,12 +306,18 @@ int MITLS_CALLCONV quic_crypto_create(quic_key **key, mitls_aead alg, const unsi
   memcpy(k->key, raw_key, klen);
   memcpy(k->static_iv, iv, 12);
 
-  if(alg == TLS_aead_AES_128_GCM)
-    k->pne.case_aes128 = EverCrypt_aes128_create((uint8_t*)pne_key);
-  else if(alg == TLS_aead_AES_256_GCM)
-    k->pne.case_aes256 = EverCrypt_aes256_create((uint8_t*)pne_key);
-  else if(alg == TLS_aead_CHACHA20_POLY1305)
-    memcpy(k->pne.case_chacha20, pne_key, 32);
+  if(EverCrypt_AEAD_create_in(CONVERT_AEAD(alg), &k->aead, k->key) != EverCrypt_Error_Success)
+  {
+    KRML_HOST_FREE(k);
+    return 0;
+  }
+
+  if(!create_pne(k, pne_key))
+  {
+    EverCrypt_AEAD_free(k->aead);
+    KRML_HOST_FREE(k);
+    return 0;
+  }
 
   *key = k;
   return 1;
@@ -290,19 +330,8 @@ int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, unsigned char *cipher, uin
   memcpy(iv, key->static_iv, 12);
   sn_to_iv(iv, sn);
 
-  if(key->alg == TLS_aead_AES_128_GCM)
-  {
-    EverCrypt_aes128_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_AES_256_GCM)
-  {
-    EverCrypt_aes256_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_CHACHA20_POLY1305)
-  {
-    EverCrypt_Chacha20Poly1305_aead_encrypt(key->key, iv, ad_len, (uint8_t*)ad,
-        plain_len, (uint8_t*)plain, cipher, cipher + plain_len);
-  }
+  EverCrypt_Error_error_code r = EverCrypt_AEAD_encrypt(key->aead, iv, 12,
+      (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, cipher + plain_len);
 
 #if DEBUG
   printf("ENCRYPT %s\n", key->alg == TLS_aead_AES_128_GCM ? "AES128-GCM" : (key->alg == TLS_aead_AES_256_GCM ? "AES256-GCM" : "CHACHA20-POLY1305"));
@@ -314,7 +343,7 @@ int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, unsigned char *cipher, uin
   printf("CIPHER="); dump(cipher, plain_len + 16);
 #endif
 
-  return 1;
+  return r == EverCrypt_Error_Success;
 }
 
 int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, unsigned char *plain, uint64_t sn,
@@ -327,21 +356,9 @@ int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, unsigned char *plain, uint
   if(cipher_len < quic_crypto_tag_length(key))
     return 0;
 
-  uint32_t r = 0, plain_len = cipher_len - quic_crypto_tag_length(key);
-
-  if(key->alg == TLS_aead_AES_128_GCM)
-  {
-    r = EverCrypt_aes128_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_AES_256_GCM)
-  {
-    r = EverCrypt_aes256_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_CHACHA20_POLY1305)
-  {
-    r = 1 - EverCrypt_Chacha20Poly1305_aead_decrypt(key->key, iv, ad_len, (uint8_t*)ad,
-        plain_len, (uint8_t*)plain, cipher, (uint8_t*)(cipher+plain_len));
-  }
+  uint32_t plain_len = cipher_len - quic_crypto_tag_length(key);
+  int r = EverCrypt_AEAD_decrypt(key->aead, iv, 12, (uint8_t*)ad, ad_len,
+      (uint8_t*)cipher, plain_len, (uint8_t*)(cipher+plain_len), plain) == EverCrypt_Error_Success;
 
 #if DEBUG
   printf("DECRYPT %X->%X %s\n", cipher, plain, r?"OK":"BAD");
@@ -356,30 +373,119 @@ int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, unsigned char *plain, uint
   return r;
 }
 
+static void chacha20_hp_mask(quic_key *key, const unsigned char *sample, unsigned char *mask)
+{
+  uint8_t zero[5] = {0};
+  uint32_t ctr = (uint32_t)sample[0] + ((uint32_t)sample[1] << 8)
+    + ((uint32_t)sample[2] << 16) + ((uint32_t)sample[3] << 24);
+
+  EverCrypt_Cipher_chacha20(5, mask, zero, key->pne_chacha20, (uint8_t*)sample+4, ctr);
+}
+
 int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sample, unsigned char *mask)
 {
   unsigned char block[16];
-  if(key->alg == TLS_aead_AES_128_GCM)
+  if(key->alg == TLS_aead_AES_128_GCM || key->alg == TLS_aead_AES_256_GCM)
   {
-    EverCrypt_aes128_compute(key->pne.case_aes128, (uint8_t*)sample, block);
+    EverCrypt_Cipher_aes_encrypt_blocks(key->pne_aes, 1, block, (uint8_t*)sample);
     memcpy(mask, block, 5);
     return 1;
   }
 
-  if(key->alg == TLS_aead_AES_256_GCM)
+  if(key->alg == TLS_aead_CHACHA20_POLY1305)
   {
-    EverCrypt_aes256_compute(key->pne.case_aes256, (uint8_t*)sample, block);
-    memcpy(mask, block, 5);
+    chacha20_hp_mask(key, sample, mask);
     return 1;
   }
 
-  if(key->alg == TLS_aead_CHACHA20_POLY1305)
+  return 0;
+}
+
+// Packets are handed to the AEAD in chunks of BATCH_CHUNK, with their IVs
+#define BATCH_CHUNK 64
+
+int MITLS_CALLCONV quic_crypto_encrypt_batch(quic_key *key, quic_packet *packets, uint32_t count)
+{
+  EverCrypt_AEAD_packet ps[BATCH_CHUNK];
+  unsigned char ivs[BATCH_CHUNK][12];
+  int r = 1;
+
+  for(uint32_t i0 = 0; i0 < count; i0 += BATCH_CHUNK)
   {
-    uint8_t zero[5] = {0};
-    uint32_t ctr = sample[0] + (sample[1] << 8) + (sample[2] << 16) + (sample[3] << 24);
+    uint32_t n = count - i0 < BATCH_CHUNK ? count - i0 : BATCH_CHUNK;
+    for(uint32_t k = 0; k < n; k++)
+    {
+      quic_packet *p = &packets[i0 + k];
+      memcpy(ivs[k], key->static_iv, 12);
+      sn_to_iv(ivs[k], p->sn);
+      ps[k] = (EverCrypt_AEAD_packet){ ivs[k], (uint8_t*)p->ad, p->ad_len,
+        (uint8_t*)p->in, p->in_len, p->out, p->out + p->in_len };
+    }
+    r &= EverCrypt_AEAD_encrypt_batch(key->aead, ps, n) == EverCrypt_Error_Success;
+  }
+
+  return r;
+}
 
-    EverCrypt_Cipher_chacha20(5, mask, zero, (uint8_t*)key->pne.case_chacha20,
-        (uint8_t*)sample+4, ctr);
+int MITLS_CALLCONV quic_crypto_decrypt_batch(quic_key *key, quic_packet *packets, uint32_t count, int *results)
+{
+  EverCrypt_AEAD_packet ps[BATCH_CHUNK];
+  EverCrypt_Error_error_code rs[BATCH_CHUNK];
+  uint32_t idx[BATCH_CHUNK];
+  unsigned char ivs[BATCH_CHUNK][12];
+  uint32_t tag_len = quic_crypto_tag_length(key);
+  int r = 1;
+
+  for(uint32_t i0 = 0; i0 < count; i0 += BATCH_CHUNK)
+  {
+    uint32_t n = count - i0 < BATCH_CHUNK ? count - i0 : BATCH_CHUNK;
+    uint32_t m = 0;
+    for(uint32_t k = 0; k < n; k++)
+    {
+      quic_packet *p = &packets[i0 + k];
+      results[i0 + k] = 0;
+      if(p->in_len < tag_len)
+        continue;
+      uint32_t plain_len = p->in_len - tag_len;
+      memcpy(ivs[m], key->static_iv, 12);
+      sn_to_iv(ivs[m], p->sn);
+      ps[m] = (EverCrypt_AEAD_packet){ ivs[m], (uint8_t*)p->ad, p->ad_len,
+        p->out, plain_len, (uint8_t*)p->in, (uint8_t*)p->in + plain_len };
+      idx[m++] = i0 + k;
+    }
+    EverCrypt_AEAD_decrypt_batch(key->aead, ps, m, rs);
+    for(uint32_t k = 0; k < m; k++)
+      results[idx[k]] = rs[k] == EverCrypt_Error_Success;
+    for(uint32_t k = 0; k < n; k++)
+      r &= results[i0 + k];
+  }
+
+  return r;
+}
+
+int MITLS_CALLCONV quic_crypto_hp_mask_batch(quic_key *key, const unsigned char **samples, uint32_t count, unsigned char *masks)
+{
+  unsigned char blocks[BATCH_CHUNK * 16];
+
+  if(key->alg == TLS_aead_AES_128_GCM || key->alg == TLS_aead_AES_256_GCM)
+  {
+    for(uint32_t i0 = 0; i0 < count; i0 += BATCH_CHUNK)
+    {
+      uint32_t n = count - i0 < BATCH_CHUNK ? count - i0 : BATCH_CHUNK;
+      for(uint32_t k = 0; k < n; k++)
+        memcpy(blocks + 16 * k, samples[i0 + k], 16);
+      EverCrypt_Cipher_aes_encrypt_blocks(key->pne_aes, n, blocks, blocks);
+      for(uint32_t k = 0; k < n; k++)
+        memcpy(masks + 5 * (i0 + k), blocks + 16 * k, 5);
+    }
+    return 1;
+  }
+
+  // Each sample is its own ChaCha20 nonce and counter
+  if(key->alg == TLS_aead_CHACHA20_POLY1305)
+  {
+    for(uint32_t i = 0; i < count; i++)
+      chacha20_hp_mask(key, samples[i], masks + 5 * i);
     return 1;
   }
 
@@ -390,10 +496,9 @@ int MITLS_CALLCONV quic_crypto_free_key(quic_key *key)
 {
   if(key != NULL)
   {
-    if(key->alg == TLS_aead_AES_128_GCM)
-      EverCrypt_aes128_free(key->pne.case_aes128);
-    if(key->alg == TLS_aead_AES_256_GCM)
-      EverCrypt_aes256_free(key->pne.case_aes256);
+    EverCrypt_AEAD_free(key->aead);
+    if(key->pne_aes != NULL)
+      EverCrypt_Cipher_aes_free(key->pne_aes);
     KRML_HOST_FREE(key);
   }
   return 1;
@@ -73,6 +73,37 @@ int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, /*out*/ unsigned char *pla
 // 5 bytes will be written to *mask
 int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sample, unsigned char *mask);
 
+// Batched variants of the three functions above, for flushing or
+// receiving a burst of packets protected under the same key. Each
+// descriptor is processed as by the corresponding single-packet
+// function: for encryption, in_len bytes of in are encrypted to
+// in_len + 16 bytes of out; for decryption, in is a ciphertext of
+// in_len bytes (tag included) and in_len - 16 bytes are written to out,
+// which must not be used unless the packet is authentic. in and out may
+// be the same buffer.
+//
+// With AES-GCM, the AES work of all packets (keystream, tag masks and
+// header-protection masks) is done in multi-block calls, so that short
+// packets keep the AES pipeline full.
+typedef struct quic_packet {
+  uint64_t sn;
+  const unsigned char *ad;
+  uint32_t ad_len;
+  const unsigned char *in;
+  uint32_t in_len;
+  unsigned char *out;
+} quic_packet;
+
+// Succeeds only if every packet was encrypted.
+int MITLS_CALLCONV quic_crypto_encrypt_batch(quic_key *key, quic_packet *packets, uint32_t count);
+
+// Writes 1 (authentic) or 0 to results[i] for each packet; succeeds
+// only if every packet was authentic.
+int MITLS_CALLCONV quic_crypto_decrypt_batch(quic_key *key, quic_packet *packets, uint32_t count, /*out*/ int *results);
+
+// Writes the 5-byte mask for samples[i] to masks + 5*i.
+int MITLS_CALLCONV quic_crypto_hp_mask_batch(quic_key *key, const unsigned char **samples, uint32_t count, /*out*/ unsigned char *masks);
+
 // Keys allocated by quic_crypto_derive_key and quic_crypto_create must be freed
 int MITLS_CALLCONV quic_crypto_free_key(quic_key *key);
 
@@ -542,6 +542,71 @@ void test_pn_encrypt()
   }
 }
 
+void test_batch(mitls_aead alg)
+{
+  printf("==== test_batch(%d) ====\n", alg);
+
+  unsigned char raw_key[32], iv[12], pne_key[32], ad[20];
+  unsigned char plain[4][200], cipher[4][216], batch_cipher[4][216], decrypted[4][200];
+  unsigned char masks[20], mask[5];
+  const unsigned char *samples[4];
+  quic_packet packets[4];
+  int results[4];
+  quic_key *key;
+
+  for (int i = 0; i < 32; i++) { raw_key[i] = i; pne_key[i] = 0x80 + i; }
+  for (int i = 0; i < 12; i++) iv[i] = 0x40 + i;
+  memset(ad, 0xad, sizeof(ad));
+  for (int j = 0; j < 4; j++)
+    for (int i = 0; i < 200; i++) plain[j][i] = i * (j + 1);
+
+  if (!quic_crypto_create(&key, alg, raw_key, iv, pne_key)) {
+      printf("FAIL: quic_crypto_create failed\n");
+      exit(1);
+  }
+
+  // Packets of different lengths must encrypt as with quic_crypto_encrypt
+  for (int j = 0; j < 4; j++) {
+    uint32_t len = 17 + 60 * j;
+    quic_crypto_encrypt(key, cipher[j], 1000 + j, ad, sizeof(ad), plain[j], len);
+    packets[j] = (quic_packet){ 1000 + j, ad, sizeof(ad), plain[j], len, batch_cipher[j] };
+  }
+  assert(quic_crypto_encrypt_batch(key, packets, 4) == 1);
+  for (int j = 0; j < 4; j++)
+    check_result("quic_crypto_encrypt_batch", batch_cipher[j], cipher[j], packets[j].in_len + 16);
+
+  // Decrypt them back, with one corrupted packet
+  batch_cipher[2][5] ^= 1;
+  for (int j = 0; j < 4; j++)
+    packets[j] = (quic_packet){ 1000 + j, ad, sizeof(ad), batch_cipher[j], 17 + 60 * j + 16, decrypted[j] };
+  assert(quic_crypto_decrypt_batch(key, packets, 4, results) == 0);
+  for (int j = 0; j < 4; j++) {
+    assert(results[j] == (j != 2));
+    if (results[j])
+      check_result("quic_crypto_decrypt_batch", decrypted[j], plain[j], 17 + 60 * j);
+  }
+
+  // And in place
+  batch_cipher[2][5] ^= 1;
+  for (int j = 0; j < 4; j++)
+    packets[j] = (quic_packet){ 1000 + j, ad, sizeof(ad), batch_cipher[j], 17 + 60 * j + 16, batch_cipher[j] };
+  assert(quic_crypto_decrypt_batch(key, packets, 4, results) == 1);
+  for (int j = 0; j < 4; j++)
+    check_result("quic_crypto_decrypt_batch (in place)", batch_cipher[j], plain[j], 17 + 60 * j);
+
+  // Header protection masks must match quic_crypto_hp_mask
+  for (int j = 0; j < 4; j++)
+    samples[j] = cipher[j] + 4;
+  assert(quic_crypto_hp_mask_batch(key, samples, 4, masks) == 1);
+  for (int j = 0; j < 4; j++) {
+    assert(quic_crypto_hp_mask(key, samples[j], mask) == 1);
+    check_result("quic_crypto_hp_mask_batch", masks + 5 * j, mask, 5);
+  }
+
+  quic_crypto_free_key(key);
+  printf("PASS\n");
+}
+
 void test_initial_secrets()
 {
     int result;
@@ -595,6 +660,9 @@ void exhaustive(void)
     }
 
     test_pn_encrypt();
+    test_batch(TLS_aead_AES_128_GCM);
+    test_batch(TLS_aead_AES_256_GCM);
+    test_batch(TLS_aead_CHACHA20_POLY1305);
     test_initial_secrets();
 }
 
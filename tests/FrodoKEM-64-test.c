@@ -1,5 +1,11 @@
 #include "Hacl_Frodo_KEM.h"
+#include "Hacl_SHA3.h"
+#include "Hacl_SHA3_Vec256.h"
+#include "Hacl_Frodo_Vec256.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Hash.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdbool.h>
 
 bool
@@ -24,9 +30,86 @@ test_frodo()
   return true;
 }
 
+// Matrix generation runs four cSHAKE instances at a time on AVX2: check the
+// 4-way SHAKE128, through the dispatching wrapper and, on AVX2 machines, the
+// Vec256 kernel itself, against the single-state one across block boundaries
+bool
+test_shake128_x4()
+{
+  uint8_t in[4][400U];
+  uint8_t out[4][400U];
+  uint8_t out4[4][400U];
+  uint8_t exp[400U];
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+
+  for (int l = 0; l < 4; l++)
+    for (int i = 0; i < 400; i++)
+      in[l][i] = (uint8_t)(31 * l + 7 * i);
+
+  for (uint32_t len = 0; len < 400U; len += 13U) {
+    EverCrypt_Hash_shake128_x4(len, in[0], in[1], in[2], in[3],
+      len, out[0], out[1], out[2], out[3]);
+    if (avx2)
+      Hacl_SHA3_Vec256_shake128_4(len, in[0], in[1], in[2], in[3],
+        len, out4[0], out4[1], out4[2], out4[3]);
+    for (int l = 0; l < 4; l++) {
+      Hacl_SHA3_shake128_hacl(len, in[l], len, exp);
+      if (memcmp(out[l], exp, len) != 0) {
+        return false;
+      }
+      if (avx2 && memcmp(out4[l], exp, len) != 0) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+// The AVX2 matrix products against the textbook loops, at the FrodoKEM-640
+// shapes and at a shape that exercises every tail path
+bool
+test_matrix_mul_avx2()
+{
+  uint32_t dims[3][3] = { { 8U, 640U, 640U }, { 640U, 640U, 8U }, { 5U, 130U, 83U } };
+  bool ok = true;
+
+  if (!EverCrypt_AutoConfig2_has_avx2())
+    return true;
+
+  for (int d = 0; d < 3; d++) {
+    uint32_t n1 = dims[d][0], n2 = dims[d][1], n3 = dims[d][2];
+    uint16_t *a = malloc(n1 * n2 * sizeof(uint16_t));
+    uint16_t *b = malloc(n2 * n3 * sizeof(uint16_t));
+    uint16_t *c = malloc(n1 * n3 * sizeof(uint16_t));
+    uint16_t *cs = malloc(n1 * n3 * sizeof(uint16_t));
+    for (uint32_t i = 0; i < n1 * n2; i++)
+      a[i] = (uint16_t)(i * 40503U + 1U);
+    for (uint32_t i = 0; i < n2 * n3; i++)
+      b[i] = (uint16_t)(i * 2654435761U >> 7);
+
+    // b is read as n2 x n3 by matrix_mul and as n3 x n2 by matrix_mul_s
+    Hacl_Frodo_Vec256_matrix_mul(n1, n2, n3, a, b, c);
+    Hacl_Frodo_Vec256_matrix_mul_s(n1, n2, n3, a, b, cs);
+    for (uint32_t i = 0; i < n1; i++)
+      for (uint32_t j = 0; j < n3; j++) {
+        uint16_t r = 0, rs = 0;
+        for (uint32_t k = 0; k < n2; k++) {
+          r += a[i * n2 + k] * b[k * n3 + j];
+          rs += a[i * n2 + k] * b[j * n2 + k];
+        }
+        ok = ok && c[i * n3 + j] == r && cs[i * n3 + j] == rs;
+      }
+    free(a); free(b); free(c); free(cs);
+  }
+
+  return ok;
+}
+
 int main()
 {
-  bool pass = test_frodo();
+  EverCrypt_AutoConfig2_init();
+  bool pass = test_frodo() && test_shake128_x4() && test_matrix_mul_avx2();
   if (pass)
     {
       printf("[FrodoKEM] Self-test: PASS\n");
@@ -0,0 +1,309 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <openssl/evp.h>
+
+#include "Hacl_AES_GCM_CT64.h"
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_Cipher.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "aes_gcm_vectors.h"
+
+#define ROUNDS 2000
+#define SIZE   16384
+
+bool print_result(int in_len, uint8_t* comp, uint8_t* exp) {
+  return compare_and_print(in_len, comp, exp);
+}
+
+bool print_test(aes_gcm_test_vector *v){
+  uint64_t ctx[124];
+  uint8_t plaintext[v->input_len + 1];
+  uint8_t ciphertext[v->input_len + 1];
+  uint8_t tag[16] = {0};
+  bool aes128 = v->key_len == 16;
+
+  if (aes128) {
+    Hacl_AES_GCM_CT64_aes128_init(ctx, v->key);
+    Hacl_AES_GCM_CT64_aes128_encrypt(ctx, v->iv, v->iv_len, v->aad, v->aad_len, v->input, v->input_len, ciphertext, tag);
+  } else {
+    Hacl_AES_GCM_CT64_aes256_init(ctx, v->key);
+    Hacl_AES_GCM_CT64_aes256_encrypt(ctx, v->iv, v->iv_len, v->aad, v->aad_len, v->input, v->input_len, ciphertext, tag);
+  }
+  printf("AES%d-GCM (CT64) Result (cipher):\n", aes128 ? 128 : 256);
+  bool ok = print_result(v->input_len, ciphertext, v->cipher);
+  printf("(tag):\n");
+  ok = print_result(16, tag, v->tag) && ok;
+
+  uint32_t res = aes128
+    ? Hacl_AES_GCM_CT64_aes128_decrypt(ctx, v->iv, v->iv_len, v->aad, v->aad_len, v->cipher, v->input_len, v->tag, plaintext)
+    : Hacl_AES_GCM_CT64_aes256_decrypt(ctx, v->iv, v->iv_len, v->aad, v->aad_len, v->cipher, v->input_len, v->tag, plaintext);
+  if (res != 0) printf("AEAD Decrypt (AES-GCM CT64) failed \n.");
+  ok = ok && (res == 0);
+  ok = ok && print_result(v->input_len, plaintext, v->input);
+
+  // A corrupted tag must be rejected
+  tag[0] ^= 1;
+  res = aes128
+    ? Hacl_AES_GCM_CT64_aes128_decrypt(ctx, v->iv, v->iv_len, v->aad, v->aad_len, v->cipher, v->input_len, tag, plaintext)
+    : Hacl_AES_GCM_CT64_aes256_decrypt(ctx, v->iv, v->iv_len, v->aad, v->aad_len, v->cipher, v->input_len, tag, plaintext);
+  ok = ok && (res == 1);
+
+  // Through EverCrypt_AEAD, which picks Vale or the CT64 fallback
+  EverCrypt_AEAD_state_s *s = NULL;
+  Spec_Agile_AEAD_alg alg = aes128 ? Spec_Agile_AEAD_AES128_GCM : Spec_Agile_AEAD_AES256_GCM;
+  EverCrypt_Error_error_code e = EverCrypt_AEAD_create_in(alg, &s, v->key);
+  ok = ok && (e == EverCrypt_Error_Success);
+  if (e == EverCrypt_Error_Success) {
+    ok = ok && (EverCrypt_AEAD_alg_of_state(s) == alg);
+    e = EverCrypt_AEAD_encrypt(s, v->iv, v->iv_len, v->aad, v->aad_len, v->input, v->input_len, ciphertext, tag);
+    printf("AES%d-GCM (EverCrypt) Result (cipher):\n", aes128 ? 128 : 256);
+    ok = ok && (e == EverCrypt_Error_Success) && print_result(v->input_len, ciphertext, v->cipher);
+    printf("(tag):\n");
+    ok = ok && print_result(16, tag, v->tag);
+    e = EverCrypt_AEAD_decrypt(s, v->iv, v->iv_len, v->aad, v->aad_len, v->cipher, v->input_len, v->tag, plaintext);
+    ok = ok && (e == EverCrypt_Error_Success) && print_result(v->input_len, plaintext, v->input);
+    EverCrypt_AEAD_free(s);
+  }
+  e = aes128
+    ? EverCrypt_AEAD_decrypt_expand_aes128_gcm(v->key, v->iv, v->iv_len, v->aad, v->aad_len, v->cipher, v->input_len, v->tag, plaintext)
+    : EverCrypt_AEAD_decrypt_expand_aes256_gcm(v->key, v->iv, v->iv_len, v->aad, v->aad_len, v->cipher, v->input_len, v->tag, plaintext);
+  ok = ok && (e == EverCrypt_Error_Success) && print_result(v->input_len, plaintext, v->input);
+
+  return ok;
+}
+
+// Streams a message through the incremental API in chunks of at most chunk bytes
+bool incremental_roundtrip(EverCrypt_AEAD_state_s *s, uint8_t *iv, uint32_t iv_len,
+  uint8_t *aad, uint32_t aad_len, uint8_t *plain, uint32_t len, uint32_t chunk,
+  uint8_t *exp_cipher, uint8_t *exp_tag) {
+  EverCrypt_AEAD_Incremental_state_s *p = NULL;
+  uint8_t cipher[len + 1];
+  uint8_t plaintext[len + 1];
+  uint8_t tag[16] = {0};
+  bool ok = EverCrypt_AEAD_Incremental_create_in(s, &p) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Incremental_init(p, iv, iv_len) == EverCrypt_Error_Success;
+  for (uint32_t i = 0; ok && i < aad_len; i += chunk) {
+    uint32_t n = aad_len - i < chunk ? aad_len - i : chunk;
+    ok = EverCrypt_AEAD_Incremental_update_aad(p, aad + i, n) == EverCrypt_Error_Success;
+  }
+  for (uint32_t i = 0; ok && i < len; i += chunk) {
+    uint32_t n = len - i < chunk ? len - i : chunk;
+    ok = EverCrypt_AEAD_Incremental_encrypt_update(p, plain + i, n, cipher + i) == EverCrypt_Error_Success;
+  }
+  ok = ok && EverCrypt_AEAD_Incremental_encrypt_finish(p, tag) == EverCrypt_Error_Success;
+  ok = ok && memcmp(cipher, exp_cipher, len) == 0 && memcmp(tag, exp_tag, 16) == 0;
+
+  // Decrypt in place, with the chunks shifted by one byte
+  memcpy(plaintext, cipher, len);
+  ok = ok && EverCrypt_AEAD_Incremental_init(p, iv, iv_len) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Incremental_update_aad(p, aad, aad_len) == EverCrypt_Error_Success;
+  uint32_t n0 = len < 1 ? len : 1;
+  ok = ok && EverCrypt_AEAD_Incremental_decrypt_update(p, plaintext, n0, plaintext) == EverCrypt_Error_Success;
+  for (uint32_t i = n0; ok && i < len; i += chunk) {
+    uint32_t n = len - i < chunk ? len - i : chunk;
+    ok = EverCrypt_AEAD_Incremental_decrypt_update(p, plaintext + i, n, plaintext + i) == EverCrypt_Error_Success;
+  }
+  ok = ok && EverCrypt_AEAD_Incremental_decrypt_finish(p, tag) == EverCrypt_Error_Success;
+  ok = ok && memcmp(plaintext, plain, len) == 0;
+
+  // A corrupted tag is rejected; calls out of order are refused
+  tag[15] ^= 0x80;
+  ok = ok && EverCrypt_AEAD_Incremental_init(p, iv, iv_len) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Incremental_update_aad(p, aad, aad_len) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Incremental_decrypt_update(p, cipher, len, plaintext) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Incremental_update_aad(p, aad, aad_len) == EverCrypt_Error_InvalidState;
+  ok = ok && EverCrypt_AEAD_Incremental_encrypt_update(p, plain, len, cipher) == EverCrypt_Error_InvalidState;
+  ok = ok && EverCrypt_AEAD_Incremental_decrypt_finish(p, tag) == EverCrypt_Error_AuthenticationFailure;
+  ok = ok && EverCrypt_AEAD_Incremental_decrypt_finish(p, tag) == EverCrypt_Error_InvalidState;
+  if (p != NULL)
+    EverCrypt_AEAD_Incremental_free(p);
+  return ok;
+}
+
+bool print_test_incremental(aes_gcm_test_vector *v){
+  uint32_t chunks[] = { 1, 7, 16, 17, 64, 4096 };
+  EverCrypt_AEAD_state_s *s = NULL;
+  Spec_Agile_AEAD_alg alg = v->key_len == 16 ? Spec_Agile_AEAD_AES128_GCM : Spec_Agile_AEAD_AES256_GCM;
+  bool ok = EverCrypt_AEAD_create_in(alg, &s, v->key) == EverCrypt_Error_Success;
+  for (int i = 0; ok && i < sizeof(chunks)/sizeof(chunks[0]); ++i)
+    ok = incremental_roundtrip(s, v->iv, v->iv_len, v->aad, v->aad_len, v->input, v->input_len,
+      chunks[i], v->cipher, v->tag);
+  if (s != NULL)
+    EverCrypt_AEAD_free(s);
+  printf("AES%d-GCM (EverCrypt incremental) Result: %s\n", v->key_len == 16 ? 128 : 256,
+    ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Longer messages against the one-shot API, to cover the multi-block paths
+bool print_test_incremental_long(Spec_Agile_AEAD_alg alg){
+  uint32_t chunks[] = { 1, 15, 100, 1024, 5000 };
+  uint32_t len = 5000;
+  uint8_t key[32], iv[20], aad[37], plain[len], cipher[len], tag[16];
+  for (int i = 0; i < 32; ++i) key[i] = i;
+  for (int i = 0; i < 20; ++i) iv[i] = 3 * i;
+  for (int i = 0; i < 37; ++i) aad[i] = 5 * i;
+  for (uint32_t i = 0; i < len; ++i) plain[i] = i * 7 + 1;
+  EverCrypt_AEAD_state_s *s = NULL;
+  bool ok = EverCrypt_AEAD_create_in(alg, &s, key) == EverCrypt_Error_Success;
+  for (uint32_t iv_len = 12; ok && iv_len <= 20; iv_len += 8) {
+    ok = EverCrypt_AEAD_encrypt(s, iv, iv_len, aad, 37, plain, len, cipher, tag) == EverCrypt_Error_Success;
+    for (int i = 0; ok && i < sizeof(chunks)/sizeof(chunks[0]); ++i)
+      ok = incremental_roundtrip(s, iv, iv_len, aad, 37, plain, len, chunks[i], cipher, tag);
+  }
+  if (s != NULL)
+    EverCrypt_AEAD_free(s);
+  printf("%s (EverCrypt incremental, long) Result: %s\n",
+    alg == Spec_Agile_AEAD_AES128_GCM ? "AES128-GCM" : "AES256-GCM", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Multi-block ECB against OpenSSL, for every count of blocks up to 37
+bool print_test_blocks(Spec_Agile_Cipher_cipher_alg alg){
+  uint8_t key[32], in[37 * 16], out[37 * 16], expected[37 * 16];
+  int len = 0;
+  for (int i = 0; i < 32; ++i) key[i] = 9 * i + 1;
+  for (int i = 0; i < sizeof(in); ++i) in[i] = 13 * i + 5;
+  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  EVP_EncryptInit_ex(ctx, alg == Spec_Agile_Cipher_AES128 ? EVP_aes_128_ecb() : EVP_aes_256_ecb(),
+    NULL, key, NULL);
+  EVP_CIPHER_CTX_set_padding(ctx, 0);
+  EVP_EncryptUpdate(ctx, expected, &len, in, sizeof(in));
+  EVP_CIPHER_CTX_free(ctx);
+  EverCrypt_Cipher_aes_state_s *s = NULL;
+  bool ok = EverCrypt_Cipher_aes_create_in(alg, &s, key) == EverCrypt_Error_Success;
+  for (uint32_t n = 0; ok && n <= 37; ++n) {
+    memset(out, 0, sizeof(out));
+    EverCrypt_Cipher_aes_encrypt_blocks(s, n, out, in);
+    ok = memcmp(out, expected, n * 16) == 0;
+  }
+  if (s != NULL)
+    EverCrypt_Cipher_aes_free(s);
+  printf("%s (EverCrypt_Cipher blocks) Result: %s\n",
+    alg == Spec_Agile_Cipher_AES128 ? "AES128" : "AES256", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Batches of packets of assorted lengths against the one-shot API; the longest
+// packet spans several block cipher calls
+#define BATCH 9
+bool print_test_batch(Spec_Agile_AEAD_alg alg){
+  uint32_t lens[BATCH] = { 0, 1, 15, 16, 17, 100, 1200, 33, 2500 };
+  uint8_t key[32], ivs[BATCH][12], aad[BATCH][21];
+  uint8_t plain[BATCH][2500], cipher[BATCH][2500], tags[BATCH][16];
+  uint8_t out[BATCH][2500], out_tags[BATCH][16];
+  EverCrypt_AEAD_packet packets[BATCH];
+  EverCrypt_Error_error_code results[BATCH];
+  for (int i = 0; i < 32; ++i) key[i] = 3 * i + 1;
+  EverCrypt_AEAD_state_s *s = NULL;
+  bool ok = EverCrypt_AEAD_create_in(alg, &s, key) == EverCrypt_Error_Success;
+  for (int k = 0; ok && k < BATCH; ++k) {
+    for (int i = 0; i < 12; ++i) ivs[k][i] = 5 * i + k;
+    for (int i = 0; i < 21; ++i) aad[k][i] = 7 * i + k;
+    for (uint32_t i = 0; i < lens[k]; ++i) plain[k][i] = 11 * i + k;
+    ok = EverCrypt_AEAD_encrypt(s, ivs[k], 12, aad[k], k % 3 * 10, plain[k], lens[k],
+      cipher[k], tags[k]) == EverCrypt_Error_Success;
+    packets[k] = (EverCrypt_AEAD_packet){ ivs[k], aad[k], k % 3 * 10, plain[k], lens[k],
+      out[k], out_tags[k] };
+  }
+  ok = ok && EverCrypt_AEAD_encrypt_batch(s, packets, BATCH) == EverCrypt_Error_Success;
+  for (int k = 0; ok && k < BATCH; ++k)
+    ok = memcmp(out[k], cipher[k], lens[k]) == 0 && memcmp(out_tags[k], tags[k], 16) == 0;
+
+  // In place, with one corrupted tag
+  out_tags[6][0] ^= 1;
+  for (int k = 0; ok && k < BATCH; ++k)
+    packets[k].plain = out[k];
+  ok = ok && EverCrypt_AEAD_decrypt_batch(s, packets, BATCH, results)
+    == EverCrypt_Error_AuthenticationFailure;
+  for (int k = 0; ok && k < BATCH; ++k)
+    if (k == 6)
+      ok = results[k] == EverCrypt_Error_AuthenticationFailure;
+    else
+      ok = results[k] == EverCrypt_Error_Success && memcmp(out[k], plain[k], lens[k]) == 0;
+  if (s != NULL)
+    EverCrypt_AEAD_free(s);
+  printf("%s (EverCrypt batch) Result: %s\n",
+    alg == Spec_Agile_AEAD_AES128_GCM ? "AES128-GCM" : "AES256-GCM", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+int main(){
+  EverCrypt_AutoConfig2_init();
+
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors)/sizeof(aes_gcm_test_vector); ++i) {
+    ok &= print_test(&vectors[i]);
+    ok &= print_test_incremental(&vectors[i]);
+  }
+  ok &= print_test_incremental_long(Spec_Agile_AEAD_AES128_GCM);
+  ok &= print_test_incremental_long(Spec_Agile_AEAD_AES256_GCM);
+  ok &= print_test_batch(Spec_Agile_AEAD_AES128_GCM);
+  ok &= print_test_batch(Spec_Agile_AEAD_AES256_GCM);
+  ok &= print_test_blocks(Spec_Agile_Cipher_AES128);
+  ok &= print_test_blocks(Spec_Agile_Cipher_AES256);
+  // Without AES-NI, EverCrypt_AEAD falls back to the CT64 implementation
+  EverCrypt_AutoConfig2_disable_aesni();
+  for (int i = 0; i < sizeof(vectors)/sizeof(aes_gcm_test_vector); ++i) {
+    ok &= print_test(&vectors[i]);
+    ok &= print_test_incremental(&vectors[i]);
+  }
+  ok &= print_test_incremental_long(Spec_Agile_AEAD_AES128_GCM);
+  ok &= print_test_incremental_long(Spec_Agile_AEAD_AES256_GCM);
+  ok &= print_test_batch(Spec_Agile_AEAD_AES128_GCM);
+  ok &= print_test_batch(Spec_Agile_AEAD_AES256_GCM);
+  ok &= print_test_blocks(Spec_Agile_Cipher_AES128);
+  ok &= print_test_blocks(Spec_Agile_Cipher_AES256);
+
+  uint8_t plain[SIZE];
+  uint8_t cipher[SIZE];
+  uint8_t key[32];
+  uint8_t iv[12];
+  uint8_t tag[16];
+  uint64_t ctx[124];
+  int res = 0;
+  cycles a,b;
+  clock_t t1,t2;
+
+  memset(plain,'P',SIZE);
+  memset(key,'K',32);
+  memset(iv,'N',12);
+  Hacl_AES_GCM_CT64_aes128_init(ctx, key);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_AES_GCM_CT64_aes128_encrypt(ctx, iv, 12, NULL, 0, plain, SIZE, cipher, tag);
+    res ^= tag[0] ^ tag[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  Hacl_AES_GCM_CT64_aes256_init(ctx, key);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_AES_GCM_CT64_aes256_encrypt(ctx, iv, 12, NULL, 0, plain, SIZE, cipher, tag);
+    res ^= tag[0] ^ tag[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("AES128-GCM (CT64) PERF:\n"); print_time(count,tdiff1,cdiff1);
+  printf("AES256-GCM (CT64) PERF:\n"); print_time(count,tdiff2,cdiff2);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
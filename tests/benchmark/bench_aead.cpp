@@ -11,6 +11,7 @@ extern "C" {
 #ifdef HAVE_VALE
 #include <EverCrypt_Vale.h>
 #endif
+#include <EverCrypt_AutoConfig2.h>
 #include <EverCrypt_Chacha20Poly1305.h>
 }
 
@@ -212,6 +213,68 @@ class EverCryptAEADDecrypt : public AEADBenchmark
     virtual ~EverCryptAEADDecrypt() { }
 };
 
+// Fixed-width HACL Chacha20-Poly1305, bypassing EverCrypt's dispatch. Comparing
+// the 256 and 512 rows against each other (and against a --no-avx512 run)
+// shows how much the wider vectors gain once the AVX-512 frequency licence is paid.
+template<size_t vec_size>
+class HaclChacha20Poly1305Encrypt : public AEADBenchmark
+{
+  public:
+    static void (*f)(uint8_t*, uint8_t*, uint32_t, uint8_t*, uint32_t, uint8_t*, uint8_t*, uint8_t*);
+
+    HaclChacha20Poly1305Encrypt(size_t msg_len) :
+      AEADBenchmark(256, 16, msg_len)
+      {
+        std::stringstream ss;
+        ss << "Chacha20\\nPoly1305\\n" << vec_size << "-bit";
+        set_name("HACL", ss.str());
+      }
+    virtual void bench_func()
+    {
+      f(key, iv, ad_len, ad, msg_len, plain, cipher, tag);
+    }
+    virtual ~HaclChacha20Poly1305Encrypt() { }
+};
+
+template<> void (*HaclChacha20Poly1305Encrypt<256>::f)(uint8_t*, uint8_t*, uint32_t, uint8_t*, uint32_t, uint8_t*, uint8_t*, uint8_t*) = Hacl_Chacha20Poly1305_256_aead_encrypt;
+template<> void (*HaclChacha20Poly1305Encrypt<512>::f)(uint8_t*, uint8_t*, uint32_t, uint8_t*, uint32_t, uint8_t*, uint8_t*, uint8_t*) = Hacl_Chacha20Poly1305_512_aead_encrypt;
+
+template<size_t vec_size>
+class HaclChacha20Poly1305Decrypt : public AEADBenchmark
+{
+  protected:
+    static uint32_t (*f)(uint8_t*, uint8_t*, uint32_t, uint8_t*, uint32_t, uint8_t*, uint8_t*, uint8_t*);
+
+  public:
+    HaclChacha20Poly1305Decrypt(size_t msg_len) :
+      AEADBenchmark(256, 16, msg_len)
+      {
+        std::stringstream ss;
+        ss << "Chacha20\\nPoly1305\\n" << vec_size << "-bit";
+        set_name("HACL", ss.str());
+      }
+    virtual void bench_setup(const BenchmarkSettings & s)
+    {
+      AEADBenchmark::bench_setup(s);
+      HaclChacha20Poly1305Encrypt<vec_size>::f(key, iv, ad_len, ad, msg_len, plain, cipher, tag);
+    }
+    virtual void bench_func()
+    {
+      #ifdef _DEBUG
+      if (
+      #endif
+        f(key, iv, ad_len, ad, msg_len, plain, cipher, tag)
+      #ifdef _DEBUG
+        != 0) throw std::logic_error("AEAD decryption failed")
+      #endif
+      ;
+    }
+    virtual ~HaclChacha20Poly1305Decrypt() { }
+};
+
+template<> uint32_t (*HaclChacha20Poly1305Decrypt<256>::f)(uint8_t*, uint8_t*, uint32_t, uint8_t*, uint32_t, uint8_t*, uint8_t*, uint8_t*) = Hacl_Chacha20Poly1305_256_aead_decrypt;
+template<> uint32_t (*HaclChacha20Poly1305Decrypt<512>::f)(uint8_t*, uint8_t*, uint32_t, uint8_t*, uint32_t, uint8_t*, uint8_t*, uint8_t*) = Hacl_Chacha20Poly1305_512_aead_decrypt;
+
 #ifdef HAVE_VALE
 template<size_t key_size_bits, size_t tag_len>
 class OldValeEncrypt : public AEADBenchmark
@@ -722,6 +785,10 @@ void bench_aead_encrypt(const BenchmarkSettings & s)
       new EverCryptAEADEncrypt<Spec_Agile_AEAD_AES128_GCM, 128, 16>(ds),
       new EverCryptAEADEncrypt<Spec_Agile_AEAD_AES256_GCM, 256, 16>(ds),
       new EverCryptAEADEncrypt<Spec_Agile_AEAD_CHACHA20_POLY1305, 256, 16>(ds),
+      new HaclChacha20Poly1305Encrypt<256>(ds),
+      EverCrypt_AutoConfig2_has_avx512() ?
+        (Benchmark*)new HaclChacha20Poly1305Encrypt<512>(ds) :
+        (Benchmark*)new NilBenchmark("HACL", "Chacha20\\nPoly1305\\n512-bit"),
       // new EverCryptAEADEncrypt<Spec_Agile_AEAD_AES128_CCM, 128, 16>(ds), // unsupported?
       // new EverCryptAEADEncrypt<Spec_Agile_AEAD_AES256_CCM, 256, 16>(ds), // unsupported?
       // new EverCryptAEADEncrypt<Spec_Agile_AEAD_AES128_CCM8, 128, 8>(ds), // unsupported?
@@ -884,6 +951,10 @@ void bench_aead_decrypt(const BenchmarkSettings & s)
       new EverCryptAEADDecrypt<Spec_Agile_AEAD_AES128_GCM, 128, 16>(ds),
       new EverCryptAEADDecrypt<Spec_Agile_AEAD_AES256_GCM, 256, 16>(ds),
       new EverCryptAEADDecrypt<Spec_Agile_AEAD_CHACHA20_POLY1305, 256, 16>(ds),
+      new HaclChacha20Poly1305Decrypt<256>(ds),
+      EverCrypt_AutoConfig2_has_avx512() ?
+        (Benchmark*)new HaclChacha20Poly1305Decrypt<512>(ds) :
+        (Benchmark*)new NilBenchmark("HACL", "Chacha20\\nPoly1305\\n512-bit"),
       // new EverCryptAEADDecrypt<Spec_Agile_AEAD_AES128_CCM, 128, 16>(ds), // unsupported?
       // new EverCryptAEADDecrypt<Spec_Agile_AEAD_AES256_CCM, 256, 16>(ds), // unsupported?
       // new EverCryptAEADDecrypt<Spec_Agile_AEAD_AES128_CCM8, 128, 8>(ds), // unsupported?
@@ -57,6 +57,15 @@ class DSABenchmark: public Benchmark
 };
 
 #ifdef HAVE_HACL
+class HaclKeygen: public DSABenchmark
+{
+  public:
+    HaclKeygen(size_t msg_len) : DSABenchmark(msg_len, "HaCl (keygen)") {}
+    virtual void bench_func()
+      { Hacl_Ed25519_secret_to_public(our_public, our_secret); }
+    virtual ~HaclKeygen() {}
+};
+
 class HaclSign: public DSABenchmark
 {
   public:
@@ -108,9 +117,106 @@ class HaclVerify: public DSABenchmark
     }
     virtual ~HaclVerify() {}
 };
+
+#define BATCH_SIZE 64
+
+class HaclVerifyN: public DSABenchmark
+{
+  protected:
+    uint8_t *pks[BATCH_SIZE], *msgs[BATCH_SIZE], *sigs[BATCH_SIZE];
+    uint32_t lens[BATCH_SIZE];
+    bool results[BATCH_SIZE];
+
+  public:
+    HaclVerifyN(size_t msg_len, std::string const & prefix) : DSABenchmark(msg_len, prefix)
+    {
+      for (size_t i = 0; i < BATCH_SIZE; i++)
+      {
+        pks[i] = new uint8_t[32];
+        sigs[i] = new uint8_t[SIGNATURE_LENGTH];
+        msgs[i] = new uint8_t[msg_len];
+        lens[i] = msg_len;
+      }
+    }
+    virtual void bench_setup(const BenchmarkSettings & s)
+    {
+      DSABenchmark::bench_setup(s);
+      for (size_t i = 0; i < BATCH_SIZE; i++)
+      {
+        randomize(our_secret, 32);
+        randomize(msgs[i], msg_len);
+        Hacl_Ed25519_secret_to_public(pks[i], our_secret);
+        Hacl_Ed25519_sign(sigs[i], our_secret, msg_len, msgs[i]);
+      }
+    }
+    virtual ~HaclVerifyN()
+    {
+      for (size_t i = 0; i < BATCH_SIZE; i++)
+      {
+        delete[](pks[i]);
+        delete[](sigs[i]);
+        delete[](msgs[i]);
+      }
+    }
+};
+
+class HaclVerifyLoop: public HaclVerifyN
+{
+  public:
+    HaclVerifyLoop(size_t msg_len) : HaclVerifyN(msg_len, "HaCl (verify x" + std::to_string(BATCH_SIZE) + ")") {}
+    virtual void bench_func()
+    {
+      bool ok = true;
+      for (size_t i = 0; i < BATCH_SIZE; i++)
+        ok &= Hacl_Ed25519_verify(pks[i], lens[i], msgs[i], sigs[i]);
+      #ifdef _DEBUG
+      if (!ok) throw std::logic_error("Signature verification failed");
+      #endif
+    }
+    virtual ~HaclVerifyLoop() {}
+};
+
+class HaclVerifyBatch: public HaclVerifyN
+{
+  public:
+    HaclVerifyBatch(size_t msg_len) : HaclVerifyN(msg_len, "HaCl (verify_batch " + std::to_string(BATCH_SIZE) + ")") {}
+    virtual void bench_func()
+    {
+      #ifdef _DEBUG
+      if (!
+      #endif
+        Hacl_Ed25519_verify_batch(BATCH_SIZE, pks, lens, msgs, sigs, results)
+      #ifdef _DEBUG
+      ) throw std::logic_error("Batch signature verification failed")
+      #endif
+      ;
+    }
+    virtual ~HaclVerifyBatch() {}
+};
 #endif
 
 #ifdef HAVE_OPENSSL
+class OpenSSLKeygen: public DSABenchmark
+{
+  protected:
+    size_t pub_len = 32;
+
+  public:
+    OpenSSLKeygen(size_t msg_len) : DSABenchmark(msg_len, "OpenSSL (keygen)") {}
+    virtual void bench_func()
+    {
+      EVP_PKEY *ours = EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519, NULL, our_secret, 32);
+      #ifdef _DEBUG
+      if (ours == NULL || EVP_PKEY_get_raw_public_key(ours, our_public, &pub_len) <= 0)
+        throw std::logic_error("OpenSSL EVP_PKEY_get_raw_public_key failed");
+      #else
+      EVP_PKEY_get_raw_public_key(ours, our_public, &pub_len);
+      #endif
+      EVP_PKEY_free(ours);
+    }
+    virtual ~OpenSSLKeygen() {}
+};
+
 class OpenSSLSign: public DSABenchmark
 {
   protected:
@@ -213,12 +319,16 @@ void bench_ed25519(const BenchmarkSettings & s)
 
     std::list<Benchmark*> todo = {
       #ifdef HAVE_HACL
+      new HaclKeygen(ds),
       new HaclSign(ds),
       new HaclSignExpanded(ds),
       new HaclVerify(ds),
+      new HaclVerifyLoop(ds),
+      new HaclVerifyBatch(ds),
       #endif
 
       #ifdef HAVE_OPENSSL
+      new OpenSSLKeygen(ds),
       new OpenSSLSign(ds),
       new OpenSSLVerify(ds),
       #endif
@@ -264,4 +374,4 @@ void bench_ed25519(const BenchmarkSettings & s)
                          "bench_ed25519_" + std::to_string(ds) + "_candlesticks.svg",
                          extras.str());
   }
-}
\ No newline at end of file
+}
\ No newline at end of file
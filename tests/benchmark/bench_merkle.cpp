@@ -1,4 +1,7 @@
 #include <sys/time.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 
 #include <sstream>
 #include <algorithm>
@@ -88,6 +91,61 @@ class MerkleInsert : public Benchmark
     }
 };
 
+class MerkleInsertBatch : public Benchmark
+{
+  protected:
+    static const size_t batch_size = 4096;
+    size_t num_nodes = 0;
+    merkle_tree *tree;
+    std::vector<uint8_t> leaves;
+
+  public:
+    static std::string column_headers() { return "\"Nodes\"" + Benchmark::column_headers(); }
+
+    MerkleInsertBatch(size_t num_nodes) : Benchmark(), num_nodes(num_nodes) { }
+
+    virtual ~MerkleInsertBatch() {}
+
+    virtual void bench_setup(const BenchmarkSettings & s)
+    {
+      Benchmark::bench_setup(s);
+      uint8_t *ih = mt_init_hash(hash_size);
+      tree = mt_create(ih);
+      mt_free_hash(ih);
+
+      leaves.resize(num_nodes * hash_size, 0);
+      for (uint64_t i = 0; i < num_nodes; i++)
+        for (size_t j = 0; j < 8; j++)
+          leaves[i * hash_size + j] = rand() % 8;
+    }
+
+    virtual void bench_func()
+    {
+      for (uint64_t i = 0; i < num_nodes; i += batch_size)
+      {
+        uint32_t n = (uint32_t)std::min(batch_size, num_nodes - i);
+        #ifdef _DEBUG
+        if (!mt_insert_batch_pre(tree, n, &leaves[i * hash_size]))
+          throw std::logic_error("precondition violation");
+        #endif
+        mt_insert_batch(tree, n, &leaves[i * hash_size]);
+      }
+    }
+
+    virtual void bench_cleanup(const BenchmarkSettings & s)
+    {
+      mt_free(tree);
+      Benchmark::bench_cleanup(s);
+    }
+
+    virtual void report(std::ostream & rs, const BenchmarkSettings & s) const
+    {
+      rs << num_nodes;
+      Benchmark::report(rs, s);
+      rs << "\n";
+    }
+};
+
 class MerklePathExtraction : public Benchmark
 {
   protected:
@@ -259,6 +317,133 @@ class MerklePathVerification : public Benchmark
     }
 };
 
+class MerklePathRandomAccess : public Benchmark
+{
+  protected:
+    static const size_t num_lookups = 65536;
+    size_t num_nodes = 0;
+    merkle_tree *tree;
+    MerkleTree_Low_path *path;
+    uint8_t *root;
+    std::vector<uint64_t> indices;
+
+  public:
+    static std::string column_headers() { return "\"Nodes\"" + Benchmark::column_headers(); }
+
+    MerklePathRandomAccess(size_t num_nodes) : Benchmark(), num_nodes(num_nodes) { }
+
+    virtual ~MerklePathRandomAccess() {}
+
+    virtual void bench_setup(const BenchmarkSettings & s)
+    {
+      Benchmark::bench_setup(s);
+      uint8_t *ih = mt_init_hash(hash_size);
+      tree = mt_create(ih);
+      mt_free_hash(ih);
+
+      std::vector<uint8_t> leaves(num_nodes * hash_size, 0);
+      for (uint64_t i = 0; i < num_nodes; i++)
+        for (size_t j = 0; j < 8; j++)
+          leaves[i * hash_size + j] = rand() % 8;
+      mt_insert_batch(tree, num_nodes, leaves.data());
+
+      indices.resize(num_lookups);
+      for (size_t i = 0; i < num_lookups; i++)
+        indices[i] = (((uint64_t)rand() << 31) | rand()) % num_nodes;
+
+      path = mt_init_path(hash_size);
+      root = mt_init_hash(hash_size);
+      mt_get_root(tree, root);
+    }
+
+    virtual void bench_func()
+    {
+      for (size_t i = 0; i < num_lookups; i++)
+      {
+        MerkleTree_Low_clear_path(path);
+        #ifdef _DEBUG
+        if (!mt_get_path_pre(tree, indices[i], path, root))
+          throw std::logic_error("precondition violation");
+        #endif
+        mt_get_path(tree, indices[i], path, root);
+      }
+    }
+
+    virtual void bench_cleanup(const BenchmarkSettings & s)
+    {
+      mt_free_path(path);
+      mt_free_hash(root);
+      mt_free(tree);
+      Benchmark::bench_cleanup(s);
+    }
+
+    virtual void report(std::ostream & rs, const BenchmarkSettings & s) const
+    {
+      rs << num_nodes;
+      Benchmark::report(rs, s);
+      rs << "\n";
+    }
+};
+
+// Heap growth caused by building a tree of num_nodes leaves with mt_insert.
+class MerkleMemory : public Benchmark
+{
+  protected:
+    size_t num_nodes = 0;
+    merkle_tree *tree;
+    uint8_t *hash;
+    size_t heap_before = 0, heap_bytes = 0;
+
+    static size_t heap_in_use()
+    {
+      #if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+      struct mallinfo2 mi = mallinfo2();
+      return mi.uordblks + mi.hblkhd;
+      #else
+      return 0;
+      #endif
+    }
+
+  public:
+    static std::string column_headers() { return "\"Nodes\",\"Bytes\"" + Benchmark::column_headers(); }
+
+    MerkleMemory(size_t num_nodes) : Benchmark(), num_nodes(num_nodes) { }
+
+    virtual ~MerkleMemory() {}
+
+    virtual void bench_setup(const BenchmarkSettings & s)
+    {
+      Benchmark::bench_setup(s);
+      hash = mt_init_hash(hash_size);
+      heap_before = heap_in_use();
+      tree = mt_create(hash);
+    }
+
+    virtual void bench_func()
+    {
+      for (uint64_t i = 0; i < num_nodes; i++)
+      {
+        *(uint64_t*)hash = i;
+        mt_insert(tree, hash);
+      }
+    }
+
+    virtual void bench_cleanup(const BenchmarkSettings & s)
+    {
+      heap_bytes = heap_in_use() - heap_before;
+      mt_free(tree);
+      mt_free_hash(hash);
+      Benchmark::bench_cleanup(s);
+    }
+
+    virtual void report(std::ostream & rs, const BenchmarkSettings & s) const
+    {
+      rs << num_nodes << "," << heap_bytes;
+      Benchmark::report(rs, s);
+      rs << "\n";
+    }
+};
+
 void bench_merkle_insert(const BenchmarkSettings & s)
 {
   size_t data_sizes[] = { 1024, 2048, 4096, 8192, 16384, 32768, 65536, 131072, 262144, 524288, 1048576 };
@@ -303,6 +488,41 @@ void bench_merkle_insert(const BenchmarkSettings & s)
                   extras.str());
 }
 
+void bench_merkle_insert_batch(const BenchmarkSettings & s)
+{
+  size_t data_sizes[] = { 1024, 2048, 4096, 8192, 16384, 32768, 65536, 131072, 262144, 524288, 1048576 };
+  std::string data_filename = "bench_merkle_insert_batch.csv";
+
+  std::list<Benchmark*> todo;
+  for (size_t ds: data_sizes)
+    todo.push_back(new MerkleInsertBatch(ds));
+
+  Benchmark::run_batch(s, MerkleInsertBatch::column_headers(), data_filename, todo);
+
+  // Side by side with the mt_insert numbers written by bench_merkle_insert
+  std::string X = "((" + std::to_string(s.samples) + " * column('Nodes'))/(column('CPUexcl')/1000000000))";
+  std::string lbls = "sprintf(\"%dk\", column('Nodes')/1024)";
+  Benchmark::PlotSpec plot_specs_timed = {
+    std::make_pair("bench_merkle_insert.csv", "using " + X + ":xticlabels(" + lbls + ") title 'mt\\_insert'"),
+    std::make_pair(data_filename, "using " + X + ":xticlabels(" + lbls + ") title 'mt\\_insert\\_batch'"),
+  };
+
+  std::stringstream extras;
+  extras << "set key top left\n";
+  extras << "set style histogram clustered gap 3 title\n";
+  extras << "set style data histograms\n";
+  extras << "set bmargin 5\n";
+
+  Benchmark::make_plot(s,
+                  "svg",
+                  "Merkle tree insertion performance (single vs. batch)",
+                  "# tree nodes",
+                  "Avg. performance [insertion/sec]",
+                  plot_specs_timed,
+                  "bench_merkle_insert_batch_timed.svg",
+                  extras.str());
+}
+
 void bench_merkle_get_path(const BenchmarkSettings & s)
 {
   size_t data_sizes[] = { 1024, 2048, 4096, 8192, 16384, 32768, 65536, 131072, 262144, 524288, 1048576 };
@@ -347,6 +567,76 @@ void bench_merkle_get_path(const BenchmarkSettings & s)
                   extras.str());
 }
 
+void bench_merkle_get_path_random(const BenchmarkSettings & s)
+{
+  size_t data_sizes[] = { 65536, 262144, 1048576, 4194304 };
+  std::string data_filename = "bench_merkle_get_path_random.csv";
+
+  std::list<Benchmark*> todo;
+  for (size_t ds: data_sizes)
+    todo.push_back(new MerklePathRandomAccess(ds));
+
+  Benchmark::run_batch(s, MerklePathRandomAccess::column_headers(), data_filename, todo);
+
+  std::stringstream extras;
+  extras << "set boxwidth 0.8\n";
+  extras << "set key off\n";
+  extras << "set style histogram clustered gap 3 title\n";
+  extras << "set style data histograms\n";
+  extras << "set bmargin 5\n";
+
+  std::string X = "((" + std::to_string(s.samples) + " * 65536)/(column('CPUexcl')/1000000000))";
+  std::string lbls = "sprintf(\"%dk\", column('Nodes')/1024)";
+  Benchmark::PlotSpec plot_specs_timed = {
+    std::make_pair(data_filename, "using " + X + ":xticlabels(" + lbls + ") with boxes"),
+    std::make_pair("", "using 0:" + X + ":xticlabels(" + lbls + "):(sprintf(\"%0.0f\", " + X + ")) with labels font \"Courier,8\" offset char 0,.5 center notitle"),
+  };
+
+  Benchmark::make_plot(s,
+                  "svg",
+                  "Merkle tree path extraction performance (random leaves)",
+                  "# tree nodes",
+                  "Avg. performance [paths/sec]",
+                  plot_specs_timed,
+                  "bench_merkle_get_path_random_timed.svg",
+                  extras.str());
+}
+
+void bench_merkle_memory(const BenchmarkSettings & s)
+{
+  size_t data_sizes[] = { 1024, 4096, 16384, 65536, 262144, 1048576, 4194304 };
+  std::string data_filename = "bench_merkle_memory.csv";
+
+  std::list<Benchmark*> todo;
+  for (size_t ds: data_sizes)
+    todo.push_back(new MerkleMemory(ds));
+
+  Benchmark::run_batch(s, MerkleMemory::column_headers(), data_filename, todo);
+
+  std::stringstream extras;
+  extras << "set boxwidth 0.8\n";
+  extras << "set key off\n";
+  extras << "set style histogram clustered gap 3 title\n";
+  extras << "set style data histograms\n";
+  extras << "set bmargin 5\n";
+
+  std::string X = "(column('Bytes')/column('Nodes'))";
+  std::string lbls = "sprintf(\"%dk\", column('Nodes')/1024)";
+  Benchmark::PlotSpec plot_specs = {
+    std::make_pair(data_filename, "using " + X + ":xticlabels(" + lbls + ") with boxes"),
+    std::make_pair("", "using 0:" + X + ":xticlabels(" + lbls + "):(sprintf(\"%0.1f\", " + X + ")) with labels font \"Courier,8\" offset char 0,.5 center notitle"),
+  };
+
+  Benchmark::make_plot(s,
+                  "svg",
+                  "Merkle tree memory footprint",
+                  "# tree nodes",
+                  "Heap usage [bytes/leaf]",
+                  plot_specs,
+                  "bench_merkle_memory.svg",
+                  extras.str());
+}
+
 void bench_merkle_verify(const BenchmarkSettings & s)
 {
   size_t data_sizes[] = { 1024, 2048, 4096, 8192, 16384, 32768, 65536, 131072, 262144, 524288, 1048576 };
@@ -399,6 +689,9 @@ void bench_merkle(const BenchmarkSettings & s)
   s_local.warmup_samples = 0;
 
   bench_merkle_insert(s_local);
+  bench_merkle_insert_batch(s_local);
   bench_merkle_get_path(s_local);
+  bench_merkle_get_path_random(s_local);
   bench_merkle_verify(s_local);
+  bench_merkle_memory(s_local);
 }
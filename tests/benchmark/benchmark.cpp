@@ -19,7 +19,7 @@ void Benchmark::initialize()
 {
   srand(0);
 
-  Benchmark::set_runtime_config(1, 1, 1, 1, 1, 1, 1, 1, 1);
+  Benchmark::set_runtime_config(1, 1, 1, 1, 1, 1, 1, 1, 1, 1);
 
   have_gnuplot = false;
   #ifndef WIN32
@@ -70,6 +70,7 @@ std::string Benchmark::get_runtime_config()
   rs << " " << (EverCrypt_AutoConfig2_has_pclmulqdq() ? "+" : "-") << "PCLMULQDQ";
   rs << " " << (EverCrypt_AutoConfig2_has_avx() ? "+" : "-") << "AVX";
   rs << " " << (EverCrypt_AutoConfig2_has_avx2() ? "+" : "-") << "AVX2";
+  rs << " " << (EverCrypt_AutoConfig2_has_avx512() ? "+" : "-") << "AVX512";
   rs << " " << (EverCrypt_AutoConfig2_has_bmi2() ? "+" : "-") << "BMI2";
   rs << " " << (EverCrypt_AutoConfig2_has_adx() ? "+" : "-") << "ADX";
   rs << " " << (EverCrypt_AutoConfig2_wants_hacl() ? "+" : "-") << "HACL";
@@ -142,7 +143,7 @@ std::pair<std::string, std::string> & Benchmark::get_build_config(bool escaped)
   return escaped ? r_esc : r;
 }
 
-void Benchmark::set_runtime_config(int shaext, int aesni, int pclmulqdq, int avx, int avx2, int bmi2, int adx, int hacl, int vale)
+void Benchmark::set_runtime_config(int shaext, int aesni, int pclmulqdq, int avx, int avx2, int avx512, int bmi2, int adx, int hacl, int vale)
 {
   EverCrypt_AutoConfig2_init();
   if (shaext == 0) EverCrypt_AutoConfig2_disable_shaext();
@@ -150,6 +151,7 @@ void Benchmark::set_runtime_config(int shaext, int aesni, int pclmulqdq, int avx
   if (pclmulqdq == 0) EverCrypt_AutoConfig2_disable_pclmulqdq();
   if (avx == 0) EverCrypt_AutoConfig2_disable_avx();
   if (avx2 == 0) EverCrypt_AutoConfig2_disable_avx2();
+  if (avx512 == 0) EverCrypt_AutoConfig2_disable_avx512();
 
   // No way to disable these?
   // if (bmi2 == 0) EverCrypt_AutoConfig2_disable_bmi2();
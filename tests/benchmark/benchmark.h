@@ -71,7 +71,7 @@ class Benchmark
     // Global tools, just in here for the namespace
 
     static std::string get_runtime_config();
-    static void set_runtime_config(int shaext, int aesni, int pclmulqdq, int avx, int avx2, int bmi2, int adx, int hacl, int vale);
+    static void set_runtime_config(int shaext, int aesni, int pclmulqdq, int avx, int avx2, int avx512, int bmi2, int adx, int hacl, int vale);
     static std::pair<std::string, std::string> & get_build_config(bool escaped=false);
     static std::string get_cpu_string();
 
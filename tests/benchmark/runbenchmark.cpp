@@ -28,11 +28,15 @@ BenchmarkSettings & parse_args(int argc, char const ** argv)
       if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0 ||
           strcmp(argv[i], "-?") == 0 || strcmp(argv[i], "/?") == 0)
       {
-        std::cout << "Usage: " << argv[0] << " [-h] [--help] [-s seed] [-n samples] families ...\n";
+        std::cout << "Usage: " << argv[0] << " [-h] [--help] [-s seed] [-n samples] [--no-avx512] families ...\n";
         exit(1);
       }
       else if (strcmp(argv[i], "-s") == 0)
         r.seed = strtoul(argv[++i], NULL, 10);
+      else if (strcmp(argv[i], "--no-avx512") == 0)
+        // Keeps EverCrypt on its 256-bit code paths, e.g. to compare against
+        // a default run and see what the AVX-512 frequency licence costs.
+        Benchmark::set_runtime_config(1, 1, 1, 1, 1, 0, 1, 1, 1, 1);
       else if (strcmp(argv[i], "-n") == 0)
       {
         r.samples = strtoul(argv[++i], NULL, 10);
@@ -12,7 +12,9 @@
 #include "Hacl_Chacha20_Vec32.h"
 #include "Hacl_Chacha20_Vec128.h"
 #include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec512.h"
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Cipher.h"
 
 #include "test_helpers.h"
 #include "chacha20_vectors.h"
@@ -42,6 +44,79 @@ bool print_test(int in_len, uint8_t* in, uint8_t* key, uint8_t* nonce, uint8_t*
     printf("Chacha20 (256-bit) Result:\n");
     ok = ok && print_result(in_len,comp,exp);
   }
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    Hacl_Chacha20_Vec512_chacha20_encrypt_512(in_len,comp,in,key,nonce,1);
+    printf("Chacha20 (512-bit) Result:\n");
+    ok = ok && print_result(in_len,comp,exp);
+  }
+
+  EverCrypt_Cipher_chacha20(in_len,comp,in,key,nonce,1);
+  printf("Chacha20 (EverCrypt) Result:\n");
+  ok = ok && print_result(in_len,comp,exp);
+
+  // The same bytes through the keystream state, one odd-sized chunk at a time,
+  // then again backwards after seeking to each chunk
+  EverCrypt_Cipher_chacha20_state_s *st = EverCrypt_Cipher_chacha20_create_in(key,nonce,1);
+  memset(comp, 0, in_len * sizeof comp[0]);
+  for (int off = 0; off < in_len; off += 37) {
+    int n = in_len - off < 37 ? in_len - off : 37;
+    EverCrypt_Cipher_chacha20_update(st,n,comp+off,in+off);
+  }
+  printf("Chacha20 (EverCrypt, chunked) Result:\n");
+  ok = ok && print_result(in_len,comp,exp);
+  memset(comp, 0, in_len * sizeof comp[0]);
+  for (int off = (in_len - 1) / 37 * 37; off >= 0; off -= 37) {
+    int n = in_len - off < 37 ? in_len - off : 37;
+    EverCrypt_Cipher_chacha20_seek(st,off);
+    EverCrypt_Cipher_chacha20_update(st,n,comp+off,in+off);
+  }
+  printf("Chacha20 (EverCrypt, seek) Result:\n");
+  ok = ok && print_result(in_len,comp,exp);
+  EverCrypt_Cipher_chacha20_free(st);
+  return ok;
+}
+
+
+// The keystream state must stop at block 0xffffffff rather than wrap around
+// to block 0: check both sides of the end of the stream.
+bool print_test_counter_end() {
+  uint8_t key[32], nonce[12], in[128], exp[128], comp[128];
+  memset(key,'K',32);
+  memset(nonce,'N',12);
+  memset(in,'P',128);
+  EverCrypt_Cipher_chacha20(128,exp,in,key,nonce,0xfffffffeU);
+  bool ok = true;
+
+  // Two blocks left: 128 bytes can be processed, not one more
+  EverCrypt_Cipher_chacha20_state_s *st = EverCrypt_Cipher_chacha20_create_in(key,nonce,0xfffffffeU);
+  memset(comp, 0, 128);
+  ok = ok && EverCrypt_Cipher_chacha20_update(st,100,comp,in) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_Cipher_chacha20_update(st,29,comp+100,in+100) == EverCrypt_Error_MaximumLengthExceeded;
+  ok = ok && EverCrypt_Cipher_chacha20_pos(st) == 100 && comp[100] == 0;
+  ok = ok && EverCrypt_Cipher_chacha20_update(st,28,comp+100,in+100) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_Cipher_chacha20_update(st,1,comp,in) == EverCrypt_Error_MaximumLengthExceeded;
+  ok = ok && memcmp(comp,exp,128) == 0;
+  ok = ok && EverCrypt_Cipher_chacha20_seek(st,129) == EverCrypt_Error_MaximumLengthExceeded;
+  ok = ok && EverCrypt_Cipher_chacha20_pos(st) == 128;
+  ok = ok && EverCrypt_Cipher_chacha20_seek(st,128) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_Cipher_chacha20_seek(st,127) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_Cipher_chacha20_update(st,1,comp,in) == EverCrypt_Error_Success;
+  ok = ok && comp[0] == exp[127];
+  EverCrypt_Cipher_chacha20_free(st);
+
+  // From counter 0, the last block starts 2^38 - 64 bytes in
+  uint64_t end = (uint64_t)1 << 38;
+  st = EverCrypt_Cipher_chacha20_create_in(key,nonce,0);
+  ok = ok && EverCrypt_Cipher_chacha20_seek(st,end + 1) == EverCrypt_Error_MaximumLengthExceeded;
+  ok = ok && EverCrypt_Cipher_chacha20_seek(st,end) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_Cipher_chacha20_seek(st,end - 59) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_Cipher_chacha20_update(st,60,comp,in) == EverCrypt_Error_MaximumLengthExceeded;
+  ok = ok && EverCrypt_Cipher_chacha20_update(st,59,comp,in) == EverCrypt_Error_Success;
+  ok = ok && memcmp(comp,exp+64+5,59) == 0;
+  EverCrypt_Cipher_chacha20_free(st);
+
+  printf("Chacha20 (EverCrypt, end of stream) Result: %s\n", ok ? "Success!" : "**FAILED**");
   return ok;
 }
 
@@ -52,6 +127,7 @@ int main() {
   for (int i = 0; i < sizeof(vectors)/sizeof(chacha20_test_vector); ++i) {
     ok &= print_test(vectors[i].input_len,vectors[i].input,vectors[i].key,vectors[i].nonce,vectors[i].cipher);
   }
+  ok &= print_test_counter_end();
 
   uint64_t len = SIZE;
   uint8_t plain[SIZE];
@@ -118,12 +194,36 @@ int main() {
   double diff3 = t2 - t1;
   uint64_t cyc3 = b - a;
 
+
+  memset(plain,'P',SIZE);
+  memset(key,'K',16);
+  memset(nonce,'N',12);
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20_Vec512_chacha20_encrypt_512(SIZE,plain,plain,key,nonce,1);
+    }
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20_Vec512_chacha20_encrypt_512(SIZE,plain,plain,key,nonce,1);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  double diff4 = t2 - t1;
+  uint64_t cyc4 = b - a;
+
   uint64_t count = ROUNDS * SIZE;
   printf("32-bit Chacha20\n"); print_time(count,diff1,cyc1);
   printf("128-bit Chacha20\n"); print_time(count,diff2,cyc2);
   if (EverCrypt_AutoConfig2_has_avx2()) {
     printf("256-bit Chacha20\n"); print_time(count,diff3,cyc3);
   }
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    printf("512-bit Chacha20\n"); print_time(count,diff4,cyc4);
+  }
 
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
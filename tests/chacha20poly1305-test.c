@@ -12,7 +12,9 @@
 #include "Hacl_Chacha20Poly1305_32.h"
 #include "Hacl_Chacha20Poly1305_128.h"
 #include "Hacl_Chacha20Poly1305_256.h"
+#include "Hacl_Chacha20Poly1305_512.h"
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_AEAD.h"
 
 #include "test_helpers.h"
 #include "chacha20poly1305_vectors.h"
@@ -68,6 +70,138 @@ bool print_test(int in_len, uint8_t* in, uint8_t* key, uint8_t* nonce, int aad_l
     ok = ok && print_result(in_len,plaintext,in);
   }
 
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    Hacl_Chacha20Poly1305_512_aead_encrypt(key, nonce, aad_len, aad, in_len, in, ciphertext, mac);
+    printf("Chacha20Poly1305 (512-bit) Result (chacha20):\n");
+    ok = ok && print_result(in_len,ciphertext,exp_cipher);
+    printf("(poly1305):\n");
+    ok = ok && print_result(16,mac,exp_mac);
+
+    res = Hacl_Chacha20Poly1305_512_aead_decrypt(key, nonce, aad_len, aad, in_len, plaintext, exp_cipher, exp_mac);
+    if (res != 0) printf("AEAD Decrypt (Chacha20/Poly1305) failed \n.");
+    ok = ok && (res == 0);
+    ok = ok && print_result(in_len,plaintext,in);
+  }
+
+  return ok;
+}
+
+// Streams through EverCrypt_AEAD_Incremental in chunks of at most chunk bytes, then
+// decrypts in place with a one-byte first chunk
+bool incremental_roundtrip(EverCrypt_AEAD_state_s *s, uint8_t *nonce, uint32_t aad_len,
+  uint8_t *aad, uint32_t len, uint8_t *in, uint32_t chunk, uint8_t *exp_cipher, uint8_t *exp_mac) {
+  EverCrypt_AEAD_Incremental_state_s *p = NULL;
+  uint8_t cipher[len + 1];
+  uint8_t plaintext[len + 1];
+  uint8_t mac[16] = {0};
+  bool ok = EverCrypt_AEAD_Incremental_create_in(s, &p) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Incremental_init(p, nonce, 12) == EverCrypt_Error_Success;
+  for (uint32_t i = 0; ok && i < aad_len; i += chunk) {
+    uint32_t n = aad_len - i < chunk ? aad_len - i : chunk;
+    ok = EverCrypt_AEAD_Incremental_update_aad(p, aad + i, n) == EverCrypt_Error_Success;
+  }
+  for (uint32_t i = 0; ok && i < len; i += chunk) {
+    uint32_t n = len - i < chunk ? len - i : chunk;
+    ok = EverCrypt_AEAD_Incremental_encrypt_update(p, in + i, n, cipher + i) == EverCrypt_Error_Success;
+  }
+  ok = ok && EverCrypt_AEAD_Incremental_encrypt_finish(p, mac) == EverCrypt_Error_Success;
+  ok = ok && memcmp(cipher, exp_cipher, len) == 0 && memcmp(mac, exp_mac, 16) == 0;
+
+  memcpy(plaintext, cipher, len);
+  ok = ok && EverCrypt_AEAD_Incremental_init(p, nonce, 12) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Incremental_update_aad(p, aad, aad_len) == EverCrypt_Error_Success;
+  uint32_t n0 = len < 1 ? len : 1;
+  ok = ok && EverCrypt_AEAD_Incremental_decrypt_update(p, plaintext, n0, plaintext) == EverCrypt_Error_Success;
+  for (uint32_t i = n0; ok && i < len; i += chunk) {
+    uint32_t n = len - i < chunk ? len - i : chunk;
+    ok = EverCrypt_AEAD_Incremental_decrypt_update(p, plaintext + i, n, plaintext + i) == EverCrypt_Error_Success;
+  }
+  ok = ok && EverCrypt_AEAD_Incremental_decrypt_finish(p, mac) == EverCrypt_Error_Success;
+  ok = ok && memcmp(plaintext, in, len) == 0;
+
+  mac[0] ^= 1;
+  ok = ok && EverCrypt_AEAD_Incremental_init(p, nonce, 12) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Incremental_update_aad(p, aad, aad_len) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Incremental_decrypt_update(p, cipher, len, plaintext) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_Incremental_encrypt_finish(p, mac) == EverCrypt_Error_InvalidState;
+  ok = ok && EverCrypt_AEAD_Incremental_decrypt_finish(p, mac) == EverCrypt_Error_AuthenticationFailure;
+  ok = ok && EverCrypt_AEAD_Incremental_init(p, nonce, 8) == EverCrypt_Error_InvalidIVLength;
+  if (p != NULL)
+    EverCrypt_AEAD_Incremental_free(p);
+  return ok;
+}
+
+bool print_test_incremental(int in_len, uint8_t* in, uint8_t* key, uint8_t* nonce, int aad_len, uint8_t* aad, uint8_t* exp_mac, uint8_t* exp_cipher){
+  uint32_t chunks[] = { 1, 7, 16, 63, 64, 65, 4096 };
+  EverCrypt_AEAD_state_s *s = NULL;
+  bool ok = EverCrypt_AEAD_create_in(Spec_Agile_AEAD_CHACHA20_POLY1305, &s, key) == EverCrypt_Error_Success;
+  for (int i = 0; ok && i < sizeof(chunks)/sizeof(chunks[0]); ++i)
+    ok = incremental_roundtrip(s, nonce, aad_len, aad, in_len, in, chunks[i], exp_cipher, exp_mac);
+  if (s != NULL)
+    EverCrypt_AEAD_free(s);
+
+  // A longer message against the one-shot 32-bit implementation
+  uint32_t len = 5000;
+  uint8_t plain[len], cipher[len], mac[16];
+  for (uint32_t i = 0; i < len; ++i) plain[i] = i * 7 + 1;
+  Hacl_Chacha20Poly1305_32_aead_encrypt(key, nonce, aad_len, aad, len, plain, cipher, mac);
+  uint32_t long_chunks[] = { 1, 100, 1000, 5000 };
+  ok = ok && EverCrypt_AEAD_create_in(Spec_Agile_AEAD_CHACHA20_POLY1305, &s, key) == EverCrypt_Error_Success;
+  for (int i = 0; ok && i < sizeof(long_chunks)/sizeof(long_chunks[0]); ++i)
+    ok = incremental_roundtrip(s, nonce, aad_len, aad, len, plain, long_chunks[i], cipher, mac);
+  if (s != NULL)
+    EverCrypt_AEAD_free(s);
+
+  printf("Chacha20Poly1305 (EverCrypt incremental) Result: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// A forged tag must be rejected by every vector width, on both sides of the
+// 4096-byte chunks of the fused decrypt. In place the ciphertext must survive
+// the failure; with separate buffers the plaintext is zeroed.
+typedef uint32_t (*aead_decrypt_fn)(uint8_t*, uint8_t*, uint32_t, uint8_t*, uint32_t, uint8_t*, uint8_t*, uint8_t*);
+
+bool print_test_forgery(){
+  aead_decrypt_fn impls[] = {
+    Hacl_Chacha20Poly1305_128_aead_decrypt,
+    Hacl_Chacha20Poly1305_256_aead_decrypt,
+    Hacl_Chacha20Poly1305_512_aead_decrypt
+  };
+  bool avail[] = { true, EverCrypt_AutoConfig2_has_avx2(), EverCrypt_AutoConfig2_has_avx512() };
+  uint32_t lens[] = { 0, 1, 63, 4095, 4096, 4097, 10000 };
+  uint8_t key[32], nonce[12], aad[13], mac[16];
+  static uint8_t in[10000], cipher[10000], buf[10000];
+  memset(key,'K',32);
+  memset(nonce,'N',12);
+  memset(aad,'A',13);
+  for (int i = 0; i < sizeof(in); ++i)
+    in[i] = (uint8_t)(i * 7);
+  bool ok = true;
+
+  for (int l = 0; l < sizeof(lens)/sizeof(lens[0]); ++l) {
+    uint32_t len = lens[l];
+    Hacl_Chacha20Poly1305_32_aead_encrypt(key, nonce, 13, aad, len, in, cipher, mac);
+    for (int j = 0; j < sizeof(impls)/sizeof(impls[0]); ++j) {
+      if (!avail[j])
+        continue;
+      memcpy(buf, cipher, len);
+      ok = ok && impls[j](key, nonce, 13, aad, len, buf, buf, mac) == 0;
+      ok = ok && memcmp(buf, in, len) == 0;
+
+      mac[15] ^= 1;
+      memcpy(buf, cipher, len);
+      ok = ok && impls[j](key, nonce, 13, aad, len, buf, buf, mac) == 1;
+      ok = ok && memcmp(buf, cipher, len) == 0;
+      memset(buf, 0xff, len);
+      ok = ok && impls[j](key, nonce, 13, aad, len, buf, cipher, mac) == 1;
+      for (uint32_t i = 0; i < len; ++i)
+        ok = ok && buf[i] == 0;
+      mac[15] ^= 1;
+    }
+  }
+
+  printf("Chacha20Poly1305 (forged tag) Result: %s\n", ok ? "Success!" : "**FAILED**");
   return ok;
 }
 
@@ -78,6 +212,19 @@ int main(){
   for (int i = 0; i < sizeof(vectors)/sizeof(chacha20poly1305_test_vector); ++i) {
     ok &= print_test(vectors[i].input_len,vectors[i].input,vectors[i].key,vectors[i].nonce,vectors[i].aad_len,vectors[i].aad,vectors[i].tag,vectors[i].cipher);
   }
+  ok &= print_test_forgery();
+  // The incremental API at every Poly1305 and ChaCha20 vector width
+  EverCrypt_AutoConfig2_disabler disablers[] = {
+    EverCrypt_AutoConfig2_disable_avx512, EverCrypt_AutoConfig2_disable_avx2, EverCrypt_AutoConfig2_disable_avx
+  };
+  for (int d = 0; d <= sizeof(disablers)/sizeof(disablers[0]); ++d) {
+    for (int i = 0; i < sizeof(vectors)/sizeof(chacha20poly1305_test_vector); ++i) {
+      ok &= print_test_incremental(vectors[i].input_len,vectors[i].input,vectors[i].key,vectors[i].nonce,vectors[i].aad_len,vectors[i].aad,vectors[i].tag,vectors[i].cipher);
+    }
+    if (d < sizeof(disablers)/sizeof(disablers[0]))
+      disablers[d]();
+  }
+  EverCrypt_AutoConfig2_init();
 
   uint8_t plain[SIZE];
   uint8_t cipher[SIZE];
@@ -147,6 +294,26 @@ int main(){
   cycles cdiff3 = b - a;
 
 
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    memset(plain,'P',SIZE);
+    memset(aead_key,'K',32);
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_512_aead_encrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+    }
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_512_aead_encrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+      res ^= tag[0] ^ tag[15];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  clock_t tdiff7 = t2 - t1;
+  cycles cdiff7 = b - a;
+
+
   int res1 = 0;
   for (int j = 0; j < ROUNDS; j++) {
     res1 = Hacl_Chacha20Poly1305_32_aead_decrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
@@ -205,6 +372,27 @@ int main(){
   clock_t tdiff6 = t2 - t1;
   cycles cdiff6 = b - a;
 
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    res1 = 0;
+    for (int j = 0; j < ROUNDS; j++) {
+      res1 = Hacl_Chacha20Poly1305_512_aead_decrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+      res1 ^= res1;
+    }
+
+    res1 = 0;
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_512_aead_decrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+      res1 ^= res1;
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  clock_t tdiff8 = t2 - t1;
+  cycles cdiff8 = b - a;
+
   // JP: I don't understand what this does since this variable is almost always
   // zeroed-out.
   printf ("\n res1: %i \n", res1);
@@ -216,11 +404,17 @@ int main(){
   if (EverCrypt_AutoConfig2_has_avx2()) {
     printf("Chacha20Poly1305 Encrypt (256-bit) PERF:\n"); print_time(count,tdiff3,cdiff3);
   }
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    printf("Chacha20Poly1305 Encrypt (512-bit) PERF:\n"); print_time(count,tdiff7,cdiff7);
+  }
   printf("Chacha20Poly1305 Decrypt (32-bit) PERF:\n");  print_time(count,tdiff4,cdiff4);
   printf("Chacha20Poly1305 Decrypt (128-bit) PERF:\n"); print_time(count,tdiff5,cdiff5);
   if (EverCrypt_AutoConfig2_has_avx2()) {
     printf("Chacha20Poly1305 Decrypt (256-bit) PERF:\n"); print_time(count,tdiff6,cdiff6);
   }
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    printf("Chacha20Poly1305 Decrypt (512-bit) PERF:\n"); print_time(count,tdiff8,cdiff8);
+  }
 
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
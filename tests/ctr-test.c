@@ -0,0 +1,155 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_CTR.h"
+
+#include "test_helpers.h"
+
+// EverCrypt_CTR_update must produce the keystream of successive update_block
+// calls, whatever the chunking. The AES IV ends close to 0xffffffff, so that
+// the low 32 bits of the counter block wrap around within the message.
+
+#define N_BLOCKS 40U
+
+static uint8_t key[32U];
+static uint8_t iv[16U];
+static uint8_t src[N_BLOCKS * 64U];
+static uint8_t expected[N_BLOCKS * 64U];
+
+static uint32_t rng_state = 1U;
+
+static uint32_t next_rand(void) {
+  rng_state = rng_state * 1103515245U + 12345U;
+  return rng_state >> 8;
+}
+
+static const char *name_of_alg(Spec_Agile_Cipher_cipher_alg a) {
+  switch (a) {
+    case Spec_Agile_Cipher_AES128: return "AES128";
+    case Spec_Agile_Cipher_AES256: return "AES256";
+    default: return "CHACHA20";
+  }
+}
+
+// update_block only advances the counter for AES; for ChaCha20 it encrypts
+// with the current counter and leaves it alone.
+static uint32_t block_step(Spec_Agile_Cipher_cipher_alg a) {
+  return a == Spec_Agile_Cipher_CHACHA20 ? 0U : 1U;
+}
+
+// The keystream blocks c0, c0 + 1, ... applied to src, one update_block at a
+// time.
+static void reference(EverCrypt_CTR_state_s *p, uint32_t iv_len, uint32_t block_len,
+  uint32_t c0, uint32_t n, uint8_t *dst)
+{
+  for (uint32_t b = 0; b < n; b++) {
+    EverCrypt_CTR_init(p, key, iv, iv_len, c0 + b);
+    EverCrypt_CTR_update_block(p, dst + b * block_len, src + b * block_len);
+  }
+}
+
+// Runs update over len bytes in random chunks, from src into dst, which may be
+// the same buffer.
+static bool update_chunked(EverCrypt_CTR_state_s *p, uint32_t block_len,
+  uint8_t *dst, uint8_t *in, uint32_t len)
+{
+  bool ok = true;
+  uint32_t off = 0;
+  while (off < len) {
+    uint32_t n = next_rand() % (3U * block_len + 1U);
+    if (n > len - off)
+      n = len - off;
+    ok &= EverCrypt_CTR_update(p, dst + off, in + off, n) == EverCrypt_Error_Success;
+    off += n;
+  }
+  return ok;
+}
+
+static bool test_alg(Spec_Agile_Cipher_cipher_alg a) {
+  uint32_t block_len = a == Spec_Agile_Cipher_CHACHA20 ? 64U : 16U;
+  uint32_t iv_len = a == Spec_Agile_Cipher_CHACHA20 ? 12U : 16U;
+  uint32_t c0 = 5U;
+  uint32_t len = N_BLOCKS * block_len - 7U;
+  uint8_t computed[N_BLOCKS * 64U];
+  bool ok = true;
+
+  EverCrypt_CTR_state_s *p = NULL;
+  if (EverCrypt_CTR_create_in(a, &p, key, iv, iv_len, c0) != EverCrypt_Error_Success) {
+    printf("%s: not supported on this machine, skipping\n", name_of_alg(a));
+    return true;
+  }
+  reference(p, iv_len, block_len, c0, N_BLOCKS, expected);
+
+  for (int round = 0; round < 8; round++) {
+    EverCrypt_CTR_init(p, key, iv, iv_len, c0);
+    memset(computed, 0, sizeof computed);
+    ok &= update_chunked(p, block_len, computed, src, len);
+    printf("%s, random chunking %d:\n", name_of_alg(a), round);
+    ok &= compare_and_print(len, computed, expected);
+  }
+
+  EverCrypt_CTR_init(p, key, iv, iv_len, c0);
+  memcpy(computed, src, len);
+  ok &= update_chunked(p, block_len, computed, computed, len);
+  printf("%s, in place:\n", name_of_alg(a));
+  ok &= compare_and_print(len, computed, expected);
+
+  // update_block drops the keystream left over by update: a following update
+  // starts on a block boundary.
+  EverCrypt_CTR_init(p, key, iv, iv_len, c0);
+  ok &= EverCrypt_CTR_update(p, computed, src, 10U) == EverCrypt_Error_Success;
+  EverCrypt_CTR_update_block(p, computed + block_len, src + block_len);
+  uint32_t b = 1U + block_step(a);
+  ok &= EverCrypt_CTR_update(p, computed + b * block_len, src + b * block_len, block_len)
+    == EverCrypt_Error_Success;
+  printf("%s, update after update_block:\n", name_of_alg(a));
+  ok &= compare_and_print(10U, computed, expected);
+  ok &= compare_and_print(block_len, computed + block_len, expected + block_len);
+  ok &= compare_and_print(block_len, computed + b * block_len, expected + b * block_len);
+
+  // The counter of the state stops short of wrapping around.
+  uint32_t c1 = 0xfffffffdU;
+  reference(p, iv_len, block_len, c1, 2U, expected);
+  EverCrypt_CTR_init(p, key, iv, iv_len, c1);
+  ok &= EverCrypt_CTR_update(p, computed, src, block_len + 3U) == EverCrypt_Error_Success;
+  ok &= EverCrypt_CTR_update(p, computed + block_len + 3U, src + block_len + 3U,
+    block_len - 3U) == EverCrypt_Error_Success;
+  uint8_t sentinel = computed[2U * block_len] = 0xa5U;
+  ok &= EverCrypt_CTR_update(p, computed + 2U * block_len, src + 2U * block_len, 1U)
+    == EverCrypt_Error_MaximumLengthExceeded;
+  ok &= computed[2U * block_len] == sentinel;
+  EverCrypt_CTR_init(p, key, iv, iv_len, c1);
+  ok &= EverCrypt_CTR_update(p, computed, src, 3U * block_len)
+    == EverCrypt_Error_MaximumLengthExceeded;
+  ok &= EverCrypt_CTR_update(p, computed, src, 2U * block_len) == EverCrypt_Error_Success;
+  printf("%s, up to the last counter:\n", name_of_alg(a));
+  ok &= compare_and_print(2U * block_len, computed, expected);
+
+  EverCrypt_CTR_free(p);
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  for (uint32_t i = 0; i < sizeof key; i++)
+    key[i] = (uint8_t)(3U * i + 1U);
+  for (uint32_t i = 0; i < 12U; i++)
+    iv[i] = (uint8_t)(7U * i);
+  iv[12U] = 0xffU;
+  iv[13U] = 0xffU;
+  iv[14U] = 0xffU;
+  iv[15U] = 0xf0U;
+  for (uint32_t i = 0; i < sizeof src; i++)
+    src[i] = (uint8_t)next_rand();
+
+  bool ok = true;
+  ok &= test_alg(Spec_Agile_Cipher_AES128);
+  ok &= test_alg(Spec_Agile_Cipher_AES256);
+  ok &= test_alg(Spec_Agile_Cipher_CHACHA20);
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,132 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "EverCrypt_DRBG.h"
+
+#include "test_helpers.h"
+
+// This test replaces the system entropy source so that it can count how
+// often the DRBG reseeds and make two generators produce the same stream.
+// Since the test object comes first on the link line, this definition wins
+// over the one in libevercrypt.a.
+
+static uint32_t entropy_calls = 0;
+static uint8_t entropy_next = 0;
+
+bool Lib_RandomBuffer_System_randombytes(uint8_t *x, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++)
+    x[i] = entropy_next++;
+  entropy_calls++;
+  return true;
+}
+
+static void reset_entropy(void) {
+  entropy_calls = 0;
+  entropy_next = 0;
+}
+
+// Serves [reqs] requests of [len] bytes and returns the number of reseeds.
+// Every request must write fresh output.
+static uint32_t count_reseeds(EverCrypt_DRBG_reseed_policy policy, uint32_t n,
+  uint32_t reqs, uint32_t len, bool *ok)
+{
+  reset_entropy();
+  EverCrypt_DRBG_state_s *st = EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256);
+  *ok &= EverCrypt_DRBG_instantiate(st, NULL, 0);
+  EverCrypt_DRBG_set_reseed_policy(st, policy, n);
+  uint32_t calls0 = entropy_calls;
+  uint8_t out[len];
+  uint8_t prev[len];
+  memset(prev, 0, len);
+  for (uint32_t i = 0; i < reqs; i++) {
+    memset(out, 0, len);
+    *ok &= EverCrypt_DRBG_generate(out, st, len, NULL, 0);
+    *ok &= memcmp(out, prev, len) != 0;
+    memcpy(prev, out, len);
+  }
+  EverCrypt_DRBG_uninstantiate(st);
+  return entropy_calls - calls0;
+}
+
+static bool print_test_reseed(const char *name, EverCrypt_DRBG_reseed_policy policy,
+  uint32_t n, uint32_t reqs, uint32_t len, uint32_t expected)
+{
+  bool ok = true;
+  uint32_t got = count_reseeds(policy, n, reqs, len, &ok);
+  printf("%s: %" PRIu32 " reseeds for %" PRIu32 " requests (expected %" PRIu32 ")\n",
+    name, got, reqs, expected);
+  ok &= got == expected;
+  if (ok)
+    printf("Success!\n");
+  else
+    printf("**FAILED**\n");
+  return ok;
+}
+
+// Requests served by a buffered generator are slices of the blocks that a
+// plain generator fed with the same entropy produces.
+static bool print_test_buffered(void)
+{
+  const uint32_t buf_len = 256;
+  uint32_t sizes[] = { 16, 16, 32, 64, 100, 16, 250, 300, 1, 255, 256, 7 };
+  uint32_t nreqs = sizeof(sizes) / sizeof(sizes[0]);
+  uint8_t computed[2048];
+  uint8_t expected[2048];
+  bool ok = true;
+
+  reset_entropy();
+  EverCrypt_DRBG_buffered_s *b =
+    EverCrypt_DRBG_buffered_create(Spec_Hash_Definitions_SHA2_256, buf_len, NULL, 0);
+  ok &= b != NULL;
+  if (b == NULL)
+    return false;
+  uint32_t off = 0;
+  for (uint32_t i = 0; i < nreqs; i++) {
+    ok &= EverCrypt_DRBG_buffered_generate(computed + off, b, sizes[i]);
+    off += sizes[i];
+  }
+  EverCrypt_DRBG_buffered_free(b);
+
+  reset_entropy();
+  EverCrypt_DRBG_state_s *st = EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256);
+  ok &= EverCrypt_DRBG_instantiate(st, NULL, 0);
+  uint8_t block[buf_len];
+  uint32_t avail = 0;
+  off = 0;
+  for (uint32_t i = 0; i < nreqs; i++) {
+    uint32_t n = sizes[i];
+    if (n > avail) {
+      if (n >= buf_len) {
+        ok &= EverCrypt_DRBG_generate(expected + off, st, n, NULL, 0);
+        off += n;
+        continue;
+      }
+      ok &= EverCrypt_DRBG_generate(block, st, buf_len, NULL, 0);
+      avail = buf_len;
+    }
+    memcpy(expected + off, block + buf_len - avail, n);
+    avail -= n;
+    off += n;
+  }
+  EverCrypt_DRBG_uninstantiate(st);
+
+  printf("buffered generator (%" PRIu32 " bytes):\n", off);
+  ok &= compare_and_print(off, computed, expected);
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  ok &= print_test_reseed("every call", EverCrypt_DRBG_Reseed_every_call, 0, 10, 16, 10);
+  ok &= print_test_reseed("every 4 requests", EverCrypt_DRBG_Reseed_every_requests, 4, 12, 16, 2);
+  ok &= print_test_reseed("every 64 bytes", EverCrypt_DRBG_Reseed_every_bytes, 64, 12, 16, 2);
+  ok &= print_test_reseed("every 60 bytes", EverCrypt_DRBG_Reseed_every_bytes, 60, 12, 16, 3);
+  ok &= print_test_reseed("reseed interval", EverCrypt_DRBG_Reseed_every_requests, 0xffffffffU,
+    2100, 16, 2);
+  ok &= print_test_buffered();
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
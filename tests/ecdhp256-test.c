@@ -26,6 +26,48 @@ static uint8_t point_compressed[64] = {
 	0x44, 0x17, 0x82, 0xca, 0xb8, 0x5f, 0xa4, 0xac 
 };
 
+static uint8_t order[32] = {
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xbc, 0xe6, 0xfa, 0xad, 0xa7, 0x17, 0x9e, 0x84,
+	0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x51
+};
+
+// Scalars are not required to be below the group order: [n + t]G = [t]G.
+static bool test_scalar_above_order(uint32_t count)
+{
+	uint8_t t[32];
+	uint8_t nt[32];
+	uint8_t r0[64];
+	uint8_t r1[64];
+	uint32_t mismatches = 0;
+
+	for (uint32_t v = 1; v <= count; v++)
+	{
+		memset(t, 0, 32);
+		t[30] = (uint8_t)(v >> 8);
+		t[31] = (uint8_t)v;
+		uint32_t carry = 0;
+		for (int i = 31; i >= 0; i--)
+		{
+			uint32_t s = (uint32_t)order[i] + t[i] + carry;
+			nt[i] = (uint8_t)s;
+			carry = s >> 8;
+		}
+		uint64_t f0 = Hacl_P256_ecp256dh_i(r0, t);
+		uint64_t f1 = Hacl_P256_ecp256dh_i(r1, nt);
+		if (f0 != 0 || f1 != 0 || memcmp(r0, r1, 64) != 0)
+			mismatches++;
+	}
+	printf("ECDH Initiator with scalars n + 1 .. n + %" PRIu32 ": %" PRIu32 " mismatches\n",
+		count, mismatches);
+	if (mismatches == 0)
+		printf("Success!\n");
+	else
+		printf("**FAILED**\n");
+	return mismatches == 0;
+}
+
 
 int main()
 {
@@ -42,6 +84,8 @@ int main()
 	}
 
 	
+	ok = ok && test_scalar_above_order(4999);
+
 	uint8_t* pk = (uint8_t*) malloc (sizeof (uint8_t) * 64);
 	
 	for (int i = 0 ; i< sizeof(i_vectors)/sizeof(ecdhp256_tv_i); i++)
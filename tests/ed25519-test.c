@@ -0,0 +1,168 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "Hacl_Ed25519.h"
+
+#include "test_helpers.h"
+#include "ed25519_vectors.h"
+
+#define ROUNDS 10000
+#define SIZE   1
+
+bool print_result(int in_len, uint8_t* comp, uint8_t* exp) {
+  return compare_and_print(in_len, comp, exp);
+}
+
+bool print_test(ed25519_test_vector *v){
+  uint8_t pub[32] = {0};
+  uint8_t sig[64] = {0};
+
+  Hacl_Ed25519_secret_to_public(pub, v->secret);
+  printf("Ed25519 secret_to_public Result:\n");
+  bool ok = print_result(32, pub, v->public);
+
+  Hacl_Ed25519_sign(sig, v->secret, v->msg_len, v->msg);
+  printf("Ed25519 sign Result:\n");
+  ok = print_result(64, sig, v->signature) && ok;
+
+  bool verified = Hacl_Ed25519_verify(v->public, v->msg_len, v->msg, v->signature);
+  printf("Ed25519 verify Result: %s\n", verified ? "Success!" : "**FAILED**");
+  ok = ok && verified;
+
+  return ok;
+}
+
+#define NVECTORS (sizeof(vectors)/sizeof(ed25519_test_vector))
+
+bool print_test_batch(){
+  uint8_t *pubs[NVECTORS + 1];
+  uint32_t lens[NVECTORS + 1];
+  uint8_t *msgs[NVECTORS + 1];
+  uint8_t *sigs[NVECTORS + 1];
+  bool res[NVECTORS + 1];
+  uint8_t bad_sig[64];
+
+  for (int i = 0; i < NVECTORS; ++i) {
+    pubs[i] = vectors[i].public;
+    lens[i] = vectors[i].msg_len;
+    msgs[i] = vectors[i].msg;
+    sigs[i] = vectors[i].signature;
+  }
+
+  bool all = Hacl_Ed25519_verify_batch(NVECTORS, pubs, lens, msgs, sigs, res);
+  bool ok = all;
+  for (int i = 0; i < NVECTORS; ++i)
+    ok = ok && res[i];
+
+  // Append a copy of the last vector with a corrupted s: only that entry fails
+  memcpy(bad_sig, vectors[NVECTORS - 1].signature, 64);
+  bad_sig[40] ^= 1;
+  pubs[NVECTORS] = vectors[NVECTORS - 1].public;
+  lens[NVECTORS] = vectors[NVECTORS - 1].msg_len;
+  msgs[NVECTORS] = vectors[NVECTORS - 1].msg;
+  sigs[NVECTORS] = bad_sig;
+  all = Hacl_Ed25519_verify_batch(NVECTORS + 1, pubs, lens, msgs, sigs, res);
+  ok = ok && !all && !res[NVECTORS];
+  for (int i = 0; i < NVECTORS; ++i)
+    ok = ok && res[i];
+
+  printf("Ed25519 verify_batch Result: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// A = (0, -1) has order 2, R is the identity and s = 0: the cofactored
+// equation holds for every message, the cofactorless one only when h is even.
+// The batch must judge such a signature the same way whatever it is batched with.
+bool print_test_batch_small_order(){
+  uint8_t small_pub[32] = {0};
+  uint8_t small_sig[64] = {0};
+  uint8_t msg[1] = {0};
+  small_pub[0] = 0xec;
+  memset(small_pub + 1, 0xff, 30);
+  small_pub[31] = 0x7f;
+  small_sig[0] = 1;
+  while (Hacl_Ed25519_verify(small_pub, 1, msg, small_sig))
+    msg[0]++;
+
+  uint8_t bad_sig[64];
+  memcpy(bad_sig, vectors[0].signature, 64);
+  bad_sig[40] ^= 1;
+  uint8_t *pubs[3] = { small_pub, vectors[0].public, vectors[0].public };
+  uint32_t lens[3] = { 1, vectors[0].msg_len, vectors[0].msg_len };
+  uint8_t *msgs[3] = { msg, vectors[0].msg, vectors[0].msg };
+  uint8_t *sigs[3] = { small_sig, vectors[0].signature, bad_sig };
+  bool res[3];
+
+  bool ok = Hacl_Ed25519_verify_batch(1, pubs, lens, msgs, sigs, res) && res[0];
+  ok = ok && Hacl_Ed25519_verify_batch(2, pubs, lens, msgs, sigs, res) && res[0] && res[1];
+  ok = ok && !Hacl_Ed25519_verify_batch(3, pubs, lens, msgs, sigs, res) && res[0] && res[1] && !res[2];
+  printf("Ed25519 verify_batch (small order) Result: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  for (int i = 0; i < NVECTORS; ++i) {
+    ok &= print_test(&vectors[i]);
+  }
+  ok &= print_test_batch();
+  ok &= print_test_batch_small_order();
+
+  uint8_t pub[32], priv[32], sig[64];
+  uint8_t msg[32];
+  uint64_t res = 0;
+  cycles a,b;
+  clock_t t1,t2;
+
+  memset(priv,'S',32);
+  memset(msg,'M',32);
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Ed25519_secret_to_public(pub,priv);
+    res ^= pub[0] ^ pub[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff1 = t2 - t1;
+  cycles cdiff1 = b - a;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Ed25519_sign(sig,priv,32,msg);
+    res ^= sig[0] ^ sig[15];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff2 = t2 - t1;
+  cycles cdiff2 = b - a;
+
+  Hacl_Ed25519_secret_to_public(pub,priv);
+  Hacl_Ed25519_sign(sig,priv,32,msg);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    ok &= Hacl_Ed25519_verify(pub,32,msg,sig);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  clock_t tdiff3 = t2 - t1;
+  cycles cdiff3 = b - a;
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("Ed25519 secret_to_public PERF:\n"); print_time(count,tdiff1,cdiff1);
+  printf("keygen %8.2f ops/s\n",((double)ROUNDS) / (((double)tdiff1) / CLOCKS_PER_SEC));
+  printf("Ed25519 sign PERF:\n"); print_time(count,tdiff2,cdiff2);
+  printf("sign %8.2f ops/s\n",((double)ROUNDS) / (((double)tdiff2) / CLOCKS_PER_SEC));
+  printf("Ed25519 verify PERF:\n"); print_time(count,tdiff3,cdiff3);
+  printf("verify %8.2f ops/s\n",((double)ROUNDS) / (((double)tdiff3) / CLOCKS_PER_SEC));
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
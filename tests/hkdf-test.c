@@ -0,0 +1,84 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "EverCrypt_HMAC.h"
+#include "EverCrypt_HKDF.h"
+
+#include "test_helpers.h"
+#include "hkdf_vectors.h"
+
+bool print_test_hmac(hmac_test_vector *v) {
+  uint32_t tag_len = Hacl_Hash_Definitions_hash_len(v->alg);
+  uint8_t comp[64] = {0};
+  bool ok = true;
+
+  EverCrypt_HMAC_compute(v->alg, comp, v->key, v->key_len, v->data, v->data_len);
+  printf("HMAC:\n");
+  ok &= compare_and_print(tag_len, comp, v->tag);
+
+  // A keyed state is reusable: compute the same MAC twice from it.
+  EverCrypt_HMAC_state_s st;
+  EverCrypt_HMAC_init(&st, v->alg, v->key, v->key_len);
+  for (int i = 0; i < 2; i++) {
+    memset(comp, 0, 64);
+    EverCrypt_HMAC_compute_keyed(&st, comp, v->data, v->data_len);
+    printf("HMAC keyed (init):\n");
+    ok &= compare_and_print(tag_len, comp, v->tag);
+  }
+
+  EverCrypt_HMAC_state_s *s = NULL;
+  ok &= EverCrypt_HMAC_create_in(v->alg, &s, v->key, v->key_len) == EverCrypt_Error_Success;
+  memset(comp, 0, 64);
+  EverCrypt_HMAC_compute_keyed(s, comp, v->data, v->data_len);
+  printf("HMAC keyed (create_in):\n");
+  ok &= compare_and_print(tag_len, comp, v->tag);
+  EverCrypt_HMAC_free(s);
+  return ok;
+}
+
+bool print_test_hkdf(hkdf_test_vector *v) {
+  uint32_t prk_len = Hacl_Hash_Definitions_hash_len(v->alg);
+  uint8_t prk[64] = {0};
+  uint8_t okm[v->okm_len];
+  bool ok = true;
+
+  EverCrypt_HKDF_extract(v->alg, prk, v->salt, v->salt_len, v->ikm, v->ikm_len);
+  printf("HKDF extract:\n");
+  ok &= compare_and_print(prk_len, prk, v->prk);
+
+  memset(okm, 0, v->okm_len);
+  EverCrypt_HKDF_expand(v->alg, okm, v->prk, prk_len, v->info, v->info_len, v->okm_len);
+  printf("HKDF expand:\n");
+  ok &= compare_and_print(v->okm_len, okm, v->okm);
+
+  EverCrypt_HMAC_state_s st;
+  EverCrypt_HMAC_init(&st, v->alg, v->prk, prk_len);
+  memset(okm, 0, v->okm_len);
+  EverCrypt_HKDF_expand_keyed(&st, okm, v->info, v->info_len, v->okm_len);
+  printf("HKDF expand keyed:\n");
+  ok &= compare_and_print(v->okm_len, okm, v->okm);
+
+  // Shorter outputs are prefixes of the full OKM, including when the
+  // length is not a multiple of the hash length.
+  uint32_t short_len = prk_len + 3;
+  memset(okm, 0, v->okm_len);
+  EverCrypt_HKDF_expand_keyed(&st, okm, v->info, v->info_len, short_len);
+  printf("HKDF expand keyed (%" PRIu32 " bytes):\n", short_len);
+  ok &= compare_and_print(short_len, okm, v->okm);
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  for (int i = 0; i < sizeof(hmac_vectors)/sizeof(hmac_test_vector); ++i) {
+    ok &= print_test_hmac(&hmac_vectors[i]);
+  }
+  for (int i = 0; i < sizeof(hkdf_vectors)/sizeof(hkdf_test_vector); ++i) {
+    ok &= print_test_hkdf(&hkdf_vectors[i]);
+  }
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
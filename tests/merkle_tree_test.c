@@ -2,6 +2,11 @@
 #include <stdint.h>
 #include <assert.h>
 
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <pthread.h>
+#endif
+
 #include "EverCrypt_AutoConfig2.h"
 #include "MerkleTree.h"
 #include "merkle_tree_test.h"
@@ -23,15 +28,59 @@ void print_hash(const char *name, const uint8_t *h) {
 
 void print_tree(const mt_p mt, size_t num_elts) {
   printf("Tree:\n");
-  for (size_t lv = 0; lv < num_elts; lv++) {
+  for (size_t lv = 0; lv < num_elts && lv < mt->hs.sz; lv++) {
     printf("%02lu:", lv);
     uint32_t lvsz = mt->hs.vs[lv].sz;
     for (size_t i = 0; i < lvsz; i++)
-      printf(" %lu=%s", i, hash_to_string(mt->hs.vs[lv].vs[i]));
+      printf(" %lu=%s", i, hash_to_string(mt->hs.vs[lv].vs + i * hash_size));
     printf("\n");
   }
 }
 
+#if !defined(_WIN32)
+typedef struct {
+  MerkleTree_Low_Snapshot_publisher *pub;
+  bool *stop;
+  uint64_t paths;
+  bool ok;
+} snapshot_reader;
+
+// Repeatedly acquires the current snapshot of a tree whose leaf k ends with
+// the byte k, and checks one of its paths, until told to stop. Paths are
+// verified against a private tree, since mt_verify reads the tree it is given
+// while the writer modifies the published one.
+static void *snapshot_reader_run(void *arg) {
+  snapshot_reader *r = (snapshot_reader *)arg;
+  uint8_t *ih = mt_init_hash(hash_size);
+  mt_p mtv = mt_create(ih);
+  uint8_t *rt = mt_init_hash(hash_size);
+  uint8_t *leaf = mt_init_hash(hash_size);
+  uint64_t n = 0;
+  while (!__atomic_load_n(r->stop, __ATOMIC_SEQ_CST)) {
+    const MerkleTree_Low_Snapshot_snapshot *snap = mt_snapshot_acquire(r->pub);
+    uint64_t j = mt_snapshot_size(snap);
+    uint64_t k = (n * 7919) % j;
+    MerkleTree_Low_path *path = mt_init_path(hash_size);
+    mt_get_path_at(snap, k, path, rt);
+    mt_snapshot_release(snap);
+    leaf[hash_size-1] = (uint8_t)k;
+    if (memcmp(leaf, mt_get_path_step(path, 0), hash_size) != 0
+        || !mt_verify(mtv, k, j, path, rt)) {
+      printf("ERROR: Concurrent snapshot path does not verify with k(%ld), j(%ld)\n", k, j);
+      r->ok = false;
+    }
+    mt_free_path(path);
+    n++;
+  }
+  r->paths = n;
+  mt_free_hash(leaf);
+  mt_free_hash(rt);
+  mt_free(mtv);
+  mt_free_hash(ih);
+  return NULL;
+}
+#endif
+
 int main(int argc, char *argv[]) {
 
   uint64_t num_elts = 1;
@@ -66,6 +115,474 @@ int main(int argc, char *argv[]) {
 
   printf("All values are inserted!\n");
 
+  {
+    printf("Testing batch insertion...\n");
+    uint8_t *ih = mt_init_hash(hash_size);
+    mt_p mtb = mt_create(ih);
+    mt_free_hash(ih);
+
+    uint8_t *leaves = calloc(num_elts, hash_size);
+    for (size_t i = 1; i < num_elts; i++)
+      leaves[(i - 1) * hash_size + hash_size - 1] = (uint8_t)i;
+
+    // Two uneven batches, so that the second one starts mid-level
+    uint32_t first = (num_elts - 1) / 3;
+    mt_insert_batch(mtb, first, leaves);
+    if (!mt_insert_batch_pre(mtb, num_elts - 1 - first, leaves + first * hash_size)) {
+      printf("ERROR: Precondition for mt_insert_batch does not hold; exiting.\n");
+      exit(1);
+    }
+    mt_insert_batch(mtb, num_elts - 1 - first, leaves + first * hash_size);
+    free(leaves);
+
+    uint8_t *rh = mt_init_hash(hash_size);
+    uint8_t *rhb = mt_init_hash(hash_size);
+    mt_get_root(mt, rh);
+    mt_get_root(mtb, rhb);
+    print_hash("batch root", rhb);
+    if (memcmp(rh, rhb, hash_size) != 0) {
+      printf("ERROR: Batch insertion yields a different root; exiting.\n");
+      exit(1);
+    }
+    mt_free_hash(rh);
+    mt_free_hash(rhb);
+    mt_free(mtb);
+  }
+
+  {
+    printf("Testing trees with 64-bit indices...\n");
+    uint8_t *ih = mt_init_hash(hash_size);
+    mt64_p mt64 = mt64_create(ih);
+    mt_free_hash(ih);
+    for (size_t i = 1; i < num_elts; i++) {
+      uint8_t *hash = mt_init_hash(hash_size);
+      hash[hash_size-1] = (uint8_t)i;
+      mt64_insert(mt64, hash);
+      mt_free_hash(hash);
+    }
+
+    uint8_t *rh = mt_init_hash(hash_size);
+    uint8_t *rh64 = mt_init_hash(hash_size);
+    mt_get_root(mt, rh);
+    mt64_get_root(mt64, rh64);
+    if (memcmp(rh, rh64, hash_size) != 0) {
+      printf("ERROR: 64-bit tree yields a different root; exiting.\n");
+      exit(1);
+    }
+
+    uint64_t flush_to = num_elts / 3;
+    if (flush_to > 0)
+      mt64_flush_to(mt64, flush_to);
+    for (uint64_t k = flush_to; k < num_elts; k++) {
+      MerkleTree_Low_path *cur_path = mt_init_path(hash_size);
+      uint64_t j = mt64_get_path(mt64, k, cur_path, rh64);
+      if (!mt64_verify_pre(mt64, k, j, cur_path, rh64) ||
+          !mt64_verify(mt64, k, j, cur_path, rh64)) {
+        printf("ERROR: 64-bit tree path does not verify with k(%ld); exiting.\n", k);
+        exit(1);
+      }
+      mt_free_path(cur_path);
+    }
+
+    // A tree flushed just below 2^33, as deserialized from a stored frontier
+    uint64_t j = (1ULL << 33) + 5, i = j - 1;
+    size_t len = 25 + 1 + 4 + 65 * hash_size;
+    for (int lv = 0; lv < 64; lv++)
+      len += 8 + ((j >> lv) - ((i >> lv) & ~1ULL)) * hash_size;
+    uint8_t *buf = calloc(len, 1), *pos = buf;
+    *pos++ = 2;
+    for (int b = 3; b >= 0; b--) *pos++ = (uint8_t)(hash_size >> (8 * b));
+    for (int b = 7; b >= 0; b--) *pos++ = (uint8_t)(i >> (8 * b));
+    for (int b = 7; b >= 0; b--) *pos++ = (uint8_t)(j >> (8 * b));
+    *pos++ = 0; *pos++ = 0; *pos++ = 0; *pos++ = 64;
+    for (int lv = 0; lv < 64; lv++) {
+      uint64_t n = (j >> lv) - ((i >> lv) & ~1ULL);
+      for (int b = 7; b >= 0; b--) *pos++ = (uint8_t)(n >> (8 * b));
+      for (uint64_t h = 0; h < n; h++, pos += hash_size)
+        pos[0] = (uint8_t)lv, pos[1] = (uint8_t)h;
+    }
+    *pos++ = 0;
+    *pos++ = 0; *pos++ = 0; *pos++ = 0; *pos++ = 64;
+    mt64_p mtf = mt64_deserialize(buf, len, mt_sha256_compress);
+    if (mtf == NULL || mt64_deserialize(buf, len - 1, mt_sha256_compress) != NULL) {
+      printf("ERROR: 64-bit tree deserialization failed; exiting.\n");
+      exit(1);
+    }
+    free(buf);
+    for (size_t l = 1; l < num_elts; l++) {
+      uint8_t *hash = mt_init_hash(hash_size);
+      hash[hash_size-1] = (uint8_t)l;
+      mt64_insert(mtf, hash);
+      mt_free_hash(hash);
+    }
+    mt64_retract_to(mtf, i + num_elts / 2);
+    for (uint64_t k = i; k <= i + num_elts / 2; k++) {
+      MerkleTree_Low_path *cur_path = mt_init_path(hash_size);
+      uint64_t n = mt64_get_path(mtf, k, cur_path, rh64);
+      if (!mt64_verify_pre(mtf, k, n, cur_path, rh64) ||
+          !mt64_verify(mtf, k, n, cur_path, rh64)) {
+        printf("ERROR: 64-bit tree path does not verify with k(%ld); exiting.\n", k);
+        exit(1);
+      }
+      mt_free_path(cur_path);
+    }
+
+    // Serialization round trip
+    uint64_t num_bytes = mt64_serialize_size(mtf);
+    buf = malloc(num_bytes);
+    if (mt64_serialize(mtf, buf, num_bytes) != num_bytes) {
+      printf("ERROR: 64-bit tree serialization failed; exiting.\n");
+      exit(1);
+    }
+    mt64_p mtd = mt64_deserialize(buf, num_bytes, mt_sha256_compress);
+    mt64_get_root(mtf, rh);
+    mt64_get_root(mtd, rh64);
+    if (memcmp(rh, rh64, hash_size) != 0) {
+      printf("ERROR: Deserialized 64-bit tree yields a different root; exiting.\n");
+      exit(1);
+    }
+    printf("Paths verified on 64-bit tree holding [%ld,%ld]\n", i, i + num_elts / 2);
+    free(buf);
+    mt64_free(mtd);
+    mt64_free(mtf);
+    mt64_free(mt64);
+    mt_free_hash(rh);
+    mt_free_hash(rh64);
+  }
+
+#if !defined(_WIN32)
+  {
+    printf("Testing memory-mapped trees...\n");
+    char dir[] = "/tmp/merkle_tree_test.XXXXXX";
+    if (mkdtemp(dir) == NULL) {
+      printf("ERROR: Cannot create a temporary directory; exiting.\n");
+      exit(1);
+    }
+
+    uint8_t *ih = mt_init_hash(hash_size);
+    mt_p mtp = mt_create_mapped(dir, ih);
+    if (mtp == NULL || mt_create_mapped(dir, ih) != NULL) {
+      printf("ERROR: Persistent tree creation failed; exiting.\n");
+      exit(1);
+    }
+    mt_free_hash(ih);
+    for (size_t i = 1; i < num_elts; i++) {
+      uint8_t *hash = mt_init_hash(hash_size);
+      hash[hash_size-1] = (uint8_t)i;
+      mt_insert(mtp, hash);
+      mt_free_hash(hash);
+    }
+    mt_free(mtp);
+
+    uint8_t *rh = mt_init_hash(hash_size);
+    uint8_t *rhp = mt_init_hash(hash_size);
+    mt_get_root(mt, rh);
+    uint64_t flush_to = 0;
+    for (int round = 0; round < 2; round++) {
+      mtp = mt_open_mapped(dir, mt_sha256_compress);
+      if (mtp == NULL) {
+        printf("ERROR: Persistent tree cannot be reopened; exiting.\n");
+        exit(1);
+      }
+      for (uint64_t k = flush_to; k < num_elts; k++) {
+        MerkleTree_Low_path *cur_path = mt_init_path(hash_size);
+        uint32_t j = mt_get_path(mtp, k, cur_path, rhp);
+        if (memcmp(rh, rhp, hash_size) != 0 || !mt_verify(mtp, k, j, cur_path, rhp)) {
+          printf("ERROR: Reopened tree does not verify with k(%ld); exiting.\n", k);
+          exit(1);
+        }
+        mt_free_path(cur_path);
+      }
+      flush_to = num_elts / 3;
+      mt_flush_to(mtp, flush_to);
+      if (!mt_sync(mtp)) {
+        printf("ERROR: Persistent tree cannot be synced; exiting.\n");
+        exit(1);
+      }
+      if (!mt_free(mtp)) {
+        printf("ERROR: Persistent tree cannot be synced when freed; exiting.\n");
+        exit(1);
+      }
+    }
+    mt_free_hash(rh);
+    mt_free_hash(rhp);
+    printf("Reopened tree verified after flushing to %ld\n", flush_to);
+
+    char path[64];
+    snprintf(path, sizeof path, "%s/meta", dir);
+    if (truncate(path, 16) != 0 || mt_open_mapped(dir, mt_sha256_compress) != NULL) {
+      printf("ERROR: Tree with truncated metadata was opened; exiting.\n");
+      exit(1);
+    }
+    for (int lv = 0; lv < 32; lv++) {
+      snprintf(path, sizeof path, "%s/level%02d", dir, lv);
+      unlink(path);
+    }
+    snprintf(path, sizeof path, "%s/meta", dir);
+    unlink(path);
+    rmdir(dir);
+  }
+#endif
+
+  {
+    printf("Testing paths across insertions...\n");
+    uint8_t *ih = mt_init_hash(hash_size);
+    mt_p mtg = mt_create(ih);
+    mt_free_hash(ih);
+    const uint32_t n_early = 5;
+    MerkleTree_Low_path *early[5];
+    uint32_t early_j[5];
+    uint8_t *early_rh[5];
+    for (uint32_t i = 1; i < n_early; i++) {
+      uint8_t *hash = mt_init_hash(hash_size);
+      hash[hash_size-1] = (uint8_t)i;
+      mt_insert(mtg, hash);
+      mt_free_hash(hash);
+    }
+    for (uint32_t k = 0; k < n_early; k++) {
+      early[k] = mt_init_path(hash_size);
+      early_rh[k] = mt_init_hash(hash_size);
+      early_j[k] = mt_get_path(mtg, k, early[k], early_rh[k]);
+    }
+    // Enough insertions to move every level to a larger slab, and a root
+    // computation that rewrites the rightmost hashes; the paths extracted
+    // above must depend on neither.
+    for (uint32_t i = n_early; i < 4096; i++) {
+      uint8_t *hash = mt_init_hash(hash_size);
+      hash[hash_size-1] = (uint8_t)i;
+      hash[hash_size-2] = (uint8_t)(i >> 8);
+      mt_insert(mtg, hash);
+      mt_free_hash(hash);
+    }
+    uint8_t *rhg = mt_init_hash(hash_size);
+    mt_get_root(mtg, rhg);
+    for (uint32_t k = 0; k < n_early; k++) {
+      if (!mt_verify(mtg, k, early_j[k], early[k], early_rh[k])) {
+        printf("ERROR: Path extracted before insertions does not verify with k(%d); exiting.\n", k);
+        exit(1);
+      }
+      mt_free_path(early[k]);
+      mt_free_hash(early_rh[k]);
+    }
+    mt_free_hash(rhg);
+    mt_free(mtg);
+    printf("Paths extracted before insertions verified\n");
+  }
+
+  {
+    printf("Testing snapshots...\n");
+    uint8_t *ih = mt_init_hash(hash_size);
+    mt_p mts = mt_create(ih);
+    mt_free_hash(ih);
+    uint64_t half = num_elts / 2;
+    for (size_t i = 1; i < half; i++) {
+      uint8_t *hash = mt_init_hash(hash_size);
+      hash[hash_size-1] = (uint8_t)i;
+      mt_insert(mts, hash);
+      mt_free_hash(hash);
+    }
+    MerkleTree_Low_Snapshot_publisher *pub = mt_publish(mts);
+    const MerkleTree_Low_Snapshot_snapshot *s1 = mt_snapshot_acquire(pub);
+    uint8_t *rh1 = mt_init_hash(hash_size);
+    mt_snapshot_get_root(s1, rh1);
+
+    // Grow, flush and retract the tree under the snapshot, then grow it back
+    uint64_t flush_to = half / 2;
+    for (size_t i = half > 0 ? half : 1; i < num_elts; i++) {
+      uint8_t *hash = mt_init_hash(hash_size);
+      hash[hash_size-1] = (uint8_t)i;
+      mt_insert(mts, hash);
+      mt_free_hash(hash);
+    }
+    mt_flush_to(mts, flush_to);
+    mt_retract_to(mts, flush_to);
+    for (size_t i = flush_to + 1; i < num_elts; i++) {
+      uint8_t *hash = mt_init_hash(hash_size);
+      hash[hash_size-1] = (uint8_t)i;
+      mt_insert(mts, hash);
+      mt_free_hash(hash);
+    }
+    if (mt_publish(mts) != pub) {
+      printf("ERROR: Publisher changed across publications; exiting.\n");
+      exit(1);
+    }
+    const MerkleTree_Low_Snapshot_snapshot *s2 = mt_snapshot_acquire(pub);
+
+    uint8_t *rhp = mt_init_hash(hash_size);
+    uint8_t *leaf = mt_init_hash(hash_size);
+    for (uint64_t k = 0; k < mt_snapshot_size(s1); k++) {
+      MerkleTree_Low_path *cur_path = mt_init_path(hash_size);
+      if (!mt_get_path_at_pre(s1, k, cur_path, rhp)) {
+        printf("ERROR: Precondition for mt_get_path_at does not hold; exiting.\n");
+        exit(1);
+      }
+      mt_get_path_at(s1, k, cur_path, rhp);
+      leaf[hash_size-1] = (uint8_t)k;
+      if (memcmp(rh1, rhp, hash_size) != 0
+          || memcmp(leaf, mt_get_path_step(cur_path, 0), hash_size) != 0
+          || !mt_verify(mts, k, mt_snapshot_size(s1), cur_path, rhp)) {
+        printf("ERROR: Snapshot path does not verify with k(%ld); exiting.\n", k);
+        exit(1);
+      }
+      mt_free_path(cur_path);
+    }
+    mt_snapshot_release(s1);
+    mt_publish(mts);
+
+    uint8_t *rh = mt_init_hash(hash_size);
+    mt_get_root(mt, rh);
+    for (uint64_t k = flush_to; k < num_elts; k++) {
+      MerkleTree_Low_path *cur_path = mt_init_path(hash_size);
+      mt_get_path_at(s2, k, cur_path, rhp);
+      if (memcmp(rh, rhp, hash_size) != 0
+          || !mt_verify(mts, k, mt_snapshot_size(s2), cur_path, rhp)) {
+        printf("ERROR: Snapshot path does not verify with k(%ld); exiting.\n", k);
+        exit(1);
+      }
+      mt_free_path(cur_path);
+    }
+    mt_snapshot_release(s2);
+    printf("Snapshot paths verified across insertion, flushing and retraction\n");
+    mt_free_hash(leaf);
+    mt_free_hash(rhp);
+    mt_free_hash(rh);
+    mt_free_hash(rh1);
+    mt_free(mts);
+  }
+
+#if !defined(_WIN32)
+  {
+    printf("Testing concurrent publication and acquisition...\n");
+    uint8_t *ih = mt_init_hash(hash_size);
+    mt_p mtc = mt_create(ih);
+    mt_free_hash(ih);
+    MerkleTree_Low_Snapshot_publisher *pub = mt_publish(mtc);
+    bool stop = false;
+    snapshot_reader readers[4];
+    pthread_t threads[4];
+    for (size_t t = 0; t < 4; t++) {
+      readers[t] = (snapshot_reader){ .pub = pub, .stop = &stop, .paths = 0, .ok = true };
+      pthread_create(&threads[t], NULL, snapshot_reader_run, &readers[t]);
+    }
+    uint32_t max_pending = 0;
+    for (size_t i = 1; i < 4096; i++) {
+      uint8_t *hash = mt_init_hash(hash_size);
+      hash[hash_size-1] = (uint8_t)i;
+      mt_insert(mtc, hash);
+      mt_free_hash(hash);
+      mt_publish(mtc);
+      uint32_t pending = mt_snapshot_pending(pub);
+      if (pending > max_pending)
+        max_pending = pending;
+    }
+    __atomic_store_n(&stop, true, __ATOMIC_SEQ_CST);
+    bool ok = true;
+    uint64_t paths = 0;
+    for (size_t t = 0; t < 4; t++) {
+      pthread_join(threads[t], NULL);
+      ok = ok && readers[t].ok;
+      paths += readers[t].paths;
+    }
+    // Once readers are gone, every retired snapshot is freed within a couple
+    // of publications, leaving only the current one.
+    mt_publish(mtc);
+    mt_publish(mtc);
+    uint32_t pending = mt_snapshot_pending(pub);
+    printf("%ld concurrent paths verified, at most %d snapshots pending, %d after readers\n",
+      paths, max_pending, pending);
+    if (!ok || pending != 1) {
+      printf("ERROR: Concurrent snapshots failed or were not reclaimed; exiting.\n");
+      exit(1);
+    }
+    mt_free(mtc);
+  }
+#endif
+
+  {
+    printf("Testing consistency and multi-leaf proofs...\n");
+    uint64_t old_max = (num_elts + 1) / 2;
+    uint8_t *ih = mt_init_hash(hash_size);
+    mt_p mto = mt_create(ih);
+    mt_free_hash(ih);
+    for (size_t i = 1; i < old_max; i++) {
+      uint8_t *hash = mt_init_hash(hash_size);
+      hash[hash_size-1] = (uint8_t)i;
+      mt_insert(mto, hash);
+      mt_free_hash(hash);
+    }
+    uint8_t *old_rh = mt_init_hash(hash_size);
+    uint8_t *rh = mt_init_hash(hash_size);
+    mt_get_root(mto, old_rh);
+    mt_free(mto);
+
+    proof_p cp = mt_init_proof(hash_size);
+    if (!mt_get_consistency_pre(mt, old_max, cp, rh)) {
+      printf("ERROR: Precondition for mt_get_consistency does not hold; exiting.\n");
+      exit(1);
+    }
+    uint32_t j = mt_get_consistency(mt, old_max, cp, rh);
+    uint8_t *buf = malloc(8 + (mt_get_proof_length(cp) + num_elts) * hash_size);
+    uint64_t len = mt_serialize_proof(cp, buf, 8 + mt_get_proof_length(cp) * hash_size);
+    proof_p cpd = mt_deserialize_proof(buf, len);
+    if (cpd == NULL
+        || !mt_verify_consistency_pre(mt, old_max, old_rh, j, rh, cpd)
+        || !mt_verify_consistency(mt, old_max, old_rh, j, rh, cpd)) {
+      printf("ERROR: Consistency proof from %ld to %d does not verify; exiting.\n", old_max, j);
+      exit(1);
+    }
+    old_rh[0] ^= 1;
+    if (mt_verify_consistency(mt, old_max, old_rh, j, rh, cpd)) {
+      printf("ERROR: Consistency proof verifies with a wrong root; exiting.\n");
+      exit(1);
+    }
+    printf("Consistency proof from %ld to %d verified with %d hashes\n",
+           old_max, j, mt_get_proof_length(cp));
+
+    // Every third leaf, and the last one
+    uint64_t *idxs = calloc(num_elts, sizeof (uint64_t));
+    uint32_t n = 0;
+    for (uint64_t k = 0; k < num_elts; k++)
+      if (k % 3 == 0 || k == num_elts - 1)
+        idxs[n++] = k;
+    proof_p mp = mt_init_proof(hash_size);
+    if (!mt_get_multi_proof_pre(mt, n, idxs, mp, rh)) {
+      printf("ERROR: Precondition for mt_get_multi_proof does not hold; exiting.\n");
+      exit(1);
+    }
+    j = mt_get_multi_proof(mt, n, idxs, mp, rh);
+    len = mt_serialize_proof(mp, buf, 8 + (mt_get_proof_length(cp) + num_elts) * hash_size);
+    proof_p mpd = mt_deserialize_proof(buf, len);
+    if (mpd == NULL
+        || !mt_verify_multi_proof_pre(mt, n, idxs, j, mpd, rh)
+        || !mt_verify_multi_proof(mt, n, idxs, j, mpd, rh)) {
+      printf("ERROR: Multi-leaf proof does not verify; exiting.\n");
+      exit(1);
+    }
+    for (uint32_t k = 0; k < n; k++) {
+      uint8_t *leaf = mt_get_proof_step(mpd, k);
+      if (leaf[hash_size-1] != (uint8_t)idxs[k]) {
+        printf("ERROR: Multi-leaf proof holds a wrong leaf; exiting.\n");
+        exit(1);
+      }
+    }
+    mt_get_proof_step(mpd, mt_get_proof_length(mpd) - 1)[0] ^= 1;
+    if (mt_verify_multi_proof(mt, n, idxs, j, mpd, rh)) {
+      printf("ERROR: Tampered multi-leaf proof verifies; exiting.\n");
+      exit(1);
+    }
+    printf("Multi-leaf proof for %d leaves verified with %d hashes\n",
+           n, mt_get_proof_length(mp));
+
+    free(idxs);
+    free(buf);
+    mt_free_proof(cp);
+    mt_free_proof(cpd);
+    mt_free_proof(mp);
+    mt_free_proof(mpd);
+    mt_free_hash(old_rh);
+    mt_free_hash(rh);
+  }
+
   print_tree(mt, num_elts);
 
   // Getting the Merkle path and verify it
@@ -86,6 +86,44 @@ static uint8_t scalar0[32] = {
 };
 
 
+/* Public key of prKey and a signature for which [u1]G = [u2]Q: verification
+   has to double rather than add when combining the two halves. */
+static uint8_t exc_pkx[32] = {
+  0x1c, 0xcb, 0xe9, 0x1c, 0x07, 0x5f, 0xc7, 0xf4,
+  0xf0, 0x33, 0xbf, 0xa2, 0x48, 0xdb, 0x8f, 0xcc,
+  0xd3, 0x56, 0x5d, 0xe9, 0x4b, 0xbf, 0xb1, 0x2f,
+  0x3c, 0x59, 0xff, 0x46, 0xc2, 0x71, 0xbf, 0x83
+};
+
+static uint8_t exc_pky[32] = {
+  0xce, 0x40, 0x14, 0xc6, 0x88, 0x11, 0xf9, 0xa2,
+  0x1a, 0x1f, 0xdb, 0x2c, 0x0e, 0x61, 0x13, 0xe0,
+  0x6d, 0xb7, 0xca, 0x93, 0xb7, 0x40, 0x4e, 0x78,
+  0xdc, 0x7c, 0xcd, 0x5c, 0xa8, 0x9a, 0x4c, 0xa9
+};
+
+static uint8_t exc_msg[32] = {
+  0xd5, 0x77, 0x7c, 0x45, 0x01, 0x96, 0x73, 0x12,
+  0x5a, 0xd2, 0x40, 0xf8, 0x30, 0x94, 0xd4, 0x25,
+  0x2d, 0x82, 0x95, 0x16, 0xfa, 0xc8, 0x60, 0x1e,
+  0xd0, 0x19, 0x79, 0xec, 0x1e, 0xc1, 0xa2, 0x51
+};
+
+static uint8_t exc_r[32] = {
+  0xf3, 0xac, 0x80, 0x61, 0xb5, 0x14, 0x79, 0x5b,
+  0x88, 0x43, 0xe3, 0xd6, 0x62, 0x95, 0x27, 0xed,
+  0x2a, 0xfd, 0x6b, 0x1f, 0x6a, 0x55, 0x5a, 0x7a,
+  0xca, 0xbb, 0x5e, 0x6f, 0x79, 0xc8, 0xc2, 0xac
+};
+
+static uint8_t exc_s[32] = {
+  0xfe, 0x9b, 0x97, 0xb8, 0xe6, 0x54, 0x78, 0x86,
+  0x7e, 0x02, 0x60, 0x0a, 0x0a, 0x2f, 0x5b, 0x2a,
+  0x70, 0x70, 0x00, 0xb6, 0x6a, 0xcf, 0x1d, 0x8d,
+  0x7c, 0xbd, 0x5c, 0xa3, 0x5b, 0x00, 0x55, 0x3c
+};
+
+
 bool print_result(int in_len, uint8_t* comp, uint8_t* exp) {
   return compare_and_print(in_len, comp, exp);
 }
@@ -103,6 +141,20 @@ bool testImplementationHacl()
 	return s0 && s1 && (flag == 0);
 }
 
+bool testVerifyHacl()
+{
+	uint8_t sig[64];
+	uint8_t pk[64];
+	memcpy(pk, exc_pkx, 32);
+	memcpy(pk + 32, exc_pky, 32);
+	Hacl_P256_ecdsa_sign_p256_without_hash(sig, 32, digest, prKey, nonce);
+	bool ok = Hacl_P256_ecdsa_verif_without_hash(32, digest, pk, sig, sig + 32);
+	sig[40] ^= 1;
+	ok = ok && !Hacl_P256_ecdsa_verif_without_hash(32, digest, pk, sig, sig + 32);
+	ok = ok && Hacl_P256_ecdsa_verif_without_hash(32, exc_msg, pk, exc_r, exc_s);
+	return ok;
+}
+
 void handleErrors()
 {
 	printf("%s\n", "OpenSSl exception");
@@ -116,6 +168,12 @@ int main()
 		return -1;
 	}
 
+	if (!testVerifyHacl())
+	{
+		printf("%s\n", "Test Verification failed for Hacl* ECDSA");
+		return -1;
+	}
+
 
   	cycles a,b;
 	clock_t t1,t2;
@@ -141,6 +199,25 @@ int main()
 	cycles cdiff1 = b - a;
 
 
+	uint8_t sig[64];
+	uint8_t pkv[64];
+	memcpy(pkv, exc_pkx, 32);
+	memcpy(pkv + 32, exc_pky, 32);
+	Hacl_P256_ecdsa_sign_p256_without_hash(sig, 32, digest, prKey, nonce);
+	bool vres = true;
+
+	t1 = clock();
+	a = cpucycles_begin();
+
+	for (int j = 0; j < ROUNDS; j++)
+		vres &= Hacl_P256_ecdsa_verif_without_hash(32, digest, pkv, sig, sig + 32);
+
+	b = cpucycles_end();
+	t2 = clock();
+	clock_t tdiff2 = t2 - t1;
+	cycles cdiff2 = b - a;
+
+
 	uint8_t* pk = (uint8_t*) malloc (sizeof (uint8_t) * 64);
 	memcpy(pk, px0_0,  32);
 	memcpy(pk+32, py0_0,  32);
@@ -172,6 +249,9 @@ int main()
 	printf("Hacl ECDSA (without hashing) PERF: %d\n"); 
 	print_time(count,tdiff1,cdiff1);
 
+	printf("Hacl ECDSA verification (without hashing) PERF: %d\n"); 
+	print_time(count,tdiff2,cdiff2);
+
 	printf("Hacl ECDH PERF: %d\n"); 
 	print_time(count,tdiff3,cdiff3);  
 }
@@ -9,6 +9,10 @@
 #include <time.h>
 #include <stdbool.h>
 #include "Hacl_Hash.h"
+#include "Hacl_Streaming_SHA2.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Hash.h"
+#include "Hacl_SHA2_Vec256.h"
 #include <openssl/sha.h>
 
 #include "sha2_vectors.h"
@@ -62,12 +66,118 @@ bool print_test(uint8_t* in, int in_len, uint8_t* exp224, uint8_t* exp256, uint8
   return ok;
 }
 
+#define NVECTORS (sizeof(vectors)/sizeof(sha2_test_vector))
+#define NMULTI   (3 * NVECTORS)
+#define NLANES   8
+#define MAXLEN   1000
+
+bool print_test_multi(){
+  uint8_t *inputs[NMULTI];
+  uint32_t lens[NMULTI];
+  uint8_t digests[NMULTI][64];
+  uint8_t *dst[NMULTI];
+  bool ok = true;
+
+  for (int i = 0; i < NMULTI; ++i) {
+    inputs[i] = vectors[i % NVECTORS].input;
+    lens[i] = vectors[i % NVECTORS].input_len;
+    dst[i] = digests[i];
+  }
+
+  EverCrypt_Hash_hash_256_multi(NMULTI, inputs, lens, dst);
+  for (int i = 0; i < NMULTI; ++i)
+    ok = ok && memcmp(digests[i], vectors[i % NVECTORS].tag_256, 32) == 0;
+  EverCrypt_Hash_hash_512_multi(NMULTI, inputs, lens, dst);
+  for (int i = 0; i < NMULTI; ++i)
+    ok = ok && memcmp(digests[i], vectors[i % NVECTORS].tag_512, 64) == 0;
+
+  if (!EverCrypt_AutoConfig2_has_avx2()) {
+    printf("SHA2 multi-message Result: %s\n", ok ? "Success!" : "**FAILED**");
+    return ok;
+  }
+
+  // The EverCrypt entry points above prefer SHA-NI over the 8-way kernel for
+  // SHA-256, so call the Vec256 kernels directly as well.
+  memset(digests, 0, sizeof(digests));
+  Hacl_SHA2_Vec256_sha256_multi(NMULTI, inputs, lens, dst);
+  for (int i = 0; i < NMULTI; ++i)
+    ok = ok && memcmp(digests[i], vectors[i % NVECTORS].tag_256, 32) == 0;
+  memset(digests, 0, sizeof(digests));
+  Hacl_SHA2_Vec256_sha512_multi(NMULTI, inputs, lens, dst);
+  for (int i = 0; i < NMULTI; ++i)
+    ok = ok && memcmp(digests[i], vectors[i % NVECTORS].tag_512, 64) == 0;
+
+  printf("SHA2 multi-message Result: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Multi-message streaming: every lane hashes different data of the same
+// length, fed in two pieces split at various offsets.
+bool print_test_streaming_multi(){
+  uint8_t digests[NLANES][64];
+  uint8_t *dst[NLANES];
+  bool ok = true;
+
+  for (int j = 0; j < NLANES; ++j)
+    dst[j] = digests[j];
+
+  static uint8_t msgs[NLANES][MAXLEN];
+  for (int j = 0; j < NLANES; ++j)
+    for (int k = 0; k < MAXLEN; ++k)
+      msgs[j][k] = (uint8_t)(j * 31 + k * 7 + (k >> 8));
+  uint32_t stream_lens[] = { 0, 1, 55, 56, 64, 111, 112, 128, 200, MAXLEN };
+  for (int i = 0; i < sizeof(stream_lens)/sizeof(uint32_t); ++i) {
+    uint32_t len = stream_lens[i];
+    uint32_t splits[] = { 0, len / 3, len / 2, len };
+    for (int s = 0; s < 4; ++s) {
+      uint8_t expected[NLANES][64];
+      uint8_t *lo[NLANES], *hi[NLANES];
+      for (int j = 0; j < NLANES; ++j) {
+        lo[j] = msgs[j];
+        hi[j] = msgs[j] + splits[s];
+      }
+
+      memset(digests, 0, sizeof(digests));
+      Hacl_Streaming_SHA2_state_256_x8 *s256 = Hacl_Streaming_SHA2_create_in_256_x8();
+      Hacl_Streaming_SHA2_update_256_x8(s256, lo, splits[s]);
+      Hacl_Streaming_SHA2_update_256_x8(s256, hi, len - splits[s]);
+      Hacl_Streaming_SHA2_finish_256_x8(s256, dst);
+      Hacl_Streaming_SHA2_free_256_x8(s256);
+      for (int j = 0; j < 8; ++j) {
+        Hacl_Hash_SHA2_hash_256(msgs[j], len, expected[j]);
+        ok = ok && memcmp(digests[j], expected[j], 32) == 0;
+      }
+
+      memset(digests, 0, sizeof(digests));
+      Hacl_Streaming_SHA2_state_512_x4 *s512 = Hacl_Streaming_SHA2_create_in_512_x4();
+      Hacl_Streaming_SHA2_update_512_x4(s512, lo, splits[s]);
+      Hacl_Streaming_SHA2_update_512_x4(s512, hi, len - splits[s]);
+      Hacl_Streaming_SHA2_finish_512_x4(s512, dst);
+      Hacl_Streaming_SHA2_free_512_x4(s512);
+      for (int j = 0; j < 4; ++j) {
+        Hacl_Hash_SHA2_hash_512(msgs[j], len, expected[j]);
+        ok = ok && memcmp(digests[j], expected[j], 64) == 0;
+      }
+    }
+  }
+
+  printf("SHA2 multi-message streaming (%s) Result: %s\n",
+    EverCrypt_AutoConfig2_has_avx2() ? "AVX2" : "lane by lane", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
 int main(){
+  EverCrypt_AutoConfig2_init();
 
   bool ok = true;
-  for (int i = 0; i < sizeof(vectors)/sizeof(sha2_test_vector); ++i) {
+  for (int i = 0; i < NVECTORS; ++i) {
     ok &= print_test(vectors[i].input,vectors[i].input_len,vectors[i].tag_224,vectors[i].tag_256,vectors[i].tag_384,vectors[i].tag_512);
   }
+  ok &= print_test_multi();
+  ok &= print_test_streaming_multi();
+  // Again on the lane-by-lane fallback used without AVX2
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok &= print_test_streaming_multi();
 
   uint64_t len = SIZE;
   uint8_t plain[SIZE];
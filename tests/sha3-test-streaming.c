@@ -0,0 +1,114 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "Hacl_Streaming_SHA3.h"
+#include "EverCrypt_Hash.h"
+
+#include "test_helpers.h"
+
+static uint8_t abc[3] = { 0x61, 0x62, 0x63 };
+
+static uint8_t sha3_256_empty[32] = {
+  0xa7, 0xff, 0xc6, 0xf8, 0xbf, 0x1e, 0xd7, 0x66, 0x51, 0xc1, 0x47, 0x56, 0xa0, 0x61, 0xd6, 0x62,
+  0xf5, 0x80, 0xff, 0x4d, 0xe4, 0x3b, 0x49, 0xfa, 0x82, 0xd8, 0x0a, 0x4b, 0x80, 0xf8, 0x43, 0x4a
+};
+
+static uint8_t sha3_256_abc[32] = {
+  0x3a, 0x98, 0x5d, 0xa7, 0x4f, 0xe2, 0x25, 0xb2, 0x04, 0x5c, 0x17, 0x2d, 0x6b, 0xd3, 0x90, 0xbd,
+  0x85, 0x5f, 0x08, 0x6e, 0x3e, 0x9d, 0x52, 0x5b, 0x46, 0xbf, 0xe2, 0x45, 0x11, 0x43, 0x15, 0x32
+};
+
+static uint8_t shake128_empty[32] = {
+  0x7f, 0x9c, 0x2b, 0xa4, 0xe8, 0x8f, 0x82, 0x7d, 0x61, 0x60, 0x45, 0x50, 0x76, 0x05, 0x85, 0x3e,
+  0xd7, 0x3b, 0x80, 0x93, 0xf6, 0xef, 0xbc, 0x88, 0xeb, 0x1a, 0x6e, 0xac, 0xfa, 0x66, 0xef, 0x26
+};
+
+#define MSG_LEN 1000
+#define XOF_LEN 700
+
+int main() {
+  bool ok = true;
+  uint8_t tag[64] = {};
+  uint8_t msg[MSG_LEN];
+  for (int i = 0; i < MSG_LEN; i++)
+    msg[i] = (uint8_t)i;
+
+  // Known answers, fed in pieces
+  Hacl_Streaming_SHA3_state *s = Hacl_Streaming_SHA3_create_in(Spec_Hash_Definitions_SHA3_256);
+  Hacl_Streaming_SHA3_update(s, NULL, 0);
+  Hacl_Streaming_SHA3_finish(s, tag);
+  ok &= compare_and_print(32, tag, sha3_256_empty);
+
+  Hacl_Streaming_SHA3_update(s, abc, 1);
+  Hacl_Streaming_SHA3_update(s, abc + 1, 2);
+  Hacl_Streaming_SHA3_finish(s, tag);
+  ok &= compare_and_print(32, tag, sha3_256_abc);
+  Hacl_Streaming_SHA3_free(s);
+
+  s = Hacl_Streaming_SHA3_create_in(Spec_Hash_Definitions_Shake128);
+  Hacl_Streaming_SHA3_squeeze(s, tag, 5);
+  Hacl_Streaming_SHA3_squeeze(s, tag + 5, 27);
+  ok &= compare_and_print(32, tag, shake128_empty);
+
+  // Chunked updates around the rate boundaries agree with the one-shot functions
+  uint8_t expected[XOF_LEN];
+  uint8_t computed[XOF_LEN];
+  uint32_t chunks[5] = { 1, 135, 136, 168, 300 };
+  for (int c = 0; c < 5; c++) {
+    Spec_Hash_Definitions_hash_alg algs[2] =
+      { Spec_Hash_Definitions_SHA3_256, Spec_Hash_Definitions_SHA3_512 };
+    for (int a = 0; a < 2; a++) {
+      Hacl_Streaming_SHA3_state *t = Hacl_Streaming_SHA3_create_in(algs[a]);
+      for (uint32_t i = 0; i < MSG_LEN; i += chunks[c]) {
+        uint32_t n = MSG_LEN - i < chunks[c] ? MSG_LEN - i : chunks[c];
+        Hacl_Streaming_SHA3_update(t, msg + i, n);
+      }
+      Hacl_Streaming_SHA3_finish(t, computed);
+      if (a == 0) {
+        Hacl_SHA3_sha3_256(MSG_LEN, msg, expected);
+        ok &= compare_and_print(32, computed, expected);
+      } else {
+        Hacl_SHA3_sha3_512(MSG_LEN, msg, expected);
+        ok &= compare_and_print(64, computed, expected);
+      }
+      Hacl_Streaming_SHA3_free(t);
+    }
+
+    // Squeezing in pieces continues the same output stream
+    Hacl_Streaming_SHA3_init(s);
+    for (uint32_t i = 0; i < MSG_LEN; i += chunks[c]) {
+      uint32_t n = MSG_LEN - i < chunks[c] ? MSG_LEN - i : chunks[c];
+      Hacl_Streaming_SHA3_update(s, msg + i, n);
+    }
+    for (uint32_t i = 0; i < XOF_LEN; i += chunks[c]) {
+      uint32_t n = XOF_LEN - i < chunks[c] ? XOF_LEN - i : chunks[c];
+      Hacl_Streaming_SHA3_squeeze(s, computed + i, n);
+    }
+    Hacl_SHA3_shake128_hacl(MSG_LEN, msg, XOF_LEN, expected);
+    ok &= compare_and_print(XOF_LEN, computed, expected);
+  }
+  Hacl_Streaming_SHA3_free(s);
+
+  // EverCrypt_Hash agrees on the new algorithms
+  EverCrypt_Hash_hash(Spec_Hash_Definitions_SHA3_256, tag, msg, MSG_LEN);
+  Hacl_SHA3_sha3_256(MSG_LEN, msg, expected);
+  ok &= compare_and_print(32, tag, expected);
+
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *h =
+    EverCrypt_Hash_Incremental_create_in(Spec_Hash_Definitions_Shake256);
+  EverCrypt_Hash_Incremental_init(h);
+  EverCrypt_Hash_Incremental_update(h, msg, 500);
+  EverCrypt_Hash_Incremental_update(h, msg + 500, MSG_LEN - 500);
+  EverCrypt_Hash_Incremental_finish(h, tag);
+  Hacl_SHA3_shake256_hacl(MSG_LEN, msg, 64, expected);
+  ok &= compare_and_print(64, tag, expected);
+  EverCrypt_Hash_Incremental_free(h);
+
+  if (ok)
+    return EXIT_SUCCESS;
+  else
+    return EXIT_FAILURE;
+}